@@ -42,8 +42,16 @@ class CentralSystemConfig : public ocpp::config::ICentralSystemConfig
 
     /** @brief Path to the database to store persistent data */
     std::string databasePath() const override { return getString("DatabasePath"); }
+    /** @brief Enable the write-ahead log journal mode of the database */
+    bool databaseWalMode() const override { return getBool("DatabaseWalMode"); }
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    std::string databaseSynchronousMode() const override { return getString("DatabaseSynchronousMode"); }
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath() */
+    std::string logDatabasePath() const override { return getString("LogDatabasePath"); }
     /** @brief Path to the JSON schemas to validate the messages */
     std::string jsonSchemasPath() const override { return getString("JsonSchemasPath"); }
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    unsigned int workerThreadCount() const override { return get<unsigned int>("WorkerThreadCount"); }
 
     // Communication parameters
 
@@ -51,6 +59,14 @@ class CentralSystemConfig : public ocpp::config::ICentralSystemConfig
     std::string listenUrl() const override { return getString("ListenUrl"); }
     /** @brief Call request timeout */
     std::chrono::milliseconds callRequestTimeout() const override { return get<std::chrono::milliseconds>("CallRequestTimeout"); }
+    /** @brief Allow several call requests to be in flight at the same time on a charge point connection */
+    bool callRequestsPipelining() const override { return getBool("CallRequestsPipelining"); }
+    /** @brief Number of threads shared by all the charge point connections to process the incoming call requests (0 = one thread per connection) */
+    unsigned int incomingCallsThreadCount() const override { return get<unsigned int>("IncomingCallsThreadCount"); }
+    /** @brief Number of threads servicing the websocket connections (TLS handshakes, encryption and frames processing) */
+    unsigned int webSocketServiceThreadCount() const override { return get<unsigned int>("WebSocketServiceThreadCount"); }
+    /** @brief Maximum size in bytes of a received websocket message */
+    unsigned int webSocketMaxMessageSize() const override { return get<unsigned int>("WebSocketMaxMessageSize"); }
     /** @brief Websocket PING interval */
     std::chrono::seconds webSocketPingInterval() const override { return get<std::chrono::seconds>("WebSocketPingInterval"); }
     /** @brief Boot notification retry interval */
@@ -83,6 +99,7 @@ class CentralSystemConfig : public ocpp::config::ICentralSystemConfig
 
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     unsigned int logMaxEntriesCount() const override { return get<unsigned int>("LogMaxEntriesCount"); }
+    unsigned int logAsyncQueueSize() const override { return get<unsigned int>("LogAsyncQueueSize"); }
 
   private:
     /** @brief Configuration file */
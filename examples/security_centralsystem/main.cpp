@@ -159,8 +159,8 @@ int main(int argc, char* argv[])
 
     // Use the same timer and worker pool for all the instances
     std::shared_ptr<ocpp::helpers::ITimerPool>       timer_pool(new ocpp::helpers::TimerPool());
-    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool =
-        std::make_shared<ocpp::helpers::WorkerThreadPool>(2u); // 1 asynchronous timer operations + 1 for asynchronous jobs/responses
+    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool = std::make_shared<ocpp::helpers::WorkerThreadPool>(
+        ocpp::helpers::WorkerThreadPool::computeThreadCount(config_p0.stackConfig().workerThreadCount()));
 
     // Instanciate 1 central system per security profile has required by the specification
     std::unique_ptr<ICentralSystem> central_system_p0 =
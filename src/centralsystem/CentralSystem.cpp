@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "DateTime.h"
 #include "ICentralSystemEventsHandler.h"
 #include "InternalConfigKeys.h"
+#include "LogDatabase.h"
 #include "Logger.h"
 #include "TimerPool.h"
 #include "Version.h"
@@ -38,13 +39,16 @@ namespace ocpp
 namespace centralsystem
 {
 
+/** @brief Maximum number of connections waiting for their incoming call requests to be processed */
+static constexpr size_t MAX_PENDING_RX_JOBS = 4096u;
+
 /** @brief Instanciate a central system */
 std::unique_ptr<ICentralSystem> ICentralSystem::create(const ocpp::config::ICentralSystemConfig& stack_config,
                                                        ICentralSystemEventsHandler&              events_handler)
 {
     std::shared_ptr<ocpp::helpers::ITimerPool>       timer_pool(new ocpp::helpers::TimerPool());
-    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool =
-        std::make_shared<ocpp::helpers::WorkerThreadPool>(2u); // 1 asynchronous timer operations + 1 for asynchronous jobs/responses
+    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool = std::make_shared<ocpp::helpers::WorkerThreadPool>(
+        ocpp::helpers::WorkerThreadPool::computeThreadCount(stack_config.workerThreadCount()));
     return std::unique_ptr<ICentralSystem>(new CentralSystem(stack_config, events_handler, timer_pool, worker_pool));
 }
 
@@ -66,7 +70,9 @@ CentralSystem::CentralSystem(const ocpp::config::ICentralSystemConfig&        st
       m_events_handler(events_handler),
       m_timer_pool(timer_pool),
       m_worker_pool(worker_pool),
+      m_rx_executor(),
       m_database(),
+      m_log_database(),
       m_internal_config(m_database),
       m_messages_converter(),
       m_ws_server(),
@@ -75,15 +81,18 @@ CentralSystem::CentralSystem(const ocpp::config::ICentralSystemConfig&        st
       m_uptime(0),
       m_total_uptime(0)
 {
-    // Open database
-    if (m_database.open(m_stack_config.databasePath()))
+    // Asynchronous logs
+    if (m_stack_config.logAsyncQueueSize() != 0)
     {
-        // Register logger
-        if (m_stack_config.logMaxEntriesCount() != 0)
-        {
-            ocpp::log::Logger::registerDefaultLogger(m_database, m_stack_config.logMaxEntriesCount());
-        }
+        ocpp::log::Logger::startAsyncMode(m_stack_config.logAsyncQueueSize());
+    }
+
+    // Register logger
+    initLogDatabase();
 
+    // Open database
+    if (m_database.open(m_stack_config.databasePath(), m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
+    {
         // Initialize the database
         initDatabase();
     }
@@ -95,6 +104,14 @@ CentralSystem::CentralSystem(const ocpp::config::ICentralSystemConfig&        st
     // Uptime timer
     m_uptime_timer.setCallback(std::bind(&CentralSystem::processUptime, this));
 
+    // Shared executor for the incoming call requests, a connection has at most one reception job
+    // pending : when too many connections are waiting, the new requests are rejected with a CALLERROR
+    if (m_stack_config.incomingCallsThreadCount() != 0)
+    {
+        m_rx_executor = std::make_unique<ocpp::helpers::WorkStealingExecutor>(m_stack_config.incomingCallsThreadCount(),
+                                                                              MAX_PENDING_RX_JOBS);
+    }
+
     // Random numbers
     std::srand(time(nullptr));
 }
@@ -103,6 +120,9 @@ CentralSystem::CentralSystem(const ocpp::config::ICentralSystemConfig&        st
 CentralSystem::~CentralSystem()
 {
     stop();
+
+    // Write the pending logs while the database is still opened and detach the logger from it
+    ocpp::log::Logger::unregisterLoggers(m_log_database);
 }
 
 /** @copydoc bool ICentralSystem::resetData() */
@@ -116,26 +136,23 @@ bool CentralSystem::resetData()
         LOG_INFO << "Reset all data";
 
         // Unregister logger
-        if (m_stack_config.logMaxEntriesCount() != 0)
-        {
-            ocpp::log::Logger::unregisterDefaultLogger();
-        }
+        ocpp::log::Logger::unregisterLoggers(m_log_database);
 
-        // Close database to invalid existing connexions
+        // Close databases to invalid existing connexions
         m_database.close();
+        m_log_database.close();
+
+        // Delete log database
+        std::error_code error;
+        std::filesystem::remove(ocpp::log::LogDatabase::path(m_stack_config.databasePath(), m_stack_config.logDatabasePath()), error);
+        initLogDatabase();
 
         // Delete database
         if (std::filesystem::remove(m_stack_config.databasePath()))
         {
             // Open database
-            if (m_database.open(m_stack_config.databasePath()))
+            if (m_database.open(m_stack_config.databasePath(), m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
             {
-                // Register logger
-                if (m_stack_config.logMaxEntriesCount() != 0)
-                {
-                    ocpp::log::Logger::registerDefaultLogger(m_database, m_stack_config.logMaxEntriesCount());
-                }
-
                 // Re-initialize with default values
                 m_total_uptime = 0;
                 initDatabase();
@@ -170,8 +187,9 @@ bool CentralSystem::start()
         m_uptime_timer.start(std::chrono::seconds(1u));
 
         // Allocate resources
-        m_ws_server  = std::unique_ptr<ocpp::websockets::IWebsocketServer>(ocpp::websockets::WebsocketFactory::newServer());
-        m_rpc_server = std::make_unique<ocpp::rpc::RpcServer>(*m_ws_server, "ocpp1.6");
+        m_ws_server  = std::unique_ptr<ocpp::websockets::IWebsocketServer>(ocpp::websockets::WebsocketFactory::newServer(
+            m_stack_config.webSocketServiceThreadCount(), m_stack_config.webSocketMaxMessageSize()));
+        m_rpc_server = std::make_unique<ocpp::rpc::RpcServer>(*m_ws_server, "ocpp1.6", m_timer_pool.get(), m_rx_executor.get());
         m_rpc_server->registerServerListener(*this);
 
         // Configure websocket link
@@ -264,9 +282,33 @@ void CentralSystem::rpcServerError()
     LOG_ERROR << "Critical server error";
 }
 
+/** @brief Open the log database and register the default logger */
+void CentralSystem::initLogDatabase()
+{
+    if (m_stack_config.logMaxEntriesCount() != 0)
+    {
+        std::string path = ocpp::log::LogDatabase::path(m_stack_config.databasePath(), m_stack_config.logDatabasePath());
+        if (m_log_database.open(path, m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
+        {
+            ocpp::log::Logger::registerDefaultLogger(m_log_database, m_stack_config.logMaxEntriesCount());
+        }
+        else
+        {
+            LOG_ERROR << "Unable to open log database";
+        }
+    }
+}
+
 /** @brief Initialize the database */
 void CentralSystem::initDatabase()
 {
+    // The logs were stored in the stack's database by the previous versions
+    auto drop_query = m_database.query("DROP TABLE IF EXISTS " DEFAULT_LOG_NAME ";");
+    if (drop_query.get())
+    {
+        drop_query->exec();
+    }
+
     // Initialize internal configuration
     m_internal_config.initDatabaseTable();
 
@@ -309,7 +351,7 @@ void CentralSystem::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&CentralSystem::saveUptime, this));
+        m_worker_pool->post(std::bind(&CentralSystem::saveUptime, this));
     }
 }
 
@@ -25,6 +25,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "MessagesConverter.h"
 #include "RpcServer.h"
 #include "Timer.h"
+#include "WorkStealingExecutor.h"
 
 #include <memory>
 
@@ -87,9 +88,14 @@ class CentralSystem : public ICentralSystem, public ocpp::rpc::RpcServer::IListe
     std::shared_ptr<ocpp::helpers::ITimerPool> m_timer_pool;
     /** @brief Worker thread pool */
     std::shared_ptr<ocpp::helpers::WorkerThreadPool> m_worker_pool;
+    /** @brief Executor shared by the charge point connections to process the incoming call requests,
+     *         declared before the RPC server which stops the connections before it is released */
+    std::unique_ptr<ocpp::helpers::WorkStealingExecutor> m_rx_executor;
 
     /** @brief Database */
     ocpp::database::Database m_database;
+    /** @brief Database to store the logs (own connection so that logging never waits for the transactions on m_database) */
+    ocpp::database::Database m_log_database;
     /** @brief Internal configuration manager */
     ocpp::config::InternalConfigManager m_internal_config;
 
@@ -110,6 +116,8 @@ class CentralSystem : public ICentralSystem, public ocpp::rpc::RpcServer::IListe
 
     /** @brief Initialize the database */
     void initDatabase();
+    /** @brief Open the log database and register the default logger */
+    void initLogDatabase();
     /** @brief Process uptime */
     void processUptime();
     /** @brief Save the uptime counter in database */
@@ -70,6 +70,7 @@ ChargePointProxy::ChargePointProxy(ICentralSystem&
 {
     m_rpc->registerSpy(*this);
     m_rpc->registerListener(*this);
+    m_rpc->setStrictOrdering(!stack_config.callRequestsPipelining());
 }
 
 /** @brief Destructor */
@@ -96,13 +97,55 @@ void ChargePointProxy::registerHandler(IChargePointRequestHandler& handler)
     m_handler.registerHandler(handler);
 }
 
+/** @brief Execute a call request and process its result with the given handler */
+template <typename RequestType, typename ResponseType>
+bool ChargePointProxy::call(const std::string&                                                   action,
+                            const RequestType&                                                   request,
+                            std::function<void(ocpp::messages::CallResult, const ResponseType&)> handler,
+                            bool                                                                 async)
+{
+    bool ret = true;
+    if (async)
+    {
+        ret = m_msg_sender.callAsync<RequestType, ResponseType>(action, request, handler);
+        if (!ret)
+        {
+            LOG_ERROR << "[" << m_identifier << "] - Call failed";
+        }
+    }
+    else
+    {
+        ResponseType response;
+        CallResult   res = m_msg_sender.call(action, request, response);
+        handler(res, response);
+    }
+    return ret;
+}
+
 // OCPP operations
 
 /** @copydoc bool ICentralSystem::IChargePoint::cancelReservation(int) */
 bool ChargePointProxy::cancelReservation(int reservation_id)
 {
     bool ret = false;
+    cancelReservation(
+        reservation_id, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::cancelReservationAsync(int,
+                                                                       std::function<void(bool)>) */
+bool ChargePointProxy::cancelReservationAsync(int                       reservation_id,
+                                              std::function<void(bool)> callback)
+{
+    return cancelReservation(reservation_id, callback, true);
+}
 
+/** @brief Execute a cancel reservation request, the result is notified through the callback */
+bool ChargePointProxy::cancelReservation(int                       reservation_id,
+                                         std::function<void(bool)> callback,
+                                         bool                      async)
+{
     LOG_INFO << "[" << m_identifier << "] - Cancel reservation : reservationId = " << reservation_id;
 
     // Prepare request
@@ -110,26 +153,51 @@ bool ChargePointProxy::cancelReservation(int reservation_id)
     req.reservationId = reservation_id;
 
     // Send request
-    CancelReservationConf resp;
-    CallResult            res = m_msg_sender.call(CANCEL_RESERVATION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == CancelReservationStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Cancel reservation : " << CancelReservationStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<CancelReservationReq, CancelReservationConf>(
+        CANCEL_RESERVATION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const CancelReservationConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == CancelReservationStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Cancel reservation : " << CancelReservationStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::AvailabilityStatus ICentralSystem::IChargePoint::changeAvailability(int, ocpp::types::AvailabilityType) */
 ocpp::types::AvailabilityStatus ChargePointProxy::changeAvailability(int connector_id, ocpp::types::AvailabilityType availability)
 {
     AvailabilityStatus ret = AvailabilityStatus::Rejected;
+    changeAvailability(
+        connector_id, availability, [&ret](ocpp::types::AvailabilityStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::changeAvailabilityAsync(int,
+                                                                        ocpp::types::AvailabilityType,
+                                                                        std::function<void(ocpp::types::AvailabilityStatus)>) */
+bool ChargePointProxy::changeAvailabilityAsync(int                                                  connector_id,
+                                               ocpp::types::AvailabilityType                        availability,
+                                               std::function<void(ocpp::types::AvailabilityStatus)> callback)
+{
+    return changeAvailability(connector_id, availability, callback, true);
+}
 
+/** @brief Execute a change availability request, the result is notified through the callback */
+bool ChargePointProxy::changeAvailability(int                                                  connector_id,
+                                          ocpp::types::AvailabilityType                        availability,
+                                          std::function<void(ocpp::types::AvailabilityStatus)> callback,
+                                          bool                                                 async)
+{
     LOG_INFO << "[" << m_identifier << "] - Change availability : connectorId = " << connector_id
              << " - availability = " << AvailabilityTypeHelper.toString(availability);
 
@@ -139,26 +207,51 @@ ocpp::types::AvailabilityStatus ChargePointProxy::changeAvailability(int connect
     req.type        = availability;
 
     // Send request
-    ChangeAvailabilityConf resp;
-    CallResult             res = m_msg_sender.call(CHANGE_AVAILABILITY_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Change availability : " << AvailabilityStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ChangeAvailabilityReq, ChangeAvailabilityConf>(
+        CHANGE_AVAILABILITY_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ChangeAvailabilityConf& resp)
+        {
+            AvailabilityStatus ret = AvailabilityStatus::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Change availability : " << AvailabilityStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::ConfigurationStatus ICentralSystem::IChargePoint::changeConfiguration(const std::string&, const std::string&) */
 ocpp::types::ConfigurationStatus ChargePointProxy::changeConfiguration(const std::string& key, const std::string& value)
 {
     ConfigurationStatus ret = ConfigurationStatus::Rejected;
+    changeConfiguration(
+        key, value, [&ret](ocpp::types::ConfigurationStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::changeConfigurationAsync(const std::string&,
+                                                                         const std::string&,
+                                                                         std::function<void(ocpp::types::ConfigurationStatus)>) */
+bool ChargePointProxy::changeConfigurationAsync(const std::string&                                    key,
+                                                const std::string&                                    value,
+                                                std::function<void(ocpp::types::ConfigurationStatus)> callback)
+{
+    return changeConfiguration(key, value, callback, true);
+}
 
+/** @brief Execute a change configuration request, the result is notified through the callback */
+bool ChargePointProxy::changeConfiguration(const std::string&                                    key,
+                                           const std::string&                                    value,
+                                           std::function<void(ocpp::types::ConfigurationStatus)> callback,
+                                           bool                                                  async)
+{
     LOG_INFO << "[" << m_identifier << "] - Change configuration : key = " << key << " - value = " << value;
 
     // Prepare request
@@ -167,45 +260,69 @@ ocpp::types::ConfigurationStatus ChargePointProxy::changeConfiguration(const std
     req.value.assign(value);
 
     // Send request
-    ChangeConfigurationConf resp;
-    CallResult              res = m_msg_sender.call(CHANGE_CONFIGURATION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Change configuration : " << ConfigurationStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ChangeConfigurationReq, ChangeConfigurationConf>(
+        CHANGE_CONFIGURATION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ChangeConfigurationConf& resp)
+        {
+            ConfigurationStatus ret = ConfigurationStatus::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Change configuration : " << ConfigurationStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::clearCache() */
 bool ChargePointProxy::clearCache()
 {
     bool ret = false;
+    clearCache(
+        [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::clearCacheAsync(std::function<void(bool)>) */
+bool ChargePointProxy::clearCacheAsync(std::function<void(bool)> callback)
+{
+    return clearCache(callback, true);
+}
 
+/** @brief Execute a clear cache request, the result is notified through the callback */
+bool ChargePointProxy::clearCache(std::function<void(bool)> callback,
+                                  bool                      async)
+{
     LOG_INFO << "[" << m_identifier << "] - Clear cache";
 
     // Prepare request
     ClearCacheReq req;
 
     // Send request
-    ClearCacheConf resp;
-    CallResult     res = m_msg_sender.call(CLEAR_CACHE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == ClearCacheStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Clear cache : " << ClearCacheStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ClearCacheReq, ClearCacheConf>(
+        CLEAR_CACHE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ClearCacheConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == ClearCacheStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Clear cache : " << ClearCacheStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::clearChargingProfile(const ocpp::types::Optional<int>&,
@@ -218,7 +335,33 @@ bool ChargePointProxy::clearChargingProfile(const ocpp::types::Optional<int>&
                                             const ocpp::types::Optional<unsigned int>&                            stack_level)
 {
     bool ret = false;
+    clearChargingProfile(
+        profile_id, connector_id, purpose, stack_level, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::clearChargingProfileAsync(const ocpp::types::Optional<int>&,
+                                                                          const ocpp::types::Optional<unsigned int>&,
+                                                                          const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>&,
+                                                                          const ocpp::types::Optional<unsigned int>&,
+                                                                          std::function<void(bool)>) */
+bool ChargePointProxy::clearChargingProfileAsync(const ocpp::types::Optional<int>&                                     profile_id,
+                                                 const ocpp::types::Optional<unsigned int>&                            connector_id,
+                                                 const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>& purpose,
+                                                 const ocpp::types::Optional<unsigned int>&                            stack_level,
+                                                 std::function<void(bool)>                                             callback)
+{
+    return clearChargingProfile(profile_id, connector_id, purpose, stack_level, callback, true);
+}
 
+/** @brief Execute a clear charging profile request, the result is notified through the callback */
+bool ChargePointProxy::clearChargingProfile(const ocpp::types::Optional<int>&                                     profile_id,
+                                            const ocpp::types::Optional<unsigned int>&                            connector_id,
+                                            const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>& purpose,
+                                            const ocpp::types::Optional<unsigned int>&                            stack_level,
+                                            std::function<void(bool)>                                             callback,
+                                            bool                                                                  async)
+{
     LOG_INFO << "[" << m_identifier << "] - Clear charging profile : id = " << (profile_id.isSet() ? std::to_string(profile_id) : "not set")
              << " - connectorId = " << (connector_id.isSet() ? std::to_string(connector_id) : "not set")
              << " - chargingProfilePurpose = " << (purpose.isSet() ? ChargingProfilePurposeTypeHelper.toString(purpose) : "not set")
@@ -232,19 +375,24 @@ bool ChargePointProxy::clearChargingProfile(const ocpp::types::Optional<int>&
     req.stackLevel             = stack_level;
 
     // Send request
-    ClearChargingProfileConf resp;
-    CallResult               res = m_msg_sender.call(CLEAR_CHARGING_PROFILE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == ClearChargingProfileStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Clear charging profile : " << ClearChargingProfileStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ClearChargingProfileReq, ClearChargingProfileConf>(
+        CLEAR_CHARGING_PROFILE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ClearChargingProfileConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == ClearChargingProfileStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Clear charging profile : " << ClearChargingProfileStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::dataTransfer(const std::string&,
@@ -259,7 +407,41 @@ bool ChargePointProxy::dataTransfer(const std::string&               vendor_id,
                                     std::string&                     response_data)
 {
     bool ret = false;
+    dataTransfer(
+        vendor_id,
+        message_id,
+        request_data,
+        [&](bool                            _ret,
+            ocpp::types::DataTransferStatus _status,
+            const std::string&              _response_data)
+        {
+            ret           = _ret;
+            status        = _status;
+            response_data = _response_data;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::dataTransferAsync(const std::string&,
+                                                                  const std::string&,
+                                                                  const std::string&,
+                                                                  std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)>) */
+bool ChargePointProxy::dataTransferAsync(const std::string&                                                             vendor_id,
+                                         const std::string&                                                             message_id,
+                                         const std::string&                                                             request_data,
+                                         std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)> callback)
+{
+    return dataTransfer(vendor_id, message_id, request_data, callback, true);
+}
 
+/** @brief Execute a data transfer request, the result is notified through the callback */
+bool ChargePointProxy::dataTransfer(const std::string&                                                             vendor_id,
+                                    const std::string&                                                             message_id,
+                                    const std::string&                                                             request_data,
+                                    std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)> callback,
+                                    bool                                                                           async)
+{
     LOG_INFO << "[" << m_identifier << "] - Data transfer : vendorId = " << vendor_id << " - messageId = " << message_id
              << " - data = " << request_data;
 
@@ -276,22 +458,29 @@ bool ChargePointProxy::dataTransfer(const std::string&               vendor_id,
     }
 
     // Send request
-    DataTransferConf resp;
-    CallResult       res = m_msg_sender.call(DATA_TRANSFER_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret           = (resp.status == DataTransferStatus::Accepted);
-        status        = resp.status;
-        response_data = resp.data;
-        LOG_INFO << "[" << m_identifier << "] - Data transfer : status = " << DataTransferStatusHelper.toString(resp.status)
-                 << " - data = " << (resp.data.isSet() ? resp.data.value() : "not set");
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<DataTransferReq, DataTransferConf>(
+        DATA_TRANSFER_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const DataTransferConf& resp)
+        {
+            bool                            ret    = false;
+            ocpp::types::DataTransferStatus status = DataTransferStatus::Rejected;
+            std::string                     response_data;
+            if (res == CallResult::Ok)
+            {
+                ret           = (resp.status == DataTransferStatus::Accepted);
+                status        = resp.status;
+                response_data = resp.data;
+                LOG_INFO << "[" << identifier << "] - Data transfer : status = " << DataTransferStatusHelper.toString(resp.status)
+                         << " - data = " << (resp.data.isSet() ? resp.data.value() : "not set");
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, status, response_data);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getCompositeSchedule(unsigned int,
@@ -308,7 +497,43 @@ bool ChargePointProxy::getCompositeSchedule(unsigned int
                                             ocpp::types::Optional<ocpp::types::ChargingSchedule>&           schedule)
 {
     bool ret = false;
+    getCompositeSchedule(
+        connector_id,
+        duration,
+        unit,
+        [&](bool                                                        _ret,
+            const ocpp::types::Optional<unsigned int>&                  _schedule_connector_id,
+            const ocpp::types::Optional<ocpp::types::DateTime>&         _schedule_start,
+            const ocpp::types::Optional<ocpp::types::ChargingSchedule>& _schedule)
+        {
+            ret                   = _ret;
+            schedule_connector_id = _schedule_connector_id;
+            schedule_start        = _schedule_start;
+            schedule              = _schedule;
+        },
+        false);
+    return ret;
+}
 
+/** @copydoc bool ICentralSystem::IChargePoint::getCompositeScheduleAsync(unsigned int,
+                                                                          std::chrono::seconds,
+                                                                          const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>&,
+                                                                          GetCompositeScheduleCallback) */
+bool ChargePointProxy::getCompositeScheduleAsync(unsigned int                                                    connector_id,
+                                                 std::chrono::seconds                                            duration,
+                                                 const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>& unit,
+                                                 GetCompositeScheduleCallback                                    callback)
+{
+    return getCompositeSchedule(connector_id, duration, unit, callback, true);
+}
+
+/** @brief Execute a get composite schedule request, the result is notified through the callback */
+bool ChargePointProxy::getCompositeSchedule(unsigned int                                                    connector_id,
+                                            std::chrono::seconds                                            duration,
+                                            const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>& unit,
+                                            GetCompositeScheduleCallback                                    callback,
+                                            bool                                                            async)
+{
     LOG_INFO << "[" << m_identifier << "] - Get composite schedule : connectorId = " << connector_id << " - duration = " << duration.count()
              << " - unit = " << (unit.isSet() ? ChargingRateUnitTypeHelper.toString(unit) : "not set");
 
@@ -319,26 +544,34 @@ bool ChargePointProxy::getCompositeSchedule(unsigned int
     req.chargingRateUnit = unit;
 
     // Send request
-    GetCompositeScheduleConf resp;
-    CallResult               res = m_msg_sender.call(GET_COMPOSITE_SCHEDULE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret                   = (resp.status == GetCompositeScheduleStatus::Accepted);
-        schedule_connector_id = resp.connectorId;
-        schedule_start        = resp.scheduleStart;
-        schedule              = resp.chargingSchedule;
-        LOG_INFO << "[" << m_identifier
-                 << "] - Get composite schedule : status = " << GetCompositeScheduleStatusHelper.toString(resp.status)
-                 << " - connectorId = " << (resp.connectorId.isSet() ? std::to_string(resp.connectorId) : "not set")
-                 << " - scheduleStart = " << (resp.scheduleStart.isSet() ? resp.scheduleStart.value().str() : "not set")
-                 << " - chargingSchedule = " << (resp.chargingSchedule.isSet() ? "set" : "not set");
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<GetCompositeScheduleReq, GetCompositeScheduleConf>(
+        GET_COMPOSITE_SCHEDULE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetCompositeScheduleConf& resp)
+        {
+            bool                                                 ret = false;
+            ocpp::types::Optional<unsigned int>                  schedule_connector_id;
+            ocpp::types::Optional<ocpp::types::DateTime>         schedule_start;
+            ocpp::types::Optional<ocpp::types::ChargingSchedule> schedule;
+            if (res == CallResult::Ok)
+            {
+                ret                   = (resp.status == GetCompositeScheduleStatus::Accepted);
+                schedule_connector_id = resp.connectorId;
+                schedule_start        = resp.scheduleStart;
+                schedule              = resp.chargingSchedule;
+                LOG_INFO << "[" << identifier
+                         << "] - Get composite schedule : status = " << GetCompositeScheduleStatusHelper.toString(resp.status)
+                         << " - connectorId = " << (resp.connectorId.isSet() ? std::to_string(resp.connectorId) : "not set")
+                         << " - scheduleStart = " << (resp.scheduleStart.isSet() ? resp.scheduleStart.value().str() : "not set")
+                         << " - chargingSchedule = " << (resp.chargingSchedule.isSet() ? "set" : "not set");
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, schedule_connector_id, schedule_start, schedule);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getConfiguration(const std::vector<std::string>&,
@@ -349,7 +582,33 @@ bool ChargePointProxy::getConfiguration(const std::vector<std::string>&     keys
                                         std::vector<std::string>&           unknown_keys)
 {
     bool ret = false;
+    getConfiguration(
+        keys,
+        [&](bool                                      _ret,
+            const std::vector<ocpp::types::KeyValue>& _config_keys,
+            const std::vector<std::string>&           _unknown_keys)
+        {
+            ret          = _ret;
+            config_keys  = _config_keys;
+            unknown_keys = _unknown_keys;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::getConfigurationAsync(const std::vector<std::string>&,
+                                                                      std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)>) */
+bool ChargePointProxy::getConfigurationAsync(const std::vector<std::string>&                                                                       keys,
+                                             std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)> callback)
+{
+    return getConfiguration(keys, callback, true);
+}
 
+/** @brief Execute a get configuration request, the result is notified through the callback */
+bool ChargePointProxy::getConfiguration(const std::vector<std::string>&                                                                       keys,
+                                        std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)> callback,
+                                        bool                                                                                                  async)
+{
     LOG_INFO << "[" << m_identifier << "] - Get configuration : key count = " << keys.size();
 
     // Prepare request
@@ -364,31 +623,38 @@ bool ChargePointProxy::getConfiguration(const std::vector<std::string>&     keys
     }
 
     // Send request
-    GetConfigurationConf resp;
-    CallResult           res = m_msg_sender.call(GET_CONFIGURATION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = true;
-        if (resp.configurationKey.isSet())
-        {
-            config_keys = resp.configurationKey;
-        }
-        if (resp.unknownKey.isSet())
+    return call<GetConfigurationReq, GetConfigurationConf>(
+        GET_CONFIGURATION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetConfigurationConf& resp)
         {
-            for (const auto& key : resp.unknownKey.value())
+            bool                               ret = false;
+            std::vector<ocpp::types::KeyValue> config_keys;
+            std::vector<std::string>           unknown_keys;
+            if (res == CallResult::Ok)
             {
-                unknown_keys.emplace_back(key.str());
+                ret = true;
+                if (resp.configurationKey.isSet())
+                {
+                    config_keys = resp.configurationKey;
+                }
+                if (resp.unknownKey.isSet())
+                {
+                    for (const auto& key : resp.unknownKey.value())
+                    {
+                        unknown_keys.emplace_back(key.str());
+                    }
+                }
+                LOG_INFO << "[" << identifier << "] - Get configuration : key count = " << config_keys.size()
+                         << " - unknown key count = " << unknown_keys.size();
             }
-        }
-        LOG_INFO << "[" << m_identifier << "] - Get configuration : key count = " << config_keys.size()
-                 << " - unknown key count = " << unknown_keys.size();
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, config_keys, unknown_keys);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getDiagnostics(const std::string&,
@@ -405,7 +671,47 @@ bool ChargePointProxy::getDiagnostics(const std::string&
                                       std::string&                                        diagnotic_filename)
 {
     bool ret = false;
+    getDiagnostics(
+        uri,
+        retries,
+        retry_interval,
+        start,
+        stop,
+        [&](bool               _ret,
+            const std::string& _diagnotic_filename)
+        {
+            ret                = _ret;
+            diagnotic_filename = _diagnotic_filename;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::getDiagnosticsAsync(const std::string&,
+                                                                    const ocpp::types::Optional<unsigned int>&,
+                                                                    const ocpp::types::Optional<std::chrono::seconds>&,
+                                                                    const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                                                    const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                                                    std::function<void(bool, const std::string&)>) */
+bool ChargePointProxy::getDiagnosticsAsync(const std::string&                                  uri,
+                                           const ocpp::types::Optional<unsigned int>&          retries,
+                                           const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                                           const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                                           const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                                           std::function<void(bool, const std::string&)>       callback)
+{
+    return getDiagnostics(uri, retries, retry_interval, start, stop, callback, true);
+}
 
+/** @brief Execute a get diagnostics request, the result is notified through the callback */
+bool ChargePointProxy::getDiagnostics(const std::string&                                  uri,
+                                      const ocpp::types::Optional<unsigned int>&          retries,
+                                      const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                                      const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                                      const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                                      std::function<void(bool, const std::string&)>       callback,
+                                      bool                                                async)
+{
     LOG_INFO << "[" << m_identifier << "] - Get diagnostics : location = " << uri
              << " - retries = " << (retries.isSet() ? std::to_string(retries) : "not set")
              << " - retryInterval = " << (retry_interval.isSet() ? std::to_string(retry_interval.value().count()) : "not set")
@@ -424,47 +730,79 @@ bool ChargePointProxy::getDiagnostics(const std::string&
     req.stopTime  = stop;
 
     // Send request
-    GetDiagnosticsConf resp;
-    CallResult         res = m_msg_sender.call(GET_DIAGNOSTICS_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret                = true;
-        diagnotic_filename = resp.fileName;
-        LOG_INFO << "[" << m_identifier << "] - Get diagnostics : filename = " << resp.fileName.str();
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<GetDiagnosticsReq, GetDiagnosticsConf>(
+        GET_DIAGNOSTICS_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetDiagnosticsConf& resp)
+        {
+            bool        ret = false;
+            std::string diagnotic_filename;
+            if (res == CallResult::Ok)
+            {
+                ret                = true;
+                diagnotic_filename = resp.fileName;
+                LOG_INFO << "[" << identifier << "] - Get diagnostics : filename = " << resp.fileName.str();
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, diagnotic_filename);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getLocalListVersion(int&) */
 bool ChargePointProxy::getLocalListVersion(int& version)
 {
     bool ret = false;
+    getLocalListVersion(
+        [&](bool _ret,
+            int  _version)
+        {
+            ret     = _ret;
+            version = _version;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::getLocalListVersionAsync(std::function<void(bool, int)>) */
+bool ChargePointProxy::getLocalListVersionAsync(std::function<void(bool, int)> callback)
+{
+    return getLocalListVersion(callback, true);
+}
 
+/** @brief Execute a get local list version request, the result is notified through the callback */
+bool ChargePointProxy::getLocalListVersion(std::function<void(bool, int)> callback,
+                                           bool                           async)
+{
     LOG_INFO << "[" << m_identifier << "] - Get local list version";
 
     // Prepare request
     GetLocalListVersionReq req;
 
     // Send request
-    GetLocalListVersionConf resp;
-    CallResult              res = m_msg_sender.call(GET_LOCAL_LIST_VERSION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret     = true;
-        version = resp.listVersion;
-        LOG_INFO << "[" << m_identifier << "] - Get local list version : " << resp.listVersion;
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<GetLocalListVersionReq, GetLocalListVersionConf>(
+        GET_LOCAL_LIST_VERSION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetLocalListVersionConf& resp)
+        {
+            bool ret     = false;
+            int  version = 0;
+            if (res == CallResult::Ok)
+            {
+                ret     = true;
+                version = resp.listVersion;
+                LOG_INFO << "[" << identifier << "] - Get local list version : " << resp.listVersion;
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, version);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::remoteStartTransaction(const ocpp::types::Optional<unsigned int>&,
@@ -475,7 +813,30 @@ bool ChargePointProxy::remoteStartTransaction(const ocpp::types::Optional<unsign
                                               const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile)
 {
     bool ret = false;
+    remoteStartTransaction(
+        connector_id, id_tag, profile, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::remoteStartTransactionAsync(const ocpp::types::Optional<unsigned int>&,
+                                                                            const std::string&,
+                                                                            const ocpp::types::Optional<ocpp::types::ChargingProfile>&,
+                                                                            std::function<void(bool)>) */
+bool ChargePointProxy::remoteStartTransactionAsync(const ocpp::types::Optional<unsigned int>&                 connector_id,
+                                                   const std::string&                                         id_tag,
+                                                   const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile,
+                                                   std::function<void(bool)>                                  callback)
+{
+    return remoteStartTransaction(connector_id, id_tag, profile, callback, true);
+}
 
+/** @brief Execute a remote start transaction request, the result is notified through the callback */
+bool ChargePointProxy::remoteStartTransaction(const ocpp::types::Optional<unsigned int>&                 connector_id,
+                                              const std::string&                                         id_tag,
+                                              const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile,
+                                              std::function<void(bool)>                                  callback,
+                                              bool                                                       async)
+{
     LOG_INFO << "[" << m_identifier
              << "] - Remote start transaction : connectorId = " << (connector_id.isSet() ? std::to_string(connector_id) : "not set")
              << " - idTag = " << id_tag << " - chargingProfile = " << (profile.isSet() ? "set" : "not set");
@@ -487,26 +848,48 @@ bool ChargePointProxy::remoteStartTransaction(const ocpp::types::Optional<unsign
     req.chargingProfile = profile;
 
     // Send request
-    RemoteStartTransactionConf resp;
-    CallResult                 res = m_msg_sender.call(REMOTE_START_TRANSACTION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == RemoteStartStopStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Remote start transaction : " << RemoteStartStopStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<RemoteStartTransactionReq, RemoteStartTransactionConf>(
+        REMOTE_START_TRANSACTION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const RemoteStartTransactionConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == RemoteStartStopStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Remote start transaction : " << RemoteStartStopStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::remoteStopTransaction(int) */
 bool ChargePointProxy::remoteStopTransaction(int transaction_id)
 {
     bool ret = false;
+    remoteStopTransaction(
+        transaction_id, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::remoteStopTransactionAsync(int,
+                                                                           std::function<void(bool)>) */
+bool ChargePointProxy::remoteStopTransactionAsync(int                       transaction_id,
+                                                  std::function<void(bool)> callback)
+{
+    return remoteStopTransaction(transaction_id, callback, true);
+}
 
+/** @brief Execute a remote stop transaction request, the result is notified through the callback */
+bool ChargePointProxy::remoteStopTransaction(int                       transaction_id,
+                                             std::function<void(bool)> callback,
+                                             bool                      async)
+{
     LOG_INFO << "[" << m_identifier << "] - Remote stop transaction : transactionId = " << transaction_id;
 
     // Prepare request
@@ -514,19 +897,24 @@ bool ChargePointProxy::remoteStopTransaction(int transaction_id)
     req.transactionId = transaction_id;
 
     // Send request
-    RemoteStopTransactionConf resp;
-    CallResult                res = m_msg_sender.call(REMOTE_STOP_TRANSACTION_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == RemoteStartStopStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Remote stop transaction : " << RemoteStartStopStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<RemoteStopTransactionReq, RemoteStopTransactionConf>(
+        REMOTE_STOP_TRANSACTION_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const RemoteStopTransactionConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == RemoteStartStopStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Remote stop transaction : " << RemoteStartStopStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::ReservationStatus ICentralSystem::IChargePoint::reserveNow(unsigned int,
@@ -541,7 +929,36 @@ ocpp::types::ReservationStatus ChargePointProxy::reserveNow(unsigned int
                                                             int                          reservation_id)
 {
     ReservationStatus ret = ReservationStatus::Rejected;
+    reserveNow(
+        connector_id, expiry_date, id_tag, parent_id_tag, reservation_id, [&ret](ocpp::types::ReservationStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::reserveNowAsync(unsigned int,
+                                                                const ocpp::types::DateTime&,
+                                                                const std::string&,
+                                                                const std::string&,
+                                                                int,
+                                                                std::function<void(ocpp::types::ReservationStatus)>) */
+bool ChargePointProxy::reserveNowAsync(unsigned int                                        connector_id,
+                                       const ocpp::types::DateTime&                        expiry_date,
+                                       const std::string&                                  id_tag,
+                                       const std::string&                                  parent_id_tag,
+                                       int                                                 reservation_id,
+                                       std::function<void(ocpp::types::ReservationStatus)> callback)
+{
+    return reserveNow(connector_id, expiry_date, id_tag, parent_id_tag, reservation_id, callback, true);
+}
 
+/** @brief Execute a reserve now request, the result is notified through the callback */
+bool ChargePointProxy::reserveNow(unsigned int                                        connector_id,
+                                  const ocpp::types::DateTime&                        expiry_date,
+                                  const std::string&                                  id_tag,
+                                  const std::string&                                  parent_id_tag,
+                                  int                                                 reservation_id,
+                                  std::function<void(ocpp::types::ReservationStatus)> callback,
+                                  bool                                                async)
+{
     LOG_INFO << "[" << m_identifier << "] - Reserve now : connectorId = " << connector_id << " - expiryDate = " << expiry_date.str()
              << " - idTag = " << id_tag << " - parentIdTag = " << parent_id_tag << " - reservationId = " << reservation_id;
 
@@ -557,26 +974,48 @@ ocpp::types::ReservationStatus ChargePointProxy::reserveNow(unsigned int
     req.reservationId = reservation_id;
 
     // Send request
-    ReserveNowConf resp;
-    CallResult     res = m_msg_sender.call(RESERVE_NOW_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Reserve now : " << ReservationStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ReserveNowReq, ReserveNowConf>(
+        RESERVE_NOW_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ReserveNowConf& resp)
+        {
+            ReservationStatus ret = ReservationStatus::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Reserve now : " << ReservationStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::reset(ocpp::types::ResetType) */
 bool ChargePointProxy::reset(ocpp::types::ResetType type)
 {
     bool ret = false;
+    reset(
+        type, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::resetAsync(ocpp::types::ResetType,
+                                                           std::function<void(bool)>) */
+bool ChargePointProxy::resetAsync(ocpp::types::ResetType    type,
+                                  std::function<void(bool)> callback)
+{
+    return reset(type, callback, true);
+}
 
+/** @brief Execute a reset request, the result is notified through the callback */
+bool ChargePointProxy::reset(ocpp::types::ResetType    type,
+                             std::function<void(bool)> callback,
+                             bool                      async)
+{
     LOG_INFO << "[" << m_identifier << "] - Reset : type = " << ResetTypeHelper.toString(type);
 
     // Prepare request
@@ -584,19 +1023,24 @@ bool ChargePointProxy::reset(ocpp::types::ResetType type)
     req.type = type;
 
     // Send request
-    ResetConf  resp;
-    CallResult res = m_msg_sender.call(RESET_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == ResetStatus::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Reset : " << ResetStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ResetReq, ResetConf>(
+        RESET_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ResetConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == ResetStatus::Accepted);
+                LOG_INFO << "[" << identifier << "] - Reset : " << ResetStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::UpdateStatus ICentralSystem::IChargePoint::sendLocalList(int,
@@ -607,7 +1051,30 @@ ocpp::types::UpdateStatus ChargePointProxy::sendLocalList(int
                                                           ocpp::types::UpdateType                            update_type)
 {
     UpdateStatus ret = UpdateStatus::Failed;
+    sendLocalList(
+        version, authorization_list, update_type, [&ret](ocpp::types::UpdateStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::sendLocalListAsync(int,
+                                                                   const std::vector<ocpp::types::AuthorizationData>&,
+                                                                   ocpp::types::UpdateType,
+                                                                   std::function<void(ocpp::types::UpdateStatus)>) */
+bool ChargePointProxy::sendLocalListAsync(int                                                version,
+                                          const std::vector<ocpp::types::AuthorizationData>& authorization_list,
+                                          ocpp::types::UpdateType                            update_type,
+                                          std::function<void(ocpp::types::UpdateStatus)>     callback)
+{
+    return sendLocalList(version, authorization_list, update_type, callback, true);
+}
 
+/** @brief Execute a send local list request, the result is notified through the callback */
+bool ChargePointProxy::sendLocalList(int                                                version,
+                                     const std::vector<ocpp::types::AuthorizationData>& authorization_list,
+                                     ocpp::types::UpdateType                            update_type,
+                                     std::function<void(ocpp::types::UpdateStatus)>     callback,
+                                     bool                                               async)
+{
     LOG_INFO << "[" << m_identifier << "] - Send local list : listVersion = " << version
              << " - localAuthorizationList count = " << authorization_list.size()
              << " - updateType = " << UpdateTypeHelper.toString(update_type);
@@ -619,19 +1086,24 @@ ocpp::types::UpdateStatus ChargePointProxy::sendLocalList(int
     req.updateType             = update_type;
 
     // Send request
-    SendLocalListConf resp;
-    CallResult        res = m_msg_sender.call(SEND_LOCAL_LIST_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Send local list : " << UpdateStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<SendLocalListReq, SendLocalListConf>(
+        SEND_LOCAL_LIST_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const SendLocalListConf& resp)
+        {
+            UpdateStatus ret = UpdateStatus::Failed;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Send local list : " << UpdateStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::ChargingProfileStatus ICentralSystem::IChargePoint::setChargingProfile(unsigned int,
@@ -640,7 +1112,27 @@ ocpp::types::ChargingProfileStatus ChargePointProxy::setChargingProfile(unsigned
                                                                         const ocpp::types::ChargingProfile& profile)
 {
     ChargingProfileStatus ret = ChargingProfileStatus::Rejected;
+    setChargingProfile(
+        connector_id, profile, [&ret](ocpp::types::ChargingProfileStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::setChargingProfileAsync(unsigned int,
+                                                                        const ocpp::types::ChargingProfile&,
+                                                                        std::function<void(ocpp::types::ChargingProfileStatus)>) */
+bool ChargePointProxy::setChargingProfileAsync(unsigned int                                            connector_id,
+                                               const ocpp::types::ChargingProfile&                     profile,
+                                               std::function<void(ocpp::types::ChargingProfileStatus)> callback)
+{
+    return setChargingProfile(connector_id, profile, callback, true);
+}
 
+/** @brief Execute a set charging profile request, the result is notified through the callback */
+bool ChargePointProxy::setChargingProfile(unsigned int                                            connector_id,
+                                          const ocpp::types::ChargingProfile&                     profile,
+                                          std::function<void(ocpp::types::ChargingProfileStatus)> callback,
+                                          bool                                                    async)
+{
     LOG_INFO << "[" << m_identifier << "] - Set charging profile : connectorId = " << connector_id
              << " - csChargingProfiles : id = " << profile.chargingProfileId
              << " - purpose = " << ChargingProfilePurposeTypeHelper.toString(profile.chargingProfilePurpose);
@@ -651,19 +1143,24 @@ ocpp::types::ChargingProfileStatus ChargePointProxy::setChargingProfile(unsigned
     req.csChargingProfiles = profile;
 
     // Send request
-    SetChargingProfileConf resp;
-    CallResult             res = m_msg_sender.call(SET_CHARGING_PROFILE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Set charging profile : " << ChargingProfileStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<SetChargingProfileReq, SetChargingProfileConf>(
+        SET_CHARGING_PROFILE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const SetChargingProfileConf& resp)
+        {
+            ChargingProfileStatus ret = ChargingProfileStatus::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Set charging profile : " << ChargingProfileStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::TriggerMessageStatus ICentralSystem::IChargePoint::triggerMessage(ocpp::types::MessageTrigger,
@@ -672,7 +1169,27 @@ ocpp::types::TriggerMessageStatus ChargePointProxy::triggerMessage(ocpp::types::
                                                                    const ocpp::types::Optional<unsigned int> connector_id)
 {
     TriggerMessageStatus ret = TriggerMessageStatus::Rejected;
+    triggerMessage(
+        message, connector_id, [&ret](ocpp::types::TriggerMessageStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::triggerMessageAsync(ocpp::types::MessageTrigger,
+                                                                    const ocpp::types::Optional<unsigned int>,
+                                                                    std::function<void(ocpp::types::TriggerMessageStatus)>) */
+bool ChargePointProxy::triggerMessageAsync(ocpp::types::MessageTrigger                            message,
+                                           const ocpp::types::Optional<unsigned int>              connector_id,
+                                           std::function<void(ocpp::types::TriggerMessageStatus)> callback)
+{
+    return triggerMessage(message, connector_id, callback, true);
+}
 
+/** @brief Execute a trigger message request, the result is notified through the callback */
+bool ChargePointProxy::triggerMessage(ocpp::types::MessageTrigger                            message,
+                                      const ocpp::types::Optional<unsigned int>              connector_id,
+                                      std::function<void(ocpp::types::TriggerMessageStatus)> callback,
+                                      bool                                                   async)
+{
     LOG_INFO << "[" << m_identifier << "] - Trigger message : requestedMessage = " << MessageTriggerHelper.toString(message)
              << " - connectorId = " << (connector_id.isSet() ? std::to_string(connector_id) : "not set");
 
@@ -682,26 +1199,48 @@ ocpp::types::TriggerMessageStatus ChargePointProxy::triggerMessage(ocpp::types::
     req.connectorId      = connector_id;
 
     // Send request
-    TriggerMessageConf resp;
-    CallResult         res = m_msg_sender.call(TRIGGER_MESSAGE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Trigger message : " << TriggerMessageStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<TriggerMessageReq, TriggerMessageConf>(
+        TRIGGER_MESSAGE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const TriggerMessageConf& resp)
+        {
+            TriggerMessageStatus ret = TriggerMessageStatus::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Trigger message : " << TriggerMessageStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::UnlockStatus ICentralSystem::IChargePoint::unlockConnector(unsigned int) */
 ocpp::types::UnlockStatus ChargePointProxy::unlockConnector(unsigned int connector_id)
 {
     UnlockStatus ret = UnlockStatus::UnlockFailed;
+    unlockConnector(
+        connector_id, [&ret](ocpp::types::UnlockStatus _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::unlockConnectorAsync(unsigned int,
+                                                                     std::function<void(ocpp::types::UnlockStatus)>) */
+bool ChargePointProxy::unlockConnectorAsync(unsigned int                                   connector_id,
+                                            std::function<void(ocpp::types::UnlockStatus)> callback)
+{
+    return unlockConnector(connector_id, callback, true);
+}
 
+/** @brief Execute an unlock connector request, the result is notified through the callback */
+bool ChargePointProxy::unlockConnector(unsigned int                                   connector_id,
+                                       std::function<void(ocpp::types::UnlockStatus)> callback,
+                                       bool                                           async)
+{
     LOG_INFO << "[" << m_identifier << "] - Unlock connector : connectorId = " << connector_id;
 
     // Prepare request
@@ -709,19 +1248,24 @@ ocpp::types::UnlockStatus ChargePointProxy::unlockConnector(unsigned int connect
     req.connectorId = connector_id;
 
     // Send request
-    UnlockConnectorConf resp;
-    CallResult          res = m_msg_sender.call(UNLOCK_CONNECTOR_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Unlock connector : " << UnlockStatusHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<UnlockConnectorReq, UnlockConnectorConf>(
+        UNLOCK_CONNECTOR_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const UnlockConnectorConf& resp)
+        {
+            UnlockStatus ret = UnlockStatus::UnlockFailed;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Unlock connector : " << UnlockStatusHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::updateFirmware(const std::string&,
@@ -734,7 +1278,33 @@ bool ChargePointProxy::updateFirmware(const std::string&
                                       const ocpp::types::Optional<std::chrono::seconds>& retry_interval)
 {
     bool ret = false;
+    updateFirmware(
+        uri, retries, retrieve_date, retry_interval, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::updateFirmwareAsync(const std::string&,
+                                                                    const ocpp::types::Optional<unsigned int>&,
+                                                                    const ocpp::types::DateTime&,
+                                                                    const ocpp::types::Optional<std::chrono::seconds>&,
+                                                                    std::function<void(bool)>) */
+bool ChargePointProxy::updateFirmwareAsync(const std::string&                                 uri,
+                                           const ocpp::types::Optional<unsigned int>&         retries,
+                                           const ocpp::types::DateTime&                       retrieve_date,
+                                           const ocpp::types::Optional<std::chrono::seconds>& retry_interval,
+                                           std::function<void(bool)>                          callback)
+{
+    return updateFirmware(uri, retries, retrieve_date, retry_interval, callback, true);
+}
 
+/** @brief Execute an update firmware request, the result is notified through the callback */
+bool ChargePointProxy::updateFirmware(const std::string&                                 uri,
+                                      const ocpp::types::Optional<unsigned int>&         retries,
+                                      const ocpp::types::DateTime&                       retrieve_date,
+                                      const ocpp::types::Optional<std::chrono::seconds>& retry_interval,
+                                      std::function<void(bool)>                          callback,
+                                      bool                                               async)
+{
     LOG_INFO << "[" << m_identifier << "] - Update firmware : location = " << uri
              << " - retries = " << (retries.isSet() ? std::to_string(retries) : "not set") << " - retrieveDate = " << retrieve_date.str()
              << " - retryInterval = " << (retry_interval.isSet() ? std::to_string(retry_interval.value().count()) : "not set");
@@ -750,19 +1320,24 @@ bool ChargePointProxy::updateFirmware(const std::string&
     }
 
     // Send request
-    UpdateFirmwareConf resp;
-    CallResult         res = m_msg_sender.call(UPDATE_FIRMWARE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = true;
-        LOG_INFO << "[" << m_identifier << "] - Update firmware : Accepted";
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<UpdateFirmwareReq, UpdateFirmwareConf>(
+        UPDATE_FIRMWARE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const UpdateFirmwareConf&)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = true;
+                LOG_INFO << "[" << identifier << "] - Update firmware : Accepted";
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 // Security extensions
@@ -771,7 +1346,24 @@ bool ChargePointProxy::updateFirmware(const std::string&
 bool ChargePointProxy::certificateSigned(const ocpp::x509::Certificate& certificate_chain)
 {
     bool ret = false;
+    certificateSigned(
+        certificate_chain, [&ret](bool _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::certificateSignedAsync(const ocpp::x509::Certificate&,
+                                                                       std::function<void(bool)>) */
+bool ChargePointProxy::certificateSignedAsync(const ocpp::x509::Certificate& certificate_chain,
+                                              std::function<void(bool)>      callback)
+{
+    return certificateSigned(certificate_chain, callback, true);
+}
 
+/** @brief Execute a certificate signed request, the result is notified through the callback */
+bool ChargePointProxy::certificateSigned(const ocpp::x509::Certificate& certificate_chain,
+                                         std::function<void(bool)>      callback,
+                                         bool                           async)
+{
     LOG_INFO << "[" << m_identifier << "] - Certificate signed : certificate chain size = " << certificate_chain.pemChain().size();
 
     // Prepare request
@@ -779,27 +1371,48 @@ bool ChargePointProxy::certificateSigned(const ocpp::x509::Certificate& certific
     req.certificateChain.assign(certificate_chain.pem());
 
     // Send request
-    CertificateSignedConf resp;
-    CallResult            res = m_msg_sender.call(CERTIFICATE_SIGNED_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = (resp.status == CertificateSignedStatusEnumType::Accepted);
-        LOG_INFO << "[" << m_identifier << "] - Certificate signed : " << CertificateSignedStatusEnumTypeHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<CertificateSignedReq, CertificateSignedConf>(
+        CERTIFICATE_SIGNED_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const CertificateSignedConf& resp)
+        {
+            bool ret = false;
+            if (res == CallResult::Ok)
+            {
+                ret = (resp.status == CertificateSignedStatusEnumType::Accepted);
+                LOG_INFO << "[" << identifier << "] - Certificate signed : " << CertificateSignedStatusEnumTypeHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::DeleteCertificateStatusEnumType ICentralSystem::IChargePoint::deleteCertificate(const ocpp::types::CertificateHashDataType&) */
 ocpp::types::DeleteCertificateStatusEnumType ChargePointProxy::deleteCertificate(const ocpp::types::CertificateHashDataType& certificate)
-
 {
     DeleteCertificateStatusEnumType ret = DeleteCertificateStatusEnumType::Failed;
+    deleteCertificate(
+        certificate, [&ret](ocpp::types::DeleteCertificateStatusEnumType _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::deleteCertificateAsync(const ocpp::types::CertificateHashDataType&,
+                                                                       std::function<void(ocpp::types::DeleteCertificateStatusEnumType)>) */
+bool ChargePointProxy::deleteCertificateAsync(const ocpp::types::CertificateHashDataType&                       certificate,
+                                              std::function<void(ocpp::types::DeleteCertificateStatusEnumType)> callback)
+{
+    return deleteCertificate(certificate, callback, true);
+}
 
+/** @brief Execute a delete certificate request, the result is notified through the callback */
+bool ChargePointProxy::deleteCertificate(const ocpp::types::CertificateHashDataType&                       certificate,
+                                         std::function<void(ocpp::types::DeleteCertificateStatusEnumType)> callback,
+                                         bool                                                              async)
+{
     LOG_INFO << "[" << m_identifier << "] - Delete certificate : serialNumber = " << certificate.serialNumber.str();
 
     // Prepare request
@@ -807,19 +1420,24 @@ ocpp::types::DeleteCertificateStatusEnumType ChargePointProxy::deleteCertificate
     req.certificateHashData = certificate;
 
     // Send request
-    DeleteCertificateConf resp;
-    CallResult            res = m_msg_sender.call(DELETE_CERTIFICATE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Delete certificate : " << DeleteCertificateStatusEnumTypeHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<DeleteCertificateReq, DeleteCertificateConf>(
+        DELETE_CERTIFICATE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const DeleteCertificateConf& resp)
+        {
+            DeleteCertificateStatusEnumType ret = DeleteCertificateStatusEnumType::Failed;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Delete certificate : " << DeleteCertificateStatusEnumTypeHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::TriggerMessageStatusEnumType ICentralSystem::IChargePoint::extendedTriggerMessage(ocpp::types::MessageTriggerEnumType,
@@ -828,7 +1446,27 @@ ocpp::types::TriggerMessageStatusEnumType ChargePointProxy::extendedTriggerMessa
                                                                                    const ocpp::types::Optional<unsigned int> connector_id)
 {
     TriggerMessageStatusEnumType ret = TriggerMessageStatusEnumType::Rejected;
+    extendedTriggerMessage(
+        message, connector_id, [&ret](ocpp::types::TriggerMessageStatusEnumType _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::extendedTriggerMessageAsync(ocpp::types::MessageTriggerEnumType,
+                                                                            const ocpp::types::Optional<unsigned int>,
+                                                                            std::function<void(ocpp::types::TriggerMessageStatusEnumType)>) */
+bool ChargePointProxy::extendedTriggerMessageAsync(ocpp::types::MessageTriggerEnumType                            message,
+                                                   const ocpp::types::Optional<unsigned int>                      connector_id,
+                                                   std::function<void(ocpp::types::TriggerMessageStatusEnumType)> callback)
+{
+    return extendedTriggerMessage(message, connector_id, callback, true);
+}
 
+/** @brief Execute an extended trigger message request, the result is notified through the callback */
+bool ChargePointProxy::extendedTriggerMessage(ocpp::types::MessageTriggerEnumType                            message,
+                                              const ocpp::types::Optional<unsigned int>                      connector_id,
+                                              std::function<void(ocpp::types::TriggerMessageStatusEnumType)> callback,
+                                              bool                                                           async)
+{
     LOG_INFO << "[" << m_identifier
              << "] - Extended trigger message : requestedMessage = " << MessageTriggerEnumTypeHelper.toString(message)
              << " - connectorId = " << (connector_id.isSet() ? std::to_string(connector_id) : "not set");
@@ -839,19 +1477,24 @@ ocpp::types::TriggerMessageStatusEnumType ChargePointProxy::extendedTriggerMessa
     req.connectorId      = connector_id;
 
     // Send request
-    ExtendedTriggerMessageConf resp;
-    CallResult                 res = m_msg_sender.call(EXTENDED_TRIGGER_MESSAGE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Extended trigger message : " << TriggerMessageStatusEnumTypeHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<ExtendedTriggerMessageReq, ExtendedTriggerMessageConf>(
+        EXTENDED_TRIGGER_MESSAGE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const ExtendedTriggerMessageConf& resp)
+        {
+            TriggerMessageStatusEnumType ret = TriggerMessageStatusEnumType::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Extended trigger message : " << TriggerMessageStatusEnumTypeHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getInstalledCertificateIds(ocpp::types::CertificateUseEnumType,
@@ -860,7 +1503,31 @@ bool ChargePointProxy::getInstalledCertificateIds(ocpp::types::CertificateUseEnu
                                                   std::vector<ocpp::types::CertificateHashDataType>& certificates)
 {
     bool ret = false;
+    getInstalledCertificateIds(
+        type,
+        [&](bool                                                     _ret,
+            const std::vector<ocpp::types::CertificateHashDataType>& _certificates)
+        {
+            ret          = _ret;
+            certificates = _certificates;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::getInstalledCertificateIdsAsync(ocpp::types::CertificateUseEnumType,
+                                                                                std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)>) */
+bool ChargePointProxy::getInstalledCertificateIdsAsync(ocpp::types::CertificateUseEnumType                                                 type,
+                                                       std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)> callback)
+{
+    return getInstalledCertificateIds(type, callback, true);
+}
 
+/** @brief Execute a get installed certificate ids request, the result is notified through the callback */
+bool ChargePointProxy::getInstalledCertificateIds(ocpp::types::CertificateUseEnumType                                                 type,
+                                                  std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)> callback,
+                                                  bool                                                                                async)
+{
     LOG_INFO << "[" << m_identifier
              << "] - Get installed certificate ids : certificateType = " << CertificateUseEnumTypeHelper.toString(type);
 
@@ -869,22 +1536,28 @@ bool ChargePointProxy::getInstalledCertificateIds(ocpp::types::CertificateUseEnu
     req.certificateType = type;
 
     // Send request
-    GetInstalledCertificateIdsConf resp;
-    CallResult                     res = m_msg_sender.call(GET_INSTALLED_CERTIFICATE_IDS_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        LOG_INFO << "[" << m_identifier
-                 << "] - Get installed certificate ids : status = " << GetInstalledCertificateStatusEnumTypeHelper.toString(resp.status)
-                 << " - count = " << resp.certificateHashData.size();
-        certificates = resp.certificateHashData;
-        ret          = true;
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<GetInstalledCertificateIdsReq, GetInstalledCertificateIdsConf>(
+        GET_INSTALLED_CERTIFICATE_IDS_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetInstalledCertificateIdsConf& resp)
+        {
+            bool                                              ret = false;
+            std::vector<ocpp::types::CertificateHashDataType> certificates;
+            if (res == CallResult::Ok)
+            {
+                LOG_INFO << "[" << identifier
+                         << "] - Get installed certificate ids : status = " << GetInstalledCertificateStatusEnumTypeHelper.toString(resp.status)
+                         << " - count = " << resp.certificateHashData.size();
+                certificates = resp.certificateHashData;
+                ret          = true;
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, certificates);
+        },
+        async);
 }
 
 /** @copydoc bool ICentralSystem::IChargePoint::getLog(ocpp::types::LogEnumType,
@@ -905,7 +1578,55 @@ bool ChargePointProxy::getLog(ocpp::types::LogEnumType
                               std::string&                                        log_filename)
 {
     bool ret = false;
+    getLog(
+        type,
+        request_id,
+        uri,
+        retries,
+        retry_interval,
+        start,
+        stop,
+        [&](bool               _ret,
+            const std::string& _log_filename)
+        {
+            ret          = _ret;
+            log_filename = _log_filename;
+        },
+        false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::getLogAsync(ocpp::types::LogEnumType,
+                                                            int,
+                                                            const std::string&,
+                                                            const ocpp::types::Optional<unsigned int>&,
+                                                            const ocpp::types::Optional<std::chrono::seconds>&,
+                                                            const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                                            const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                                            std::function<void(bool, const std::string&)>) */
+bool ChargePointProxy::getLogAsync(ocpp::types::LogEnumType                            type,
+                                   int                                                 request_id,
+                                   const std::string&                                  uri,
+                                   const ocpp::types::Optional<unsigned int>&          retries,
+                                   const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                                   const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                                   const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                                   std::function<void(bool, const std::string&)>       callback)
+{
+    return getLog(type, request_id, uri, retries, retry_interval, start, stop, callback, true);
+}
 
+/** @brief Execute a get log request, the result is notified through the callback */
+bool ChargePointProxy::getLog(ocpp::types::LogEnumType                            type,
+                              int                                                 request_id,
+                              const std::string&                                  uri,
+                              const ocpp::types::Optional<unsigned int>&          retries,
+                              const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                              const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                              const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                              std::function<void(bool, const std::string&)>       callback,
+                              bool                                                async)
+{
     LOG_INFO << "[" << m_identifier << "] - Get log : type = " << LogEnumTypeHelper.toString(type) << " - request_id = " << request_id
              << " - location = " << uri << " - retries = " << (retries.isSet() ? std::to_string(retries) : "not set")
              << " - retryInterval = " << (retry_interval.isSet() ? std::to_string(retry_interval.value().count()) : "not set")
@@ -926,21 +1647,27 @@ bool ChargePointProxy::getLog(ocpp::types::LogEnumType
     req.log.latestTimestamp = stop;
 
     // Send request
-    GetLogConf resp;
-    CallResult res = m_msg_sender.call(GET_LOG_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret          = true;
-        log_filename = resp.fileName;
-        LOG_INFO << "[" << m_identifier << "] - Get log : status = " << LogStatusEnumTypeHelper.toString(resp.status)
-                 << " - filename = " << resp.fileName.str();
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<GetLogReq, GetLogConf>(
+        GET_LOG_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const GetLogConf& resp)
+        {
+            bool        ret = false;
+            std::string log_filename;
+            if (res == CallResult::Ok)
+            {
+                ret          = true;
+                log_filename = resp.fileName;
+                LOG_INFO << "[" << identifier << "] - Get log : status = " << LogStatusEnumTypeHelper.toString(resp.status)
+                         << " - filename = " << resp.fileName.str();
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret, log_filename);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::CertificateStatusEnumType ICentralSystem::installCertificate(ocpp::types::CertificateUseEnumType,
@@ -949,7 +1676,27 @@ ocpp::types::CertificateStatusEnumType ChargePointProxy::installCertificate(ocpp
                                                                             const ocpp::x509::Certificate&      certificate)
 {
     CertificateStatusEnumType ret = CertificateStatusEnumType::Rejected;
+    installCertificate(
+        type, certificate, [&ret](ocpp::types::CertificateStatusEnumType _ret) { ret = _ret; }, false);
+    return ret;
+}
+
+/** @copydoc bool ICentralSystem::IChargePoint::installCertificateAsync(ocpp::types::CertificateUseEnumType,
+                                                                        const ocpp::x509::Certificate&,
+                                                                        std::function<void(ocpp::types::CertificateStatusEnumType)>) */
+bool ChargePointProxy::installCertificateAsync(ocpp::types::CertificateUseEnumType                         type,
+                                               const ocpp::x509::Certificate&                              certificate,
+                                               std::function<void(ocpp::types::CertificateStatusEnumType)> callback)
+{
+    return installCertificate(type, certificate, callback, true);
+}
 
+/** @brief Execute an install certificate request, the result is notified through the callback */
+bool ChargePointProxy::installCertificate(ocpp::types::CertificateUseEnumType                         type,
+                                          const ocpp::x509::Certificate&                              certificate,
+                                          std::function<void(ocpp::types::CertificateStatusEnumType)> callback,
+                                          bool                                                        async)
+{
     LOG_INFO << "[" << m_identifier << "] - Install certificate : certificateType = " << CertificateUseEnumTypeHelper.toString(type)
              << " - certificate subject = " << certificate.subjectString();
 
@@ -959,19 +1706,24 @@ ocpp::types::CertificateStatusEnumType ChargePointProxy::installCertificate(ocpp
     req.certificate.assign(certificate.pem());
 
     // Send request
-    InstallCertificateConf resp;
-    CallResult             res = m_msg_sender.call(INSTALL_CERTIFICATE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Install certificate : " << CertificateStatusEnumTypeHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<InstallCertificateReq, InstallCertificateConf>(
+        INSTALL_CERTIFICATE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const InstallCertificateConf& resp)
+        {
+            CertificateStatusEnumType ret = CertificateStatusEnumType::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Install certificate : " << CertificateStatusEnumTypeHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 /** @copydoc ocpp::types::UpdateFirmwareStatusEnumType ICentralSystem::signedUpdateFirmware(
@@ -994,7 +1746,45 @@ ocpp::types::UpdateFirmwareStatusEnumType ChargePointProxy::signedUpdateFirmware
     const std::string&                                  signature)
 {
     UpdateFirmwareStatusEnumType ret = UpdateFirmwareStatusEnumType::Rejected;
+    signedUpdateFirmware(
+        request_id, uri, retries, retrieve_date, retry_interval, install_date, signing_certificate, signature, [&ret](ocpp::types::UpdateFirmwareStatusEnumType _ret) { ret = _ret; }, false);
+    return ret;
+}
 
+/** @copydoc bool ICentralSystem::IChargePoint::signedUpdateFirmwareAsync(int,
+                                                                          const std::string&,
+                                                                          const ocpp::types::Optional<unsigned int>&,
+                                                                          const ocpp::types::DateTime&,
+                                                                          const ocpp::types::Optional<std::chrono::seconds>&,
+                                                                          const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                                                          const ocpp::x509::Certificate&,
+                                                                          const std::string&,
+                                                                          std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)>) */
+bool ChargePointProxy::signedUpdateFirmwareAsync(int                                                            request_id,
+                                                 const std::string&                                             uri,
+                                                 const ocpp::types::Optional<unsigned int>&                     retries,
+                                                 const ocpp::types::DateTime&                                   retrieve_date,
+                                                 const ocpp::types::Optional<std::chrono::seconds>&             retry_interval,
+                                                 const ocpp::types::Optional<ocpp::types::DateTime>&            install_date,
+                                                 const ocpp::x509::Certificate&                                 signing_certificate,
+                                                 const std::string&                                             signature,
+                                                 std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)> callback)
+{
+    return signedUpdateFirmware(request_id, uri, retries, retrieve_date, retry_interval, install_date, signing_certificate, signature, callback, true);
+}
+
+/** @brief Execute a signed update firmware request, the result is notified through the callback */
+bool ChargePointProxy::signedUpdateFirmware(int                                                            request_id,
+                                            const std::string&                                             uri,
+                                            const ocpp::types::Optional<unsigned int>&                     retries,
+                                            const ocpp::types::DateTime&                                   retrieve_date,
+                                            const ocpp::types::Optional<std::chrono::seconds>&             retry_interval,
+                                            const ocpp::types::Optional<ocpp::types::DateTime>&            install_date,
+                                            const ocpp::x509::Certificate&                                 signing_certificate,
+                                            const std::string&                                             signature,
+                                            std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)> callback,
+                                            bool                                                           async)
+{
     LOG_INFO << "[" << m_identifier << "] - Signed firmware update : requestId = " << request_id << " - location = " << uri
              << " - retries = " << (retries.isSet() ? std::to_string(retries) : "not set")
              << " - retrieveDateTime = " << retrieve_date.str()
@@ -1017,19 +1807,24 @@ ocpp::types::UpdateFirmwareStatusEnumType ChargePointProxy::signedUpdateFirmware
     req.firmware.signature.assign(signature);
 
     // Send request
-    SignedUpdateFirmwareConf resp;
-    CallResult               res = m_msg_sender.call(SIGNED_UPDATE_FIRMWARE_ACTION, req, resp);
-    if (res == CallResult::Ok)
-    {
-        ret = resp.status;
-        LOG_INFO << "[" << m_identifier << "] - Signed firmware update : " << UpdateFirmwareStatusEnumTypeHelper.toString(resp.status);
-    }
-    else
-    {
-        LOG_ERROR << "[" << m_identifier << "] - Call failed";
-    }
-
-    return ret;
+    return call<SignedUpdateFirmwareReq, SignedUpdateFirmwareConf>(
+        SIGNED_UPDATE_FIRMWARE_ACTION,
+        req,
+        [identifier = m_identifier, callback](CallResult res, const SignedUpdateFirmwareConf& resp)
+        {
+            UpdateFirmwareStatusEnumType ret = UpdateFirmwareStatusEnumType::Rejected;
+            if (res == CallResult::Ok)
+            {
+                ret = resp.status;
+                LOG_INFO << "[" << identifier << "] - Signed firmware update : " << UpdateFirmwareStatusEnumTypeHelper.toString(resp.status);
+            }
+            else
+            {
+                LOG_ERROR << "[" << identifier << "] - Call failed";
+            }
+            callback(ret);
+        },
+        async);
 }
 
 // IRpc::IListener interface
@@ -1051,17 +1846,19 @@ void ChargePointProxy::rpcError()
 }
 
 /** @copydoc bool IRpc::IListener::rpcCallReceived(const std::string&,
-                                                       const rapidjson::Value&,
+                                                       const char*,
+                                                       size_t,
                                                        rapidjson::Document&,
                                                        const char*&,
                                                        std::string&) */
-bool ChargePointProxy::rpcCallReceived(const std::string&      action,
-                                       const rapidjson::Value& payload,
-                                       rapidjson::Document&    response,
-                                       const char*&            error_code,
-                                       std::string&            error_message)
+bool ChargePointProxy::rpcCallReceived(const std::string&   action,
+                                       const char*          payload,
+                                       size_t               size,
+                                       rapidjson::Document& response,
+                                       const char*&         error_code,
+                                       std::string&         error_message)
 {
-    return m_msg_dispatcher.dispatchMessage(action, payload, response, error_code, error_message);
+    return m_msg_dispatcher.dispatchMessage(action, payload, size, response, error_code, error_message);
 }
 
 // IRpc::ISpy interface
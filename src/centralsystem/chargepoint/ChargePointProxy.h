@@ -251,6 +251,146 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
                                                                    const ocpp::x509::Certificate&                      signing_certificate,
                                                                    const std::string&                                  signature) override;
 
+    // Asynchronous OCPP operations
+
+    /** @copydoc bool ICentralSystem::IChargePoint::cancelReservationAsync(int, std::function<void(bool)>) */
+    bool cancelReservationAsync(int reservation_id, std::function<void(bool)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::changeAvailabilityAsync(int, ocpp::types::AvailabilityType, std::function<void(ocpp::types::AvailabilityStatus)>) */
+    bool changeAvailabilityAsync(int                                                  connector_id,
+                                 ocpp::types::AvailabilityType                        availability,
+                                 std::function<void(ocpp::types::AvailabilityStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::changeConfigurationAsync(const std::string&, const std::string&, std::function<void(ocpp::types::ConfigurationStatus)>) */
+    bool changeConfigurationAsync(const std::string&                                    key,
+                                  const std::string&                                    value,
+                                  std::function<void(ocpp::types::ConfigurationStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::clearCacheAsync(std::function<void(bool)>) */
+    bool clearCacheAsync(std::function<void(bool)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::clearChargingProfileAsync(const ocpp::types::Optional<int>&, const ocpp::types::Optional<unsigned int>&, const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>&, const ocpp::types::Optional<unsigned int>&, std::function<void(bool)>) */
+    bool clearChargingProfileAsync(const ocpp::types::Optional<int>&                                     profile_id,
+                                   const ocpp::types::Optional<unsigned int>&                            connector_id,
+                                   const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>& purpose,
+                                   const ocpp::types::Optional<unsigned int>&                            stack_level,
+                                   std::function<void(bool)>                                             callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::dataTransferAsync(const std::string&, const std::string&, const std::string&, std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)>) */
+    bool dataTransferAsync(const std::string&                                                             vendor_id,
+                           const std::string&                                                             message_id,
+                           const std::string&                                                             request_data,
+                           std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getCompositeScheduleAsync(unsigned int, std::chrono::seconds, const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>&, GetCompositeScheduleCallback) */
+    bool getCompositeScheduleAsync(unsigned int                                                    connector_id,
+                                   std::chrono::seconds                                            duration,
+                                   const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>& unit,
+                                   GetCompositeScheduleCallback                                    callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getConfigurationAsync(const std::vector<std::string>&, std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)>) */
+    bool getConfigurationAsync(const std::vector<std::string>&                                                                       keys,
+                               std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getDiagnosticsAsync(const std::string&, const ocpp::types::Optional<unsigned int>&, const ocpp::types::Optional<std::chrono::seconds>&, const ocpp::types::Optional<ocpp::types::DateTime>&, const ocpp::types::Optional<ocpp::types::DateTime>&, std::function<void(bool, const std::string&)>) */
+    bool getDiagnosticsAsync(const std::string&                                  uri,
+                             const ocpp::types::Optional<unsigned int>&          retries,
+                             const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                             const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                             const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                             std::function<void(bool, const std::string&)>       callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getLocalListVersionAsync(std::function<void(bool, int)>) */
+    bool getLocalListVersionAsync(std::function<void(bool, int)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::remoteStartTransactionAsync(const ocpp::types::Optional<unsigned int>&, const std::string&, const ocpp::types::Optional<ocpp::types::ChargingProfile>&, std::function<void(bool)>) */
+    bool remoteStartTransactionAsync(const ocpp::types::Optional<unsigned int>&                 connector_id,
+                                     const std::string&                                         id_tag,
+                                     const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile,
+                                     std::function<void(bool)>                                  callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::remoteStopTransactionAsync(int, std::function<void(bool)>) */
+    bool remoteStopTransactionAsync(int transaction_id, std::function<void(bool)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::reserveNowAsync(unsigned int, const ocpp::types::DateTime&, const std::string&, const std::string&, int, std::function<void(ocpp::types::ReservationStatus)>) */
+    bool reserveNowAsync(unsigned int                                        connector_id,
+                         const ocpp::types::DateTime&                        expiry_date,
+                         const std::string&                                  id_tag,
+                         const std::string&                                  parent_id_tag,
+                         int                                                 reservation_id,
+                         std::function<void(ocpp::types::ReservationStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::resetAsync(ocpp::types::ResetType, std::function<void(bool)>) */
+    bool resetAsync(ocpp::types::ResetType type, std::function<void(bool)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::sendLocalListAsync(int, const std::vector<ocpp::types::AuthorizationData>&, ocpp::types::UpdateType, std::function<void(ocpp::types::UpdateStatus)>) */
+    bool sendLocalListAsync(int                                                version,
+                            const std::vector<ocpp::types::AuthorizationData>& authorization_list,
+                            ocpp::types::UpdateType                            update_type,
+                            std::function<void(ocpp::types::UpdateStatus)>     callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::setChargingProfileAsync(unsigned int, const ocpp::types::ChargingProfile&, std::function<void(ocpp::types::ChargingProfileStatus)>) */
+    bool setChargingProfileAsync(unsigned int                                            connector_id,
+                                 const ocpp::types::ChargingProfile&                     profile,
+                                 std::function<void(ocpp::types::ChargingProfileStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::triggerMessageAsync(ocpp::types::MessageTrigger, const ocpp::types::Optional<unsigned int>, std::function<void(ocpp::types::TriggerMessageStatus)>) */
+    bool triggerMessageAsync(ocpp::types::MessageTrigger                            message,
+                             const ocpp::types::Optional<unsigned int>              connector_id,
+                             std::function<void(ocpp::types::TriggerMessageStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::unlockConnectorAsync(unsigned int, std::function<void(ocpp::types::UnlockStatus)>) */
+    bool unlockConnectorAsync(unsigned int connector_id, std::function<void(ocpp::types::UnlockStatus)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::updateFirmwareAsync(const std::string&, const ocpp::types::Optional<unsigned int>&, const ocpp::types::DateTime&, const ocpp::types::Optional<std::chrono::seconds>&, std::function<void(bool)>) */
+    bool updateFirmwareAsync(const std::string&                                 uri,
+                             const ocpp::types::Optional<unsigned int>&         retries,
+                             const ocpp::types::DateTime&                       retrieve_date,
+                             const ocpp::types::Optional<std::chrono::seconds>& retry_interval,
+                             std::function<void(bool)>                          callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::certificateSignedAsync(const ocpp::x509::Certificate&, std::function<void(bool)>) */
+    bool certificateSignedAsync(const ocpp::x509::Certificate& certificate_chain, std::function<void(bool)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::deleteCertificateAsync(const ocpp::types::CertificateHashDataType&, std::function<void(ocpp::types::DeleteCertificateStatusEnumType)>) */
+    bool deleteCertificateAsync(const ocpp::types::CertificateHashDataType&                       certificate,
+                                std::function<void(ocpp::types::DeleteCertificateStatusEnumType)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::extendedTriggerMessageAsync(ocpp::types::MessageTriggerEnumType, const ocpp::types::Optional<unsigned int>, std::function<void(ocpp::types::TriggerMessageStatusEnumType)>) */
+    bool extendedTriggerMessageAsync(ocpp::types::MessageTriggerEnumType                            message,
+                                     const ocpp::types::Optional<unsigned int>                      connector_id,
+                                     std::function<void(ocpp::types::TriggerMessageStatusEnumType)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getInstalledCertificateIdsAsync(ocpp::types::CertificateUseEnumType, std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)>) */
+    bool getInstalledCertificateIdsAsync(ocpp::types::CertificateUseEnumType                                                 type,
+                                         std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::getLogAsync(ocpp::types::LogEnumType, int, const std::string&, const ocpp::types::Optional<unsigned int>&, const ocpp::types::Optional<std::chrono::seconds>&, const ocpp::types::Optional<ocpp::types::DateTime>&, const ocpp::types::Optional<ocpp::types::DateTime>&, std::function<void(bool, const std::string&)>) */
+    bool getLogAsync(ocpp::types::LogEnumType                            type,
+                     int                                                 request_id,
+                     const std::string&                                  uri,
+                     const ocpp::types::Optional<unsigned int>&          retries,
+                     const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                     const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                     const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                     std::function<void(bool, const std::string&)>       callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::installCertificateAsync(ocpp::types::CertificateUseEnumType, const ocpp::x509::Certificate&, std::function<void(ocpp::types::CertificateStatusEnumType)>) */
+    bool installCertificateAsync(ocpp::types::CertificateUseEnumType                         type,
+                                 const ocpp::x509::Certificate&                              certificate,
+                                 std::function<void(ocpp::types::CertificateStatusEnumType)> callback) override;
+
+    /** @copydoc bool ICentralSystem::IChargePoint::signedUpdateFirmwareAsync(int, const std::string&, const ocpp::types::Optional<unsigned int>&, const ocpp::types::DateTime&, const ocpp::types::Optional<std::chrono::seconds>&, const ocpp::types::Optional<ocpp::types::DateTime>&, const ocpp::x509::Certificate&, const std::string&, std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)>) */
+    bool signedUpdateFirmwareAsync(int                                                            request_id,
+                                   const std::string&                                             uri,
+                                   const ocpp::types::Optional<unsigned int>&                     retries,
+                                   const ocpp::types::DateTime&                                   retrieve_date,
+                                   const ocpp::types::Optional<std::chrono::seconds>&             retry_interval,
+                                   const ocpp::types::Optional<ocpp::types::DateTime>&            install_date,
+                                   const ocpp::x509::Certificate&                                 signing_certificate,
+                                   const std::string&                                             signature,
+                                   std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)> callback) override;
+
     // IRpc::IListener interface
 
     /** @copydoc void IRpc::IListener::rpcDisconnected() */
@@ -260,15 +400,17 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
     void rpcError() override;
 
     /** @copydoc bool IRpc::IListener::rpcCallReceived(const std::string&,
-                                                       const rapidjson::Value&,
+                                                       const char*,
+                                                       size_t,
                                                        rapidjson::Document&,
                                                        const char*&,
                                                        std::string&) */
-    bool rpcCallReceived(const std::string&      action,
-                         const rapidjson::Value& payload,
-                         rapidjson::Document&    response,
-                         const char*&            error_code,
-                         std::string&            error_message) override;
+    bool rpcCallReceived(const std::string&   action,
+                         const char*          payload,
+                         size_t               size,
+                         rapidjson::Document& response,
+                         const char*&         error_code,
+                         std::string&         error_message) override;
 
     // IRpc::ISpy interface
 
@@ -293,6 +435,177 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
     ChargePointHandler m_handler;
     /** @brief User request handler */
     IChargePointRequestHandler* m_user_handler;
+
+    /**
+     * @brief Execute a call request and process its result with the given handler
+     * @param action RPC action for the request
+     * @param request Request payload
+     * @param handler Handler to process the result of the call request and the response payload
+     * @param async Indicate if the call request must be asynchronous
+     * @return true if the request has been sent in asynchronous mode, always true in blocking mode
+     */
+    template <typename RequestType, typename ResponseType>
+    bool call(const std::string&                                                   action,
+              const RequestType&                                                   request,
+              std::function<void(ocpp::messages::CallResult, const ResponseType&)> handler,
+              bool                                                                 async);
+
+    /** @brief Execute a cancel reservation request, the result is notified through the callback */
+    bool cancelReservation(int reservation_id, std::function<void(bool)> callback, bool async);
+
+    /** @brief Execute a change availability request, the result is notified through the callback */
+    bool changeAvailability(int                                                  connector_id,
+                            ocpp::types::AvailabilityType                        availability,
+                            std::function<void(ocpp::types::AvailabilityStatus)> callback,
+                            bool                                                 async);
+
+    /** @brief Execute a change configuration request, the result is notified through the callback */
+    bool changeConfiguration(const std::string&                                    key,
+                             const std::string&                                    value,
+                             std::function<void(ocpp::types::ConfigurationStatus)> callback,
+                             bool                                                  async);
+
+    /** @brief Execute a clear cache request, the result is notified through the callback */
+    bool clearCache(std::function<void(bool)> callback, bool async);
+
+    /** @brief Execute a clear charging profile request, the result is notified through the callback */
+    bool clearChargingProfile(const ocpp::types::Optional<int>&                                     profile_id,
+                              const ocpp::types::Optional<unsigned int>&                            connector_id,
+                              const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>& purpose,
+                              const ocpp::types::Optional<unsigned int>&                            stack_level,
+                              std::function<void(bool)>                                             callback,
+                              bool                                                                  async);
+
+    /** @brief Execute a data transfer request, the result is notified through the callback */
+    bool dataTransfer(const std::string&                                                             vendor_id,
+                      const std::string&                                                             message_id,
+                      const std::string&                                                             request_data,
+                      std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)> callback,
+                      bool                                                                           async);
+
+    /** @brief Execute a get composite schedule request, the result is notified through the callback */
+    bool getCompositeSchedule(unsigned int                                                    connector_id,
+                              std::chrono::seconds                                            duration,
+                              const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>& unit,
+                              GetCompositeScheduleCallback                                    callback,
+                              bool                                                            async);
+
+    /** @brief Execute a get configuration request, the result is notified through the callback */
+    bool getConfiguration(const std::vector<std::string>&                                                                       keys,
+                          std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)> callback,
+                          bool                                                                                                  async);
+
+    /** @brief Execute a get diagnostics request, the result is notified through the callback */
+    bool getDiagnostics(const std::string&                                  uri,
+                        const ocpp::types::Optional<unsigned int>&          retries,
+                        const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                        const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                        const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                        std::function<void(bool, const std::string&)>       callback,
+                        bool                                                async);
+
+    /** @brief Execute a get local list version request, the result is notified through the callback */
+    bool getLocalListVersion(std::function<void(bool, int)> callback, bool async);
+
+    /** @brief Execute a remote start transaction request, the result is notified through the callback */
+    bool remoteStartTransaction(const ocpp::types::Optional<unsigned int>&                 connector_id,
+                                const std::string&                                         id_tag,
+                                const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile,
+                                std::function<void(bool)>                                  callback,
+                                bool                                                       async);
+
+    /** @brief Execute a remote stop transaction request, the result is notified through the callback */
+    bool remoteStopTransaction(int transaction_id, std::function<void(bool)> callback, bool async);
+
+    /** @brief Execute a reserve now request, the result is notified through the callback */
+    bool reserveNow(unsigned int                                        connector_id,
+                    const ocpp::types::DateTime&                        expiry_date,
+                    const std::string&                                  id_tag,
+                    const std::string&                                  parent_id_tag,
+                    int                                                 reservation_id,
+                    std::function<void(ocpp::types::ReservationStatus)> callback,
+                    bool                                                async);
+
+    /** @brief Execute a reset request, the result is notified through the callback */
+    bool reset(ocpp::types::ResetType type, std::function<void(bool)> callback, bool async);
+
+    /** @brief Execute a send local list request, the result is notified through the callback */
+    bool sendLocalList(int                                                version,
+                       const std::vector<ocpp::types::AuthorizationData>& authorization_list,
+                       ocpp::types::UpdateType                            update_type,
+                       std::function<void(ocpp::types::UpdateStatus)>     callback,
+                       bool                                               async);
+
+    /** @brief Execute a set charging profile request, the result is notified through the callback */
+    bool setChargingProfile(unsigned int                                            connector_id,
+                            const ocpp::types::ChargingProfile&                     profile,
+                            std::function<void(ocpp::types::ChargingProfileStatus)> callback,
+                            bool                                                    async);
+
+    /** @brief Execute a trigger message request, the result is notified through the callback */
+    bool triggerMessage(ocpp::types::MessageTrigger                            message,
+                        const ocpp::types::Optional<unsigned int>              connector_id,
+                        std::function<void(ocpp::types::TriggerMessageStatus)> callback,
+                        bool                                                   async);
+
+    /** @brief Execute an unlock connector request, the result is notified through the callback */
+    bool unlockConnector(unsigned int connector_id, std::function<void(ocpp::types::UnlockStatus)> callback, bool async);
+
+    /** @brief Execute an update firmware request, the result is notified through the callback */
+    bool updateFirmware(const std::string&                                 uri,
+                        const ocpp::types::Optional<unsigned int>&         retries,
+                        const ocpp::types::DateTime&                       retrieve_date,
+                        const ocpp::types::Optional<std::chrono::seconds>& retry_interval,
+                        std::function<void(bool)>                          callback,
+                        bool                                               async);
+
+    /** @brief Execute a certificate signed request, the result is notified through the callback */
+    bool certificateSigned(const ocpp::x509::Certificate& certificate_chain, std::function<void(bool)> callback, bool async);
+
+    /** @brief Execute a delete certificate request, the result is notified through the callback */
+    bool deleteCertificate(const ocpp::types::CertificateHashDataType&                       certificate,
+                           std::function<void(ocpp::types::DeleteCertificateStatusEnumType)> callback,
+                           bool                                                              async);
+
+    /** @brief Execute an extended trigger message request, the result is notified through the callback */
+    bool extendedTriggerMessage(ocpp::types::MessageTriggerEnumType                            message,
+                                const ocpp::types::Optional<unsigned int>                      connector_id,
+                                std::function<void(ocpp::types::TriggerMessageStatusEnumType)> callback,
+                                bool                                                           async);
+
+    /** @brief Execute a get installed certificate ids request, the result is notified through the callback */
+    bool getInstalledCertificateIds(ocpp::types::CertificateUseEnumType                                                 type,
+                                    std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)> callback,
+                                    bool                                                                                async);
+
+    /** @brief Execute a get log request, the result is notified through the callback */
+    bool getLog(ocpp::types::LogEnumType                            type,
+                int                                                 request_id,
+                const std::string&                                  uri,
+                const ocpp::types::Optional<unsigned int>&          retries,
+                const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                std::function<void(bool, const std::string&)>       callback,
+                bool                                                async);
+
+    /** @brief Execute an install certificate request, the result is notified through the callback */
+    bool installCertificate(ocpp::types::CertificateUseEnumType                         type,
+                            const ocpp::x509::Certificate&                              certificate,
+                            std::function<void(ocpp::types::CertificateStatusEnumType)> callback,
+                            bool                                                        async);
+
+    /** @brief Execute a signed update firmware request, the result is notified through the callback */
+    bool signedUpdateFirmware(int                                                            request_id,
+                              const std::string&                                             uri,
+                              const ocpp::types::Optional<unsigned int>&                     retries,
+                              const ocpp::types::DateTime&                                   retrieve_date,
+                              const ocpp::types::Optional<std::chrono::seconds>&             retry_interval,
+                              const ocpp::types::Optional<ocpp::types::DateTime>&            install_date,
+                              const ocpp::x509::Certificate&                                 signing_certificate,
+                              const std::string&                                             signature,
+                              std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)> callback,
+                              bool                                                           async);
 };
 
 } // namespace centralsystem
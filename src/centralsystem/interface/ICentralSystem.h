@@ -28,6 +28,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "KeyValue.h"
 #include "SecurityEvent.h"
 
+#include <functional>
 #include <memory>
 
 namespace ocpp
@@ -426,6 +427,361 @@ class ICentralSystem
             const ocpp::types::Optional<ocpp::types::DateTime>& install_date,
             const ocpp::x509::Certificate&                      signing_certificate,
             const std::string&                                  signature) = 0;
+
+        // Asynchronous OCPP operations
+        // The callbacks are called from the stack's internal threads once the response has been received
+        // or the request has timed out : they must not block and must not call the blocking operations
+
+        /** @brief Callback for the getCompositeScheduleAsync() operation */
+        typedef std::function<void(bool,
+                                   const ocpp::types::Optional<unsigned int>&,
+                                   const ocpp::types::Optional<ocpp::types::DateTime>&,
+                                   const ocpp::types::Optional<ocpp::types::ChargingSchedule>&)>
+            GetCompositeScheduleCallback;
+
+        /**
+         * @brief Cancel a reservation (asynchronous)
+         * @param reservation_id Id of the reservation
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the reservation has been canceled, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool cancelReservationAsync(int reservation_id, std::function<void(bool)> callback) = 0;
+
+        /**
+         * @brief Change the availability state of a connector (asynchronous)
+         * @param connector_id Id of the connector
+         * @param availability Availability state (see AvailabilityType documentation)
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see AvailabilityStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool changeAvailabilityAsync(int                                                  connector_id,
+                                             ocpp::types::AvailabilityType                        availability,
+                                             std::function<void(ocpp::types::AvailabilityStatus)> callback) = 0;
+
+        /**
+         * @brief Change the value of a configuration key (asynchronous)
+         * @param key Configuration key to change
+         * @param value New value
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see ConfigurationStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool changeConfigurationAsync(const std::string&                                    key,
+                                              const std::string&                                    value,
+                                              std::function<void(ocpp::types::ConfigurationStatus)> callback) = 0;
+
+        /**
+         * @brief Clear the authentication cache (asynchronous)
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the cache has been cleared, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool clearCacheAsync(std::function<void(bool)> callback) = 0;
+
+        /**
+         * @brief Clear 1 or more charging profiles (asynchronous)
+         * @param profile_id Id of the profile
+         * @param connector_id Id of the connector
+         * @param purpose Purpose of the charging profile
+         * @param stack_level Stack level of the charging profile
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if at least one charging profile has been cleared, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool clearChargingProfileAsync(const ocpp::types::Optional<int>&                                     profile_id,
+                                               const ocpp::types::Optional<unsigned int>&                            connector_id,
+                                               const ocpp::types::Optional<ocpp::types::ChargingProfilePurposeType>& purpose,
+                                               const ocpp::types::Optional<unsigned int>&                            stack_level,
+                                               std::function<void(bool)>                                             callback) = 0;
+
+        /**
+         * @brief Send a data transfer request (asynchronous)
+         * @param vendor_id Identifies the vendor specific implementation
+         * @param message_id Identifies the message
+         * @param request_data Data associated to the request
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the data transfer has been done, false otherwise
+         *                 - status : Response status (see DataTransferStatus documentation)
+         *                 - response_data : Data associated with the response
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool dataTransferAsync(const std::string&                                                             vendor_id,
+                                       const std::string&                                                             message_id,
+                                       const std::string&                                                             request_data,
+                                       std::function<void(bool, ocpp::types::DataTransferStatus, const std::string&)> callback) = 0;
+
+        /**
+         * @brief Get a smart charging composite schedule (asynchronous)
+         * @param connector_id Id of the connector for which the schedule is requested
+         * @param duration Length of the requested schedule
+         * @param unit Charging rate unit for the schedule
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the composite schedule has been computed, false otherwise
+         *                 - schedule_connector_id : Connector on which the schedule applies
+         *                 - schedule_start : Periods contained in the scheduleare relative to this point in time
+         *                 - schedule : Computed composite schedule
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getCompositeScheduleAsync(unsigned int                                                    connector_id,
+                                               std::chrono::seconds                                            duration,
+                                               const ocpp::types::Optional<ocpp::types::ChargingRateUnitType>& unit,
+                                               GetCompositeScheduleCallback                                    callback) = 0;
+
+        /**
+         * @brief Get the value of the configuration keys (asynchronous)
+         * @param keys List of configuration keys to retrieve (empty = whole configuration)
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the configuration has been retrieved, false otherwise
+         *                 - config_keys : Configuration keys with their values
+         *                 - unknown_keys : Unknown configuration keys
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getConfigurationAsync(const std::vector<std::string>&                                                                       keys,
+                                           std::function<void(bool, const std::vector<ocpp::types::KeyValue>&, const std::vector<std::string>&)> callback) = 0;
+
+        /**
+         * @brief Get the diagnostic file (asynchronous)
+         * @param uri URI where the diagnostic file shall be uploaded
+         * @param retries Number of retries
+         * @param retry_interval Interval between 2 retries
+         * @param start Date and time of the oldest logging information to include in the diagnostics
+         * @param stop Date and time of the latest logging information to include in the diagnostics
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the operation has started, false otherwise
+         *                 - diagnotic_filename : Name of the diagnostic file which will be uploaded
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getDiagnosticsAsync(const std::string&                                  uri,
+                                         const ocpp::types::Optional<unsigned int>&          retries,
+                                         const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                                         const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                                         const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                                         std::function<void(bool, const std::string&)>       callback) = 0;
+
+        /**
+         * @brief Get the version of the local authorization list (asynchronous)
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the version has been retrieved, false otherwise
+         *                 - version : Version of the local authorization list
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getLocalListVersionAsync(std::function<void(bool, int)> callback) = 0;
+
+        /**
+         * @brief Send a remote start transaction request (asynchronous)
+         * @param connector_id Connector on which to start the transaction
+         * @param id_tag Identifier that charge point must use to start a transaction
+         * @param profile Profile to be used for the requested transaction
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the request has been accepted, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool remoteStartTransactionAsync(const ocpp::types::Optional<unsigned int>&                 connector_id,
+                                                 const std::string&                                         id_tag,
+                                                 const ocpp::types::Optional<ocpp::types::ChargingProfile>& profile,
+                                                 std::function<void(bool)>                                  callback) = 0;
+
+        /**
+         * @brief Send a remote stop transaction request (asynchronous)
+         * @param transaction_id Id of the transaction to stop
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the request has been accepted, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool remoteStopTransactionAsync(int transaction_id, std::function<void(bool)> callback) = 0;
+
+        /**
+         * @brief Reserve a connector (asynchronous)
+         * @param connector_id Id of the connector to be reserved
+         * @param expiry_date Date and time when the reservation ends
+         * @param id_tag Identifier for which the Charge Point has to reserve a connector
+         * @param parent_id_tag Parent id tag
+         * @param reservation_id Unique id for this reservation
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see ReservationStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool reserveNowAsync(unsigned int                                        connector_id,
+                                     const ocpp::types::DateTime&                        expiry_date,
+                                     const std::string&                                  id_tag,
+                                     const std::string&                                  parent_id_tag,
+                                     int                                                 reservation_id,
+                                     std::function<void(ocpp::types::ReservationStatus)> callback) = 0;
+
+        /**
+         * @brief Reset the charge point (asynchronous)
+         * @param type Type of reset
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the request has been accepted, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool resetAsync(ocpp::types::ResetType type, std::function<void(bool)> callback) = 0;
+
+        /**
+         * @brief Send or upgrade a local authorization list (asynchronous)
+         * @param version Version number of the list
+         * @param authorization_list New local authorization list of differential update
+         * @param update_type Update type
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see UpdateStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool sendLocalListAsync(int                                                version,
+                                        const std::vector<ocpp::types::AuthorizationData>& authorization_list,
+                                        ocpp::types::UpdateType                            update_type,
+                                        std::function<void(ocpp::types::UpdateStatus)>     callback) = 0;
+
+        /**
+         * @brief Set a charging profile in the charge point (asynchronous)
+         * @param connector_id Id of the connector for which the charging profile applies
+         * @param profile Charging profile to apply
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see ChargingProfileStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool setChargingProfileAsync(unsigned int                                            connector_id,
+                                             const ocpp::types::ChargingProfile&                     profile,
+                                             std::function<void(ocpp::types::ChargingProfileStatus)> callback) = 0;
+
+        /**
+         * @brief Request the send of a specific message (asynchronous)
+         * @param message Requested message
+         * @param connector_id Id of the connector on which the message applies
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see TriggerMessageStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool triggerMessageAsync(ocpp::types::MessageTrigger                            message,
+                                         const ocpp::types::Optional<unsigned int>              connector_id,
+                                         std::function<void(ocpp::types::TriggerMessageStatus)> callback) = 0;
+
+        /**
+         * @brief Unlock a connector (asynchronous)
+         * @param connector_id Id of the connector to unlock
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see UnlockStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool unlockConnectorAsync(unsigned int connector_id, std::function<void(ocpp::types::UnlockStatus)> callback) = 0;
+
+        /**
+         * @brief Update the firmware of the charge point (asynchronous)
+         * @param uri URI where to download the firmware
+         * @param retries Number of retries
+         * @param retrieve_date Date and time after which the charge point is allowed to download the firmware
+         * @param retry_interval Interval between 2 retries
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the operation has started, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool updateFirmwareAsync(const std::string&                                 uri,
+                                         const ocpp::types::Optional<unsigned int>&         retries,
+                                         const ocpp::types::DateTime&                       retrieve_date,
+                                         const ocpp::types::Optional<std::chrono::seconds>& retry_interval,
+                                         std::function<void(bool)>                          callback) = 0;
+
+        /**
+         * @brief Send a generated certificate chain after a SignCertificate request from the charge point (asynchronous)
+         * @param certificate_chain Generated certificate chain
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the certificate chain has been accepted by the charge point, false otherwise
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool certificateSignedAsync(const ocpp::x509::Certificate& certificate_chain, std::function<void(bool)> callback) = 0;
+
+        /**
+         * @brief Delete an installed CA certificate (asynchronous)
+         * @param certificate Certificate information
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see DeleteCertificateStatusEnumType documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool deleteCertificateAsync(const ocpp::types::CertificateHashDataType&                       certificate,
+                                            std::function<void(ocpp::types::DeleteCertificateStatusEnumType)> callback) = 0;
+
+        /**
+         * @brief Request the send of a specific message (asynchronous)
+         * @param message Requested message
+         * @param connector_id Id of the connector on which the message applies
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see TriggerMessageStatus documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool extendedTriggerMessageAsync(ocpp::types::MessageTriggerEnumType                            message,
+                                                 const ocpp::types::Optional<unsigned int>                      connector_id,
+                                                 std::function<void(ocpp::types::TriggerMessageStatusEnumType)> callback) = 0;
+
+        /**
+         * @brief Get the list of installed CA certificates (asynchronous)
+         * @param type Type of CA certificate
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true is the list has been retrieved, false otherwise
+         *                 - certificates : Certificates information
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getInstalledCertificateIdsAsync(ocpp::types::CertificateUseEnumType                                                 type,
+                                                     std::function<void(bool, const std::vector<ocpp::types::CertificateHashDataType>&)> callback) = 0;
+
+        /**
+         * @brief Get the log file (asynchronous)
+         * @param type Type of log to retrieve
+         * @param request_id Id of the request
+         * @param uri URI where the log file shall be uploaded
+         * @param retries Number of retries
+         * @param retry_interval Interval between 2 retries
+         * @param start Date and time of the oldest logging information to include in the diagnostics
+         * @param stop Date and time of the latest logging information to include in the diagnostics
+         * @param callback Callback called when the operation is over with :
+         *                 - result : true if the operation has started, false otherwise
+         *                 - log_filename : Name of the diagnostic file which will be uploaded
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool getLogAsync(ocpp::types::LogEnumType                            type,
+                                 int                                                 request_id,
+                                 const std::string&                                  uri,
+                                 const ocpp::types::Optional<unsigned int>&          retries,
+                                 const ocpp::types::Optional<std::chrono::seconds>&  retry_interval,
+                                 const ocpp::types::Optional<ocpp::types::DateTime>& start,
+                                 const ocpp::types::Optional<ocpp::types::DateTime>& stop,
+                                 std::function<void(bool, const std::string&)>       callback) = 0;
+
+        /**
+         * @brief Install a CA certificate (asynchronous)
+         * @param type Type of CA certificate
+         * @param certificate CA certificate to install
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see CertificateStatusEnumType documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool installCertificateAsync(ocpp::types::CertificateUseEnumType                         type,
+                                             const ocpp::x509::Certificate&                              certificate,
+                                             std::function<void(ocpp::types::CertificateStatusEnumType)> callback) = 0;
+
+        /**
+         * @brief Update the firmware of the charge point (asynchronous)
+         * @param request_id Id of the request
+         * @param uri URI where to download the firmware
+         * @param retries Number of retries
+         * @param retrieve_date Date and time at which the charge point must download the firmware
+         * @param retry_interval Interval between 2 retries
+         * @param install_date Date and time at which the charge point must install the firmware
+         * @param signing_certificate Certificate with which the firmware was signed
+         * @param signature Base64 encoded firmware signature
+         * @param callback Callback called when the operation is over with :
+         *                 - result : Operation status (see UpdateFirmwareStatusEnumType documentation)
+         * @return true if the request has been sent (the callback will then be called), false otherwise
+         */
+        virtual bool signedUpdateFirmwareAsync(int                                                            request_id,
+                                               const std::string&                                             uri,
+                                               const ocpp::types::Optional<unsigned int>&                     retries,
+                                               const ocpp::types::DateTime&                                   retrieve_date,
+                                               const ocpp::types::Optional<std::chrono::seconds>&             retry_interval,
+                                               const ocpp::types::Optional<ocpp::types::DateTime>&            install_date,
+                                               const ocpp::x509::Certificate&                                 signing_certificate,
+                                               const std::string&                                             signature,
+                                               std::function<void(ocpp::types::UpdateFirmwareStatusEnumType)> callback) = 0;
     };
 };
 
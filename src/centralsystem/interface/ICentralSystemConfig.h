@@ -38,8 +38,17 @@ class ICentralSystemConfig
 
     /** @brief Path to the database to store persistent data */
     virtual std::string databasePath() const = 0;
+    /** @brief Enable the write-ahead log journal mode of the database */
+    virtual bool databaseWalMode() const = 0;
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    virtual std::string databaseSynchronousMode() const = 0;
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath()
+     *         (empty = file next to databasePath() with a "_logs" suffix) */
+    virtual std::string logDatabasePath() const { return ""; }
     /** @brief Path to the JSON schemas to validate the messages */
     virtual std::string jsonSchemasPath() const = 0;
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    virtual unsigned int workerThreadCount() const = 0;
 
     // Communication parameters
 
@@ -47,6 +56,14 @@ class ICentralSystemConfig
     virtual std::string listenUrl() const = 0;
     /** @brief Call request timeout */
     virtual std::chrono::milliseconds callRequestTimeout() const = 0;
+    /** @brief Allow several call requests to be in flight at the same time on a charge point connection */
+    virtual bool callRequestsPipelining() const = 0;
+    /** @brief Number of threads shared by all the charge point connections to process the incoming call requests (0 = one thread per connection) */
+    virtual unsigned int incomingCallsThreadCount() const = 0;
+    /** @brief Number of threads servicing the websocket connections (TLS handshakes, encryption and frames processing) */
+    virtual unsigned int webSocketServiceThreadCount() const = 0;
+    /** @brief Maximum size in bytes of a received websocket message */
+    virtual unsigned int webSocketMaxMessageSize() const = 0;
     /** @brief Websocket PING interval */
     virtual std::chrono::seconds webSocketPingInterval() const = 0;
     /** @brief Boot notification retry interval */
@@ -76,6 +93,8 @@ class ICentralSystemConfig
 
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     virtual unsigned int logMaxEntriesCount() const = 0;
+    /** @brief Size of the queue of the asynchronous logs (0 = synchronous logs) */
+    virtual unsigned int logAsyncQueueSize() const { return 0; }
 };
 
 } // namespace config
@@ -22,6 +22,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "DataTransferManager.h"
 #include "GenericMessageSender.h"
 #include "InternalConfigKeys.h"
+#include "LogDatabase.h"
 #include "Logger.h"
 #include "MaintenanceManager.h"
 #include "MessageDispatcher.h"
@@ -55,8 +56,8 @@ std::unique_ptr<IChargePoint> IChargePoint::create(const ocpp::config::IChargePo
                                                    IChargePointEventsHandler&              events_handler)
 {
     std::shared_ptr<ocpp::helpers::ITimerPool>       timer_pool(new ocpp::helpers::TimerPool());
-    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool =
-        std::make_shared<ocpp::helpers::WorkerThreadPool>(2u); // 1 asynchronous timer operations + 1 for asynchronous jobs/responses
+    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool = std::make_shared<ocpp::helpers::WorkerThreadPool>(
+        ocpp::helpers::WorkerThreadPool::computeThreadCount(stack_config.workerThreadCount()));
     return std::unique_ptr<IChargePoint>(new ChargePoint(stack_config, ocpp_config, events_handler, timer_pool, worker_pool));
 }
 
@@ -82,9 +83,10 @@ ChargePoint::ChargePoint(const ocpp::config::IChargePointConfig&          stack_
       m_timer_pool(timer_pool),
       m_worker_pool(worker_pool),
       m_database(),
+      m_log_database(),
       m_internal_config(m_database),
       m_messages_converter(),
-      m_requests_fifo(m_database),
+      m_requests_fifo(m_stack_config, m_database),
       m_security_manager(
           m_stack_config, m_ocpp_config, m_database, m_events_handler, *m_worker_pool.get(), m_messages_converter, m_requests_fifo, *this),
       m_reconnect_scheduled(false),
@@ -110,15 +112,18 @@ ChargePoint::ChargePoint(const ocpp::config::IChargePointConfig&          stack_
       m_total_uptime(0),
       m_total_disconnected_time(0)
 {
-    // Open database
-    if (m_database.open(m_stack_config.databasePath()))
+    // Asynchronous logs
+    if (m_stack_config.logAsyncQueueSize() != 0)
     {
-        // Register logger
-        if (m_stack_config.logMaxEntriesCount() != 0)
-        {
-            ocpp::log::Logger::registerDefaultLogger(m_database, m_stack_config.logMaxEntriesCount());
-        }
+        ocpp::log::Logger::startAsyncMode(m_stack_config.logAsyncQueueSize());
+    }
 
+    // Register logger
+    initLogDatabase();
+
+    // Open database
+    if (m_database.open(m_stack_config.databasePath(), m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
+    {
         // Initialize the database
         initDatabase();
     }
@@ -138,6 +143,9 @@ ChargePoint::ChargePoint(const ocpp::config::IChargePointConfig&          stack_
 ChargePoint::~ChargePoint()
 {
     stop();
+
+    // Write the pending logs while the database is still opened and detach the logger from it
+    ocpp::log::Logger::unregisterLoggers(m_log_database);
 }
 
 /** @copydoc bool IChargePoint::resetData() */
@@ -151,26 +159,23 @@ bool ChargePoint::resetData()
         LOG_INFO << "Reset all data";
 
         // Unregister logger
-        if (m_stack_config.logMaxEntriesCount() != 0)
-        {
-            ocpp::log::Logger::unregisterDefaultLogger();
-        }
+        ocpp::log::Logger::unregisterLoggers(m_log_database);
 
-        // Close database to invalid existing connexions
+        // Close databases to invalid existing connexions
         m_database.close();
+        m_log_database.close();
+
+        // Delete log database
+        std::error_code error;
+        std::filesystem::remove(ocpp::log::LogDatabase::path(m_stack_config.databasePath(), m_stack_config.logDatabasePath()), error);
+        initLogDatabase();
 
         // Delete database
         if (std::filesystem::remove(m_stack_config.databasePath()))
         {
             // Open database
-            if (m_database.open(m_stack_config.databasePath()))
+            if (m_database.open(m_stack_config.databasePath(), m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
             {
-                // Register logger
-                if (m_stack_config.logMaxEntriesCount() != 0)
-                {
-                    ocpp::log::Logger::registerDefaultLogger(m_database, m_stack_config.logMaxEntriesCount());
-                }
-
                 // Re-initialize with default values
                 m_total_uptime            = 0;
                 m_total_disconnected_time = 0;
@@ -225,8 +230,10 @@ bool ChargePoint::start()
         m_uptime_timer.start(std::chrono::seconds(1u));
 
         // Allocate resources
-        m_ws_client  = std::unique_ptr<ocpp::websockets::IWebsocketClient>(ocpp::websockets::WebsocketFactory::newClient());
-        m_rpc_client = std::make_unique<ocpp::rpc::RpcClient>(*m_ws_client, "ocpp1.6");
+        m_ws_client  = std::unique_ptr<ocpp::websockets::IWebsocketClient>(
+            ocpp::websockets::WebsocketFactory::newClient(m_stack_config.webSocketMaxMessageSize()));
+        m_rpc_client = std::make_unique<ocpp::rpc::RpcClient>(*m_ws_client, "ocpp1.6", m_timer_pool.get());
+        m_rpc_client->setStrictOrdering(!m_stack_config.callRequestsPipelining());
         m_rpc_client->registerListener(*this);
         m_rpc_client->registerClientListener(*this);
         m_rpc_client->registerSpy(*this);
@@ -301,7 +308,8 @@ bool ChargePoint::start()
                                                                      *m_trigger_manager,
                                                                      m_security_manager);
 
-        m_requests_fifo_manager = std::make_unique<RequestFifoManager>(m_ocpp_config,
+        m_requests_fifo_manager = std::make_unique<RequestFifoManager>(m_stack_config,
+                                                                       m_ocpp_config,
                                                                        m_events_handler,
                                                                        *m_timer_pool.get(),
                                                                        *m_worker_pool.get(),
@@ -789,17 +797,19 @@ void ChargePoint::rpcError()
 }
 
 /** @copydoc void IRpc::IListener::rpcCallReceived(const std::string&,
-                                                   const rapidjson::Value&,
+                                                   const char*,
+                                                   size_t,
                                                    rapidjson::Document&,
                                                    const char*&,
                                                    std::string&) */
-bool ChargePoint::rpcCallReceived(const std::string&      action,
-                                  const rapidjson::Value& payload,
-                                  rapidjson::Document&    response,
-                                  const char*&            error_code,
-                                  std::string&            error_message)
+bool ChargePoint::rpcCallReceived(const std::string&   action,
+                                  const char*          payload,
+                                  size_t               size,
+                                  rapidjson::Document& response,
+                                  const char*&         error_code,
+                                  std::string&         error_message)
 {
-    return m_msg_dispatcher->dispatchMessage(action, payload, response, error_code, error_message);
+    return m_msg_dispatcher->dispatchMessage(action, payload, size, response, error_code, error_message);
 }
 
 /** @copydoc void IRpc::ISpy::rcpMessageReceived(const std::string&) */
@@ -845,9 +855,32 @@ void ChargePoint::configurationValueChanged(const std::string& key)
     }
 }
 
+/** @brief Open the log database and register the default logger */
+void ChargePoint::initLogDatabase()
+{
+    if (m_stack_config.logMaxEntriesCount() != 0)
+    {
+        std::string path = ocpp::log::LogDatabase::path(m_stack_config.databasePath(), m_stack_config.logDatabasePath());
+        if (m_log_database.open(path, m_stack_config.databaseWalMode(), m_stack_config.databaseSynchronousMode()))
+        {
+            ocpp::log::Logger::registerDefaultLogger(m_log_database, m_stack_config.logMaxEntriesCount());
+        }
+        else
+        {
+            LOG_ERROR << "Unable to open log database";
+        }
+    }
+}
+
 /** @brief Initialize the database */
 void ChargePoint::initDatabase()
 {
+    // The logs were stored in the stack's database by the previous versions
+    auto drop_query = m_database.query("DROP TABLE IF EXISTS " DEFAULT_LOG_NAME ";");
+    if (drop_query.get())
+    {
+        drop_query->exec();
+    }
 
     // Initialize internal configuration
     m_internal_config.initDatabaseTable();
@@ -921,7 +954,7 @@ void ChargePoint::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&ChargePoint::saveUptime, this));
+        m_worker_pool->post(std::bind(&ChargePoint::saveUptime, this));
     }
 }
 
@@ -941,7 +974,7 @@ void ChargePoint::scheduleReconnect()
     if (!m_reconnect_scheduled)
     {
         m_reconnect_scheduled = true;
-        m_worker_pool->run<void>(
+        m_worker_pool->post(
             [this]
             {
                 // Wait to let some time to configure other parameters
@@ -191,15 +191,17 @@ class ChargePoint : public IChargePoint,
     void rpcError() override;
 
     /** @copydoc void IRpc::IListener::rpcCallReceived(const std::string&,
-                                                       const rapidjson::Value&,
+                                                       const char*,
+                                                       size_t,
                                                        rapidjson::Document&,
                                                        const char*&,
                                                        std::string&) */
-    bool rpcCallReceived(const std::string&      action,
-                         const rapidjson::Value& payload,
-                         rapidjson::Document&    response,
-                         const char*&            error_code,
-                         std::string&            error_message) override;
+    bool rpcCallReceived(const std::string&   action,
+                         const char*          payload,
+                         size_t               size,
+                         rapidjson::Document& response,
+                         const char*&         error_code,
+                         std::string&         error_message) override;
 
     /// IRpc::ISpy interface
 
@@ -229,6 +231,8 @@ class ChargePoint : public IChargePoint,
 
     /** @brief Database */
     ocpp::database::Database m_database;
+    /** @brief Database to store the logs (own connection so that logging never waits for the transactions on m_database) */
+    ocpp::database::Database m_log_database;
     /** @brief Internal configuration manager */
     ocpp::config::InternalConfigManager m_internal_config;
 
@@ -289,6 +293,8 @@ class ChargePoint : public IChargePoint,
 
     /** @brief Initialize the database */
     void initDatabase();
+    /** @brief Open the log database and register the default logger */
+    void initLogDatabase();
     /** @brief Process uptime */
     void processUptime();
     /** @brief Save the uptime counter in database */
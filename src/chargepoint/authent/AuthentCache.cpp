@@ -46,7 +46,11 @@ AuthentCache::AuthentCache(const ocpp::config::IChargePointConfig&         stack
       m_find_query(),
       m_delete_query(),
       m_insert_query(),
-      m_update_query()
+      m_update_query(),
+      m_memory_index_enabled(stack_config.authentInMemoryIndex()),
+      m_memory_index_mutex(),
+      m_memory_index(),
+      m_memory_index_ids()
 {
     initDatabaseTable();
     msg_dispatcher.registerHandler(CLEAR_CACHE_ACTION, *this);
@@ -86,12 +90,46 @@ bool AuthentCache::handleMessage(const ocpp::messages::ClearCacheReq& request,
     return true;
 }
 
+/** @brief Fill a tag information from a database query result (columns : id, tag, parent, expiry, status) */
+static void fillTagInfo(Database::Query& query, IdTagInfo& tag_info)
+{
+    if (!query.isNull(3))
+    {
+        tag_info.expiryDate = DateTime(query.getInt64(3));
+    }
+    else
+    {
+        tag_info.expiryDate.clear();
+    }
+    std::string parent = query.getString(2);
+    if (!parent.empty())
+    {
+        tag_info.parentIdTag.value().assign(parent);
+    }
+    else
+    {
+        tag_info.parentIdTag.clear();
+    }
+    tag_info.status = static_cast<AuthorizationStatus>(query.getInt32(4));
+}
+
 /** @brief Look for a tag id in the cache */
 bool AuthentCache::check(const std::string& id_tag, ocpp::types::IdTagInfo& tag_info)
 {
     bool ret = false;
 
-    if (m_find_query)
+    if (m_memory_index_enabled)
+    {
+        // Look into the in-memory index
+        std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+        auto                        iter = m_memory_index.find(id_tag);
+        if (iter != m_memory_index.end())
+        {
+            tag_info = iter->second.second;
+            ret      = true;
+        }
+    }
+    else if (m_find_query)
     {
         // Execute query
         m_find_query->bind(0, id_tag);
@@ -102,44 +140,36 @@ bool AuthentCache::check(const std::string& id_tag, ocpp::types::IdTagInfo& tag_
             if (ret)
             {
                 // Extract data
-                bool        expiry_valid = !m_find_query->isNull(3);
-                std::time_t expiry       = m_find_query->getInt64(3);
-                if (expiry_valid)
-                {
-                    tag_info.expiryDate = DateTime(expiry);
-                }
-                else
-                {
-                    tag_info.expiryDate.clear();
-                }
-                std::string parent = m_find_query->getString(2);
-                if (!parent.empty())
-                {
-                    tag_info.parentIdTag.value().assign(parent);
-                }
-                else
-                {
-                    tag_info.parentIdTag.clear();
-                }
-                tag_info.status = static_cast<AuthorizationStatus>(m_find_query->getInt32(4));
-
-                // Check expiry date
-                std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-                if (expiry_valid && (expiry < now))
-                {
-                    // Entry is no more valid, delete entry
-                    if (m_delete_query)
-                    {
-                        m_delete_query->reset();
-                        m_delete_query->bind(0, id_tag);
-                        m_delete_query->exec();
-                    }
-                    ret = false;
-                }
+                fillTagInfo(*m_find_query, tag_info);
             }
         }
         m_find_query->reset();
     }
+
+    // Check expiry date
+    std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    if (ret && tag_info.expiryDate.isSet() && (tag_info.expiryDate.value().timestamp() < now))
+    {
+        // Entry is no more valid, delete entry
+        if (m_delete_query)
+        {
+            m_delete_query->reset();
+            m_delete_query->bind(0, id_tag);
+            m_delete_query->exec();
+        }
+        if (m_memory_index_enabled)
+        {
+            std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+            auto                        iter = m_memory_index.find(id_tag);
+            if (iter != m_memory_index.end())
+            {
+                m_memory_index_ids.erase(iter->second.first);
+                m_memory_index.erase(iter);
+            }
+        }
+        ret = false;
+    }
+
     return ret;
 }
 
@@ -149,39 +179,49 @@ void AuthentCache::update(const std::string& id_tag, const ocpp::types::IdTagInf
     // Look for the entry
     if (m_find_query)
     {
+        // Convert status
+        IdTagInfo cached_tag_info = tag_info;
+        if (cached_tag_info.status == AuthorizationStatus::ConcurrentTx)
+        {
+            cached_tag_info.status = AuthorizationStatus::Accepted;
+        }
+        if (cached_tag_info.parentIdTag.isSet() && cached_tag_info.parentIdTag.value().empty())
+        {
+            cached_tag_info.parentIdTag.clear();
+        }
+
+        // The insert and the retrieval of its id must not be interleaved with other queries
+        Database::Transaction transaction(m_database);
+        int64_t               entry  = 0;
+        bool                  stored = false;
+
         // Execute query
         m_find_query->bind(0, id_tag);
         if (m_find_query->exec())
         {
-            // Convert status
-            AuthorizationStatus status = tag_info.status;
-            if (status == AuthorizationStatus::ConcurrentTx)
-            {
-                status = AuthorizationStatus::Accepted;
-            }
             if (m_find_query->hasRows())
             {
                 // Update entry
                 if (m_update_query)
                 {
-                    int entry = m_find_query->getInt32(0);
-                    if (tag_info.parentIdTag.isSet())
+                    entry = m_find_query->getInt64(0);
+                    if (cached_tag_info.parentIdTag.isSet())
                     {
-                        m_update_query->bind(0, tag_info.parentIdTag.value());
+                        m_update_query->bind(0, cached_tag_info.parentIdTag.value());
                     }
                     else
                     {
                         m_update_query->bind(0, "");
                     }
-                    if (tag_info.expiryDate.isSet())
+                    if (cached_tag_info.expiryDate.isSet())
                     {
-                        m_update_query->bind(1, tag_info.expiryDate.value().timestamp());
+                        m_update_query->bind(1, cached_tag_info.expiryDate.value().timestamp());
                     }
                     else
                     {
                         m_update_query->bind(1);
                     }
-                    m_update_query->bind(2, static_cast<int>(status));
+                    m_update_query->bind(2, static_cast<int>(cached_tag_info.status));
                     m_update_query->bind(3, entry);
                     if (!m_update_query->exec())
                     {
@@ -190,6 +230,7 @@ void AuthentCache::update(const std::string& id_tag, const ocpp::types::IdTagInf
                     else
                     {
                         LOG_DEBUG << "IdTag [" << id_tag << "] updated";
+                        stored = true;
                     }
                     m_update_query->reset();
                 }
@@ -199,23 +240,23 @@ void AuthentCache::update(const std::string& id_tag, const ocpp::types::IdTagInf
                 if (m_insert_query)
                 {
                     m_insert_query->bind(0, id_tag);
-                    if (tag_info.parentIdTag.isSet())
+                    if (cached_tag_info.parentIdTag.isSet())
                     {
-                        m_insert_query->bind(1, tag_info.parentIdTag.value());
+                        m_insert_query->bind(1, cached_tag_info.parentIdTag.value());
                     }
                     else
                     {
                         m_insert_query->bind(1, "");
                     }
-                    if (tag_info.expiryDate.isSet())
+                    if (cached_tag_info.expiryDate.isSet())
                     {
-                        m_insert_query->bind(2, tag_info.expiryDate.value().timestamp());
+                        m_insert_query->bind(2, cached_tag_info.expiryDate.value().timestamp());
                     }
                     else
                     {
                         m_insert_query->bind(2);
                     }
-                    m_insert_query->bind(3, static_cast<int>(status));
+                    m_insert_query->bind(3, static_cast<int>(cached_tag_info.status));
                     if (!m_insert_query->exec())
                     {
                         LOG_ERROR << "Could not insert idTag [" << id_tag << "]";
@@ -223,12 +264,29 @@ void AuthentCache::update(const std::string& id_tag, const ocpp::types::IdTagInf
                     else
                     {
                         LOG_DEBUG << "IdTag [" << id_tag << "] inserted";
+                        entry  = m_database.lastInsertRowId();
+                        stored = true;
                     }
                     m_insert_query->reset();
                 }
             }
         }
         m_find_query->reset();
+
+        if (stored && transaction.commit() && m_memory_index_enabled)
+        {
+            // Update the in-memory index and apply the same rotation as the database table
+            std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+            m_memory_index[id_tag]    = std::make_pair(entry, cached_tag_info);
+            m_memory_index_ids[entry] = id_tag;
+
+            int64_t oldest_id = entry - static_cast<int64_t>(m_stack_config.authentCacheMaxEntriesCount());
+            while (!m_memory_index_ids.empty() && (m_memory_index_ids.begin()->first <= oldest_id))
+            {
+                m_memory_index.erase(m_memory_index_ids.begin()->second);
+                m_memory_index_ids.erase(m_memory_index_ids.begin());
+            }
+        }
     }
 }
 
@@ -250,12 +308,38 @@ void AuthentCache::initDatabaseTable()
             LOG_ERROR << "Could not create authent cache table : " << query->lastError();
         }
     }
+
+    // Unique index on tags, the duplicates which may exist in databases of previous versions
+    // are removed before its creation (most recent entry is kept)
+    query = m_database.query("SELECT name FROM sqlite_master WHERE type='index' AND name='AuthentCache_tag';");
+    if (query && query->exec() && !query->hasRows())
+    {
+        query = m_database.query("DELETE FROM AuthentCache WHERE id NOT IN (SELECT MAX(id) FROM AuthentCache GROUP BY tag);");
+        if (query)
+        {
+            query->exec();
+        }
+        query = m_database.query("CREATE UNIQUE INDEX AuthentCache_tag ON AuthentCache([tag]);");
+        if (query)
+        {
+            if (!query->exec())
+            {
+                LOG_ERROR << "Could not create authent cache index : " << query->lastError();
+            }
+        }
+    }
+
+    // Rotation in constant time using the ids (see LogDatabase)
+    query = m_database.query("DROP TRIGGER IF EXISTS delete_oldest_AuthentCache;");
+    if (query)
+    {
+        query->exec();
+    }
     std::stringstream trigger_query;
-    trigger_query << "CREATE TRIGGER delete_oldest_AuthentCache AFTER INSERT ON AuthentCache WHEN "
-                     " ((SELECT count() FROM AuthentCache) > ";
+    trigger_query << "CREATE TRIGGER delete_oldest_AuthentCache AFTER INSERT ON AuthentCache BEGIN "
+                     "DELETE FROM AuthentCache WHERE [id] <= (NEW.[id] - ";
     trigger_query << m_stack_config.authentCacheMaxEntriesCount();
-    trigger_query << ") BEGIN DELETE FROM AuthentCache WHERE ROWID IN "
-                     "(SELECT ROWID FROM AuthentCache LIMIT 1);END;";
+    trigger_query << ");END;";
     query = m_database.query(trigger_query.str());
     if (query)
     {
@@ -270,6 +354,34 @@ void AuthentCache::initDatabaseTable()
     m_delete_query = m_database.query("DELETE FROM AuthentCache WHERE tag=?;");
     m_insert_query = m_database.query("INSERT INTO AuthentCache VALUES (NULL, ?, ?, ?, ?);");
     m_update_query = m_database.query("UPDATE AuthentCache SET [parent]=?, [expiry]=?, [status]=? WHERE id=?;");
+
+    // In-memory index
+    if (m_memory_index_enabled)
+    {
+        loadMemoryIndex();
+    }
+}
+
+/** @brief Load the in-memory index from the database */
+void AuthentCache::loadMemoryIndex()
+{
+    std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+    m_memory_index.clear();
+    m_memory_index_ids.clear();
+
+    auto query = m_database.query("SELECT * FROM AuthentCache;");
+    if (query && query->exec() && query->hasRows())
+    {
+        do
+        {
+            int64_t     id  = query->getInt64(0);
+            std::string tag = query->getString(1);
+            IdTagInfo   tag_info;
+            fillTagInfo(*query, tag_info);
+            m_memory_index[tag]    = std::make_pair(id, tag_info);
+            m_memory_index_ids[id] = tag;
+        } while (query->next());
+    }
 }
 
 /** @brief Clear the cache */
@@ -280,6 +392,12 @@ void AuthentCache::clear()
     {
         query->exec();
     }
+    if (m_memory_index_enabled)
+    {
+        std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+        m_memory_index.clear();
+        m_memory_index_ids.clear();
+    }
 }
 
 } // namespace chargepoint
@@ -26,6 +26,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GenericMessageHandler.h"
 #include "IdTagInfo.h"
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 namespace ocpp
 {
 // Forward declarations
@@ -103,8 +107,19 @@ class AuthentCache : public ocpp::messages::GenericMessageHandler<ocpp::messages
     /** @brief Query to update a tag in the cache */
     std::unique_ptr<ocpp::database::Database::Query> m_update_query;
 
+    /** @brief Indicate if the in-memory index is enabled */
+    bool m_memory_index_enabled;
+    /** @brief Mutex for concurrent access to the in-memory index */
+    std::mutex m_memory_index_mutex;
+    /** @brief In-memory index : tag => database id and tag information */
+    std::unordered_map<std::string, std::pair<int64_t, ocpp::types::IdTagInfo>> m_memory_index;
+    /** @brief Tags of the in-memory index ordered by database id to mirror the rotation of the table */
+    std::map<int64_t, std::string> m_memory_index_ids;
+
     /** @brief Initialize the database table */
     void initDatabaseTable();
+    /** @brief Load the in-memory index from the database */
+    void loadMemoryIndex();
     /** @brief Clear the cache */
     void clear();
 };
@@ -30,27 +30,33 @@ using namespace ocpp::database;
 using namespace ocpp::types;
 using namespace ocpp::messages;
 
+/** @brief Number of entries written by each transaction when filling the back buffer table of a double buffered update */
+static constexpr size_t BACK_BUFFER_BATCH_SIZE = 1000u;
+
 namespace ocpp
 {
 namespace chargepoint
 {
 
 /** @brief Constructor */
-AuthentLocalList::AuthentLocalList(ocpp::config::IOcppConfig&                      ocpp_config,
+AuthentLocalList::AuthentLocalList(const ocpp::config::IChargePointConfig&         stack_config,
+                                   ocpp::config::IOcppConfig&                      ocpp_config,
                                    ocpp::database::Database&                       database,
                                    ocpp::config::IInternalConfigManager&           internal_config,
                                    const ocpp::messages::GenericMessagesConverter& messages_converter,
                                    ocpp::messages::IMessageDispatcher&             msg_dispatcher)
     : GenericMessageHandler<GetLocalListVersionReq, GetLocalListVersionConf>(GET_LOCAL_LIST_VERSION_ACTION, messages_converter),
       GenericMessageHandler<SendLocalListReq, SendLocalListConf>(SEND_LOCAL_LIST_ACTION, messages_converter),
+      m_stack_config(stack_config),
       m_ocpp_config(ocpp_config),
       m_database(database),
       m_internal_config(internal_config),
       m_local_list_version(0),
-      m_find_query(),
-      m_delete_query(),
-      m_insert_query(),
-      m_update_query()
+      m_tables(),
+      m_current_table(0),
+      m_memory_index_enabled(m_stack_config.authentInMemoryIndex()),
+      m_memory_index_mutex(),
+      m_memory_index()
 {
     initDatabaseTable();
     msg_dispatcher.registerHandler(GET_LOCAL_LIST_VERSION_ACTION,
@@ -134,22 +140,18 @@ bool AuthentLocalList::handleMessage(const ocpp::messages::SendLocalListReq& req
                 bool success;
                 if (request.updateType == UpdateType::Full)
                 {
-                    success = performFullUpdate(request.localAuthorizationList);
+                    success = performFullUpdate(request.localAuthorizationList, request.listVersion);
                 }
                 else
                 {
-                    success = performPartialUpdate(request.localAuthorizationList);
+                    success = performPartialUpdate(request.localAuthorizationList, request.listVersion);
                 }
                 if (success)
                 {
                     response.status = UpdateStatus::Accepted;
 
-                    // Update local list version
+                    // Local list version has been saved with the list
                     m_local_list_version = request.listVersion;
-                    if (!m_internal_config.setKey(LOCAL_LIST_VERSION_KEY, std::to_string(m_local_list_version)))
-                    {
-                        LOG_ERROR << "Unable to save authent local list version";
-                    }
                 }
                 else
                 {
@@ -176,62 +178,118 @@ bool AuthentLocalList::handleMessage(const ocpp::messages::SendLocalListReq& req
     return true;
 }
 
+/** @brief Fill a tag information from a database query result (columns : id, tag, parent, expiry, status) */
+static void fillTagInfo(Database::Query& query, IdTagInfo& tag_info)
+{
+    if (!query.isNull(3))
+    {
+        tag_info.expiryDate = DateTime(query.getInt64(3));
+    }
+    else
+    {
+        tag_info.expiryDate.clear();
+    }
+    std::string parent = query.getString(2);
+    if (parent.empty())
+    {
+        tag_info.parentIdTag.clear();
+    }
+    else
+    {
+        tag_info.parentIdTag.value().assign(parent);
+    }
+    tag_info.status = static_cast<AuthorizationStatus>(query.getInt32(4));
+}
+
 /** @brief Look for a tag id in the local list */
 bool AuthentLocalList::check(const std::string& id_tag, ocpp::types::IdTagInfo& tag_info)
 {
     bool ret = false;
 
-    if (m_find_query)
+    if (m_memory_index_enabled)
     {
-        // Execute query
-        m_find_query->bind(0, id_tag);
-        if (m_find_query->exec())
+        // Look into the in-memory index
+        std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+        auto                        iter = m_memory_index.find(id_tag);
+        if (iter != m_memory_index.end())
         {
-            // Check if a match has been found
-            ret = m_find_query->hasRows();
-            if (ret)
+            tag_info = iter->second;
+            ret      = true;
+        }
+    }
+    else
+    {
+        Table& table = m_tables[m_current_table];
+        if (table.find_query)
+        {
+            // Execute query
+            table.find_query->bind(0, id_tag);
+            if (table.find_query->exec())
             {
-                // Extract data
-                bool        expiry_valid = !m_find_query->isNull(3);
-                std::time_t expiry       = m_find_query->getInt64(3);
-                if (expiry_valid)
-                {
-                    tag_info.expiryDate = expiry;
-                }
-                else
+                // Check if a match has been found
+                ret = table.find_query->hasRows();
+                if (ret)
                 {
-                    tag_info.expiryDate.clear();
-                }
-                std::string parent = m_find_query->getString(2);
-                if (parent.empty())
-                {
-                    tag_info.parentIdTag.clear();
-                }
-                else
-                {
-                    tag_info.parentIdTag.value().assign(parent);
-                }
-                tag_info.status = static_cast<AuthorizationStatus>(m_find_query->getInt32(4));
-
-                // Check expiry date
-                std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-                if (expiry_valid && (expiry < now))
-                {
-                    // Entry is no more valid
-                    ret = false;
+                    // Extract data
+                    fillTagInfo(*table.find_query, tag_info);
                 }
             }
+            table.find_query->reset();
         }
-        m_find_query->reset();
     }
+
+    // Check expiry date
+    std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    if (ret && tag_info.expiryDate.isSet() && (tag_info.expiryDate.value().timestamp() < now))
+    {
+        // Entry is no more valid
+        ret = false;
+    }
+
     return ret;
 }
 
 /** @brief Initialize the database table */
 void AuthentLocalList::initDatabaseTable()
 {
-    // Create database
-    auto query = m_database.query("CREATE TABLE IF NOT EXISTS AuthentLocalList ("
+    // Create tables
+    m_tables[0].name = "AuthentLocalList";
+    m_tables[1].name = "AuthentLocalList2";
+    for (Table& table : m_tables)
+    {
+        initTable(table);
+    }
+
+    // Table containing the current list
+    std::string current_table;
+    if (!m_internal_config.keyExist(LOCAL_LIST_TABLE_KEY))
+    {
+        m_internal_config.createKey(LOCAL_LIST_TABLE_KEY, "0");
+    }
+    else if (m_internal_config.getKey(LOCAL_LIST_TABLE_KEY, current_table))
+    {
+        m_current_table = (current_table == "1") ? 1u : 0u;
+    }
+
+    // Local list version
+    if (!m_internal_config.keyExist(LOCAL_LIST_VERSION_KEY))
+    {
+        m_internal_config.createKey(LOCAL_LIST_VERSION_KEY, std::to_string(m_local_list_version));
+    }
+
+    // In-memory index
+    if (m_memory_index_enabled)
+    {
+        loadMemoryIndex();
+    }
+}
+
+/** @brief Initialize a local list table */
+void AuthentLocalList::initTable(Table& table)
+{
+    // Create table
+    auto query = m_database.query("CREATE TABLE IF NOT EXISTS " + table.name +
+                                  " ("
                                   "[id]	INTEGER,"
                                   "[tag]	VARCHAR(20),"
                                   "[parent]	VARCHAR(20),"
@@ -246,21 +304,52 @@ void AuthentLocalList::initDatabaseTable()
         }
     }
 
+    // Unique index on tags, the duplicates which may exist in databases of previous versions
+    // are removed before its creation (most recent entry is kept)
+    query = m_database.query("SELECT name FROM sqlite_master WHERE type='index' AND name='" + table.name + "_tag';");
+    if (query && query->exec() && !query->hasRows())
+    {
+        query = m_database.query("DELETE FROM " + table.name + " WHERE id NOT IN (SELECT MAX(id) FROM " + table.name + " GROUP BY tag);");
+        if (query)
+        {
+            query->exec();
+        }
+        query = m_database.query("CREATE UNIQUE INDEX " + table.name + "_tag ON " + table.name + "([tag]);");
+        if (query)
+        {
+            if (!query->exec())
+            {
+                LOG_ERROR << "Could not create authent local list index : " << query->lastError();
+            }
+        }
+    }
+
     // Create parametrized queries
-    m_find_query   = m_database.query("SELECT * FROM AuthentLocalList WHERE tag=?;");
-    m_delete_query = m_database.query("DELETE FROM AuthentLocalList WHERE tag=?;");
-    m_insert_query = m_database.query("INSERT INTO AuthentLocalList VALUES (NULL, ?, ?, ?, ?);");
-    m_update_query = m_database.query("UPDATE AuthentLocalList SET [parent]=?, [expiry]=?, [status]=? WHERE id=?;");
+    table.find_query   = m_database.query("SELECT * FROM " + table.name + " WHERE tag=?;");
+    table.delete_query = m_database.query("DELETE FROM " + table.name + " WHERE tag=?;");
+    table.insert_query = m_database.query("INSERT OR REPLACE INTO " + table.name + " VALUES (NULL, ?, ?, ?, ?);");
+}
 
-    // Local list version
-    if (!m_internal_config.keyExist(LOCAL_LIST_VERSION_KEY))
+/** @brief Load the in-memory index from the database */
+void AuthentLocalList::loadMemoryIndex()
+{
+    std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+    m_memory_index.clear();
+
+    auto query = m_database.query("SELECT * FROM " + m_tables[m_current_table].name + ";");
+    if (query && query->exec() && query->hasRows())
     {
-        m_internal_config.createKey(LOCAL_LIST_VERSION_KEY, std::to_string(m_local_list_version));
+        do
+        {
+            IdTagInfo tag_info;
+            fillTagInfo(*query, tag_info);
+            m_memory_index[query->getString(1)] = tag_info;
+        } while (query->next());
     }
 }
 
 /** @brief Perform the full update of the local list */
-bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas)
+bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version)
 {
     bool ret = true;
 
@@ -283,52 +372,37 @@ bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::Authoriz
     }
     if (ret)
     {
-        // Clear local list
-        auto query = m_database.query("DELETE FROM AuthentLocalList WHERE TRUE;");
-        if (query)
+        if (m_stack_config.authentLocalListDoubleBuffering())
         {
-            ret = query->exec();
-            if (!ret)
+            ret = performDoubleBufferedUpdate(authorization_datas, list_version);
+        }
+        else
+        {
+            // The new list replaces the old one at once or not at all
+            Database::Transaction transaction(m_database);
+
+            // Clear local list
+            Table& table = m_tables[m_current_table];
+            ret          = clearTable(table);
+
+            // Insert new list
+            for (auto it = authorization_datas.begin(); ret && (it != authorization_datas.end()); ++it)
+            {
+                ret = insertEntry(*table.insert_query, *it);
+            }
+            if (ret)
             {
-                LOG_ERROR << "Could not clear authent local list table";
+                ret = saveListVersion(list_version) && transaction.commit();
             }
         }
-    }
-    if (ret)
-    {
-        // Insert new list
-        if (m_insert_query)
+        if (ret && m_memory_index_enabled)
         {
+            // Replace the in-memory index
+            std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+            m_memory_index.clear();
             for (const AuthorizationData& authorization_data : authorization_datas)
             {
-                m_insert_query->bind(0, authorization_data.idTag);
-                if (authorization_data.idTagInfo.value().parentIdTag.isSet())
-                {
-                    m_insert_query->bind(1, authorization_data.idTagInfo.value().parentIdTag.value());
-                }
-                else
-                {
-                    m_insert_query->bind(1, "");
-                }
-                if (authorization_data.idTagInfo.value().expiryDate.isSet())
-                {
-                    m_insert_query->bind(2, authorization_data.idTagInfo.value().expiryDate.value().timestamp());
-                }
-                else
-                {
-                    m_insert_query->bind(2);
-                }
-                m_insert_query->bind(3, static_cast<int>(authorization_data.idTagInfo.value().status));
-                if (!m_insert_query->exec())
-                {
-                    LOG_ERROR << "Could not insert idTag [" << authorization_data.idTag.str() << "]";
-                    ret = false;
-                }
-                else
-                {
-                    LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] inserted";
-                }
-                m_insert_query->reset();
+                setMemoryIndexEntry(authorization_data);
             }
         }
     }
@@ -336,22 +410,72 @@ bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::Authoriz
     return ret;
 }
 
+/** @brief Perform the full update of the local list in the back buffer table which replaces the current one once filled */
+bool AuthentLocalList::performDoubleBufferedUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version)
+{
+    // Clear the back buffer, it may contain the previous list or the entries of an interrupted update
+    unsigned int back_table = 1u - m_current_table;
+    Table&       table      = m_tables[back_table];
+    bool         ret        = clearTable(table);
+
+    // Fill the back buffer by batches so that the current list stays available to the other threads
+    auto it = authorization_datas.begin();
+    while (ret && (it != authorization_datas.end()))
+    {
+        Database::Transaction transaction(m_database);
+        for (size_t i = 0; ret && (i < BACK_BUFFER_BATCH_SIZE) && (it != authorization_datas.end()); i++, ++it)
+        {
+            ret = insertEntry(*table.insert_query, *it);
+        }
+        if (ret)
+        {
+            ret = transaction.commit();
+        }
+    }
+    if (ret)
+    {
+        // Swap the tables, the new list and its version are saved at once
+        Database::Transaction transaction(m_database);
+        ret = m_internal_config.setKey(LOCAL_LIST_TABLE_KEY, std::to_string(back_table)) && saveListVersion(list_version) &&
+              transaction.commit();
+        if (ret)
+        {
+            unsigned int previous_table = m_current_table;
+            m_current_table             = back_table;
+            clearTable(m_tables[previous_table]);
+        }
+        else
+        {
+            LOG_ERROR << "Unable to swap authent local list tables";
+        }
+    }
+
+    return ret;
+}
+
 /** @brief Perform the partial update of the local list */
-bool AuthentLocalList::performPartialUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas)
+bool AuthentLocalList::performPartialUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version)
 {
-    bool ret = true;
+    bool ret = false;
 
-    if (m_delete_query && m_find_query && m_update_query && m_insert_query)
+    Table& table = m_tables[m_current_table];
+    if (table.delete_query && table.insert_query)
     {
+        // All the updates are written at once
+        Database::Transaction transaction(m_database);
+
         // Far all idTags
-        for (const AuthorizationData& authorization_data : authorization_datas)
+        ret = true;
+        for (auto it = authorization_datas.begin(); ret && (it != authorization_datas.end()); ++it)
         {
+            const AuthorizationData& authorization_data = *it;
+
             // Check if the idTag must be deleted
             if (!authorization_data.idTagInfo.isSet())
             {
                 // Delete entry
-                m_delete_query->bind(0, authorization_data.idTag);
-                if (!m_delete_query->exec())
+                table.delete_query->bind(0, authorization_data.idTag);
+                if (!table.delete_query->exec())
                 {
                     LOG_ERROR << "Could not delete idTag [" << authorization_data.idTag.str() << "]";
                     ret = false;
@@ -360,70 +484,32 @@ bool AuthentLocalList::performPartialUpdate(const std::vector<ocpp::types::Autho
                 {
                     LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] deleted";
                 }
-                m_delete_query->reset();
+                table.delete_query->reset();
             }
             else
             {
-                // Create or update, check if the entry exists
-                m_find_query->bind(0, authorization_data.idTag);
-                if (m_find_query->exec())
+                // Create or update, the unique index on tags replaces the existing entry
+                ret = insertEntry(*table.insert_query, authorization_data);
+            }
+        }
+        if (ret)
+        {
+            ret = saveListVersion(list_version) && transaction.commit();
+        }
+        if (ret && m_memory_index_enabled)
+        {
+            // Apply the updates to the in-memory index
+            std::lock_guard<std::mutex> lock(m_memory_index_mutex);
+            for (const AuthorizationData& authorization_data : authorization_datas)
+            {
+                if (authorization_data.idTagInfo.isSet())
                 {
-                    if (m_find_query->hasRows())
-                    {
-                        // Update
-                        int entry = m_find_query->getInt32(0);
-                        m_update_query->bind(0, authorization_data.idTagInfo.value().parentIdTag.value());
-                        if (authorization_data.idTagInfo.value().expiryDate.isSet())
-                        {
-                            m_update_query->bind(1, authorization_data.idTagInfo.value().expiryDate.value().timestamp());
-                        }
-                        else
-                        {
-                            m_update_query->bind(1);
-                        }
-                        m_update_query->bind(2, static_cast<int>(authorization_data.idTagInfo.value().status));
-                        m_update_query->bind(3, entry);
-                        if (!m_update_query->exec())
-                        {
-                            LOG_ERROR << "Could not update idTag [" << authorization_data.idTag.str() << "]";
-                        }
-                        else
-                        {
-                            LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] updated";
-                        }
-                        m_update_query->reset();
-                    }
-                    else
-                    {
-                        // Insert
-                        m_insert_query->bind(0, authorization_data.idTag);
-                        m_insert_query->bind(1, authorization_data.idTagInfo.value().parentIdTag.value());
-                        if (authorization_data.idTagInfo.value().expiryDate.isSet())
-                        {
-                            m_insert_query->bind(2, authorization_data.idTagInfo.value().expiryDate.value().timestamp());
-                        }
-                        else
-                        {
-                            m_insert_query->bind(2);
-                        }
-                        m_insert_query->bind(3, static_cast<int>(authorization_data.idTagInfo.value().status));
-                        if (!m_insert_query->exec())
-                        {
-                            LOG_ERROR << "Could not insert idTag [" << authorization_data.idTag.str() << "]";
-                            ret = false;
-                        }
-                        else
-                        {
-                            LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] inserted";
-                        }
-                        m_insert_query->reset();
-                    }
+                    setMemoryIndexEntry(authorization_data);
                 }
                 else
                 {
-                    ret = false;
+                    m_memory_index.erase(authorization_data.idTag.str());
                 }
-                m_find_query->reset();
             }
         }
     }
@@ -431,5 +517,85 @@ bool AuthentLocalList::performPartialUpdate(const std::vector<ocpp::types::Autho
     return ret;
 }
 
+/** @brief Save the version of the local list (must be called inside the transaction updating the list) */
+bool AuthentLocalList::saveListVersion(int list_version)
+{
+    bool ret = m_internal_config.setKey(LOCAL_LIST_VERSION_KEY, std::to_string(list_version));
+    if (!ret)
+    {
+        LOG_ERROR << "Unable to save authent local list version";
+    }
+    return ret;
+}
+
+/** @brief Clear a local list table */
+bool AuthentLocalList::clearTable(Table& table)
+{
+    bool ret = false;
+
+    // No WHERE clause to benefit from the truncate optimization
+    auto query = m_database.query("DELETE FROM " + table.name + ";");
+    if (query)
+    {
+        ret = query->exec();
+    }
+    if (!ret)
+    {
+        LOG_ERROR << "Could not clear authent local list table : " << m_database.lastError();
+    }
+
+    return ret;
+}
+
+/** @brief Insert an entry in a local list table */
+bool AuthentLocalList::insertEntry(ocpp::database::Database::Query& query, const ocpp::types::AuthorizationData& authorization_data)
+{
+    bool             ret      = true;
+    const IdTagInfo& tag_info = authorization_data.idTagInfo.value();
+
+    query.bind(0, authorization_data.idTag);
+    if (tag_info.parentIdTag.isSet())
+    {
+        query.bind(1, tag_info.parentIdTag.value());
+    }
+    else
+    {
+        query.bind(1, "");
+    }
+    if (tag_info.expiryDate.isSet())
+    {
+        query.bind(2, tag_info.expiryDate.value().timestamp());
+    }
+    else
+    {
+        query.bind(2);
+    }
+    query.bind(3, static_cast<int>(tag_info.status));
+    if (!query.exec())
+    {
+        LOG_ERROR << "Could not insert idTag [" << authorization_data.idTag.str() << "]";
+        ret = false;
+    }
+    else
+    {
+        LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] inserted";
+    }
+    query.reset();
+
+    return ret;
+}
+
+/** @brief Set an entry of the in-memory index (the index must be locked) */
+void AuthentLocalList::setMemoryIndexEntry(const ocpp::types::AuthorizationData& authorization_data)
+{
+    // Same conversion as the storage in database
+    IdTagInfo& tag_info = m_memory_index[authorization_data.idTag.str()];
+    tag_info            = authorization_data.idTagInfo.value();
+    if (tag_info.parentIdTag.isSet() && tag_info.parentIdTag.value().empty())
+    {
+        tag_info.parentIdTag.clear();
+    }
+}
+
 } // namespace chargepoint
 } // namespace ocpp
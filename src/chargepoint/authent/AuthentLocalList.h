@@ -25,6 +25,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GetLocalListVersion.h"
 #include "SendLocalList.h"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 namespace ocpp
 {
 // Forward declarations
@@ -50,7 +54,8 @@ class AuthentLocalList
 {
   public:
     /** @brief Constructor */
-    AuthentLocalList(ocpp::config::IOcppConfig&                      ocpp_config,
+    AuthentLocalList(const ocpp::config::IChargePointConfig&         stack_config,
+                     ocpp::config::IOcppConfig&                      ocpp_config,
                      ocpp::database::Database&                       database,
                      ocpp::config::IInternalConfigManager&           internal_config,
                      const ocpp::messages::GenericMessagesConverter& messages_converter,
@@ -92,6 +97,8 @@ class AuthentLocalList
     bool check(const std::string& id_tag, ocpp::types::IdTagInfo& tag_info);
 
   private:
+    /** @brief Stack configuration */
+    const ocpp::config::IChargePointConfig& m_stack_config;
     /** @brief Standard OCPP configuration */
     ocpp::config::IOcppConfig& m_ocpp_config;
     /** @brief Charge point's database */
@@ -102,21 +109,50 @@ class AuthentLocalList
     /** @brief Current local list version */
     int m_local_list_version;
 
-    /** @brief Query to look for a tag in the local list */
-    std::unique_ptr<ocpp::database::Database::Query> m_find_query;
-    /** @brief Query to delete a tag in the local list */
-    std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
-    /** @brief Query to insert a tag in the local list */
-    std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
-    /** @brief Query to update a tag in the local list */
-    std::unique_ptr<ocpp::database::Database::Query> m_update_query;
+    /** @brief Local list table */
+    struct Table
+    {
+        /** @brief Name of the table */
+        std::string name;
+        /** @brief Query to look for a tag in the table */
+        std::unique_ptr<ocpp::database::Database::Query> find_query;
+        /** @brief Query to delete a tag in the table */
+        std::unique_ptr<ocpp::database::Database::Query> delete_query;
+        /** @brief Query to insert or replace a tag in the table */
+        std::unique_ptr<ocpp::database::Database::Query> insert_query;
+    };
+    /** @brief Local list tables : current list and back buffer for the double buffered full updates */
+    Table m_tables[2u];
+    /** @brief Index of the table containing the current list */
+    std::atomic<unsigned int> m_current_table;
+
+    /** @brief Indicate if the in-memory index is enabled */
+    bool m_memory_index_enabled;
+    /** @brief Mutex for concurrent access to the in-memory index */
+    std::mutex m_memory_index_mutex;
+    /** @brief In-memory index : tag => tag information */
+    std::unordered_map<std::string, ocpp::types::IdTagInfo> m_memory_index;
 
     /** @brief Initialize the database table */
     void initDatabaseTable();
+    /** @brief Initialize a local list table */
+    void initTable(Table& table);
+    /** @brief Load the in-memory index from the database */
+    void loadMemoryIndex();
+    /** @brief Set an entry of the in-memory index (the index must be locked) */
+    void setMemoryIndexEntry(const ocpp::types::AuthorizationData& authorization_data);
     /** @brief Perform the full update of the local list */
-    bool performFullUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas);
+    bool performFullUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version);
     /** @brief Perform the partial update of the local list */
-    bool performPartialUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas);
+    bool performPartialUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version);
+    /** @brief Perform the full update of the local list in the back buffer table which replaces the current one once filled */
+    bool performDoubleBufferedUpdate(const std::vector<ocpp::types::AuthorizationData>& authorization_datas, int list_version);
+    /** @brief Save the version of the local list (must be called inside the transaction updating the list) */
+    bool saveListVersion(int list_version);
+    /** @brief Clear a local list table */
+    bool clearTable(Table& table);
+    /** @brief Insert an entry in a local list table */
+    bool insertEntry(ocpp::database::Database::Query& query, const ocpp::types::AuthorizationData& authorization_data);
 };
 
 } // namespace chargepoint
@@ -45,7 +45,7 @@ AuthentManager::AuthentManager(const ocpp::config::IChargePointConfig&         s
     : m_ocpp_config(ocpp_config),
       m_msg_sender(msg_sender),
       m_cache(*new AuthentCache(stack_config, ocpp_config, database, messages_converter, msg_dispatcher)),
-      m_local_list(*new AuthentLocalList(ocpp_config, database, internal_config, messages_converter, msg_dispatcher))
+      m_local_list(*new AuthentLocalList(stack_config, ocpp_config, database, internal_config, messages_converter, msg_dispatcher))
 {
 }
 
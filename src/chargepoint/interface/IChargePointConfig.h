@@ -38,8 +38,17 @@ class IChargePointConfig
 
     /** @brief Path to the database to store persistent data */
     virtual std::string databasePath() const = 0;
+    /** @brief Enable the write-ahead log journal mode of the database */
+    virtual bool databaseWalMode() const = 0;
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    virtual std::string databaseSynchronousMode() const = 0;
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath()
+     *         (empty = file next to databasePath() with a "_logs" suffix) */
+    virtual std::string logDatabasePath() const { return ""; }
     /** @brief Path to the JSON schemas to validate the messages */
     virtual std::string jsonSchemasPath() const = 0;
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    virtual unsigned int workerThreadCount() const = 0;
 
     // Communication parameters
 
@@ -53,6 +62,10 @@ class IChargePointConfig
     virtual std::chrono::milliseconds retryInterval() const = 0;
     /** @brief Call request timeout */
     virtual std::chrono::milliseconds callRequestTimeout() const = 0;
+    /** @brief Allow several call requests to be in flight at the same time */
+    virtual bool callRequestsPipelining() const = 0;
+    /** @brief Maximum size in bytes of a received websocket message */
+    virtual unsigned int webSocketMaxMessageSize() const = 0;
     /** @brief Cipher list to use for TLSv1.2 connections */
     virtual std::string tlsv12CipherList() const = 0;
     /** @brief Cipher list to use for TLSv1.3 connections */
@@ -108,11 +121,24 @@ class IChargePointConfig
 
     /** @brief Maximum number of entries in the authentication cache */
     virtual unsigned int authentCacheMaxEntriesCount() const = 0;
+    /** @brief Keep an in-memory index of the authentication cache and local list */
+    virtual bool authentInMemoryIndex() const = 0;
+    /** @brief Build the new authentication local list in a separate table on full updates */
+    virtual bool authentLocalListDoubleBuffering() const = 0;
+
+    // Requests FIFO
+
+    /** @brief Maximum number of requests in the transaction related requests FIFO (0 = no limit) */
+    virtual unsigned int requestFifoMaxSize() const = 0;
+    /** @brief Maximum number of requests of the transaction related requests FIFO to send at the same time when replaying the FIFO */
+    virtual unsigned int requestFifoReplayDepth() const = 0;
 
     // Log
 
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     virtual unsigned int logMaxEntriesCount() const = 0;
+    /** @brief Size of the queue of the asynchronous logs (0 = synchronous logs) */
+    virtual unsigned int logAsyncQueueSize() const { return 0; }
 
     // Security
 
@@ -171,7 +171,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTrigger message, c
     {
         case MessageTrigger::DiagnosticsStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -183,7 +183,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTrigger message, c
 
         case MessageTrigger::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -213,7 +213,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType
     {
         case MessageTriggerEnumType::LogStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -225,7 +225,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType
 
         case MessageTriggerEnumType::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
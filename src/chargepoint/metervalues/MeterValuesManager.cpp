@@ -30,6 +30,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "WorkerThreadPool.h"
 
 #include <functional>
+#include <utility>
+#include <vector>
 
 using namespace ocpp::types;
 using namespace ocpp::messages;
@@ -273,7 +275,7 @@ void MeterValuesManager::processClockAligned(void)
     if (m_status_manager.getRegistrationStatus() == RegistrationStatus::Accepted)
     {
         // Process in background thread
-        m_worker_pool.run<void>(
+        m_worker_pool.post(
             [this]
             {
                 // Process meter value configuration
@@ -298,22 +300,31 @@ void MeterValuesManager::processClockAligned(void)
                     {
                         LOG_DEBUG << "Clock aligned transaction meter values : " << meter_values;
 
-                        // Fill meter value
-                        MeterValue meter_value;
+                        // Fill meter values
+                        MeterValue                               meter_value;
+                        std::vector<std::pair<int, std::string>> tx_meter_values;
                         for (const Connector* connector : m_connectors.getConnectors())
                         {
                             if ((connector->transaction_id != 0) &&
                                 fillMeterValue(connector->id, measurands, meter_value, ReadingContext::SampleClock))
                             {
                                 // Serialize value
-                                std::string meter_value_str = serialize(meter_value);
+                                tx_meter_values.emplace_back(connector->transaction_id, serialize(meter_value));
+                            }
+                        }
 
-                                // Store into database
+                        // Store all the values into database at once
+                        if (!tx_meter_values.empty())
+                        {
+                            ocpp::database::Database::Transaction transaction(m_database);
+                            for (const auto& tx_meter_value : tx_meter_values)
+                            {
                                 m_insert_query->reset();
-                                m_insert_query->bind(0u, connector->transaction_id);
-                                m_insert_query->bind(1u, meter_value_str);
+                                m_insert_query->bind(0u, tx_meter_value.first);
+                                m_insert_query->bind(1u, tx_meter_value.second);
                                 m_insert_query->exec();
                             }
+                            transaction.commit();
                         }
                     }
                 }
@@ -325,7 +336,7 @@ void MeterValuesManager::processClockAligned(void)
 void MeterValuesManager::processSampled(unsigned int connector_id)
 {
     // Process in background thread
-    m_worker_pool.run<void>(
+    m_worker_pool.post(
         [this, connector_id]
         {
             // Process sampled meter value configuration
@@ -374,7 +385,7 @@ void MeterValuesManager::processSampled(unsigned int connector_id)
 void MeterValuesManager::processTriggered(unsigned int connector_id)
 {
     // Process in background thread
-    m_worker_pool.run<void>(
+    m_worker_pool.post(
         [this, connector_id]
         {
             // To let some time for the trigger message reply
@@ -561,7 +572,6 @@ std::string MeterValuesManager::serialize(const ocpp::types::MeterValue& meter_v
     rapidjson::Document meter_value_json;
     meter_value_json.Parse("{}");
     MeterValueConverter meter_value_converter;
-    meter_value_converter.setAllocator(&meter_value_json.GetAllocator());
     meter_value_converter.toJson(meter_value, meter_value_json);
 
     rapidjson::StringBuffer                    buffer;
@@ -579,7 +589,6 @@ bool MeterValuesManager::deserialize(const std::string& meter_value_str, ocpp::t
     rapidjson::Document meter_value_json;
     meter_value_json.Parse(meter_value_str.c_str());
     MeterValueConverter meter_value_converter;
-    meter_value_converter.setAllocator(&meter_value_json.GetAllocator());
     return meter_value_converter.fromJson(meter_value_json, meter_value, error_code, error_message);
 }
 } // namespace chargepoint
@@ -17,7 +17,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "RequestFifo.h"
+#include "IChargePointConfig.h"
 #include "Logger.h"
+#include "MeterValues.h"
 
 using namespace ocpp::database;
 using namespace ocpp::messages;
@@ -28,8 +30,18 @@ namespace chargepoint
 {
 
 /** @brief Constructor */
-RequestFifo::RequestFifo(ocpp::database::Database& database)
-    : m_database(database), m_delete_query(), m_insert_query(), m_mutex(), m_fifo(), m_id(0), m_listener(nullptr)
+RequestFifo::RequestFifo(const ocpp::config::IChargePointConfig& stack_config, ocpp::database::Database& database)
+    : m_stack_config(stack_config),
+      m_database(database),
+      m_delete_query(),
+      m_insert_query(),
+      m_find_query(),
+      m_update_query(),
+      m_mutex(),
+      m_fifo(),
+      m_eviction_cursor(m_fifo.end()),
+      m_id(0),
+      m_listener(nullptr)
 {
 }
 
@@ -43,22 +55,21 @@ void RequestFifo::push(unsigned int connector_id, const std::string& action, con
 
     LOG_DEBUG << "Transaction related request FIFO : pushing " << action << " request";
 
-    // Serialize request
-    rapidjson::StringBuffer                    buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    payload.Accept(writer);
-    std::string request = buffer.GetString();
-
     // Add a new entry to the FIFO
-    m_fifo.emplace(m_id, connector_id, action, request);
-    if (m_insert_query)
+    m_fifo.emplace_back(m_id, connector_id, action);
+    Entry& entry = m_fifo.back();
+    fillMeterValuesInfo(entry, payload);
+    storeRequest(entry, payload, false);
+
+    // Make room if needed, the new entry can be the target of a merge
+    unsigned int max_size = m_stack_config.requestFifoMaxSize();
+    if (max_size != 0)
     {
-        m_insert_query->reset();
-        m_insert_query->bind(0, m_id);
-        m_insert_query->bind(1, connector_id);
-        m_insert_query->bind(2, action);
-        m_insert_query->bind(3, request);
-        m_insert_query->exec();
+        while ((m_fifo.size() > max_size) && makeRoom()) { }
+        if (m_fifo.size() > max_size)
+        {
+            LOG_WARNING << "Transaction related request FIFO : FIFO is full and no MeterValues request can be merged or dropped";
+        }
     }
 
     // Prepare for next entry
@@ -80,12 +91,13 @@ bool RequestFifo::front(unsigned int& connector_id, std::string& action, rapidjs
     if (!m_fifo.empty())
     {
         // Get entry from FIFO
-        const std::string& request_str = m_fifo.front().request;
-        action                         = m_fifo.front().action;
-        connector_id                   = m_fifo.front().connector_id;
+        Entry& entry = m_fifo.front();
+        action       = entry.action;
+        connector_id = entry.connector_id;
+        entry.sent   = true;
 
         // Deserialize request
-        payload.Parse(request_str.c_str());
+        loadRequest(entry, payload);
 
         ret = true;
     }
@@ -97,17 +109,69 @@ bool RequestFifo::front(unsigned int& connector_id, std::string& action, rapidjs
 void RequestFifo::pop()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_fifo.empty())
+    {
+        LOG_DEBUG << "Transaction related request FIFO : poping " << m_fifo.front().action << " request";
 
-    LOG_DEBUG << "Transaction related request FIFO : poping " << m_fifo.front().action << " request";
+        // Delete entry
+        erase(m_fifo.begin());
+    }
+}
 
-    // Delete entry
-    unsigned int id = m_fifo.front().id;
-    m_fifo.pop();
-    if (m_delete_query)
+/** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t) */
+size_t RequestFifo::front(std::vector<Request>& requests, size_t max_count)
+{
+    return front(requests, max_count, [](unsigned int, const std::string&) { return Selection::Select; });
+}
+
+/** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t, const Selector&) */
+size_t RequestFifo::front(std::vector<Request>& requests, size_t max_count, const Selector& selector)
+{
+    requests.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_fifo.begin(); (it != m_fifo.end()) && (requests.size() < max_count); ++it)
     {
-        m_delete_query->reset();
-        m_delete_query->bind(0, id);
-        m_delete_query->exec();
+        // Check if the entry must be retrieved, the payload of the skipped entries is not loaded
+        Selection selection = selector(it->connector_id, it->action);
+        if (selection == Selection::End)
+        {
+            break;
+        }
+        if (selection == Selection::Skip)
+        {
+            continue;
+        }
+
+        // Get entry from FIFO
+        requests.emplace_back();
+        Request& request     = requests.back();
+        request.id           = it->id;
+        request.connector_id = it->connector_id;
+        request.action       = it->action;
+        it->sent             = true;
+
+        // Deserialize request
+        loadRequest(*it, request.payload);
+    }
+
+    return requests.size();
+}
+
+/** @copydoc void IRequestFifo::pop(unsigned int) */
+void RequestFifo::pop(unsigned int id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_fifo.begin(); it != m_fifo.end(); ++it)
+    {
+        if (it->id == id)
+        {
+            LOG_DEBUG << "Transaction related request FIFO : poping " << it->action << " request";
+
+            // Delete entry
+            erase(it);
+            break;
+        }
     }
 }
 
@@ -136,6 +200,8 @@ void RequestFifo::initDatabaseTable()
     // Create parametrized queries
     m_delete_query = m_database.query("DELETE FROM RequestFifo WHERE id=?;");
     m_insert_query = m_database.query("INSERT INTO RequestFifo VALUES (?, ?, ?, ?);");
+    m_find_query   = m_database.query("SELECT request FROM RequestFifo WHERE id=?;");
+    m_update_query = m_database.query("UPDATE RequestFifo SET [request]=? WHERE id=?;");
 
     // Load data
     load();
@@ -145,12 +211,9 @@ void RequestFifo::initDatabaseTable()
 void RequestFifo::load()
 {
     // Clear FIFO
-    while (!m_fifo.empty())
-    {
-        m_fifo.pop();
-    }
+    m_fifo.clear();
 
-    // Query all stored requests
+    // Query all stored requests, only their description is kept in memory
     auto query = m_database.query("SELECT * FROM RequestFifo WHERE TRUE ORDER BY id ASC;");
     if (query.get())
     {
@@ -159,22 +222,255 @@ void RequestFifo::load()
             do
             {
                 // Extract table data
-                int          id           = query->getUInt32(0);
+                unsigned int id           = query->getUInt32(0);
                 unsigned int connector_id = query->getUInt32(1);
                 std::string  action       = query->getString(2);
-                std::string  request_str  = query->getString(3);
 
-                // Store request inside the FIFO
-                m_fifo.emplace(id, connector_id, action, request_str);
+                // Store request description inside the FIFO
+                m_fifo.emplace_back(id, connector_id, action);
+                if (action == METER_VALUES_ACTION)
+                {
+                    rapidjson::Document payload;
+                    payload.Parse(query->getString(3).c_str());
+                    fillMeterValuesInfo(m_fifo.back(), payload);
+                }
             } while (query->next());
 
             // Prepare for next entry
             m_id = m_fifo.back().id + 1u;
         }
     }
+    m_eviction_cursor = m_fifo.begin();
 
     LOG_INFO << "Transaction related request FIFO : " << m_fifo.size() << " message(s) pending";
 }
 
+/** @brief Extract the merge information of a MeterValues request */
+void RequestFifo::fillMeterValuesInfo(Entry& entry, const rapidjson::Document& payload)
+{
+    if ((entry.action == METER_VALUES_ACTION) && payload.IsObject())
+    {
+        auto it = payload.FindMember("meterValue");
+        if ((it != payload.MemberEnd()) && it->value.IsArray())
+        {
+            entry.meter_values_count = it->value.Size();
+        }
+        it = payload.FindMember("transactionId");
+        if ((it != payload.MemberEnd()) && it->value.IsInt())
+        {
+            entry.has_transaction_id = true;
+            entry.transaction_id     = it->value.GetInt();
+        }
+    }
+}
+
+/** @brief Store the request of an entry */
+void RequestFifo::storeRequest(Entry& entry, const rapidjson::Document& payload, bool update)
+{
+    // Serialize request
+    rapidjson::StringBuffer                    buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    payload.Accept(writer);
+
+    // Requests which cannot be stored in the database are kept in memory
+    bool stored = false;
+    if (update)
+    {
+        if (entry.request.empty() && m_update_query)
+        {
+            m_update_query->reset();
+            m_update_query->bind(0, buffer.GetString());
+            m_update_query->bind(1, entry.id);
+            stored = m_update_query->exec();
+        }
+    }
+    else
+    {
+        if (m_insert_query)
+        {
+            m_insert_query->reset();
+            m_insert_query->bind(0, entry.id);
+            m_insert_query->bind(1, entry.connector_id);
+            m_insert_query->bind(2, entry.action);
+            m_insert_query->bind(3, buffer.GetString());
+            stored = m_insert_query->exec();
+        }
+    }
+    if (!stored)
+    {
+        entry.request = buffer.GetString();
+    }
+}
+
+/** @brief Retrieve the request of an entry */
+bool RequestFifo::loadRequest(const Entry& entry, rapidjson::Document& payload)
+{
+    bool ret = false;
+
+    if (!entry.request.empty())
+    {
+        payload.Parse(entry.request.c_str());
+        ret = !payload.HasParseError();
+    }
+    else if (m_find_query)
+    {
+        m_find_query->reset();
+        m_find_query->bind(0, entry.id);
+        if (m_find_query->exec() && m_find_query->hasRows())
+        {
+            payload.Parse(m_find_query->getString(0).c_str());
+            ret = !payload.HasParseError();
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Remove an entry from the FIFO */
+std::list<RequestFifo::Entry>::iterator RequestFifo::erase(std::list<Entry>::iterator entry)
+{
+    if (m_delete_query)
+    {
+        m_delete_query->reset();
+        m_delete_query->bind(0, entry->id);
+        m_delete_query->exec();
+    }
+
+    bool is_cursor = (entry == m_eviction_cursor);
+    auto next      = m_fifo.erase(entry);
+    if (is_cursor)
+    {
+        m_eviction_cursor = next;
+    }
+    return next;
+}
+
+/** @brief Make room in the FIFO by merging or dropping an old MeterValues request */
+bool RequestFifo::makeRoom()
+{
+    bool ret = false;
+
+    // A MeterValues request can be merged or dropped if it has not been retrieved for sending yet
+    auto evictable = [](const Entry& entry) { return ((entry.meter_values_count != 0) && !entry.sent); };
+
+    // Look for the first MeterValues request, starting at the cursor, which can be merged
+    // into the next request of its connector : the cursor moves after the merged request
+    // so that successive evictions are spread over the whole FIFO instead of always hitting
+    // the same requests
+    if (m_eviction_cursor == m_fifo.end())
+    {
+        m_eviction_cursor = m_fifo.begin();
+    }
+    auto candidate = m_fifo.end();
+    auto merge_to  = m_fifo.end();
+    auto fallback  = m_fifo.end();
+    auto it        = m_eviction_cursor;
+    for (size_t i = 0; i < m_fifo.size(); i++)
+    {
+        if (evictable(*it))
+        {
+            if (fallback == m_fifo.end())
+            {
+                fallback = it;
+            }
+            auto next = nextOnConnector(it);
+            if ((next != m_fifo.end()) && evictable(*next) && (next->has_transaction_id == it->has_transaction_id) &&
+                (next->transaction_id == it->transaction_id))
+            {
+                candidate = it;
+                merge_to  = next;
+                break;
+            }
+        }
+        ++it;
+        if (it == m_fifo.end())
+        {
+            it = m_fifo.begin();
+        }
+    }
+
+    if (candidate != m_fifo.end())
+    {
+        // Merge the meter values of the candidate at the beginning of the next request
+        rapidjson::Document old_payload;
+        rapidjson::Document new_payload;
+        if (loadRequest(*candidate, old_payload) && loadRequest(*merge_to, new_payload))
+        {
+            rapidjson::Value&                   old_values = old_payload["meterValue"];
+            rapidjson::Value&                   new_values = new_payload["meterValue"];
+            rapidjson::Document::AllocatorType& allocator  = new_payload.GetAllocator();
+            rapidjson::Value                    merged(rapidjson::kArrayType);
+            merged.Reserve(old_values.Size() + new_values.Size(), allocator);
+            for (auto& value : old_values.GetArray())
+            {
+                merged.PushBack(rapidjson::Value(value, allocator), allocator);
+            }
+            for (auto& value : new_values.GetArray())
+            {
+                merged.PushBack(value, allocator);
+            }
+
+            // Downsample the meter values by keeping one out of two, including the most recent one,
+            // until the limit is reached
+            while (merged.Size() > MAX_MERGED_METER_VALUES)
+            {
+                rapidjson::SizeType count = 0;
+                for (rapidjson::SizeType i = ((merged.Size() - 1u) % 2u); i < merged.Size(); i += 2u)
+                {
+                    if (i != count)
+                    {
+                        merged[count] = merged[i];
+                    }
+                    count++;
+                }
+                while (merged.Size() > count)
+                {
+                    merged.PopBack();
+                }
+            }
+            merge_to->meter_values_count = merged.Size();
+            new_values                   = merged;
+
+            LOG_DEBUG << "Transaction related request FIFO : merging MeterValues request " << candidate->id << " into request "
+                      << merge_to->id << " (" << merge_to->meter_values_count << " meter values)";
+
+            Database::Transaction transaction(m_database);
+            storeRequest(*merge_to, new_payload, true);
+            erase(candidate);
+            transaction.commit();
+        }
+        else
+        {
+            LOG_DEBUG << "Transaction related request FIFO : dropping MeterValues request " << candidate->id;
+            erase(candidate);
+        }
+        m_eviction_cursor = std::next(merge_to);
+        ret               = true;
+    }
+    else if (fallback != m_fifo.end())
+    {
+        // No merge possible, drop the first MeterValues request found
+        LOG_DEBUG << "Transaction related request FIFO : dropping MeterValues request " << fallback->id;
+        erase(fallback);
+        ret = true;
+    }
+
+    return ret;
+}
+
+/** @brief Look for the next request of the same connector */
+std::list<RequestFifo::Entry>::iterator RequestFifo::nextOnConnector(std::list<Entry>::iterator entry)
+{
+    auto it = entry;
+    for (++it; it != m_fifo.end(); ++it)
+    {
+        if (it->connector_id == entry->connector_id)
+        {
+            break;
+        }
+    }
+    return it;
+}
+
 } // namespace chargepoint
 } // namespace ocpp
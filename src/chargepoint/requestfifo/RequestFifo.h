@@ -22,11 +22,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Database.h"
 #include "IRequestFifo.h"
 
+#include <list>
 #include <mutex>
-#include <queue>
 
 namespace ocpp
 {
+// Forward declarations
+namespace config
+{
+class IChargePointConfig;
+} // namespace config
+
+// Main namespace
 namespace chargepoint
 {
 
@@ -34,8 +41,11 @@ namespace chargepoint
 class RequestFifo : public ocpp::messages::IRequestFifo
 {
   public:
+    /** @brief Maximum number of meter values which can be merged in a single MeterValues request when the FIFO is full */
+    static constexpr unsigned int MAX_MERGED_METER_VALUES = 32u;
+
     /** @brief Constructor */
-    RequestFifo(ocpp::database::Database& database);
+    RequestFifo(const ocpp::config::IChargePointConfig& stack_config, ocpp::database::Database& database);
 
     /** @brief Destructor */
     virtual ~RequestFifo();
@@ -54,6 +64,14 @@ class RequestFifo : public ocpp::messages::IRequestFifo
     /** @@copydoc void IRequestFifo::pop() */
     void pop() override;
 
+    /** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t) */
+    size_t front(std::vector<Request>& requests, size_t max_count) override;
+    /** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t, const Selector&) */
+    size_t front(std::vector<Request>& requests, size_t max_count, const Selector& selector) override;
+
+    /** @copydoc void IRequestFifo::pop(unsigned int) */
+    void pop(unsigned int id) override;
+
     /** @copydoc size_t IRequestFifo::size() const */
     size_t size() const override;
 
@@ -70,43 +88,75 @@ class RequestFifo : public ocpp::messages::IRequestFifo
     struct Entry
     {
         /** @brief Default constructor */
-        Entry() : id(0), action(), request() { }
+        Entry() : Entry(0, 0, "") { }
         /** @brief Constructor */
-        Entry(unsigned int _id, unsigned int _connector_id, std::string _action, std::string _request)
-            : id(_id), connector_id(_connector_id), action(_action), request(_request)
+        Entry(unsigned int _id, unsigned int _connector_id, std::string _action)
+            : id(_id),
+              connector_id(_connector_id),
+              action(_action),
+              request(),
+              has_transaction_id(false),
+              transaction_id(0),
+              meter_values_count(0),
+              sent(false)
         {
         }
-
         /** @brief Id */
         unsigned int id;
         /** @brief Id of the connector related to the request */
         unsigned int connector_id;
         /** @brief Action */
         std::string action;
-        /** @brief Request */
+        /** @brief Request (only kept in memory when it cannot be stored in the database) */
         std::string request;
+        /** @brief Indicate if the request is a MeterValues request which contains a transaction id */
+        bool has_transaction_id;
+        /** @brief Transaction id of a MeterValues request */
+        int transaction_id;
+        /** @brief Number of meter values of a MeterValues request (0 for the other requests) */
+        unsigned int meter_values_count;
+        /** @brief Indicate if the request has been retrieved for sending : it must not be merged or dropped anymore */
+        bool sent;
     };
 
+    /** @brief Stack configuration */
+    const ocpp::config::IChargePointConfig& m_stack_config;
     /** @brief Charge point's database */
     ocpp::database::Database& m_database;
-
     /** @brief Query to delete a request */
     std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
     /** @brief Query to insert a request */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
+    /** @brief Query to look for a request */
+    std::unique_ptr<ocpp::database::Database::Query> m_find_query;
+    /** @brief Query to update a request */
+    std::unique_ptr<ocpp::database::Database::Query> m_update_query;
 
     /** @brief Protect simultaneous access to FIFO */
     mutable std::mutex m_mutex;
     /** @brief FIFO */
-    std::queue<Entry> m_fifo;
+    std::list<Entry> m_fifo;
+    /** @brief Next request to consider when room has to be made in the FIFO */
+    std::list<Entry>::iterator m_eviction_cursor;
     /** @brief Current id of the request */
     unsigned int m_id;
-
     /** @brief Listener */
     IListener* m_listener;
 
     /** @brief Load requests from the database */
     void load();
+    /** @brief Extract the merge information of a MeterValues request */
+    void fillMeterValuesInfo(Entry& entry, const rapidjson::Document& payload);
+    /** @brief Store the request of an entry */
+    void storeRequest(Entry& entry, const rapidjson::Document& payload, bool update);
+    /** @brief Retrieve the request of an entry */
+    bool loadRequest(const Entry& entry, rapidjson::Document& payload);
+    /** @brief Remove an entry from the FIFO */
+    std::list<Entry>::iterator erase(std::list<Entry>::iterator entry);
+    /** @brief Make room in the FIFO by merging or dropping an old MeterValues request */
+    bool makeRoom();
+    /** @brief Look for the next request of the same connector */
+    std::list<Entry>::iterator nextOnConnector(std::list<Entry>::iterator entry);
 };
 
 } // namespace chargepoint
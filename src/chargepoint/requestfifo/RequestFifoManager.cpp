@@ -20,6 +20,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "AuthentManager.h"
 #include "Connectors.h"
 #include "GenericMessageSender.h"
+#include "IChargePointConfig.h"
 #include "IChargePointEventsHandler.h"
 #include "IOcppConfig.h"
 #include "IStatusManager.h"
@@ -30,6 +31,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "StopTransaction.h"
 #include "WorkerThreadPool.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 using namespace ocpp::types;
 using namespace ocpp::messages;
 
@@ -39,16 +45,18 @@ namespace chargepoint
 {
 
 /** @brief Constructor */
-RequestFifoManager::RequestFifoManager(ocpp::config::IOcppConfig&            ocpp_config,
-                                       IChargePointEventsHandler&            events_handler,
-                                       ocpp::helpers::ITimerPool&            timer_pool,
-                                       ocpp::helpers::WorkerThreadPool&      worker_pool,
-                                       Connectors&                           connectors,
-                                       ocpp::messages::GenericMessageSender& msg_sender,
-                                       ocpp::messages::IRequestFifo&         requests_fifo,
-                                       IStatusManager&                       status_manager,
-                                       AuthentManager&                       authent_manager)
-    : m_ocpp_config(ocpp_config),
+RequestFifoManager::RequestFifoManager(const ocpp::config::IChargePointConfig& stack_config,
+                                       ocpp::config::IOcppConfig&              ocpp_config,
+                                       IChargePointEventsHandler&              events_handler,
+                                       ocpp::helpers::ITimerPool&              timer_pool,
+                                       ocpp::helpers::WorkerThreadPool&        worker_pool,
+                                       Connectors&                             connectors,
+                                       ocpp::messages::GenericMessageSender&   msg_sender,
+                                       ocpp::messages::IRequestFifo&           requests_fifo,
+                                       IStatusManager&                         status_manager,
+                                       AuthentManager&                         authent_manager)
+    : m_stack_config(stack_config),
+      m_ocpp_config(ocpp_config),
       m_events_handler(events_handler),
       m_worker_pool(worker_pool),
       m_connectors(connectors),
@@ -59,7 +67,7 @@ RequestFifoManager::RequestFifoManager(ocpp::config::IOcppConfig&            ocp
       m_request_retry_timer(timer_pool, "Requests FIFO"),
       m_request_retry_count(0)
 {
-    m_request_retry_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&RequestFifoManager::processFifoRequest, this)); });
+    m_request_retry_timer.setCallback([this] { m_worker_pool.post(std::bind(&RequestFifoManager::processFifoRequest, this)); });
     m_requests_fifo.registerListener(this);
 }
 
@@ -80,7 +88,7 @@ void RequestFifoManager::updateConnectionStatus(bool is_connected)
             LOG_INFO << "Restart transaction related FIFO processing";
 
             // Start processing FIFO requests
-            m_worker_pool.run<void>(std::bind(&RequestFifoManager::processFifoRequest, this));
+            m_worker_pool.post(std::bind(&RequestFifoManager::processFifoRequest, this));
         }
     }
 }
@@ -105,166 +113,382 @@ void RequestFifoManager::processFifoRequest()
         // Check registration status
         if (m_status_manager.getRegistrationStatus() == RegistrationStatus::Accepted)
         {
-            do
+            // Send requests
+            size_t replay_depth = m_stack_config.requestFifoReplayDepth();
+            if (replay_depth > 1u)
             {
-                // Get request
-                std::string         action;
-                rapidjson::Document payload;
-                unsigned int        connector_id;
-                if (m_requests_fifo.front(connector_id, action, payload))
-                {
-                    LOG_DEBUG << "Request FIFO processing " << action << " retries : " << m_request_retry_count << "/"
-                              << m_ocpp_config.transactionMessageAttempts();
+                processFifoRequestsPipelined(replay_depth);
+            }
+            else
+            {
+                processFifoRequestsOneByOne();
+            }
 
-                    // Send request
-                    CallResult res;
-                    if (action == START_TRANSACTION_ACTION)
+            // Update current transaction ids if needed
+            if (m_requests_fifo.empty())
+            {
+                for (Connector* connector : m_connectors.getConnectors())
+                {
+                    if (connector->transaction_id < 0)
                     {
-                        // Start transaction => result contains validity information
-                        StartTransactionConf response;
-                        res = m_msg_sender.call(action, payload, response);
-                        if (res == CallResult::Ok)
-                        {
-                            // Extract transaction from the request
-                            StartTransactionReq          request;
-                            StartTransactionReqConverter req_converter;
-                            std::string                  error_message;
-                            const char*                  error_code = nullptr;
-                            req_converter.fromJson(payload, request, error_code, error_message);
-
-                            // Update id tag information
-                            if (response.idTagInfo.status != AuthorizationStatus::ConcurrentTx)
-                            {
-                                m_authent_manager.update(request.idTag, response.idTagInfo);
-                            }
-
-                            // Save the offline transaction id
-                            Connector* connector = m_connectors.getConnector(request.connectorId);
-                            if (connector)
-                            {
-                                connector->transaction_id_offline = response.transactionId;
-                                m_connectors.saveConnector(request.connectorId);
-                            }
-
-                            // Check if transaction has been rejected by the Central System
-                            if (response.idTagInfo.status != AuthorizationStatus::Accepted)
-                            {
-                                // Look for the corresponding transaction
-                                if (connector && (connector->transaction_id < 0) && (connector->transaction_start == request.timestamp))
-                                {
-                                    // Update current transaction id
-                                    connector->transaction_id = connector->transaction_id_offline;
-                                    m_connectors.saveConnector(request.connectorId);
-
-                                    // Notify end of transaction
-                                    m_events_handler.transactionDeAuthorized(connector->id);
-                                }
-                            }
-                        }
+                        connector->transaction_id = connector->transaction_id_offline;
+                        m_connectors.saveConnector(connector->id);
                     }
-                    else if (action == STOP_TRANSACTION_ACTION)
-                    {
-                        // Stop transaction => update transaction id if needed and ignore response
+                }
+            }
+        }
+        else
+        {
+            // Wait to be accepted by the Central System
+            m_request_retry_timer.restart(std::chrono::milliseconds(250u), true);
+        }
+    }
+}
 
-                        int stop_transaction_id = payload["transactionId"].GetInt();
-                        if (stop_transaction_id < 0)
-                        {
-                            // Get the offline transaction id
-                            Connector* connector = m_connectors.getConnector(connector_id);
-                            if (connector)
-                            {
-                                payload["transactionId"].SetInt(connector->transaction_id_offline);
-                            }
-                        }
+/** @brief Send the FIFO requests one at a time */
+void RequestFifoManager::processFifoRequestsOneByOne()
+{
+    do
+    {
+        // Get request
+        std::string         action;
+        rapidjson::Document payload;
+        unsigned int        connector_id;
+        if (m_requests_fifo.front(connector_id, action, payload))
+        {
+            LOG_DEBUG << "Request FIFO processing " << action << " retries : " << m_request_retry_count << "/"
+                      << m_ocpp_config.transactionMessageAttempts();
 
-                        StopTransactionConf response;
-                        res = m_msg_sender.call(action, payload, response);
-                    }
-                    else if (action == METER_VALUES_ACTION)
-                    {
-                        // Meter values => update transaction id if needed and ignore response
+            // Update transaction id if needed
+            prepareRequest(connector_id, action, payload);
 
-                        if (payload.HasMember("transactionId"))
-                        {
-                            int meter_transaction_id = payload["transactionId"].GetInt();
-                            if (meter_transaction_id < 0)
-                            {
-                                // Get the offline transaction id
-                                Connector* connector = m_connectors.getConnector(connector_id);
-                                if (connector)
-                                {
-                                    payload["transactionId"].SetInt(connector->transaction_id_offline);
-                                }
-                            }
-                        }
+            // Send request
+            CallResult res;
+            if (action == START_TRANSACTION_ACTION)
+            {
+                // Start transaction => result contains validity information
+                StartTransactionConf response;
+                res = m_msg_sender.call(action, payload, response);
+                if (res == CallResult::Ok)
+                {
+                    processStartTransactionResponse(payload, response);
+                }
+            }
+            else if (action == STOP_TRANSACTION_ACTION)
+            {
+                // Stop transaction => ignore response
+                StopTransactionConf response;
+                res = m_msg_sender.call(action, payload, response);
+            }
+            else if (action == METER_VALUES_ACTION)
+            {
+                // Meter values => ignore response
+                MeterValuesConf response;
+                res = m_msg_sender.call(action, payload, response);
+            }
+            else if (action == SECURITY_EVENT_NOTIFICATION_ACTION)
+            {
+                // Security events notification => ignore response
+                SecurityEventNotificationConf response;
+                res = m_msg_sender.call(action, payload, response);
+            }
+            else
+            {
+                // Unknown action
+                res = CallResult::Failed;
+            }
+            if (res == CallResult::Ok)
+            {
+                LOG_DEBUG << "Request succeeded";
 
-                        MeterValuesConf response;
-                        res = m_msg_sender.call(action, payload, response);
-                    }
-                    else if (action == SECURITY_EVENT_NOTIFICATION_ACTION)
-                    {
-                        // Security events notification => ignore response
+                // Remove request from the FIFO
+                m_requests_fifo.pop();
+                m_request_retry_count = 0;
+            }
+            else
+            {
+                // Retry or drop the request
+                if (requestFailed())
+                {
+                    m_requests_fifo.pop();
+                }
+            }
+        }
+    } while (!m_requests_fifo.empty() && !m_request_retry_timer.isStarted() && m_msg_sender.isConnected());
+}
 
-                        SecurityEventNotificationConf response;
-                        res = m_msg_sender.call(action, payload, response);
-                    }
-                    else
-                    {
-                        // Unknown action
-                        res = CallResult::Failed;
-                    }
-                    if (res == CallResult::Ok)
-                    {
-                        LOG_DEBUG << "Request succeeded";
+/** @brief Send the FIFO requests by batches of several requests in flight */
+void RequestFifoManager::processFifoRequestsPipelined(size_t replay_depth)
+{
+    /** @brief Shared state between the replay and the RPC callbacks */
+    struct ReplayState
+    {
+        /** @brief Protect the state */
+        std::mutex mutex;
+        /** @brief Signal the reception of the responses */
+        std::condition_variable cond_var;
+        /** @brief Number of requests waiting for their response */
+        size_t pending;
+        /** @brief Result of each request */
+        std::vector<CallResult> results;
+        /** @brief Responses to the StartTransaction requests of the batch, indexed as the requests */
+        std::vector<StartTransactionConf> start_responses;
+    };
 
-                        // Remove request from the FIFO
-                        m_requests_fifo.pop();
-                        m_request_retry_count = 0;
-                    }
-                    else
+    std::vector<IRequestFifo::Request> requests;
+    std::vector<unsigned int>          open_connectors;
+    std::vector<unsigned int>          closed_connectors;
+    size_t                             skipped = 0;
+    auto                               select  = [&](unsigned int connector_id, const std::string& action)
+    {
+        // The requests of a connector are selected until its next StartTransaction or StopTransaction request :
+        // such a request is only sent once all the previous requests of its connector have been processed by the
+        // Central System and no request of its connector is sent with it, since a StartTransaction response provides
+        // the transaction id of the following requests. The other requests (MeterValues, SecurityEventNotification)
+        // are pipelined. The lookup stops when as many requests as the replay depth have been skipped.
+        IRequestFifo::Selection selection = IRequestFifo::Selection::Skip;
+        auto                    is_id     = [connector_id](unsigned int id) { return (id == connector_id); };
+        if (std::none_of(closed_connectors.begin(), closed_connectors.end(), is_id))
+        {
+            bool is_open = std::any_of(open_connectors.begin(), open_connectors.end(), is_id);
+            if ((action == START_TRANSACTION_ACTION) || (action == STOP_TRANSACTION_ACTION))
+            {
+                closed_connectors.push_back(connector_id);
+                if (!is_open)
+                {
+                    selection = IRequestFifo::Selection::Select;
+                }
+            }
+            else
+            {
+                if (!is_open)
+                {
+                    open_connectors.push_back(connector_id);
+                }
+                selection = IRequestFifo::Selection::Select;
+            }
+        }
+        if (selection == IRequestFifo::Selection::Skip)
+        {
+            skipped++;
+            if (skipped > replay_depth)
+            {
+                selection = IRequestFifo::Selection::End;
+            }
+        }
+        return selection;
+    };
+    do
+    {
+        // Get the next batch of requests, only the selected requests are marked as sent in the FIFO
+        open_connectors.clear();
+        closed_connectors.clear();
+        skipped = 0;
+        m_requests_fifo.front(requests, replay_depth, select);
+        if (requests.empty())
+        {
+            break;
+        }
+
+        LOG_DEBUG << "Request FIFO processing " << requests.size() << " request(s), retries : " << m_request_retry_count << "/"
+                  << m_ocpp_config.transactionMessageAttempts();
+
+        // Send the requests in FIFO order, they can be completed in any order
+        auto state     = std::make_shared<ReplayState>();
+        state->pending = 0;
+        state->results.resize(requests.size(), CallResult::Failed);
+        state->start_responses.resize(requests.size());
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            IRequestFifo::Request& request = requests[i];
+            prepareRequest(request.connector_id, request.action, request.payload);
+
+            auto on_response = [state, i](CallResult result)
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->results[i] = result;
+                state->pending--;
+                state->cond_var.notify_all();
+            };
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->pending++;
+            }
+            bool sent = false;
+            if (request.action == START_TRANSACTION_ACTION)
+            {
+                sent = m_msg_sender.callAsync<StartTransactionConf>(
+                    request.action,
+                    request.payload,
+                    [state, on_response, i](CallResult result, const StartTransactionConf& response)
                     {
-                        // Update retry count
-                        m_request_retry_count++;
-                        if (m_request_retry_count > m_ocpp_config.transactionMessageAttempts())
-                        {
-                            // Drop message from the FIFO
-                            LOG_DEBUG << "Request failed, drop message";
-                            m_requests_fifo.pop();
-                            m_request_retry_count = 0;
-                        }
-                        else
                         {
-                            // Schedule next retry
-                            if (m_msg_sender.isConnected())
-                            {
-                                LOG_DEBUG << "Request failed, next retry in " << m_ocpp_config.transactionMessageRetryInterval().count()
-                                          << "second(s)";
-                                m_request_retry_timer.restart(std::chrono::seconds(m_ocpp_config.transactionMessageRetryInterval()), true);
-                            }
+                            std::lock_guard<std::mutex> lock(state->mutex);
+                            state->start_responses[i] = response;
                         }
-                    }
-                }
-            } while (!m_requests_fifo.empty() && !m_request_retry_timer.isStarted() && m_msg_sender.isConnected());
+                        on_response(result);
+                    });
+            }
+            else if (request.action == STOP_TRANSACTION_ACTION)
+            {
+                sent = m_msg_sender.callAsync<StopTransactionConf>(
+                    request.action, request.payload, [on_response](CallResult result, const StopTransactionConf&) { on_response(result); });
+            }
+            else if (request.action == METER_VALUES_ACTION)
+            {
+                sent = m_msg_sender.callAsync<MeterValuesConf>(
+                    request.action, request.payload, [on_response](CallResult result, const MeterValuesConf&) { on_response(result); });
+            }
+            else if (request.action == SECURITY_EVENT_NOTIFICATION_ACTION)
+            {
+                sent = m_msg_sender.callAsync<SecurityEventNotificationConf>(
+                    request.action,
+                    request.payload,
+                    [on_response](CallResult result, const SecurityEventNotificationConf&) { on_response(result); });
+            }
+            else
+            {
+                // Unknown action => failed
+                on_response(CallResult::Failed);
+                continue;
+            }
+            if (!sent)
+            {
+                // Connection lost, the remaining requests will be sent later
+                on_response(CallResult::Failed);
+                requests.resize(i + 1u);
+                break;
+            }
+        }
 
-            // Update current transaction ids if needed
-            if (m_requests_fifo.empty())
+        // Wait for all the responses, the timeouts are handled by the RPC
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->cond_var.wait(lock, [&state] { return (state->pending == 0); });
+        }
+
+        // Process the responses in FIFO order : the successful requests have been processed by the Central System
+        // and are removed from the FIFO, the first failed request is retried or dropped after the configured number
+        // of attempts, the other failed requests will be sent again with the next batch, before the next
+        // StartTransaction or StopTransaction request of their connector
+        bool failed = false;
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            IRequestFifo::Request& request = requests[i];
+            if (state->results[i] == CallResult::Ok)
             {
-                for (Connector* connector : m_connectors.getConnectors())
+                if (request.action == START_TRANSACTION_ACTION)
                 {
-                    if (connector->transaction_id < 0)
-                    {
-                        connector->transaction_id = connector->transaction_id_offline;
-                        m_connectors.saveConnector(connector->id);
-                    }
+                    processStartTransactionResponse(request.payload, state->start_responses[i]);
+                }
+                m_requests_fifo.pop(request.id);
+                if (!failed)
+                {
+                    m_request_retry_count = 0;
+                }
+            }
+            else if (!failed)
+            {
+                failed = true;
+                if (requestFailed())
+                {
+                    m_requests_fifo.pop(request.id);
                 }
             }
         }
-        else
+        if (!failed)
         {
-            // Wait to be accepted by the Central System
-            m_request_retry_timer.restart(std::chrono::milliseconds(250u), true);
+            LOG_DEBUG << "Requests succeeded";
+        }
+    } while (!m_requests_fifo.empty() && !m_request_retry_timer.isStarted() && m_msg_sender.isConnected());
+}
+
+/** @brief Update the transaction id of a request if needed before sending it */
+void RequestFifoManager::prepareRequest(unsigned int connector_id, const std::string& action, rapidjson::Document& payload)
+{
+    // Stop transaction and meter values => requests stored while the transaction id was not known
+    // yet use a negative transaction id, which must be replaced by the one received from the
+    // Central System
+    if ((action == STOP_TRANSACTION_ACTION) || (action == METER_VALUES_ACTION))
+    {
+        auto it = payload.FindMember("transactionId");
+        if ((it != payload.MemberEnd()) && it->value.IsInt() && (it->value.GetInt() < 0))
+        {
+            // Get the offline transaction id
+            Connector* connector = m_connectors.getConnector(connector_id);
+            if (connector)
+            {
+                it->value.SetInt(connector->transaction_id_offline);
+            }
+        }
+    }
+}
+
+/** @brief Process the response to a StartTransaction request */
+void RequestFifoManager::processStartTransactionResponse(const rapidjson::Document& payload, const StartTransactionConf& response)
+{
+    // Extract transaction from the request
+    StartTransactionReq          request;
+    StartTransactionReqConverter req_converter;
+    std::string                  error_message;
+    const char*                  error_code = nullptr;
+    req_converter.fromJson(payload, request, error_code, error_message);
+
+    // Update id tag information
+    if (response.idTagInfo.status != AuthorizationStatus::ConcurrentTx)
+    {
+        m_authent_manager.update(request.idTag, response.idTagInfo);
+    }
+
+    // Save the offline transaction id
+    Connector* connector = m_connectors.getConnector(request.connectorId);
+    if (connector)
+    {
+        connector->transaction_id_offline = response.transactionId;
+        m_connectors.saveConnector(request.connectorId);
+    }
+
+    // Check if transaction has been rejected by the Central System
+    if (response.idTagInfo.status != AuthorizationStatus::Accepted)
+    {
+        // Look for the corresponding transaction
+        if (connector && (connector->transaction_id < 0) && (connector->transaction_start == request.timestamp))
+        {
+            // Update current transaction id
+            connector->transaction_id = connector->transaction_id_offline;
+            m_connectors.saveConnector(request.connectorId);
+
+            // Notify end of transaction
+            m_events_handler.transactionDeAuthorized(connector->id);
+        }
+    }
+}
+
+/** @brief Handle a failed request : schedule a retry or indicate that it must be dropped */
+bool RequestFifoManager::requestFailed()
+{
+    bool drop = false;
+
+    // Update retry count
+    m_request_retry_count++;
+    if (m_request_retry_count > m_ocpp_config.transactionMessageAttempts())
+    {
+        // Drop message from the FIFO
+        LOG_DEBUG << "Request failed, drop message";
+        m_request_retry_count = 0;
+        drop                  = true;
+    }
+    else
+    {
+        // Schedule next retry
+        if (m_msg_sender.isConnected())
+        {
+            LOG_DEBUG << "Request failed, next retry in " << m_ocpp_config.transactionMessageRetryInterval().count() << "second(s)";
+            m_request_retry_timer.restart(std::chrono::seconds(m_ocpp_config.transactionMessageRetryInterval()), true);
         }
     }
+
+    return drop;
 }
 
 } // namespace chargepoint
@@ -22,16 +22,20 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRequestFifo.h"
 #include "Timer.h"
 
+#include <vector>
+
 namespace ocpp
 {
 // Forward declarations
 namespace config
 {
+class IChargePointConfig;
 class IOcppConfig;
 } // namespace config
 namespace messages
 {
 class GenericMessageSender;
+struct StartTransactionConf;
 } // namespace messages
 namespace helpers
 {
@@ -52,15 +56,16 @@ class RequestFifoManager : public ocpp::messages::IRequestFifo::IListener
 {
   public:
     /** @brief Constructor */
-    RequestFifoManager(ocpp::config::IOcppConfig&            ocpp_config,
-                       IChargePointEventsHandler&            events_handler,
-                       ocpp::helpers::ITimerPool&            timer_pool,
-                       ocpp::helpers::WorkerThreadPool&      worker_pool,
-                       Connectors&                           connectors,
-                       ocpp::messages::GenericMessageSender& msg_sender,
-                       ocpp::messages::IRequestFifo&         requests_fifo,
-                       IStatusManager&                       status_manager,
-                       AuthentManager&                       authent_manager);
+    RequestFifoManager(const ocpp::config::IChargePointConfig& stack_config,
+                       ocpp::config::IOcppConfig&              ocpp_config,
+                       IChargePointEventsHandler&              events_handler,
+                       ocpp::helpers::ITimerPool&              timer_pool,
+                       ocpp::helpers::WorkerThreadPool&        worker_pool,
+                       Connectors&                             connectors,
+                       ocpp::messages::GenericMessageSender&   msg_sender,
+                       ocpp::messages::IRequestFifo&           requests_fifo,
+                       IStatusManager&                         status_manager,
+                       AuthentManager&                         authent_manager);
 
     /** @brief Destructor */
     virtual ~RequestFifoManager();
@@ -77,6 +82,8 @@ class RequestFifoManager : public ocpp::messages::IRequestFifo::IListener
     void requestQueued() override;
 
   private:
+    /** @brief Stack configuration */
+    const ocpp::config::IChargePointConfig& m_stack_config;
     /** @brief Standard OCPP configuration */
     ocpp::config::IOcppConfig& m_ocpp_config;
     /** @brief User defined events handler */
@@ -101,6 +108,16 @@ class RequestFifoManager : public ocpp::messages::IRequestFifo::IListener
 
     /** @brief Process a FIFO request */
     void processFifoRequest();
+    /** @brief Send the FIFO requests one at a time */
+    void processFifoRequestsOneByOne();
+    /** @brief Send the FIFO requests by batches of several requests in flight */
+    void processFifoRequestsPipelined(size_t replay_depth);
+    /** @brief Update the transaction id of a request if needed before sending it */
+    void prepareRequest(unsigned int connector_id, const std::string& action, rapidjson::Document& payload);
+    /** @brief Process the response to a StartTransaction request */
+    void processStartTransactionResponse(const rapidjson::Document& payload, const ocpp::messages::StartTransactionConf& response);
+    /** @brief Handle a failed request : schedule a retry or indicate that it must be dropped */
+    bool requestFailed();
 };
 
 } // namespace chargepoint
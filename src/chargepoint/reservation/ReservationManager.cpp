@@ -220,7 +220,7 @@ bool ReservationManager::handleMessage(const ocpp::messages::ReserveNowReq& requ
                     response.status                      = ReservationStatus::Accepted;
 
                     // Update connector status and notify new status
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, connector]
                         {
                             m_status_manager.updateConnectorStatus(connector->id, ChargePointStatus::Reserved);
@@ -288,7 +288,7 @@ bool ReservationManager::handleMessage(const ocpp::messages::CancelReservationRe
         if ((connector->status == ChargePointStatus::Reserved) && (connector->reservation_id == request.reservationId))
         {
             // Cancel reservation
-            m_worker_pool.run<void>([this, &connector] { endReservation(connector->id, true); });
+            m_worker_pool.post([this, &connector] { endReservation(connector->id, true); });
 
             // Prepare response
             response.status = CancelReservationStatus::Accepted;
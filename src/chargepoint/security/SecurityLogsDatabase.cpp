@@ -164,12 +164,18 @@ void SecurityLogsDatabase::initDatabaseTable()
                 LOG_ERROR << "Could not create security logs table  : " << query->lastError();
             }
         }
+
+        // Rotation in constant time using the ids (see LogDatabase)
+        query = m_database.query("DROP TRIGGER IF EXISTS delete_oldest_SecurityLogs;");
+        if (query)
+        {
+            query->exec();
+        }
         std::stringstream trigger_query;
-        trigger_query << "CREATE TRIGGER delete_oldest_SecurityLogs AFTER INSERT ON SecurityLogs WHEN "
-                         " ((SELECT count() FROM SecurityLogs) > ";
+        trigger_query << "CREATE TRIGGER delete_oldest_SecurityLogs AFTER INSERT ON SecurityLogs BEGIN "
+                         "DELETE FROM SecurityLogs WHERE [id] <= (NEW.[id] - ";
         trigger_query << m_stack_config.securityLogMaxEntriesCount();
-        trigger_query << ") BEGIN DELETE FROM SecurityLogs WHERE ROWID IN "
-                         "(SELECT ROWID FROM SecurityLogs LIMIT 1);END;";
+        trigger_query << ");END;";
         query = m_database.query(trigger_query.str());
         if (query)
         {
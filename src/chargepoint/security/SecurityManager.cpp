@@ -319,7 +319,6 @@ bool SecurityManager::logSecurityEvent(const std::string& type, const std::strin
                 // Stack is not started, queue the notification
                 rapidjson::Document payload;
                 payload.Parse("{}");
-                m_security_event_req_converter.setAllocator(&payload.GetAllocator());
                 if (m_security_event_req_converter.toJson(request, payload))
                 {
                     m_requests_fifo.push(0, SECURITY_EVENT_NOTIFICATION_ACTION, payload);
@@ -376,7 +375,7 @@ bool SecurityManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType messa
 
     if (message == MessageTriggerEnumType::SignChargePointCertificate)
     {
-        m_worker_pool.run<void>(
+        m_worker_pool.post(
             [this]
             {
                 // To let some time for the trigger message reply
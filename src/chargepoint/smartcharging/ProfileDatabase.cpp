@@ -340,7 +340,6 @@ std::string ProfileDatabase::serialize(const ocpp::types::ChargingProfile& profi
     rapidjson::Document profile_json;
     profile_json.Parse("{}");
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(&profile_json.GetAllocator());
     charging_profile_converter.toJson(profile, profile_json);
 
     rapidjson::StringBuffer                    buffer;
@@ -358,7 +357,6 @@ bool ProfileDatabase::deserialize(const std::string& profile_str, ocpp::types::C
     rapidjson::Document profile_json;
     profile_json.Parse(profile_str.c_str());
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(&profile_json.GetAllocator());
     return charging_profile_converter.fromJson(profile_json, profile, error_code, error_message);
 }
 
@@ -209,7 +209,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTrigger message, const
     {
         case MessageTrigger::BootNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -221,7 +221,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTrigger message, const
 
         case MessageTrigger::Heartbeat:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -236,7 +236,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTrigger message, const
             if (connector_id.isSet())
             {
                 unsigned int id = connector_id;
-                m_worker_pool.run<void>(
+                m_worker_pool.post(
                     [this, id]
                     {
                         // To let some time for the trigger message reply
@@ -249,7 +249,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTrigger message, const
                 for (const Connector* connector : m_connectors.getConnectors())
                 {
                     unsigned int id = connector->id;
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, id]
                         {
                             // To let some time for the trigger message reply
@@ -279,7 +279,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType message
     {
         case MessageTriggerEnumType::BootNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -291,7 +291,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType message
 
         case MessageTriggerEnumType::Heartbeat:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -306,7 +306,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType message
             if (connector_id.isSet())
             {
                 unsigned int id = connector_id;
-                m_worker_pool.run<void>(
+                m_worker_pool.post(
                     [this, id]
                     {
                         // To let some time for the trigger message reply
@@ -319,7 +319,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType message
                 for (const Connector* connector : m_connectors.getConnectors())
                 {
                     unsigned int id = connector->id;
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, id]
                         {
                             // To let some time for the trigger message reply
@@ -371,7 +371,7 @@ bool StatusManager::handleMessage(const ocpp::messages::ChangeAvailabilityReq& r
             {
                 status = ChargePointStatus::Available;
             }
-            m_worker_pool.run<void>([this, connector_id, status] { updateConnectorStatus(connector_id, status); });
+            m_worker_pool.post([this, connector_id, status] { updateConnectorStatus(connector_id, status); });
             ret = true;
         }
 
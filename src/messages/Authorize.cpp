@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a AuthorizationStatus enum to string */
-const EnumToStringFromString<AuthorizationStatus> AuthorizationStatusHelper = {{AuthorizationStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<AuthorizationStatus> AuthorizationStatusHelper = {{AuthorizationStatus::Accepted, "Accepted"},
                                                                                {AuthorizationStatus::Blocked, "Blocked"},
                                                                                {AuthorizationStatus::ConcurrentTx, "ConcurrentTx"},
                                                                                {AuthorizationStatus::Expired, "Expired"},
@@ -66,14 +66,18 @@ bool AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
 /** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, const char*&, std::string&) */
 bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Document& json)
 {
-    IdTagInfoConverter id_tag_info_converter;
-    id_tag_info_converter.setAllocator(allocator);
-    rapidjson::Document id_tag_info;
-    id_tag_info.Parse("{}");
-    bool ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
+    IdTagInfoConverter  id_tag_info_converter;
+    rapidjson::Document id_tag_info(rapidjson::kObjectType, &json.GetAllocator());
+    bool                ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
+    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), json.GetAllocator());
     return ret;
 }
 
+/** @brief Single pass decoding binding for Authorize.req message */
+JSON_BINDING_FIELDS(AuthorizeReq, nullptr, JSON_FIELD(AuthorizeReq, idTag))
+
+/** @brief Single pass decoding binding for Authorize.conf message */
+JSON_BINDING_FIELDS(AuthorizeConf, nullptr, JSON_FIELD(AuthorizeConf, idTagInfo))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a RegistrationStatus enum to string */
-const EnumToStringFromString<RegistrationStatus> RegistrationStatusHelper = {
+constexpr EnumToStringFromString<RegistrationStatus> RegistrationStatusHelper = {
     {RegistrationStatus::Accepted, "Accepted"}, {RegistrationStatus::Pending, "Pending"}, {RegistrationStatus::Rejected, "Rejected"}};
 } // namespace types
 namespace messages
@@ -90,11 +90,31 @@ bool BootNotificationConfConverter::fromJson(const rapidjson::Value& json,
 /** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, const char*&, std::string&) */
 bool BootNotificationConfConverter::toJson(const BootNotificationConf& data, rapidjson::Document& json)
 {
-    fill(json, "currentTime", data.currentTime.str());
+    fill(json, "currentTime", data.currentTime);
     fill(json, "interval", data.interval);
     fill(json, "status", RegistrationStatusHelper.toString(data.status));
     return true;
 }
 
+/** @brief Single pass decoding binding for BootNotification.req message */
+JSON_BINDING_FIELDS(BootNotificationReq,
+                    nullptr,
+                    JSON_FIELD(BootNotificationReq, chargeBoxSerialNumber),
+                    JSON_FIELD(BootNotificationReq, chargePointModel),
+                    JSON_FIELD(BootNotificationReq, chargePointSerialNumber),
+                    JSON_FIELD(BootNotificationReq, chargePointVendor),
+                    JSON_FIELD(BootNotificationReq, firmwareVersion),
+                    JSON_FIELD(BootNotificationReq, iccid),
+                    JSON_FIELD(BootNotificationReq, imsi),
+                    JSON_FIELD(BootNotificationReq, meterSerialNumber),
+                    JSON_FIELD(BootNotificationReq, meterType))
+
+/** @brief Single pass decoding binding for BootNotification.conf message */
+JSON_BINDING_FIELDS(BootNotificationConf,
+                    nullptr,
+                    JSON_FIELD(BootNotificationConf, currentTime),
+                    JSON_FIELD(BootNotificationConf, interval),
+                    JSON_ENUM_FIELD(BootNotificationConf, status, RegistrationStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class CancelReservationStatus enum to string */
-const EnumToStringFromString<CancelReservationStatus> CancelReservationStatusHelper = {{CancelReservationStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<CancelReservationStatus> CancelReservationStatusHelper = {{CancelReservationStatus::Accepted, "Accepted"},
                                                                                        {CancelReservationStatus::Rejected, "Rejected"}};
 
 } // namespace types
@@ -71,5 +71,11 @@ bool CancelReservationConfConverter::toJson(const CancelReservationConf& data, r
     return true;
 }
 
+/** @brief Single pass decoding binding for CancelReservation.req message */
+JSON_BINDING_FIELDS(CancelReservationReq, nullptr, JSON_FIELD(CancelReservationReq, reservationId))
+
+/** @brief Single pass decoding binding for CancelReservation.conf message */
+JSON_BINDING_FIELDS(CancelReservationConf, nullptr, JSON_ENUM_FIELD(CancelReservationConf, status, CancelReservationStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class CertificateSignedStatusEnumType enum to string */
-const EnumToStringFromString<CertificateSignedStatusEnumType> CertificateSignedStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<CertificateSignedStatusEnumType> CertificateSignedStatusEnumTypeHelper = {
     {CertificateSignedStatusEnumType::Accepted, "Accepted"}, {CertificateSignedStatusEnumType::Rejected, "Rejected"}};
 
 } // namespace types
@@ -71,5 +71,11 @@ bool CertificateSignedConfConverter::toJson(const CertificateSignedConf& data, r
     return true;
 }
 
+/** @brief Single pass decoding binding for CertificateSigned.req message */
+JSON_BINDING_FIELDS(CertificateSignedReq, nullptr, JSON_FIELD(CertificateSignedReq, certificateChain))
+
+/** @brief Single pass decoding binding for CertificateSigned.conf message */
+JSON_BINDING_FIELDS(CertificateSignedConf, nullptr, JSON_ENUM_FIELD(CertificateSignedConf, status, CertificateSignedStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
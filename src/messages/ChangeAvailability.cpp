@@ -26,11 +26,11 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a AvailabilityType enum to string */
-const EnumToStringFromString<AvailabilityType> AvailabilityTypeHelper = {{AvailabilityType::Inoperative, "Inoperative"},
+constexpr EnumToStringFromString<AvailabilityType> AvailabilityTypeHelper = {{AvailabilityType::Inoperative, "Inoperative"},
                                                                          {AvailabilityType::Operative, "Operative"}};
 
 /** @brief Helper to convert a AvailabilityStatus enum to string */
-const EnumToStringFromString<AvailabilityStatus> AvailabilityStatusHelper = {
+constexpr EnumToStringFromString<AvailabilityStatus> AvailabilityStatusHelper = {
     {AvailabilityStatus::Accepted, "Accepted"}, {AvailabilityStatus::Rejected, "Rejected"}, {AvailabilityStatus::Scheduled, "Scheduled"}};
 
 } // namespace types
@@ -80,5 +80,14 @@ bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf& data,
     return true;
 }
 
+/** @brief Single pass decoding binding for ChangeAvailability.req message */
+JSON_BINDING_FIELDS(ChangeAvailabilityReq,
+                    nullptr,
+                    JSON_FIELD(ChangeAvailabilityReq, connectorId),
+                    JSON_ENUM_FIELD(ChangeAvailabilityReq, type, AvailabilityTypeHelper))
+
+/** @brief Single pass decoding binding for ChangeAvailability.conf message */
+JSON_BINDING_FIELDS(ChangeAvailabilityConf, nullptr, JSON_ENUM_FIELD(ChangeAvailabilityConf, status, AvailabilityStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a ConfigurationStatus enum to string */
-const EnumToStringFromString<ConfigurationStatus> ConfigurationStatusHelper = {{ConfigurationStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<ConfigurationStatus> ConfigurationStatusHelper = {{ConfigurationStatus::Accepted, "Accepted"},
                                                                                {ConfigurationStatus::Rejected, "Rejected"},
                                                                                {ConfigurationStatus::RebootRequired, "RebootRequired"},
                                                                                {ConfigurationStatus::NotSupported, "NotSupported"}};
@@ -75,5 +75,11 @@ bool ChangeConfigurationConfConverter::toJson(const ChangeConfigurationConf& dat
     return true;
 }
 
+/** @brief Single pass decoding binding for ChangeConfiguration.req message */
+JSON_BINDING_FIELDS(ChangeConfigurationReq, nullptr, JSON_FIELD(ChangeConfigurationReq, key), JSON_FIELD(ChangeConfigurationReq, value))
+
+/** @brief Single pass decoding binding for ChangeConfiguration.conf message */
+JSON_BINDING_FIELDS(ChangeConfigurationConf, nullptr, JSON_ENUM_FIELD(ChangeConfigurationConf, status, ConfigurationStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a ClearCacheStatus enum to string */
-const EnumToStringFromString<ClearCacheStatus> ClearCacheStatusHelper = {{ClearCacheStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<ClearCacheStatus> ClearCacheStatusHelper = {{ClearCacheStatus::Accepted, "Accepted"},
                                                                          {ClearCacheStatus::Rejected, "Rejected"}};
 } // namespace types
 
@@ -74,5 +74,11 @@ bool ClearCacheConfConverter::toJson(const ClearCacheConf& data, rapidjson::Docu
     return true;
 }
 
+/** @brief Single pass decoding binding for ClearCache.req message */
+JSON_BINDING_EMPTY(ClearCacheReq)
+
+/** @brief Single pass decoding binding for ClearCache.conf message */
+JSON_BINDING_FIELDS(ClearCacheConf, nullptr, JSON_ENUM_FIELD(ClearCacheConf, status, ClearCacheStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,13 +27,13 @@ namespace types
 {
 
 /** @brief Helper to convert a enum class ChargingProfilePurposeType enum to string */
-const EnumToStringFromString<ChargingProfilePurposeType> ChargingProfilePurposeTypeHelper = {
+constexpr EnumToStringFromString<ChargingProfilePurposeType> ChargingProfilePurposeTypeHelper = {
     {ChargingProfilePurposeType::ChargePointMaxProfile, "ChargePointMaxProfile"},
     {ChargingProfilePurposeType::TxDefaultProfile, "TxDefaultProfile"},
     {ChargingProfilePurposeType::TxProfile, "TxProfile"}};
 
 /** @brief Helper to convert a enum class ClearChargingProfileStatus enum to string */
-const EnumToStringFromString<ClearChargingProfileStatus> ClearChargingProfileStatusHelper = {
+constexpr EnumToStringFromString<ClearChargingProfileStatus> ClearChargingProfileStatusHelper = {
     {ClearChargingProfileStatus::Accepted, "Accepted"}, {ClearChargingProfileStatus::Unknown, "Unknown"}};
 
 } // namespace types
@@ -92,5 +92,16 @@ bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf& d
     return true;
 }
 
+/** @brief Single pass decoding binding for ClearChargingProfile.req message */
+JSON_BINDING_FIELDS(ClearChargingProfileReq,
+                    nullptr,
+                    JSON_FIELD(ClearChargingProfileReq, id),
+                    JSON_FIELD(ClearChargingProfileReq, connectorId),
+                    JSON_ENUM_FIELD(ClearChargingProfileReq, chargingProfilePurpose, ChargingProfilePurposeTypeHelper),
+                    JSON_FIELD(ClearChargingProfileReq, stackLevel))
+
+/** @brief Single pass decoding binding for ClearChargingProfile.conf message */
+JSON_BINDING_FIELDS(ClearChargingProfileConf, nullptr, JSON_ENUM_FIELD(ClearChargingProfileConf, status, ClearChargingProfileStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
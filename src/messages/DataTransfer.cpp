@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class DataTransferStatus enum to string */
-const EnumToStringFromString<DataTransferStatus> DataTransferStatusHelper = {{DataTransferStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<DataTransferStatus> DataTransferStatusHelper = {{DataTransferStatus::Accepted, "Accepted"},
                                                                              {DataTransferStatus::Rejected, "Rejected"},
                                                                              {DataTransferStatus::UnknownMessageId, "UnknownMessageId"},
                                                                              {DataTransferStatus::UnknownVendorId, "UnknownVendorId"}};
@@ -79,5 +79,18 @@ bool DataTransferConfConverter::toJson(const DataTransferConf& data, rapidjson::
     return true;
 }
 
+/** @brief Single pass decoding binding for DataTransfer.req message */
+JSON_BINDING_FIELDS(DataTransferReq,
+                    nullptr,
+                    JSON_FIELD(DataTransferReq, vendorId),
+                    JSON_FIELD(DataTransferReq, messageId),
+                    JSON_FIELD(DataTransferReq, data))
+
+/** @brief Single pass decoding binding for DataTransfer.conf message */
+JSON_BINDING_FIELDS(DataTransferConf,
+                    nullptr,
+                    JSON_ENUM_FIELD(DataTransferConf, status, DataTransferStatusHelper),
+                    JSON_FIELD(DataTransferConf, data))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class DeleteCertificateStatusEnumType enum to string */
-const EnumToStringFromString<DeleteCertificateStatusEnumType> DeleteCertificateStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<DeleteCertificateStatusEnumType> DeleteCertificateStatusEnumTypeHelper = {
     {DeleteCertificateStatusEnumType::Accepted, "Accepted"},
     {DeleteCertificateStatusEnumType::Failed, "Failed"},
     {DeleteCertificateStatusEnumType::NotFound, "NotFound"}};
@@ -50,11 +50,9 @@ bool DeleteCertificateReqConverter::fromJson(const rapidjson::Value& json,
 bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rapidjson::Document& json)
 {
     CertificateHashDataTypeConverter certificate_hash_converter;
-    certificate_hash_converter.setAllocator(allocator);
-    rapidjson::Document value;
-    value.Parse("{}");
-    bool ret = certificate_hash_converter.toJson(data.certificateHashData, value);
-    json.AddMember(rapidjson::StringRef("certificateHashData"), value.Move(), *allocator);
+    rapidjson::Document              value(rapidjson::kObjectType, &json.GetAllocator());
+    bool                             ret = certificate_hash_converter.toJson(data.certificateHashData, value);
+    json.AddMember(rapidjson::StringRef("certificateHashData"), value.Move(), json.GetAllocator());
     return ret;
 }
 
@@ -77,5 +75,11 @@ bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf& data, r
     return true;
 }
 
+/** @brief Single pass decoding binding for DeleteCertificate.req message */
+JSON_BINDING_FIELDS(DeleteCertificateReq, nullptr, JSON_FIELD(DeleteCertificateReq, certificateHashData))
+
+/** @brief Single pass decoding binding for DeleteCertificate.conf message */
+JSON_BINDING_FIELDS(DeleteCertificateConf, nullptr, JSON_ENUM_FIELD(DeleteCertificateConf, status, DeleteCertificateStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
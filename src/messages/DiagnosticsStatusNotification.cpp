@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class DiagnosticsStatus enum to string */
-const EnumToStringFromString<DiagnosticsStatus> DiagnosticsStatusHelper = {{DiagnosticsStatus::Idle, "Idle"},
+constexpr EnumToStringFromString<DiagnosticsStatus> DiagnosticsStatusHelper = {{DiagnosticsStatus::Idle, "Idle"},
                                                                            {DiagnosticsStatus::Uploaded, "Uploaded"},
                                                                            {DiagnosticsStatus::UploadFailed, "UploadFailed"},
                                                                            {DiagnosticsStatus::Uploading, "Uploading"}};
@@ -76,5 +76,13 @@ bool DiagnosticsStatusNotificationConfConverter::toJson(const DiagnosticsStatusN
     return true;
 }
 
+/** @brief Single pass decoding binding for DiagnosticsStatusNotification.req message */
+JSON_BINDING_FIELDS(DiagnosticsStatusNotificationReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(DiagnosticsStatusNotificationReq, status, DiagnosticsStatusHelper))
+
+/** @brief Single pass decoding binding for DiagnosticsStatusNotification.conf message */
+JSON_BINDING_EMPTY(DiagnosticsStatusNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a MessageTriggerEnumType enum to string */
-const EnumToStringFromString<MessageTriggerEnumType> MessageTriggerEnumTypeHelper = {
+constexpr EnumToStringFromString<MessageTriggerEnumType> MessageTriggerEnumTypeHelper = {
     {MessageTriggerEnumType::BootNotification, "BootNotification"},
     {MessageTriggerEnumType::LogStatusNotification, "LogStatusNotification"},
     {MessageTriggerEnumType::FirmwareStatusNotification, "FirmwareStatusNotification"},
@@ -36,7 +36,7 @@ const EnumToStringFromString<MessageTriggerEnumType> MessageTriggerEnumTypeHelpe
     {MessageTriggerEnumType::SignChargePointCertificate, "SignChargePointCertificate"}};
 
 /** @brief Helper to convert a TriggerMessageStatusEnumType enum to string */
-const EnumToStringFromString<TriggerMessageStatusEnumType> TriggerMessageStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<TriggerMessageStatusEnumType> TriggerMessageStatusEnumTypeHelper = {
     {TriggerMessageStatusEnumType::Accepted, "Accepted"},
     {TriggerMessageStatusEnumType::NotImplemented, "NotImplemented"},
     {TriggerMessageStatusEnumType::Rejected, "Rejected"}};
@@ -89,5 +89,28 @@ bool ExtendedTriggerMessageConfConverter::toJson(const ExtendedTriggerMessageCon
     return true;
 }
 
+/** @brief Set the default connector id of an ExtendedTriggerMessage.req message */
+static bool completeExtendedTriggerMessageReq(void* data, std::string& error_message)
+{
+    (void)error_message;
+    ExtendedTriggerMessageReq& request = *reinterpret_cast<ExtendedTriggerMessageReq*>(data);
+    if (!request.connectorId.isSet())
+    {
+        request.connectorId = 0;
+    }
+    return true;
+}
+
+/** @brief Single pass decoding binding for ExtendedTriggerMessage.req message */
+JSON_BINDING_FIELDS(ExtendedTriggerMessageReq,
+                    &completeExtendedTriggerMessageReq,
+                    JSON_ENUM_FIELD(ExtendedTriggerMessageReq, requestedMessage, MessageTriggerEnumTypeHelper),
+                    JSON_FIELD(ExtendedTriggerMessageReq, connectorId))
+
+/** @brief Single pass decoding binding for ExtendedTriggerMessage.conf message */
+JSON_BINDING_FIELDS(ExtendedTriggerMessageConf,
+                    nullptr,
+                    JSON_ENUM_FIELD(ExtendedTriggerMessageConf, status, TriggerMessageStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class FirmwareStatus enum to string */
-const EnumToStringFromString<FirmwareStatus> FirmwareStatusHelper = {{FirmwareStatus::Downloaded, "Downloaded"},
+constexpr EnumToStringFromString<FirmwareStatus> FirmwareStatusHelper = {{FirmwareStatus::Downloaded, "Downloaded"},
                                                                      {FirmwareStatus::DownloadFailed, "DownloadFailed"},
                                                                      {FirmwareStatus::Downloading, "Downloading"},
                                                                      {FirmwareStatus::Idle, "Idle"},
@@ -80,5 +80,11 @@ bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotific
     return true;
 }
 
+/** @brief Single pass decoding binding for FirmwareStatusNotification.req message */
+JSON_BINDING_FIELDS(FirmwareStatusNotificationReq, nullptr, JSON_ENUM_FIELD(FirmwareStatusNotificationReq, status, FirmwareStatusHelper))
+
+/** @brief Single pass decoding binding for FirmwareStatusNotification.conf message */
+JSON_BINDING_EMPTY(FirmwareStatusNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
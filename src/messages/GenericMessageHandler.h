@@ -22,6 +22,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GenericMessagesConverter.h"
 #include "IMessageConverter.h"
 #include "IMessageDispatcher.h"
+#include "IRpc.h"
+#include "MessageDecoder.h"
 
 namespace ocpp
 {
@@ -36,7 +38,8 @@ class GenericMessageHandler : public IMessageDispatcher::IMessageHandler
     /** @brief Constructor */
     GenericMessageHandler(const std::string& action, const GenericMessagesConverter& messages_converter)
         : m_request_converter(*messages_converter.getRequestConverter<RequestType>(action)),
-          m_response_converter(*messages_converter.getResponseConverter<ResponseType>(action))
+          m_response_converter(*messages_converter.getResponseConverter<ResponseType>(action)),
+          m_request_decoder()
     {
     }
 
@@ -60,21 +63,74 @@ class GenericMessageHandler : public IMessageDispatcher::IMessageHandler
 
         // Convert request
         RequestType request;
-        if (m_request_converter.fromJson(payload, request, error_code, error_message))
+        bool        decoded;
+        if (m_request_decoder)
         {
-            // Handle message
-            ResponseType resp;
-            if (handleMessage(request, resp, error_code, error_message))
+            decoded = m_request_decoder->decode(payload, request, error_code, error_message);
+        }
+        else
+        {
+            decoded = m_request_converter.fromJson(payload, request, error_code, error_message);
+        }
+        if (decoded)
+        {
+            ret = handleRequest(request, response, error_code, error_message);
+        }
+
+        return ret;
+    }
+
+    /** @copydoc bool IMessageHandler::handle(const std::string&
+                                              const char*,
+                                              size_t,
+                                              rapidjson::Document&
+                                              const char*&
+                                              std::string&) */
+    bool handle(const std::string&   action,
+                const char*          payload,
+                size_t               size,
+                rapidjson::Document& response,
+                const char*&         error_code,
+                std::string&         error_message) override
+    {
+        bool ret = false;
+        if (m_request_decoder)
+        {
+            // Validate and convert request in a single pass over the JSON text
+            RequestType request;
+            if (m_request_decoder->decode(payload, size, request, error_code, error_message))
             {
-                // Convert response
-                m_response_converter.setAllocator(&response.GetAllocator());
-                ret = m_response_converter.toJson(resp, response);
+                ret = handleRequest(request, response, error_code, error_message);
+            }
+        }
+        else
+        {
+            // Parse request before converting it
+            rapidjson::Document json;
+            json.Parse(payload, size);
+            if (json.HasParseError())
+            {
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_FORMATION_VIOLATION;
+                error_message = rapidjson::GetParseError_En(json.GetParseError());
+            }
+            else
+            {
+                ret = handle(action, json, response, error_code, error_message);
             }
         }
-
         return ret;
     }
 
+    /** @copydoc bool IMessageHandler::enableSinglePassDecoding(const std::shared_ptr<const ocpp::json::JsonSchemaTree>&) */
+    bool enableSinglePassDecoding(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema) override
+    {
+        if (!m_request_decoder)
+        {
+            m_request_decoder = MessageDecoder::get(schema, JsonBinder<RequestType>::get());
+        }
+        return (m_request_decoder != nullptr);
+    }
+
     /**
      * @brief Handle an incoming call request
      * @param request Payload of the request
@@ -88,6 +144,24 @@ class GenericMessageHandler : public IMessageDispatcher::IMessageHandler
   private:
     IMessageConverter<RequestType>&  m_request_converter;
     IMessageConverter<ResponseType>& m_response_converter;
+    /** @brief Single pass decoder of the requests, nullptr if not enabled */
+    std::shared_ptr<const MessageDecoder> m_request_decoder;
+
+    /** @brief Handle a converted request and convert its response */
+    bool handleRequest(const RequestType& request, rapidjson::Document& response, const char*& error_code, std::string& error_message)
+    {
+        bool ret = false;
+
+        // Handle message
+        ResponseType resp;
+        if (handleMessage(request, resp, error_code, error_message))
+        {
+            // Convert response
+            ret = m_response_converter.toJson(resp, response);
+        }
+
+        return ret;
+    }
 };
 
 } // namespace messages
@@ -23,6 +23,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 #include "MessagesConverter.h"
 
+#include <functional>
+
 namespace ocpp
 {
 namespace messages
@@ -39,6 +41,24 @@ enum class CallResult
     Failed
 };
 
+/** @brief Payload serialized by its message converter directly into the RPC frame */
+template <typename DataType>
+class MessagePayload : public ocpp::rpc::IRpc::IPayload
+{
+  public:
+    /** @brief Constructor */
+    MessagePayload(IMessageConverter<DataType>& converter, const DataType& data) : m_converter(converter), m_data(data) { }
+
+    /** @copydoc bool IPayload::serialize(rapidjson::Writer<rapidjson::StringBuffer>&) const */
+    bool serialize(rapidjson::Writer<rapidjson::StringBuffer>& writer) const override { return m_converter.serialize(m_data, writer); }
+
+  private:
+    /** @brief Message converter */
+    IMessageConverter<DataType>& m_converter;
+    /** @brief Message */
+    const DataType& m_data;
+};
+
 /** @brief Generic message sender with C++ data type to JSON conversion */
 class GenericMessageSender
 {
@@ -87,46 +107,82 @@ class GenericMessageSender
         IMessageConverter<ResponseType>* resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
         if (req_converter && resp_converter)
         {
-            // Convert request
-            rapidjson::Document payload;
-            payload.Parse("{}");
-            req_converter->setAllocator(&payload.GetAllocator());
-            if (req_converter->toJson(request, payload))
+            // Check if request_fifo is empty
+            if (!request_fifo || request_fifo->empty())
             {
-                // Check if request_fifo is empty
-                if (!request_fifo || request_fifo->empty())
+                // Execute call, the request is serialized directly into the RPC frame
+                MessagePayload<RequestType> payload(*req_converter, request);
+                rapidjson::Document         resp;
+                resp.Parse("{}");
+                if (m_rpc.call(action, payload, resp, m_timeout))
+                {
+                    // Convert response
+                    const char* error_code = nullptr;
+                    std::string error_message;
+                    if (resp_converter->fromJson(resp, response, error_code, error_message))
+                    {
+                        ret = CallResult::Ok;
+                    }
+                }
+                else
+                {
+                    // Request cannot be sent or timed out, queue the message inside the FIFO
+                    if (request_fifo)
+                    {
+                        ret = queue(*req_converter, action, request, *request_fifo, connector_id);
+                    }
+                }
+            }
+            else
+            {
+                // FIFO is not empty, queue the message inside the FIFO to ensure the order of the messages
+                ret = queue(*req_converter, action, request, *request_fifo, connector_id);
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Execute an asynchronous call request
+     * @param action RPC action for the request
+     * @param request Request payload
+     * @param callback Callback to call with the result of the call request and the response payload,
+     *                 it is called from the RPC internal threads and must not block
+     * @return true if the request has been sent (the callback will then be called), false otherwise
+     */
+    template <typename RequestType, typename ResponseType>
+    bool callAsync(const std::string& action, const RequestType& request, std::function<void(CallResult, const ResponseType&)> callback)
+    {
+        bool ret = false;
+
+        // Get converters
+        IMessageConverter<RequestType>*  req_converter  = m_messages_converter.getRequestConverter<RequestType>(action);
+        IMessageConverter<ResponseType>* resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
+        if (req_converter && resp_converter)
+        {
+            // Execute call, the request is serialized directly into the RPC frame
+            MessagePayload<RequestType> payload(*req_converter, request);
+            ret = m_rpc.callAsync(
+                action,
+                payload,
+                [resp_converter, callback](bool received, const rapidjson::Document& resp)
                 {
-                    // Execute call
-                    rapidjson::Document resp;
-                    resp.Parse("{}");
-                    if (m_rpc.call(action, payload, resp, m_timeout))
+                    CallResult   result = CallResult::Failed;
+                    ResponseType response;
+                    if (received)
                     {
                         // Convert response
                         const char* error_code = nullptr;
                         std::string error_message;
-                        resp_converter->setAllocator(&resp.GetAllocator());
                         if (resp_converter->fromJson(resp, response, error_code, error_message))
                         {
-                            ret = CallResult::Ok;
-                        }
-                    }
-                    else
-                    {
-                        // Request cannot be sent or timed out, queue the message inside the FIFO
-                        if (request_fifo)
-                        {
-                            request_fifo->push(connector_id, action, payload);
-                            ret = CallResult::Delayed;
+                            result = CallResult::Ok;
                         }
                     }
-                }
-                else
-                {
-                    // FIFO is not empty, queue the message inside the FIFO to ensure the order of the messages
-                    request_fifo->push(connector_id, action, payload);
-                    ret = CallResult::Delayed;
-                }
-            }
+                    callback(result, response);
+                },
+                m_timeout);
         }
 
         return ret;
@@ -156,7 +212,6 @@ class GenericMessageSender
                 // Convert response
                 const char* error_code = nullptr;
                 std::string error_message;
-                resp_converter->setAllocator(&resp.GetAllocator());
                 if (resp_converter->fromJson(resp, response, error_code, error_message))
                 {
                     ret = CallResult::Ok;
@@ -167,6 +222,51 @@ class GenericMessageSender
         return ret;
     }
 
+    /**
+     * @brief Execute an asynchronous call request on a JSON request
+     * @param action RPC action for the request
+     * @param request JSON request payload
+     * @param callback Callback to call with the result of the call request and the response payload,
+     *                 it is called from the RPC internal threads and must not block
+     * @return true if the request has been sent (the callback will then be called), false otherwise
+     */
+    template <typename ResponseType>
+    bool callAsync(const std::string&                                   action,
+                   const rapidjson::Document&                           request,
+                   std::function<void(CallResult, const ResponseType&)> callback)
+    {
+        bool ret = false;
+
+        // Get converter
+        IMessageConverter<ResponseType>* resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
+        if (resp_converter)
+        {
+            // Execute call
+            ret = m_rpc.callAsync(
+                action,
+                request,
+                [resp_converter, callback](bool received, const rapidjson::Document& resp)
+                {
+                    CallResult   result = CallResult::Failed;
+                    ResponseType response;
+                    if (received)
+                    {
+                        // Convert response
+                        const char* error_code = nullptr;
+                        std::string error_message;
+                        if (resp_converter->fromJson(resp, response, error_code, error_message))
+                        {
+                            result = CallResult::Ok;
+                        }
+                    }
+                    callback(result, response);
+                },
+                m_timeout);
+        }
+
+        return ret;
+    }
+
   private:
     /** @brief RPC */
     ocpp::rpc::IRpc& m_rpc;
@@ -174,6 +274,33 @@ class GenericMessageSender
     MessagesConverter& m_messages_converter;
     /** @brief Request timeout */
     std::chrono::milliseconds m_timeout;
+
+    /**
+     * @brief Queue a request inside the request FIFO, the FIFO stores the requests as JSON documents
+     * @param req_converter Request converter
+     * @param action RPC action for the request
+     * @param request Request payload
+     * @param request_fifo Request FIFO
+     * @param connector_id Id of the connector associated to the request
+     * @return CallResult::Delayed if the request has been queued, CallResult::Failed otherwise
+     */
+    template <typename RequestType>
+    CallResult queue(IMessageConverter<RequestType>& req_converter,
+                     const std::string&              action,
+                     const RequestType&              request,
+                     IRequestFifo&                   request_fifo,
+                     unsigned int                    connector_id)
+    {
+        CallResult          ret = CallResult::Failed;
+        rapidjson::Document payload;
+        payload.Parse("{}");
+        if (req_converter.toJson(request, payload))
+        {
+            request_fifo.push(connector_id, action, payload);
+            ret = CallResult::Delayed;
+        }
+        return ret;
+    }
 };
 
 } // namespace messages
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class GetCompositeScheduleStatus enum to string */
-const EnumToStringFromString<GetCompositeScheduleStatus> GetCompositeScheduleStatusHelper = {
+constexpr EnumToStringFromString<GetCompositeScheduleStatus> GetCompositeScheduleStatusHelper = {
     {GetCompositeScheduleStatus::Accepted, "Accepted"}, {GetCompositeScheduleStatus::Rejected, "Rejected"}};
 
 } // namespace types
@@ -78,7 +78,7 @@ bool GetCompositeScheduleConfConverter::fromJson(const rapidjson::Value&   json,
     if (json.HasMember("chargingSchedule"))
     {
         ChargingScheduleConverter charging_schedule_converter;
-        ret = charging_schedule_converter.fromJson(json[""], data.chargingSchedule.value(), error_code, error_message);
+        ret = charging_schedule_converter.fromJson(json["chargingSchedule"], data.chargingSchedule.value(), error_code, error_message);
     }
     if (!ret && !error_code)
     {
@@ -97,15 +97,28 @@ bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf& d
     if (data.chargingSchedule.isSet())
     {
         ChargingScheduleConverter charging_schedule_converter;
-        charging_schedule_converter.setAllocator(allocator);
 
-        rapidjson::Document value;
-        value.Parse("{}");
+        rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
         ret = charging_schedule_converter.toJson(data.chargingSchedule, value);
-        json.AddMember(rapidjson::StringRef("chargingSchedule"), value.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("chargingSchedule"), value.Move(), json.GetAllocator());
     }
     return ret;
 }
 
+/** @brief Single pass decoding binding for GetCompositeSchedule.req message */
+JSON_BINDING_FIELDS(GetCompositeScheduleReq,
+                    nullptr,
+                    JSON_FIELD(GetCompositeScheduleReq, connectorId),
+                    JSON_FIELD(GetCompositeScheduleReq, duration),
+                    JSON_ENUM_FIELD(GetCompositeScheduleReq, chargingRateUnit, ChargingRateUnitTypeHelper))
+
+/** @brief Single pass decoding binding for GetCompositeSchedule.conf message */
+JSON_BINDING_FIELDS(GetCompositeScheduleConf,
+                    nullptr,
+                    JSON_ENUM_FIELD(GetCompositeScheduleConf, status, GetCompositeScheduleStatusHelper),
+                    JSON_FIELD(GetCompositeScheduleConf, connectorId),
+                    JSON_FIELD(GetCompositeScheduleConf, scheduleStart),
+                    JSON_FIELD(GetCompositeScheduleConf, chargingSchedule))
+
 } // namespace messages
 } // namespace ocpp
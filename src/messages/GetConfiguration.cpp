@@ -108,8 +108,7 @@ bool GetConfigurationConfConverter::toJson(const GetConfigurationConf& data, rap
         rapidjson::Document::AllocatorType& allocator = json.GetAllocator();
         for (const KeyValue& key : data.configurationKey.value())
         {
-            rapidjson::Document value;
-            value.Parse("{}");
+            rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
             fill(value, "key", key.key);
             fill(value, "readonly", key.readonly);
             fill(value, "value", key.value);
@@ -131,5 +130,18 @@ bool GetConfigurationConfConverter::toJson(const GetConfigurationConf& data, rap
     return true;
 }
 
+/** @brief Single pass decoding binding for KeyValue type */
+JSON_BINDING(KeyValue)
+JSON_BINDING_FIELDS(KeyValue, nullptr, JSON_FIELD(KeyValue, key), JSON_FIELD(KeyValue, readonly), JSON_FIELD(KeyValue, value))
+
+/** @brief Single pass decoding binding for GetConfiguration.req message */
+JSON_BINDING_FIELDS(GetConfigurationReq, nullptr, JSON_FIELD(GetConfigurationReq, key))
+
+/** @brief Single pass decoding binding for GetConfiguration.conf message */
+JSON_BINDING_FIELDS(GetConfigurationConf,
+                    nullptr,
+                    JSON_FIELD(GetConfigurationConf, configurationKey),
+                    JSON_FIELD(GetConfigurationConf, unknownKey))
+
 } // namespace messages
 } // namespace ocpp
@@ -78,5 +78,30 @@ bool GetDiagnosticsConfConverter::toJson(const GetDiagnosticsConf& data, rapidjs
     return true;
 }
 
+/** @brief Check the location of a GetDiagnostics.req message */
+static bool checkGetDiagnosticsReq(void* data, std::string& error_message)
+{
+    const GetDiagnosticsReq& request = *reinterpret_cast<GetDiagnosticsReq*>(data);
+    ocpp::websockets::Url    url(request.location);
+    bool                     ret = url.isValid();
+    if (!ret)
+    {
+        error_message = "location parameter is not a valid URL";
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for GetDiagnostics.req message */
+JSON_BINDING_FIELDS(GetDiagnosticsReq,
+                    &checkGetDiagnosticsReq,
+                    JSON_FIELD(GetDiagnosticsReq, location),
+                    JSON_FIELD(GetDiagnosticsReq, retries),
+                    JSON_FIELD(GetDiagnosticsReq, retryInterval),
+                    JSON_FIELD(GetDiagnosticsReq, startTime),
+                    JSON_FIELD(GetDiagnosticsReq, stopTime))
+
+/** @brief Single pass decoding binding for GetDiagnostics.conf message */
+JSON_BINDING_FIELDS(GetDiagnosticsConf, nullptr, JSON_FIELD(GetDiagnosticsConf, fileName))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,12 +27,12 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class CertificateUseEnumType enum to string */
-const EnumToStringFromString<CertificateUseEnumType> CertificateUseEnumTypeHelper = {
+constexpr EnumToStringFromString<CertificateUseEnumType> CertificateUseEnumTypeHelper = {
     {CertificateUseEnumType::CentralSystemRootCertificate, "CentralSystemRootCertificate"},
     {CertificateUseEnumType::ManufacturerRootCertificate, "ManufacturerRootCertificate"}};
 
 /** @brief Helper to convert a enum class GetInstalledCertificateStatusEnumType enum to string */
-const EnumToStringFromString<GetInstalledCertificateStatusEnumType> GetInstalledCertificateStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<GetInstalledCertificateStatusEnumType> GetInstalledCertificateStatusEnumTypeHelper = {
     {GetInstalledCertificateStatusEnumType::Accepted, "Accepted"}, {GetInstalledCertificateStatusEnumType::NotFound, "NotFound"}};
 
 } // namespace types
@@ -89,18 +89,27 @@ bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertifica
     {
         rapidjson::Value                 certificateHashData(rapidjson::kArrayType);
         CertificateHashDataTypeConverter certificate_hash_converter;
-        certificate_hash_converter.setAllocator(allocator);
         for (const CertificateHashDataType& certificate_hash : data.certificateHashData)
         {
-            rapidjson::Document value;
-            value.Parse("{}");
+            rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
             ret = ret && certificate_hash_converter.toJson(certificate_hash, value);
-            certificateHashData.PushBack(value.Move(), *allocator);
+            certificateHashData.PushBack(value.Move(), json.GetAllocator());
         }
-        json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData.Move(), json.GetAllocator());
     }
     return ret;
 }
 
+/** @brief Single pass decoding binding for GetInstalledCertificateIds.req message */
+JSON_BINDING_FIELDS(GetInstalledCertificateIdsReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(GetInstalledCertificateIdsReq, certificateType, CertificateUseEnumTypeHelper))
+
+/** @brief Single pass decoding binding for GetInstalledCertificateIds.conf message */
+JSON_BINDING_FIELDS(GetInstalledCertificateIdsConf,
+                    nullptr,
+                    JSON_ENUM_FIELD(GetInstalledCertificateIdsConf, status, GetInstalledCertificateStatusEnumTypeHelper),
+                    JSON_FIELD(GetInstalledCertificateIdsConf, certificateHashData))
+
 } // namespace messages
 } // namespace ocpp
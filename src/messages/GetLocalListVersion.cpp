@@ -66,5 +66,11 @@ bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf& dat
     return true;
 }
 
+/** @brief Single pass decoding binding for GetLocalListVersion.req message */
+JSON_BINDING_EMPTY(GetLocalListVersionReq)
+
+/** @brief Single pass decoding binding for GetLocalListVersion.conf message */
+JSON_BINDING_FIELDS(GetLocalListVersionConf, nullptr, JSON_FIELD(GetLocalListVersionConf, listVersion))
+
 } // namespace messages
 } // namespace ocpp
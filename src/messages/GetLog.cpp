@@ -28,10 +28,10 @@ namespace types
 {
 
 /** @brief Helper to convert a LogEnumType enum to string */
-const EnumToStringFromString<LogEnumType> LogEnumTypeHelper = {{LogEnumType::DiagnosticsLog, "DiagnosticsLog"},
+constexpr EnumToStringFromString<LogEnumType> LogEnumTypeHelper = {{LogEnumType::DiagnosticsLog, "DiagnosticsLog"},
                                                                {LogEnumType::SecurityLog, "SecurityLog"}};
 /** @brief Helper to convert a LogStatusEnumType enum to string */
-const EnumToStringFromString<LogStatusEnumType> LogStatusEnumTypeHelper = {{LogStatusEnumType::Accepted, "Accepted"},
+constexpr EnumToStringFromString<LogStatusEnumType> LogStatusEnumTypeHelper = {{LogStatusEnumType::Accepted, "Accepted"},
                                                                            {LogStatusEnumType::Rejected, "Rejected"},
                                                                            {LogStatusEnumType::AcceptedCanceled, "AcceptedCanceled"}};
 
@@ -69,12 +69,11 @@ bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Document& json
     fill(json, "retries", data.retries);
     fill(json, "retryInterval", data.retryInterval);
 
-    rapidjson::Document log;
-    log.Parse("{}");
+    rapidjson::Document log(rapidjson::kObjectType, &json.GetAllocator());
     fill(log, "remoteLocation", data.log.remoteLocation);
     fill(log, "oldestTimestamp", data.log.oldestTimestamp);
     fill(log, "latestTimestamp", data.log.latestTimestamp);
-    json.AddMember(rapidjson::StringRef("log"), log.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("log"), log.Move(), json.GetAllocator());
     return true;
 }
 
@@ -96,5 +95,38 @@ bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Document& js
     return true;
 }
 
+/** @brief Check the remote location of a GetLog.req message */
+static bool checkGetLogReq(void* data, std::string& error_message)
+{
+    const GetLogReq&      request = *reinterpret_cast<GetLogReq*>(data);
+    ocpp::websockets::Url url(request.log.remoteLocation);
+    bool                  ret = url.isValid();
+    if (!ret)
+    {
+        error_message = "remoteLocation parameter is not a valid URL";
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for LogParametersType type */
+JSON_BINDING(LogParametersType)
+JSON_BINDING_FIELDS(LogParametersType,
+                    nullptr,
+                    JSON_FIELD(LogParametersType, remoteLocation),
+                    JSON_FIELD(LogParametersType, oldestTimestamp),
+                    JSON_FIELD(LogParametersType, latestTimestamp))
+
+/** @brief Single pass decoding binding for GetLog.req message */
+JSON_BINDING_FIELDS(GetLogReq,
+                    &checkGetLogReq,
+                    JSON_ENUM_FIELD(GetLogReq, logType, LogEnumTypeHelper),
+                    JSON_FIELD(GetLogReq, requestId),
+                    JSON_FIELD(GetLogReq, retries),
+                    JSON_FIELD(GetLogReq, retryInterval),
+                    JSON_FIELD(GetLogReq, log))
+
+/** @brief Single pass decoding binding for GetLog.conf message */
+JSON_BINDING_FIELDS(GetLogConf, nullptr, JSON_ENUM_FIELD(GetLogConf, status, LogStatusEnumTypeHelper), JSON_FIELD(GetLogConf, fileName))
+
 } // namespace messages
 } // namespace ocpp
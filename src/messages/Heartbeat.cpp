@@ -44,6 +44,14 @@ bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document
     return true;
 }
 
+/** @copydoc bool IMessageConverter<DataType>::serialize(const DataType&, JsonWriter&) */
+bool HeartbeatReqConverter::serialize(const HeartbeatReq& data, JsonWriter& writer)
+{
+    (void)data;
+    writer.StartObject();
+    return writer.EndObject();
+}
+
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, const char*&, std::string&) */
 bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
                                       HeartbeatConf&          data,
@@ -61,9 +69,15 @@ bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
 /** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, const char*&, std::string&) */
 bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Document& json)
 {
-    fill(json, "currentTime", data.currentTime.str());
+    fill(json, "currentTime", data.currentTime);
     return true;
 }
 
+/** @brief Single pass decoding binding for Heartbeat.req message */
+JSON_BINDING_EMPTY(HeartbeatReq)
+
+/** @brief Single pass decoding binding for Heartbeat.conf message */
+JSON_BINDING_FIELDS(HeartbeatConf, nullptr, JSON_FIELD(HeartbeatConf, currentTime))
+
 } // namespace messages
 } // namespace ocpp
@@ -44,7 +44,7 @@ struct HeartbeatConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(Heartbeat)
+MESSAGE_CONVERTERS_WITH_REQ_SERIALIZER(Heartbeat)
 
 } // namespace messages
 } // namespace ocpp
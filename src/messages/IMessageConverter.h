@@ -22,6 +22,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "CiStringType.h"
 #include "DateTime.h"
 #include "IMessageDispatcher.h"
+#include "JsonBinding.h"
 #include "Optional.h"
 
 namespace ocpp
@@ -29,11 +30,18 @@ namespace ocpp
 namespace messages
 {
 
-/** @brief Interface for the message converters from JSON to C++ data type and backward */
+/** @brief Interface for the message converters from JSON to C++ data type and backward
+ *
+ *  Converters are stateless and can be used simultaneously from several threads : the JSON values
+ *  are allocated with the allocator of the document given to the conversion functions
+ */
 template <typename DataType>
 class IMessageConverter
 {
   public:
+    /** @brief JSON writer used to serialize the C++ data types without building a JSON document */
+    typedef rapidjson::Writer<rapidjson::StringBuffer> JsonWriter;
+
     /** @brief Destructor */
     virtual ~IMessageConverter() { }
 
@@ -50,20 +58,34 @@ class IMessageConverter
     /**
      * @brief Convert a C++ data type to a JSON object
      * @param data C++ data type to convert
-     * @param json JSON object to fill
+     * @param json JSON object to fill (its allocator is used for all the values created during the conversion)
      * @return true the object has been converted, false otherwise
      */
     virtual bool toJson(const DataType& data, rapidjson::Document& json) = 0;
 
+    /**
+     * @brief Serialize a C++ data type as a JSON object without building a JSON document,
+     *        the default implementation goes through toJson()
+     * @param data C++ data type to serialize
+     * @param writer JSON writer to use
+     * @return true the object has been serialized, false otherwise
+     */
+    virtual bool serialize(const DataType& data, JsonWriter& writer)
+    {
+        rapidjson::Document json;
+        json.SetObject();
+        return (toJson(data, json) && json.Accept(writer));
+    }
+
     /**
      * @brief Helper function to fill an integer value in a JSON object
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Integer value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const int value)
+    void fill(rapidjson::Document& json, const char* name, const int value)
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), json.GetAllocator());
     }
 
     /**
@@ -72,9 +94,9 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value Unsigned integer value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const unsigned int value)
+    void fill(rapidjson::Document& json, const char* name, const unsigned int value)
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), json.GetAllocator());
     }
 
     /**
@@ -83,9 +105,9 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value Floating point value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const float value)
+    void fill(rapidjson::Document& json, const char* name, const float value)
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), json.GetAllocator());
     }
 
     /**
@@ -94,9 +116,34 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value String value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const std::string& value)
+    void fill(rapidjson::Document& json, const char* name, const std::string& value)
+    {
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value.c_str(), json.GetAllocator()).Move(), json.GetAllocator());
+    }
+
+    /**
+     * @brief Helper function to fill a string value in a JSON object
+     * @param json JSON object to fill
+     * @param field Name of the field to fill
+     * @param value String value to fill
+     */
+    void fill(rapidjson::Document& json, const char* name, const char* value)
+    {
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value, json.GetAllocator()).Move(), json.GetAllocator());
+    }
+
+    /**
+     * @brief Helper function to fill a size limited string value in a JSON object
+     * @param json JSON object to fill
+     * @param field Name of the field to fill
+     * @param value Size limited string value to fill
+     */
+    template <size_t MAX_STRING_SIZE>
+    void fill(rapidjson::Document& json, const char* name, const ocpp::types::CiStringType<MAX_STRING_SIZE>& value)
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value.c_str(), *allocator).Move(), *allocator);
+        json.AddMember(rapidjson::StringRef(name),
+                       rapidjson::Value(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), json.GetAllocator()).Move(),
+                       json.GetAllocator());
     }
 
     /**
@@ -105,7 +152,14 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value Date and time value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const ocpp::types::DateTime& value) { fill(json, name, value.str()); }
+    void fill(rapidjson::Document& json, const char* name, const ocpp::types::DateTime& value)
+    {
+        char   buffer[ocpp::types::DateTime::STRING_BUFFER_SIZE];
+        size_t size = value.format(buffer, sizeof(buffer));
+        json.AddMember(rapidjson::StringRef(name),
+                       rapidjson::Value(buffer, static_cast<rapidjson::SizeType>(size), json.GetAllocator()).Move(),
+                       json.GetAllocator());
+    }
 
     /**
      * @brief Helper function to fill a boolean value in a JSON object
@@ -113,9 +167,9 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value Boolean value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const bool value)
+    void fill(rapidjson::Document& json, const char* name, const bool value)
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), json.GetAllocator());
     }
 
     /**
@@ -125,7 +179,7 @@ class IMessageConverter
      * @param value Optional value to fill
      */
     template <typename T>
-    void fill(rapidjson::Value& json, const char* name, const ocpp::types::Optional<T>& value)
+    void fill(rapidjson::Document& json, const char* name, const ocpp::types::Optional<T>& value)
     {
         if (value.isSet())
         {
@@ -133,6 +187,120 @@ class IMessageConverter
         }
     }
 
+    /**
+     * @brief Helper function to write an integer value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Integer value to write
+     */
+    void write(JsonWriter& writer, const char* name, const int value)
+    {
+        writer.Key(name);
+        writer.Int(value);
+    }
+
+    /**
+     * @brief Helper function to write an unsigned integer value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Unsigned integer value to write
+     */
+    void write(JsonWriter& writer, const char* name, const unsigned int value)
+    {
+        writer.Key(name);
+        writer.Uint(value);
+    }
+
+    /**
+     * @brief Helper function to write a floating point value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Floating point value to write
+     */
+    void write(JsonWriter& writer, const char* name, const float value)
+    {
+        writer.Key(name);
+        writer.Double(static_cast<double>(value));
+    }
+
+    /**
+     * @brief Helper function to write a string value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value String value to write
+     */
+    void write(JsonWriter& writer, const char* name, const std::string& value)
+    {
+        writer.Key(name);
+        writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+    }
+
+    /**
+     * @brief Helper function to write a string value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value String value to write
+     */
+    void write(JsonWriter& writer, const char* name, const char* value)
+    {
+        writer.Key(name);
+        writer.String(value);
+    }
+
+    /**
+     * @brief Helper function to write a size limited string value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Size limited string value to write
+     */
+    template <size_t MAX_STRING_SIZE>
+    void write(JsonWriter& writer, const char* name, const ocpp::types::CiStringType<MAX_STRING_SIZE>& value)
+    {
+        writer.Key(name);
+        writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+    }
+
+    /**
+     * @brief Helper function to write a date and time value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Date and time value to write
+     */
+    void write(JsonWriter& writer, const char* name, const ocpp::types::DateTime& value)
+    {
+        char   buffer[ocpp::types::DateTime::STRING_BUFFER_SIZE];
+        size_t size = value.format(buffer, sizeof(buffer));
+        writer.Key(name);
+        writer.String(buffer, static_cast<rapidjson::SizeType>(size));
+    }
+
+    /**
+     * @brief Helper function to write a boolean value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Boolean value to write
+     */
+    void write(JsonWriter& writer, const char* name, const bool value)
+    {
+        writer.Key(name);
+        writer.Bool(value);
+    }
+
+    /**
+     * @brief Helper function to write an optional value of a JSON object
+     * @param writer JSON writer
+     * @param field Name of the field to write
+     * @param value Optional value to write
+     */
+    template <typename T>
+    void write(JsonWriter& writer, const char* name, const ocpp::types::Optional<T>& value)
+    {
+        if (value.isSet())
+        {
+            write(writer, name, value.value());
+        }
+    }
+
     /**
      * @brief Helper function to extract an integer value from a JSON object
      * @param json JSON object
@@ -188,9 +356,10 @@ class IMessageConverter
      * @param field Name of the field to extract
      * @param value Size limited string value extracted
      */
-    void extract(const rapidjson::Value& json, const char* name, ocpp::types::ICiStringType& value)
+    void extract(const rapidjson::Value& json, const char* name, ocpp::types::CiStringView value)
     {
-        value.assign(json[name].GetString());
+        const rapidjson::Value& val = json[name];
+        value.assign(val.GetString(), val.GetStringLength());
     }
 
     /**
@@ -207,7 +376,7 @@ class IMessageConverter
         const rapidjson::Value& val = json[name];
         if (val.IsString())
         {
-            ret = value.assign(val.GetString());
+            ret = value.assign(val.GetString(), val.GetStringLength());
         }
         if (!ret)
         {
@@ -258,23 +427,31 @@ class IMessageConverter
         }
         return ret;
     }
+};
 
-    /** @brief Set the allocator to use */
-    void setAllocator(rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator>* _allocator) { allocator = _allocator; }
+/** @brief Helper macro to declare a converter class and a single pass decoding binding for req and conf messages
+ *  @param MessageType Message type name
+ */
+#define MESSAGE_CONVERTERS(MessageType) MESSAGE_CONVERTERS_DECLARATION(MessageType, )
 
-    /** @brief Allocator */
-    rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator>* allocator;
-};
+/** @brief Helper macro to declare a converter class and a single pass decoding binding for req and conf messages,
+ *         the req message converter has its own serializer which doesn't build a JSON document
+ *  @param MessageType Message type name
+ */
+#define MESSAGE_CONVERTERS_WITH_REQ_SERIALIZER(MessageType) \
+    MESSAGE_CONVERTERS_DECLARATION(MessageType, bool serialize(const MessageType##Req& data, JsonWriter& writer) override;)
 
-/** @brief Helper macro to declare a converter class for req and conf messages
+/** @brief Helper macro to declare a converter class and a single pass decoding binding for req and conf messages
  *  @param MessageType Message type name
+ *  @param ReqMethods Additional methods of the req message converter
  */
-#define MESSAGE_CONVERTERS(MessageType)                                                                                                    \
+#define MESSAGE_CONVERTERS_DECLARATION(MessageType, ReqMethods)                                                                            \
     class MessageType##ReqConverter : public IMessageConverter<MessageType##Req>                                                           \
     {                                                                                                                                      \
       public:                                                                                                                              \
         bool fromJson(const rapidjson::Value& json, MessageType##Req& data, const char*& error_code, std::string& error_message) override; \
         bool toJson(const MessageType##Req& data, rapidjson::Document& json) override;                                                     \
+        ReqMethods                                                                                                                         \
     };                                                                                                                                     \
     class MessageType##ConfConverter : public IMessageConverter<MessageType##Conf>                                                         \
     {                                                                                                                                      \
@@ -282,9 +459,11 @@ class IMessageConverter
         bool fromJson(const rapidjson::Value& json,                                                                                        \
                       MessageType##Conf&      data,                                                                                        \
                       const char*&            error_code,                                                                                  \
-                      std::string&            error_message) override;                                                                                \
+                      std::string&            error_message) override;                                                                     \
         bool toJson(const MessageType##Conf& data, rapidjson::Document& json) override;                                                    \
-    };
+    };                                                                                                                                     \
+    JSON_BINDING(MessageType##Req)                                                                                                         \
+    JSON_BINDING(MessageType##Conf)
 
 } // namespace messages
 } // namespace ocpp
@@ -19,8 +19,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef IMESSAGEDISPATCHER_H
 #define IMESSAGEDISPATCHER_H
 
+#include "JsonSchemaTree.h"
 #include "json.h"
 
+#include <memory>
 #include <string>
 
 namespace ocpp
@@ -49,17 +51,19 @@ class IMessageDispatcher
     /**
      * @brief Dispatch a received action to the registered handler
      * @param action Action
-     * @param payload JSON payload for the action
+     * @param payload JSON payload for the action, as received (not parsed)
+     * @param size Size in bytes of the JSON payload
      * @param response JSON response to send
      * @param error_code Standard error code, set to nullptr if no error
      * @param error_msg Additionnal error message, empty if no error
      * @return true if the call is accepted, false otherwise
      */
-    virtual bool dispatchMessage(const std::string&      action,
-                                 const rapidjson::Value& payload,
-                                 rapidjson::Document&    response,
-                                 const char*&            error_code,
-                                 std::string&            error_message) = 0;
+    virtual bool dispatchMessage(const std::string&   action,
+                                 const char*          payload,
+                                 size_t               size,
+                                 rapidjson::Document& response,
+                                 const char*&         error_code,
+                                 std::string&         error_message) = 0;
 
     /** @brief Interface for messages handlers implementations */
     class IMessageHandler
@@ -82,6 +86,35 @@ class IMessageDispatcher
                             rapidjson::Document&    response,
                             const char*&            error_code,
                             std::string&            error_message) = 0;
+
+        /**
+         * @brief Handle a received action given as JSON text
+         * @param action Action
+         * @param payload JSON payload for the action, as received (not parsed)
+         * @param size Size in bytes of the JSON payload
+         * @param response JSON response to send
+         * @param error_code Standard error code, set to nullptr if no error
+         * @param error_msg Additionnal error message, empty if no error
+         * @return true if the call is accepted, false otherwise
+         */
+        virtual bool handle(const std::string&   action,
+                            const char*          payload,
+                            size_t               size,
+                            rapidjson::Document& response,
+                            const char*&         error_code,
+                            std::string&         error_message) = 0;
+
+        /**
+         * @brief Enable the single pass decoding of the received payloads : the payloads will be
+         *        given to the handler without prior validation against their JSON schema
+         * @param schema Tree representation of the JSON schema of the payloads
+         * @return true if the handler validates the payloads while decoding them, false otherwise
+         */
+        virtual bool enableSinglePassDecoding(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema)
+        {
+            (void)schema;
+            return false;
+        }
     };
 };
 
@@ -21,7 +21,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "json.h"
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace ocpp
 {
@@ -34,6 +36,33 @@ class IRequestFifo
   public:
     class IListener;
 
+    /** @brief Request stored inside the FIFO */
+    struct Request
+    {
+        /** @brief Id of the request inside the FIFO */
+        unsigned int id;
+        /** @brief Id of the connector related to the request */
+        unsigned int connector_id;
+        /** @brief RPC action for the request */
+        std::string action;
+        /** @brief JSON payload of the request */
+        rapidjson::Document payload;
+    };
+
+    /** @brief Selection of a request by a request selector */
+    enum class Selection
+    {
+        /** @brief The request is retrieved */
+        Select,
+        /** @brief The request is left in the FIFO */
+        Skip,
+        /** @brief The request is left in the FIFO and the following requests are not considered */
+        End
+    };
+
+    /** @brief Request selector, called in FIFO order with the connector id and the action of the requests */
+    typedef std::function<Selection(unsigned int connector_id, const std::string& action)> Selector;
+
     /** @brief Destructor */
     virtual ~IRequestFifo() { }
 
@@ -56,6 +85,27 @@ class IRequestFifo
 
     /** @brief Delete the first request from the FIFO */
     virtual void pop() = 0;
+    /**
+     * @brief Get the first requests from the FIFO without removing them
+     * @param requests Requests retrieved from the FIFO, in FIFO order
+     * @param max_count Maximum number of requests to retrieve
+     * @return Number of requests retrieved
+     */
+    virtual size_t front(std::vector<Request>& requests, size_t max_count) = 0;
+    /**
+     * @brief Get the first requests accepted by a selector from the FIFO without removing them
+     *        (only the selected requests are retrieved, they won't be merged or dropped anymore)
+     * @param requests Requests retrieved from the FIFO, in FIFO order
+     * @param max_count Maximum number of requests to retrieve
+     * @param selector Selector called for each request until max_count requests have been selected
+     * @return Number of requests retrieved
+     */
+    virtual size_t front(std::vector<Request>& requests, size_t max_count, const Selector& selector) = 0;
+    /**
+     * @brief Delete a request from the FIFO
+     * @param id Id of the request inside the FIFO
+     */
+    virtual void pop(unsigned int id) = 0;
 
     /**
      * @brief Get the number of requests inside the FIFO
@@ -27,7 +27,7 @@ namespace types
 {
 
 /** @brief Helper to convert a enum class CertificateStatusEnumType enum to string */
-const EnumToStringFromString<CertificateStatusEnumType> CertificateStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<CertificateStatusEnumType> CertificateStatusEnumTypeHelper = {
     {CertificateStatusEnumType::Accepted, "Accepted"},
     {CertificateStatusEnumType::Failed, "Failed"},
     {CertificateStatusEnumType::Rejected, "Rejected"}};
@@ -76,5 +76,14 @@ bool InstallCertificateConfConverter::toJson(const InstallCertificateConf& data,
     return true;
 }
 
+/** @brief Single pass decoding binding for InstallCertificate.req message */
+JSON_BINDING_FIELDS(InstallCertificateReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(InstallCertificateReq, certificateType, CertificateUseEnumTypeHelper),
+                    JSON_FIELD(InstallCertificateReq, certificate))
+
+/** @brief Single pass decoding binding for InstallCertificate.conf message */
+JSON_BINDING_FIELDS(InstallCertificateConf, nullptr, JSON_ENUM_FIELD(InstallCertificateConf, status, CertificateStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
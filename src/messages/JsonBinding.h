@@ -0,0 +1,370 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JSONBINDING_H
+#define JSONBINDING_H
+
+#include "CiStringType.h"
+#include "DateTime.h"
+#include "EnumToStringFromString.h"
+#include "Optional.h"
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+namespace messages
+{
+
+// Forward declaration
+struct JsonField;
+
+/** @brief Describes how a JSON value is stored into a C++ data type by the single pass decoders (see MessageDecoder)
+ *
+ *  The bindings are immutable and type-erased : the C++ values are accessed through untyped pointers
+ *  and the functions of the binding of their type
+ */
+struct JsonBinding
+{
+    /** @brief Kind of C++ data type */
+    enum class Kind
+    {
+        /** @brief Structure filled from a JSON object */
+        Object,
+        /** @brief Vector filled from a JSON array */
+        Array,
+        /** @brief Scalar value filled from a JSON string, number or boolean */
+        Value
+    };
+
+    /** @brief Kind of C++ data type */
+    Kind kind;
+    /** @brief Fields (object) */
+    const JsonField* fields;
+    /** @brief Number of fields (object) */
+    size_t fields_count;
+    /** @brief Optional. Check and complete a structure once all its fields have been filled (object) */
+    bool (*complete)(void* data, std::string& error_message);
+    /** @brief Binding of the items (array) */
+    const JsonBinding* (*items)();
+    /** @brief Append a new item and get its address (array) */
+    void* (*append)(void* data);
+    /** @brief Store an integer value, nullptr if not allowed (value) */
+    bool (*set_integer)(void* data, int64_t value);
+    /** @brief Store a floating point value, nullptr if not allowed (value) */
+    bool (*set_number)(void* data, double value);
+    /** @brief Store a string value, nullptr if not allowed (value) */
+    bool (*set_string)(void* data, const char* value, size_t length);
+    /** @brief Store a boolean value, nullptr if not allowed (value) */
+    bool (*set_boolean)(void* data, bool value);
+    /** @brief End of the error message when a value cannot be stored (value) */
+    const char* error;
+
+    /** @brief Build the binding of a structure */
+    static constexpr JsonBinding object(const JsonField* fields, size_t fields_count, bool (*complete)(void*, std::string&))
+    {
+        return {Kind::Object, fields, fields_count, complete, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    }
+    /** @brief Build the binding of a vector */
+    static constexpr JsonBinding array(const JsonBinding* (*items)(), void* (*append)(void*))
+    {
+        return {Kind::Array, nullptr, 0, nullptr, items, append, nullptr, nullptr, nullptr, nullptr, nullptr};
+    }
+    /** @brief Build the binding of a scalar value */
+    static constexpr JsonBinding value(bool (*set_integer)(void*, int64_t),
+                                       bool (*set_number)(void*, double),
+                                       bool (*set_string)(void*, const char*, size_t),
+                                       bool (*set_boolean)(void*, bool),
+                                       const char* error)
+    {
+        return {Kind::Value, nullptr, 0, nullptr, nullptr, nullptr, set_integer, set_number, set_string, set_boolean, error};
+    }
+};
+
+/** @brief Binding of a field of a structure */
+struct JsonField
+{
+    /** @brief Name of the corresponding JSON property */
+    const char* name;
+    /** @brief Get the address of the field's value inside the structure (marks optional fields as set) */
+    void* (*access)(void* data);
+    /** @brief Binding of the field's value */
+    const JsonBinding* (*binding)();
+};
+
+/** @brief Provides the binding of a C++ data type, types without binding can only be decoded by their converters */
+template <typename DataType>
+struct JsonBinder
+{
+    /** @brief Get the binding, nullptr if the type has no binding */
+    static const JsonBinding* get() { return nullptr; }
+};
+
+/** @brief Binding of the int type */
+template <>
+struct JsonBinder<int>
+{
+    static bool set(void* data, int64_t value)
+    {
+        bool ret = ((value >= INT_MIN) && (value <= INT_MAX));
+        if (ret)
+        {
+            *reinterpret_cast<int*>(data) = static_cast<int>(value);
+        }
+        return ret;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::value(&set, nullptr, nullptr, nullptr, " parameter is not an integer");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the unsigned int type */
+template <>
+struct JsonBinder<unsigned int>
+{
+    static bool set(void* data, int64_t value)
+    {
+        bool ret = ((value >= 0) && (value <= UINT_MAX));
+        if (ret)
+        {
+            *reinterpret_cast<unsigned int*>(data) = static_cast<unsigned int>(value);
+        }
+        return ret;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding =
+            JsonBinding::value(&set, nullptr, nullptr, nullptr, " parameter is not an unsigned integer");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the float type */
+template <>
+struct JsonBinder<float>
+{
+    static bool setInteger(void* data, int64_t value)
+    {
+        *reinterpret_cast<float*>(data) = static_cast<float>(value);
+        return true;
+    }
+    static bool setNumber(void* data, double value)
+    {
+        *reinterpret_cast<float*>(data) = static_cast<float>(value);
+        return true;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding =
+            JsonBinding::value(&setInteger, &setNumber, nullptr, nullptr, " parameter is not a floating point number");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the bool type */
+template <>
+struct JsonBinder<bool>
+{
+    static bool set(void* data, bool value)
+    {
+        *reinterpret_cast<bool*>(data) = value;
+        return true;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::value(nullptr, nullptr, nullptr, &set, " parameter is not a boolean");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the std::string type */
+template <>
+struct JsonBinder<std::string>
+{
+    static bool set(void* data, const char* value, size_t length)
+    {
+        reinterpret_cast<std::string*>(data)->assign(value, length);
+        return true;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::value(nullptr, nullptr, &set, nullptr, " parameter is not a string");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the size limited string types (the size is checked by the schema) */
+template <size_t MAX_STRING_SIZE>
+struct JsonBinder<ocpp::types::CiStringType<MAX_STRING_SIZE>>
+{
+    static bool set(void* data, const char* value, size_t length)
+    {
+        reinterpret_cast<ocpp::types::CiStringType<MAX_STRING_SIZE>*>(data)->assign(value, length);
+        return true;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::value(nullptr, nullptr, &set, nullptr, " parameter is not a string");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the date and time type */
+template <>
+struct JsonBinder<ocpp::types::DateTime>
+{
+    static bool set(void* data, const char* value, size_t length)
+    {
+        return reinterpret_cast<ocpp::types::DateTime*>(data)->assign(value, length);
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding =
+            JsonBinding::value(nullptr, nullptr, &set, nullptr, " parameter is not a valid date-time object");
+        return &binding;
+    }
+};
+
+/** @brief Binding of the vector types */
+template <typename ItemType>
+struct JsonBinder<std::vector<ItemType>>
+{
+    static void* append(void* data)
+    {
+        std::vector<ItemType>& values = *reinterpret_cast<std::vector<ItemType>*>(data);
+        values.emplace_back();
+        return &values.back();
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::array(&JsonBinder<ItemType>::get, &append);
+        return &binding;
+    }
+};
+
+/** @brief Binding of an enum type, the value is converted with the enum's helper */
+template <typename EnumType, const ocpp::types::EnumToStringFromString<EnumType>& helper>
+struct JsonEnumBinder
+{
+    static bool set(void* data, const char* value, size_t length)
+    {
+        *reinterpret_cast<EnumType*>(data) = helper.fromString(std::string_view(value, length));
+        return true;
+    }
+    static const JsonBinding* get()
+    {
+        static constexpr JsonBinding binding = JsonBinding::value(nullptr, nullptr, &set, nullptr, " parameter is not a valid enum value");
+        return &binding;
+    }
+};
+
+/** @brief Underlying type of a field (the type of the value for optional fields) */
+template <typename FieldType>
+struct JsonFieldValue
+{
+    using type = FieldType;
+};
+template <typename FieldType>
+struct JsonFieldValue<ocpp::types::Optional<FieldType>>
+{
+    using type = FieldType;
+};
+
+/** @brief Get the address of the value of a field */
+template <typename FieldType>
+FieldType* jsonFieldValue(FieldType& field)
+{
+    return &field;
+}
+/** @brief Get the address of the value of an optional field and mark it as set */
+template <typename FieldType>
+FieldType* jsonFieldValue(ocpp::types::Optional<FieldType>& field)
+{
+    return &field.value();
+}
+
+/** @brief Get the address of the value of a field of a structure */
+template <typename DataType, typename FieldType, FieldType DataType::*field>
+void* jsonFieldAccess(void* data)
+{
+    return jsonFieldValue(reinterpret_cast<DataType*>(data)->*field);
+}
+
+/** @brief Helper macro to declare the binding of a field
+ *  @param DataType Type of the structure
+ *  @param field Name of the field, must be the name of the JSON property
+ */
+#define JSON_FIELD(DataType, field)                                                                            \
+    {                                                                                                          \
+        #field, &ocpp::messages::jsonFieldAccess<DataType, decltype(DataType::field), &DataType::field>,       \
+            &ocpp::messages::JsonBinder<ocpp::messages::JsonFieldValue<decltype(DataType::field)>::type>::get \
+    }
+
+/** @brief Helper macro to declare the binding of an enum field
+ *  @param DataType Type of the structure
+ *  @param field Name of the field, must be the name of the JSON property
+ *  @param helper Helper to convert the enum from string
+ */
+#define JSON_ENUM_FIELD(DataType, field, helper)                                                                             \
+    {                                                                                                                        \
+        #field, &ocpp::messages::jsonFieldAccess<DataType, decltype(DataType::field), &DataType::field>,                     \
+            &ocpp::messages::JsonEnumBinder<ocpp::messages::JsonFieldValue<decltype(DataType::field)>::type, helper>::get \
+    }
+
+/** @brief Helper macro to declare the binding of a structure
+ *  @param DataType Type of the structure
+ */
+#define JSON_BINDING(DataType)                 \
+    template <>                                \
+    struct JsonBinder<DataType>                \
+    {                                          \
+        static const JsonBinding* get();       \
+    };
+
+/** @brief Helper macro to define the binding of a structure
+ *  @param DataType Type of the structure
+ *  @param complete Function to check and complete the structure once filled (can be nullptr)
+ *  @param ... Bindings of the fields (see JSON_FIELD and JSON_ENUM_FIELD)
+ */
+#define JSON_BINDING_FIELDS(DataType, complete, ...)                                                            \
+    const JsonBinding* JsonBinder<DataType>::get()                                                              \
+    {                                                                                                           \
+        static const JsonField   fields[] = {__VA_ARGS__};                                                      \
+        static const JsonBinding binding  = JsonBinding::object(fields, sizeof(fields) / sizeof(JsonField), complete); \
+        return &binding;                                                                                        \
+    }
+
+/** @brief Helper macro to define the binding of a structure without fields
+ *  @param DataType Type of the structure
+ */
+#define JSON_BINDING_EMPTY(DataType)                                                          \
+    const JsonBinding* JsonBinder<DataType>::get()                                            \
+    {                                                                                         \
+        static const JsonBinding binding = JsonBinding::object(nullptr, 0, nullptr);          \
+        return &binding;                                                                      \
+    }
+
+} // namespace messages
+} // namespace ocpp
+
+#endif // JSONBINDING_H
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class UploadLogStatusEnumType enum to string */
-const EnumToStringFromString<UploadLogStatusEnumType> UploadLogStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<UploadLogStatusEnumType> UploadLogStatusEnumTypeHelper = {
     {UploadLogStatusEnumType::BadMessage, "BadMessage"},
     {UploadLogStatusEnumType::Idle, "Idle"},
     {UploadLogStatusEnumType::NotSupportedOperation, "NotSupportedOperation"},
@@ -82,5 +82,14 @@ bool LogStatusNotificationConfConverter::toJson(const LogStatusNotificationConf&
     return true;
 }
 
+/** @brief Single pass decoding binding for LogStatusNotification.req message */
+JSON_BINDING_FIELDS(LogStatusNotificationReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(LogStatusNotificationReq, status, UploadLogStatusEnumTypeHelper),
+                    JSON_FIELD(LogStatusNotificationReq, requestId))
+
+/** @brief Single pass decoding binding for LogStatusNotification.conf message */
+JSON_BINDING_EMPTY(LogStatusNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
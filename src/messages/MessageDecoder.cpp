@@ -0,0 +1,571 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MessageDecoder.h"
+#include "IRpc.h"
+
+#include "rapidjson/memorystream.h"
+
+#include <cstring>
+#include <map>
+#include <mutex>
+
+using namespace ocpp::json;
+
+namespace ocpp
+{
+namespace messages
+{
+
+/** @brief Mutex to protect the decoders cache */
+static std::mutex s_decoders_mutex;
+/** @brief Decoders indexed by schema tree and binding (nullptr if they cannot be linked) */
+static std::map<std::pair<const JsonSchemaTree*, const JsonBinding*>, std::shared_ptr<const MessageDecoder>> s_decoders;
+
+/** @brief SAX handler which validates and converts the JSON values while walking through them */
+class MessageDecoderHandler
+{
+  public:
+    /** @brief Constructor */
+    MessageDecoderHandler(const MessageDecoder::Node* root, void* data, const char*& error_code, std::string& error_message)
+        : m_root(root), m_data(data), m_error_code(error_code), m_error_message(error_message), m_stack(), m_depth(0)
+    {
+    }
+
+    bool Null()
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema && ((node->schema->types & JsonSchemaTree::NullType) == 0))
+        {
+            return invalid("type");
+        }
+        return true;
+    }
+    bool Bool(bool value)
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema && ((node->schema->types & JsonSchemaTree::BooleanType) == 0))
+        {
+            return invalid("type");
+        }
+        if (data && !node->binding->set_boolean(data, value))
+        {
+            return notConverted(node, name);
+        }
+        return true;
+    }
+    bool Int(int value) { return Int64(value); }
+    bool Uint(unsigned int value) { return Int64(value); }
+    bool Int64(int64_t value)
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema)
+        {
+            const char* keyword = node->schema->checkInteger(value);
+            if (keyword)
+            {
+                return invalid(keyword);
+            }
+        }
+        if (data)
+        {
+            const JsonBinding* binding = node->binding;
+            bool ret = (binding->set_integer ? binding->set_integer(data, value) : binding->set_number(data, static_cast<double>(value)));
+            if (!ret)
+            {
+                return notConverted(node, name);
+            }
+        }
+        return true;
+    }
+    bool Uint64(uint64_t value)
+    {
+        if (value <= static_cast<uint64_t>(INT64_MAX))
+        {
+            return Int64(static_cast<int64_t>(value));
+        }
+        return Double(static_cast<double>(value));
+    }
+    bool Double(double value)
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema)
+        {
+            const char* keyword = node->schema->checkNumber(value);
+            if (keyword)
+            {
+                return invalid(keyword);
+            }
+        }
+        if (data && !node->binding->set_number(data, value))
+        {
+            return notConverted(node, name);
+        }
+        return true;
+    }
+    bool RawNumber(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        // Not generated with the parse flags in use
+        (void)value;
+        (void)length;
+        (void)copy;
+        return invalid("type");
+    }
+    bool String(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        (void)copy;
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema)
+        {
+            const char* keyword = node->schema->checkString(value, length);
+            if (keyword)
+            {
+                return invalid(keyword);
+            }
+        }
+        if (data && !node->binding->set_string(data, value, length))
+        {
+            return notConverted(node, name);
+        }
+        return true;
+    }
+    bool StartObject()
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema && ((node->schema->types & JsonSchemaTree::ObjectType) == 0))
+        {
+            return invalid("type");
+        }
+        return push(node, data, name);
+    }
+    bool Key(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        (void)copy;
+        Frame& frame   = m_stack[m_depth - 1u];
+        frame.property = -1;
+        if (frame.node && frame.node->schema)
+        {
+            const JsonSchemaTree::Node* schema = frame.node->schema;
+            frame.property                     = schema->findProperty(value, length);
+            if (frame.property >= 0)
+            {
+                frame.found |= (static_cast<uint64_t>(1u) << frame.property);
+            }
+            else if (!schema->additional_properties)
+            {
+                return invalid("additionalProperties");
+            }
+        }
+        return true;
+    }
+    bool EndObject(rapidjson::SizeType count)
+    {
+        (void)count;
+        const Frame& frame = m_stack[m_depth - 1u];
+        if (frame.node && frame.node->schema)
+        {
+            uint64_t required_mask = frame.node->schema->required_mask;
+            if ((frame.found & required_mask) != required_mask)
+            {
+                return invalid("required");
+            }
+        }
+        if (frame.data && frame.node->binding->complete && !frame.node->binding->complete(frame.data, m_error_message))
+        {
+            m_error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+            return false;
+        }
+        m_depth--;
+        return true;
+    }
+    bool StartArray()
+    {
+        const MessageDecoder::Node* node;
+        void*                       data;
+        const char*                 name;
+        next(node, data, name);
+        if (node && node->schema && ((node->schema->types & JsonSchemaTree::ArrayType) == 0))
+        {
+            return invalid("type");
+        }
+        return push(node, data, name);
+    }
+    bool EndArray(rapidjson::SizeType count)
+    {
+        (void)count;
+        const Frame& frame = m_stack[m_depth - 1u];
+        if (frame.node && frame.node->schema && (frame.items < frame.node->schema->min_items))
+        {
+            return invalid("minItems");
+        }
+        m_depth--;
+        return true;
+    }
+
+  private:
+    /** @brief Object or array being decoded */
+    struct Frame
+    {
+        /** @brief Node of the object or array */
+        const MessageDecoder::Node* node;
+        /** @brief Storage of the object or array, nullptr if it is only validated */
+        void* data;
+        /** @brief Name of the object or array */
+        const char* name;
+        /** @brief Properties which have been found (object) */
+        uint64_t found;
+        /** @brief Index of the current property, -1 if not listed in the schema (object) */
+        int property;
+        /** @brief Number of items (array) */
+        size_t items;
+    };
+
+    /** @brief Root node */
+    const MessageDecoder::Node* m_root;
+    /** @brief Root storage */
+    void* m_data;
+    /** @brief Error code */
+    const char*& m_error_code;
+    /** @brief Error message */
+    std::string& m_error_message;
+    /** @brief Objects and arrays being decoded */
+    Frame m_stack[MessageDecoder::MAX_DEPTH];
+    /** @brief Number of objects and arrays being decoded */
+    size_t m_depth;
+
+    /** @brief Get the node, the storage and the name of the next value */
+    void next(const MessageDecoder::Node*& node, void*& data, const char*& name)
+    {
+        node = nullptr;
+        data = nullptr;
+        name = "";
+        if (m_depth == 0)
+        {
+            node = m_root;
+            data = m_data;
+        }
+        else
+        {
+            Frame& frame = m_stack[m_depth - 1u];
+            if (frame.node && frame.node->schema)
+            {
+                if (frame.node->schema->types == JsonSchemaTree::ArrayType)
+                {
+                    // Array item
+                    node = frame.node->items;
+                    name = frame.name;
+                    if (frame.data && node && node->binding)
+                    {
+                        data = frame.node->binding->append(frame.data);
+                    }
+                    frame.items++;
+                }
+                else if (frame.property >= 0)
+                {
+                    // Object property
+                    const MessageDecoder::Property& property = frame.node->properties[frame.property];
+                    node                                     = property.node;
+                    if (property.field)
+                    {
+                        name = property.field->name;
+                        if (frame.data)
+                        {
+                            data = property.field->access(frame.data);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /** @brief Start decoding an object or an array */
+    bool push(const MessageDecoder::Node* node, void* data, const char* name)
+    {
+        if (m_depth == MessageDecoder::MAX_DEPTH)
+        {
+            m_error_code    = ocpp::rpc::IRpc::RPC_ERROR_FORMATION_VIOLATION;
+            m_error_message = "Maximum nesting depth exceeded";
+            return false;
+        }
+        m_stack[m_depth] = {node, data, name, 0, -1, 0};
+        m_depth++;
+        return true;
+    }
+
+    /** @brief Schema validation error */
+    bool invalid(const char* keyword)
+    {
+        m_error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+        m_error_message = "Error on keyword : ";
+        m_error_message += keyword;
+        return false;
+    }
+
+    /** @brief Conversion error */
+    bool notConverted(const MessageDecoder::Node* node, const char* name)
+    {
+        m_error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+        m_error_message = name;
+        m_error_message += node->binding->error;
+        return false;
+    }
+};
+
+/** @brief Get the decoder corresponding to a JSON schema and a C++ data type binding */
+std::shared_ptr<const MessageDecoder> MessageDecoder::get(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema,
+                                                          const JsonBinding*                                       binding)
+{
+    std::shared_ptr<const MessageDecoder> decoder;
+    if (schema && binding)
+    {
+        std::lock_guard<std::mutex> lock(s_decoders_mutex);
+        auto                        key = std::make_pair(schema.get(), binding);
+        auto                        it  = s_decoders.find(key);
+        if (it == s_decoders.end())
+        {
+            // Decoders which cannot be linked are also cached to avoid linking them again,
+            // the decoders hold their schema tree so its address cannot be reused
+            auto new_decoder = std::make_shared<const MessageDecoder>(schema, binding);
+            if (!new_decoder->isValid())
+            {
+                new_decoder.reset();
+            }
+            it = s_decoders.emplace(key, new_decoder).first;
+        }
+        decoder = it->second;
+    }
+    return decoder;
+}
+
+/** @brief Constructor */
+MessageDecoder::MessageDecoder(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema, const JsonBinding* binding)
+    : m_schema(schema), m_nodes(), m_root(nullptr)
+{
+    if (m_schema && m_schema->root() && binding)
+    {
+        m_root = link(m_schema->root(), binding, 0);
+        if (!m_root)
+        {
+            m_nodes.clear();
+        }
+    }
+}
+
+/** @brief Destructor */
+MessageDecoder::~MessageDecoder() { }
+
+/** @brief Link a schema with a binding */
+const MessageDecoder::Node* MessageDecoder::link(const ocpp::json::JsonSchemaTree::Node* schema, const JsonBinding* binding, size_t depth)
+{
+    if (depth == MAX_DEPTH)
+    {
+        return nullptr;
+    }
+    if (!schema)
+    {
+        // Any value is allowed : it can only be validated
+        if (binding)
+        {
+            return nullptr;
+        }
+        m_nodes.push_back({nullptr, nullptr, {}, nullptr});
+        return &m_nodes.back();
+    }
+
+    m_nodes.push_back({schema, binding, {}, nullptr});
+    Node& node = m_nodes.back();
+
+    // Check that the binding can store the values allowed by the schema
+    if (binding)
+    {
+        switch (binding->kind)
+        {
+            case JsonBinding::Kind::Object:
+            {
+                if (schema->types != JsonSchemaTree::ObjectType)
+                {
+                    return nullptr;
+                }
+                for (size_t i = 0; i < binding->fields_count; i++)
+                {
+                    const JsonField& field = binding->fields[i];
+                    if ((schema->findProperty(field.name, strlen(field.name)) < 0) || !field.binding())
+                    {
+                        return nullptr;
+                    }
+                }
+                break;
+            }
+
+            case JsonBinding::Kind::Array:
+            {
+                if ((schema->types != JsonSchemaTree::ArrayType) || !schema->items || !binding->items())
+                {
+                    return nullptr;
+                }
+                break;
+            }
+
+            case JsonBinding::Kind::Value:
+            default:
+            {
+                unsigned int allowed = 0;
+                if (binding->set_integer)
+                {
+                    allowed |= JsonSchemaTree::IntegerType;
+                }
+                if (binding->set_number)
+                {
+                    allowed |= JsonSchemaTree::IntegerType | JsonSchemaTree::NumberType;
+                }
+                if (binding->set_string)
+                {
+                    allowed |= JsonSchemaTree::StringType;
+                }
+                if (binding->set_boolean)
+                {
+                    allowed |= JsonSchemaTree::BooleanType;
+                }
+                if ((schema->types & ~allowed) != 0)
+                {
+                    return nullptr;
+                }
+                break;
+            }
+        }
+    }
+
+    // Link the properties
+    for (const JsonSchemaTree::Property& property : schema->properties)
+    {
+        const JsonField* field = nullptr;
+        if (binding && (binding->kind == JsonBinding::Kind::Object))
+        {
+            for (size_t i = 0; (i < binding->fields_count) && !field; i++)
+            {
+                if (property.name == binding->fields[i].name)
+                {
+                    field = &binding->fields[i];
+                }
+            }
+        }
+        const Node* property_node = link(property.node, (field ? field->binding() : nullptr), depth + 1u);
+        if (!property_node)
+        {
+            return nullptr;
+        }
+        node.properties.push_back({field, property_node});
+    }
+
+    // Link the items
+    if (schema->items)
+    {
+        const JsonBinding* items_binding = nullptr;
+        if (binding && (binding->kind == JsonBinding::Kind::Array))
+        {
+            items_binding = binding->items();
+        }
+        node.items = link(schema->items, items_binding, depth + 1u);
+        if (!node.items)
+        {
+            return nullptr;
+        }
+    }
+
+    return &node;
+}
+
+/** @brief Validate and convert a JSON value */
+bool MessageDecoder::decode(const rapidjson::Value& json,
+                            const JsonBinding*      binding,
+                            void*                   data,
+                            const char*&            error_code,
+                            std::string&            error_message) const
+{
+    bool ret = false;
+
+    error_code = nullptr;
+    error_message.clear();
+    if (m_root && (binding == m_root->binding))
+    {
+        MessageDecoderHandler handler(m_root, data, error_code, error_message);
+        ret = json.Accept(handler);
+    }
+    else
+    {
+        error_code    = ocpp::rpc::IRpc::RPC_ERROR_INTERNAL;
+        error_message = "Decoder does not match the message type";
+    }
+
+    return ret;
+}
+
+/** @brief Parse, validate and convert a JSON text */
+bool MessageDecoder::decode(const char*        json,
+                            size_t             size,
+                            const JsonBinding* binding,
+                            void*              data,
+                            const char*&       error_code,
+                            std::string&       error_message) const
+{
+    bool ret = false;
+
+    error_code = nullptr;
+    error_message.clear();
+    if (m_root && (binding == m_root->binding))
+    {
+        MessageDecoderHandler   handler(m_root, data, error_code, error_message);
+        rapidjson::MemoryStream stream(json, size);
+        rapidjson::Reader       reader;
+        ret = !reader.Parse(stream, handler).IsError();
+        if (!ret && !error_code)
+        {
+            // Invalid JSON
+            error_code    = ocpp::rpc::IRpc::RPC_ERROR_FORMATION_VIOLATION;
+            error_message = rapidjson::GetParseError_En(reader.GetParseErrorCode());
+        }
+    }
+    else
+    {
+        error_code    = ocpp::rpc::IRpc::RPC_ERROR_INTERNAL;
+        error_message = "Decoder does not match the message type";
+    }
+
+    return ret;
+}
+
+} // namespace messages
+} // namespace ocpp
@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MESSAGEDECODER_H
+#define MESSAGEDECODER_H
+
+#include "JsonBinding.h"
+#include "JsonSchemaTree.h"
+#include "json.h"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+namespace messages
+{
+
+/** @brief Single pass decoder which validates a JSON payload against its schema and fills
+ *         the corresponding C++ data type while walking through the payload
+ *
+ *  A decoder is built by linking the tree representation of a JSON schema with the binding of
+ *  a C++ data type. It replaces the JSON schema validation followed by the conversion with the
+ *  message converter. Decoders are immutable and can be used simultaneously from several threads
+ */
+class MessageDecoder
+{
+  public:
+    /** @brief Maximum nesting depth of the decoded payloads */
+    static constexpr size_t MAX_DEPTH = 32u;
+
+    /**
+     * @brief Get the decoder corresponding to a JSON schema and a C++ data type binding,
+     *        the decoder is built on first use and shared between all its users
+     * @param schema Tree representation of the JSON schema
+     * @param binding Binding of the C++ data type
+     * @return Decoder if the schema and the binding match, nullptr otherwise
+     */
+    static std::shared_ptr<const MessageDecoder> get(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema,
+                                                     const JsonBinding*                                       binding);
+
+    /**
+     * @brief Constructor
+     * @param schema Tree representation of the JSON schema
+     * @param binding Binding of the C++ data type
+     */
+    MessageDecoder(const std::shared_ptr<const ocpp::json::JsonSchemaTree>& schema, const JsonBinding* binding);
+
+    /** @brief Destructor */
+    virtual ~MessageDecoder();
+
+    /** @brief Indicate if the schema and the binding have been successfully linked */
+    bool isValid() const { return (m_root != nullptr); }
+
+    /**
+     * @brief Validate and convert a JSON value to a C++ data type
+     * @param json JSON value to decode
+     * @param data C++ data type to fill
+     * @param error_code Error code in case of invalid input
+     * @param error_message Error message in case of invalid input
+     * @return true the value has been decoded, false otherwise
+     */
+    template <typename DataType>
+    bool decode(const rapidjson::Value& json, DataType& data, const char*& error_code, std::string& error_message) const
+    {
+        return decode(json, JsonBinder<DataType>::get(), &data, error_code, error_message);
+    }
+
+    /**
+     * @brief Parse, validate and convert a JSON text to a C++ data type
+     * @param json JSON text to decode
+     * @param size Size in bytes of the JSON text
+     * @param data C++ data type to fill
+     * @param error_code Error code in case of invalid input
+     * @param error_message Error message in case of invalid input
+     * @return true the text has been decoded, false otherwise
+     */
+    template <typename DataType>
+    bool decode(const char* json, size_t size, DataType& data, const char*& error_code, std::string& error_message) const
+    {
+        return decode(json, size, JsonBinder<DataType>::get(), &data, error_code, error_message);
+    }
+
+    // Forward declaration
+    struct Node;
+
+    /** @brief Property of an object node */
+    struct Property
+    {
+        /** @brief Binding of the corresponding field, nullptr if the property is only validated */
+        const JsonField* field;
+        /** @brief Node of the property's value */
+        const Node* node;
+    };
+
+    /** @brief Schema of a JSON value linked with the binding of the C++ data type storing it */
+    struct Node
+    {
+        /** @brief Schema of the value, nullptr if any value is allowed */
+        const ocpp::json::JsonSchemaTree::Node* schema;
+        /** @brief Binding of the value, nullptr if the value is only validated */
+        const JsonBinding* binding;
+        /** @brief Properties in the same order as in the schema (object) */
+        std::vector<Property> properties;
+        /** @brief Node of the items (array) */
+        const Node* items;
+    };
+
+  private:
+    /** @brief Tree representation of the JSON schema */
+    std::shared_ptr<const ocpp::json::JsonSchemaTree> m_schema;
+    /** @brief Nodes (their address does not change when new nodes are added) */
+    std::deque<Node> m_nodes;
+    /** @brief Root node */
+    const Node* m_root;
+
+    /** @brief Link a schema with a binding */
+    const Node* link(const ocpp::json::JsonSchemaTree::Node* schema, const JsonBinding* binding, size_t depth);
+
+    /** @brief Validate and convert a JSON value */
+    bool decode(const rapidjson::Value& json,
+                const JsonBinding*      binding,
+                void*                   data,
+                const char*&            error_code,
+                std::string&            error_message) const;
+
+    /** @brief Parse, validate and convert a JSON text */
+    bool decode(const char*        json,
+                size_t             size,
+                const JsonBinding* binding,
+                void*              data,
+                const char*&       error_code,
+                std::string&       error_message) const;
+};
+
+} // namespace messages
+} // namespace ocpp
+
+#endif // MESSAGEDECODER_H
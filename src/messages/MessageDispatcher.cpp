@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "MessageDispatcher.h"
 #include "IRpc.h"
+#include "JsonSchemaRegistry.h"
 #include "Logger.h"
 
 #include <filesystem>
@@ -41,23 +42,39 @@ bool MessageDispatcher::registerHandler(const std::string& action, IMessageHandl
     // Check if handler exists for this action
     if (m_handlers.find(action) == m_handlers.end())
     {
-        // Load the payload validator
-        std::shared_ptr<ocpp::json::JsonValidator> validator = std::make_shared<ocpp::json::JsonValidator>();
-        std::filesystem::path                      filepath(m_schemas_path);
+        std::filesystem::path filepath(m_schemas_path);
         filepath.append(action + ".json");
-        if (validator->init(filepath))
+
+        // Try to use a single pass decoder which validates the payload while converting it
+        std::shared_ptr<const ocpp::json::JsonSchemaTree> schema = ocpp::json::JsonSchemaRegistry::getTree(filepath);
+        if (schema && handler.enableSinglePassDecoding(schema))
         {
-            LOG_DEBUG << "[" << action << "] Validator loaded : " << filepath;
+            LOG_DEBUG << "[" << action << "] Single pass decoder enabled : " << filepath;
 
-            // Add handler
-            std::pair<std::shared_ptr<ocpp::json::JsonValidator>, IMessageHandler*> handler_data(validator, &handler);
+            // Add handler without validator
+            std::pair<std::shared_ptr<ocpp::json::JsonValidator>, IMessageHandler*> handler_data(nullptr, &handler);
 
             m_handlers[action] = handler_data;
             ret                = true;
         }
         else
         {
-            LOG_ERROR << "[" << action << "] Unable to load validator : " << filepath;
+            // Load the payload validator
+            std::shared_ptr<ocpp::json::JsonValidator> validator = std::make_shared<ocpp::json::JsonValidator>();
+            if (validator->init(filepath))
+            {
+                LOG_DEBUG << "[" << action << "] Validator loaded : " << filepath;
+
+                // Add handler
+                std::pair<std::shared_ptr<ocpp::json::JsonValidator>, IMessageHandler*> handler_data(validator, &handler);
+
+                m_handlers[action] = handler_data;
+                ret                = true;
+            }
+            else
+            {
+                LOG_ERROR << "[" << action << "] Unable to load validator : " << filepath;
+            }
         }
     }
 
@@ -65,15 +82,17 @@ bool MessageDispatcher::registerHandler(const std::string& action, IMessageHandl
 }
 
 /** @copydoc bool IMessageDispatcher::dispatchMessage(const std::string&,
-                                                          const rapidjson::Value&,
+                                                          const char*,
+                                                          size_t,
                                                           rapidjson::Document&,
                                                           const char*&,
                                                           std::string&) */
-bool MessageDispatcher::dispatchMessage(const std::string&      action,
-                                        const rapidjson::Value& payload,
-                                        rapidjson::Document&    response,
-                                        const char*&            error_code,
-                                        std::string&            error_message)
+bool MessageDispatcher::dispatchMessage(const std::string&   action,
+                                        const char*          payload,
+                                        size_t               size,
+                                        rapidjson::Document& response,
+                                        const char*&         error_code,
+                                        std::string&         error_message)
 {
     bool ret = false;
 
@@ -81,20 +100,36 @@ bool MessageDispatcher::dispatchMessage(const std::string&      action,
     auto it = m_handlers.find(action);
     if (it != m_handlers.end())
     {
-        // Check payload
         auto&                                      handler_data = it->second;
         std::shared_ptr<ocpp::json::JsonValidator> validator    = handler_data.first;
-        if (validator->isValid(payload))
+        IMessageHandler*                           handler      = handler_data.second;
+        if (!validator)
         {
-            // Call handler
-            IMessageHandler* handler = handler_data.second;
-            ret                      = handler->handle(action, payload, response, error_code, error_message);
+            // Single pass decoder : the handler validates the payload while decoding it
+            ret = handler->handle(action, payload, size, response, error_code, error_message);
         }
         else
         {
-            // Invalid payload
-            error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
-            error_message = validator->lastError();
+            // Parse and check payload
+            rapidjson::Document json;
+            json.Parse(payload, size);
+            if (json.HasParseError())
+            {
+                // Invalid JSON
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_FORMATION_VIOLATION;
+                error_message = rapidjson::GetParseError_En(json.GetParseError());
+            }
+            else if (validator->isValid(json))
+            {
+                // Call handler
+                ret = handler->handle(action, json, response, error_code, error_message);
+            }
+            else
+            {
+                // Invalid payload
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+                error_message = validator->lastError();
+            }
         }
     }
     else
@@ -46,20 +46,22 @@ class MessageDispatcher : public IMessageDispatcher
     bool registerHandler(const std::string& action, IMessageHandler& handler) override;
 
     /** @copydoc bool IMessageDispatcher::dispatchMessage(const std::string&,
-                                                          const rapidjson::Value&,
+                                                          const char*,
+                                                          size_t,
                                                           rapidjson::Document&,
                                                           const char*&,
                                                           std::string&) */
-    bool dispatchMessage(const std::string&      action,
-                         const rapidjson::Value& payload,
-                         rapidjson::Document&    response,
-                         const char*&            error_code,
-                         std::string&            error_message) override;
+    bool dispatchMessage(const std::string&   action,
+                         const char*          payload,
+                         size_t               size,
+                         rapidjson::Document& response,
+                         const char*&         error_code,
+                         std::string&         error_message) override;
 
   private:
     /** @brief Path to the JSON schemas needed to validate payloads */
     const std::string m_schemas_path;
-    /** @brief Handlers */
+    /** @brief Handlers (no validator when the handler uses a single pass decoder) */
     std::map<std::string, std::pair<std::shared_ptr<ocpp::json::JsonValidator>, IMessageHandler*>> m_handlers;
 };
 
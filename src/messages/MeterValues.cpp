@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a ReadingContext enum to string */
-const EnumToStringFromString<ReadingContext> ReadingContextHelper = {{ReadingContext::InterruptionBegin, "Interruption.Begin"},
+constexpr EnumToStringFromString<ReadingContext> ReadingContextHelper = {{ReadingContext::InterruptionBegin, "Interruption.Begin"},
                                                                      {ReadingContext::InterruptionEnd, "Interruption.End"},
                                                                      {ReadingContext::Other, "Other"},
                                                                      {ReadingContext::SampleClock, "Sample.Clock"},
@@ -36,9 +36,9 @@ const EnumToStringFromString<ReadingContext> ReadingContextHelper = {{ReadingCon
                                                                      {ReadingContext::TransactionEnd, "Transaction.End"},
                                                                      {ReadingContext::Trigger, "Trigger"}};
 /** @brief Helper to convert a ValueFormat enum to string */
-const EnumToStringFromString<ValueFormat> ValueFormatHelper = {{ValueFormat::Raw, "Raw"}, {ValueFormat::SignedData, "SignedData"}};
+constexpr EnumToStringFromString<ValueFormat> ValueFormatHelper = {{ValueFormat::Raw, "Raw"}, {ValueFormat::SignedData, "SignedData"}};
 /** @brief Helper to convert a Measurand enum to string */
-const EnumToStringFromString<Measurand> MeasurandHelper = {{Measurand::Current, "Current"},
+constexpr EnumToStringFromString<Measurand> MeasurandHelper = {{Measurand::Current, "Current"},
                                                            {Measurand::CurrentImport, "Current.Import"},
                                                            {Measurand::CurrentOffered, "Current.Offered"},
                                                            {Measurand::EnergyActiveExportInterval, "Energy.Active.Export.Interval"},
@@ -61,7 +61,7 @@ const EnumToStringFromString<Measurand> MeasurandHelper = {{Measurand::Current,
                                                            {Measurand::Temperature, "Temperature"},
                                                            {Measurand::Voltage, "Voltage"}};
 /** @brief Helper to convert a Phase enum to string */
-const EnumToStringFromString<Phase> PhaseHelper = {{Phase::L1, "L1"},
+constexpr EnumToStringFromString<Phase> PhaseHelper = {{Phase::L1, "L1"},
                                                    {Phase::L2, "L2"},
                                                    {Phase::L3, "L3"},
                                                    {Phase::N, "N"},
@@ -72,10 +72,10 @@ const EnumToStringFromString<Phase> PhaseHelper = {{Phase::L1, "L1"},
                                                    {Phase::L2L3, "L2-L3"},
                                                    {Phase::L3L1, "L3-L1"}};
 /** @brief Helper to convert a Location enum to string */
-const EnumToStringFromString<Location> LocationHelper = {
+constexpr EnumToStringFromString<Location> LocationHelper = {
     {Location::Body, "Body"}, {Location::Cable, "Cable"}, {Location::EV, "EV"}, {Location::Inlet, "Inlet"}, {Location::Outlet, "Outlet"}};
 /** @brief Helper to convert a UnitOfMeasure enum to string */
-const EnumToStringFromString<UnitOfMeasure> UnitOfMeasureHelper = {{UnitOfMeasure::A, "A"},
+constexpr EnumToStringFromString<UnitOfMeasure> UnitOfMeasureHelper = {{UnitOfMeasure::A, "A"},
                                                                    {UnitOfMeasure::Celsius, "Celsius"},
                                                                    {UnitOfMeasure::Fahrenheit, "Fahrenheit"},
                                                                    {UnitOfMeasure::K, "K"},
@@ -126,15 +126,38 @@ bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Docu
 
     rapidjson::Value    meterValue(rapidjson::kArrayType);
     MeterValueConverter metervalue_converter;
-    metervalue_converter.setAllocator(allocator);
     for (const MeterValue& meter_value : data.meterValue)
     {
-        rapidjson::Document value;
-        value.Parse("{}");
+        rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
         ret = ret && metervalue_converter.toJson(meter_value, value);
-        meterValue.PushBack(value.Move(), *allocator);
+        meterValue.PushBack(value.Move(), json.GetAllocator());
+    }
+    json.AddMember(rapidjson::StringRef("meterValue"), meterValue.Move(), json.GetAllocator());
+
+    return ret;
+}
+
+/** @copydoc bool IMessageConverter<DataType>::serialize(const DataType&, JsonWriter&) */
+bool MeterValuesReqConverter::serialize(const MeterValuesReq& data, JsonWriter& writer)
+{
+    bool ret = true;
+
+    writer.StartObject();
+    write(writer, "connectorId", data.connectorId);
+    write(writer, "transactionId", data.transactionId);
+
+    writer.Key("meterValue");
+    writer.StartArray();
+    MeterValueConverter metervalue_converter;
+    for (const MeterValue& meter_value : data.meterValue)
+    {
+        ret = ret && metervalue_converter.serialize(meter_value, writer);
+    }
+    if (ret)
+    {
+        writer.EndArray();
+        ret = writer.EndObject();
     }
-    json.AddMember(rapidjson::StringRef("meterValue"), meterValue.Move(), *allocator);
 
     return ret;
 }
@@ -160,5 +183,15 @@ bool MeterValuesConfConverter::toJson(const MeterValuesConf& data, rapidjson::Do
     return true;
 }
 
+/** @brief Single pass decoding binding for MeterValues.req message */
+JSON_BINDING_FIELDS(MeterValuesReq,
+                    nullptr,
+                    JSON_FIELD(MeterValuesReq, connectorId),
+                    JSON_FIELD(MeterValuesReq, transactionId),
+                    JSON_FIELD(MeterValuesReq, meterValue))
+
+/** @brief Single pass decoding binding for MeterValues.conf message */
+JSON_BINDING_EMPTY(MeterValuesConf)
+
 } // namespace messages
 } // namespace ocpp
@@ -53,7 +53,7 @@ struct MeterValuesConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(MeterValues)
+MESSAGE_CONVERTERS_WITH_REQ_SERIALIZER(MeterValues)
 
 } // namespace messages
 } // namespace ocpp
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class RemoteStartStopStatus enum to string */
-const EnumToStringFromString<RemoteStartStopStatus> RemoteStartStopStatusHelper = {{RemoteStartStopStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<RemoteStartStopStatus> RemoteStartStopStatusHelper = {{RemoteStartStopStatus::Accepted, "Accepted"},
                                                                                    {RemoteStartStopStatus::Rejected, "Rejected"}};
 
 } // namespace types
@@ -68,13 +68,11 @@ bool RemoteStartTransactionReqConverter::toJson(const RemoteStartTransactionReq&
     if (data.chargingProfile.isSet())
     {
         ChargingProfileConverter charging_profile_converter;
-        charging_profile_converter.setAllocator(allocator);
 
-        rapidjson::Document chargingProfile;
-        chargingProfile.Parse("{}");
+        rapidjson::Document chargingProfile(rapidjson::kObjectType, &json.GetAllocator());
 
         ret = charging_profile_converter.toJson(data.chargingProfile, chargingProfile);
-        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile.Move(), json.GetAllocator());
     }
 
     return ret;
@@ -99,5 +97,15 @@ bool RemoteStartTransactionConfConverter::toJson(const RemoteStartTransactionCon
     return true;
 }
 
+/** @brief Single pass decoding binding for RemoteStartTransaction.req message */
+JSON_BINDING_FIELDS(RemoteStartTransactionReq,
+                    nullptr,
+                    JSON_FIELD(RemoteStartTransactionReq, connectorId),
+                    JSON_FIELD(RemoteStartTransactionReq, idTag),
+                    JSON_FIELD(RemoteStartTransactionReq, chargingProfile))
+
+/** @brief Single pass decoding binding for RemoteStartTransaction.conf message */
+JSON_BINDING_FIELDS(RemoteStartTransactionConf, nullptr, JSON_ENUM_FIELD(RemoteStartTransactionConf, status, RemoteStartStopStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -64,5 +64,11 @@ bool RemoteStopTransactionConfConverter::toJson(const RemoteStopTransactionConf&
     return true;
 }
 
+/** @brief Single pass decoding binding for RemoteStopTransaction.req message */
+JSON_BINDING_FIELDS(RemoteStopTransactionReq, nullptr, JSON_FIELD(RemoteStopTransactionReq, transactionId))
+
+/** @brief Single pass decoding binding for RemoteStopTransaction.conf message */
+JSON_BINDING_FIELDS(RemoteStopTransactionConf, nullptr, JSON_ENUM_FIELD(RemoteStopTransactionConf, status, RemoteStartStopStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class ReservationStatus enum to string */
-const EnumToStringFromString<ReservationStatus> ReservationStatusHelper = {{ReservationStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<ReservationStatus> ReservationStatusHelper = {{ReservationStatus::Accepted, "Accepted"},
                                                                            {ReservationStatus::Faulted, "Faulted"},
                                                                            {ReservationStatus::Occupied, "Occupied"},
                                                                            {ReservationStatus::Rejected, "Rejected"},
@@ -85,5 +85,17 @@ bool ReserveNowConfConverter::toJson(const ReserveNowConf& data, rapidjson::Docu
     return true;
 }
 
+/** @brief Single pass decoding binding for ReserveNow.req message */
+JSON_BINDING_FIELDS(ReserveNowReq,
+                    nullptr,
+                    JSON_FIELD(ReserveNowReq, connectorId),
+                    JSON_FIELD(ReserveNowReq, expiryDate),
+                    JSON_FIELD(ReserveNowReq, idTag),
+                    JSON_FIELD(ReserveNowReq, parentIdTag),
+                    JSON_FIELD(ReserveNowReq, reservationId))
+
+/** @brief Single pass decoding binding for ReserveNow.conf message */
+JSON_BINDING_FIELDS(ReserveNowConf, nullptr, JSON_ENUM_FIELD(ReserveNowConf, status, ReservationStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
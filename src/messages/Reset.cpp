@@ -27,9 +27,9 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a ResetType enum to string */
-const EnumToStringFromString<ResetType> ResetTypeHelper = {{ResetType::Hard, "Hard"}, {ResetType::Soft, "Soft"}};
+constexpr EnumToStringFromString<ResetType> ResetTypeHelper = {{ResetType::Hard, "Hard"}, {ResetType::Soft, "Soft"}};
 /** @brief Helper to convert a ResetStatus enum to string */
-const EnumToStringFromString<ResetStatus> ResetStatusHelper = {{ResetStatus::Accepted, "Accepted"}, {ResetStatus::Rejected, "Rejected"}};
+constexpr EnumToStringFromString<ResetStatus> ResetStatusHelper = {{ResetStatus::Accepted, "Accepted"}, {ResetStatus::Rejected, "Rejected"}};
 } // namespace types
 
 namespace messages
@@ -67,5 +67,11 @@ bool ResetConfConverter::toJson(const ResetConf& data, rapidjson::Document& json
     return true;
 }
 
+/** @brief Single pass decoding binding for Reset.req message */
+JSON_BINDING_FIELDS(ResetReq, nullptr, JSON_ENUM_FIELD(ResetReq, type, ResetTypeHelper))
+
+/** @brief Single pass decoding binding for Reset.conf message */
+JSON_BINDING_FIELDS(ResetConf, nullptr, JSON_ENUM_FIELD(ResetConf, status, ResetStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
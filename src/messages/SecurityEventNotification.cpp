@@ -72,5 +72,15 @@ bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificat
     return true;
 }
 
+/** @brief Single pass decoding binding for SecurityEventNotification.req message */
+JSON_BINDING_FIELDS(SecurityEventNotificationReq,
+                    nullptr,
+                    JSON_FIELD(SecurityEventNotificationReq, type),
+                    JSON_FIELD(SecurityEventNotificationReq, timestamp),
+                    JSON_FIELD(SecurityEventNotificationReq, techInfo))
+
+/** @brief Single pass decoding binding for SecurityEventNotification.conf message */
+JSON_BINDING_EMPTY(SecurityEventNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
@@ -27,10 +27,10 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a UpdateType enum to string */
-const EnumToStringFromString<UpdateType> UpdateTypeHelper = {{UpdateType::Differential, "Differential"}, {UpdateType::Full, "Full"}};
+constexpr EnumToStringFromString<UpdateType> UpdateTypeHelper = {{UpdateType::Differential, "Differential"}, {UpdateType::Full, "Full"}};
 
 /** @brief Helper to convert a UpdateStatus enum to string */
-const EnumToStringFromString<UpdateStatus> UpdateStatusHelper = {{UpdateStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<UpdateStatus> UpdateStatusHelper = {{UpdateStatus::Accepted, "Accepted"},
                                                                  {UpdateStatus::Failed, "Failed"},
                                                                  {UpdateStatus::NotSupported, "NotSupported"},
                                                                  {UpdateStatus::VersionMismatch, "VersionMismatch"}};
@@ -46,7 +46,7 @@ bool SendLocalListReqConverter::fromJson(const rapidjson::Value& json,
 {
     bool ret = true;
     extract(json, "listVersion", data.listVersion);
-    if (json.HasMember(""))
+    if (json.HasMember("localAuthorizationList"))
     {
         AuthorizationDataConverter      authorization_data_converter;
         std::vector<AuthorizationData>& local_authorization_list = data.localAuthorizationList;
@@ -71,16 +71,14 @@ bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::
     if (!data.localAuthorizationList.empty())
     {
         AuthorizationDataConverter authorization_data_converter;
-        authorization_data_converter.setAllocator(allocator);
         rapidjson::Value localAuthorizationList(rapidjson::kArrayType);
         for (const AuthorizationData& authorization_data : data.localAuthorizationList)
         {
-            rapidjson::Document value;
-            value.Parse("{}");
+            rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
             ret = ret && authorization_data_converter.toJson(authorization_data, value);
-            localAuthorizationList.PushBack(value.Move(), *allocator);
+            localAuthorizationList.PushBack(value.Move(), json.GetAllocator());
         }
-        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList.Move(), json.GetAllocator());
     }
     fill(json, "updateType", UpdateTypeHelper.toString(data.updateType));
     return ret;
@@ -105,5 +103,15 @@ bool SendLocalListConfConverter::toJson(const SendLocalListConf& data, rapidjson
     return true;
 }
 
+/** @brief Single pass decoding binding for SendLocalList.req message */
+JSON_BINDING_FIELDS(SendLocalListReq,
+                    nullptr,
+                    JSON_FIELD(SendLocalListReq, listVersion),
+                    JSON_FIELD(SendLocalListReq, localAuthorizationList),
+                    JSON_ENUM_FIELD(SendLocalListReq, updateType, UpdateTypeHelper))
+
+/** @brief Single pass decoding binding for SendLocalList.conf message */
+JSON_BINDING_FIELDS(SendLocalListConf, nullptr, JSON_ENUM_FIELD(SendLocalListConf, status, UpdateStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
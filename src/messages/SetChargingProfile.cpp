@@ -28,21 +28,21 @@ namespace types
 {
 
 /** @brief Helper to convert a enum class ChargingProfileStatus enum to string */
-const EnumToStringFromString<ChargingProfileStatus> ChargingProfileStatusHelper = {{ChargingProfileStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<ChargingProfileStatus> ChargingProfileStatusHelper = {{ChargingProfileStatus::Accepted, "Accepted"},
                                                                                    {ChargingProfileStatus::Rejected, "Rejected"},
                                                                                    {ChargingProfileStatus::NotSupported, "NotSupported"}};
 
 /** @brief Helper to convert a enum class ChargingProfileKindType enum to string */
-const EnumToStringFromString<ChargingProfileKindType> ChargingProfileKindTypeHelper = {{ChargingProfileKindType::Absolute, "Absolute"},
+constexpr EnumToStringFromString<ChargingProfileKindType> ChargingProfileKindTypeHelper = {{ChargingProfileKindType::Absolute, "Absolute"},
                                                                                        {ChargingProfileKindType::Recurring, "Recurring"},
                                                                                        {ChargingProfileKindType::Relative, "Relative"}};
 
 /** @brief Helper to convert a enum class RecurrencyKindType enum to string */
-const EnumToStringFromString<RecurrencyKindType> RecurrencyKindTypeHelper = {{RecurrencyKindType::Daily, "Daily"},
+constexpr EnumToStringFromString<RecurrencyKindType> RecurrencyKindTypeHelper = {{RecurrencyKindType::Daily, "Daily"},
                                                                              {RecurrencyKindType::Weekly, "Weekly"}};
 
 /** @brief Helper to convert a enum class ChargingRateUnitType enum to string */
-const EnumToStringFromString<ChargingRateUnitType> ChargingRateUnitTypeHelper = {{ChargingRateUnitType::W, "W"},
+constexpr EnumToStringFromString<ChargingRateUnitType> ChargingRateUnitTypeHelper = {{ChargingRateUnitType::W, "W"},
                                                                                  {ChargingRateUnitType::A, "A"}};
 
 } // namespace types
@@ -77,13 +77,11 @@ bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, r
     fill(json, "connectorId", data.connectorId);
 
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(allocator);
 
-    rapidjson::Document csChargingProfiles;
-    csChargingProfiles.Parse("{}");
+    rapidjson::Document csChargingProfiles(rapidjson::kObjectType, &json.GetAllocator());
 
     bool ret = charging_profile_converter.toJson(data.csChargingProfiles, csChargingProfiles);
-    json.AddMember(rapidjson::StringRef("csChargingProfiles"), csChargingProfiles.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("csChargingProfiles"), csChargingProfiles.Move(), json.GetAllocator());
 
     return ret;
 }
@@ -108,5 +106,14 @@ bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf& data,
     return true;
 }
 
+/** @brief Single pass decoding binding for SetChargingProfile.req message */
+JSON_BINDING_FIELDS(SetChargingProfileReq,
+                    nullptr,
+                    JSON_FIELD(SetChargingProfileReq, connectorId),
+                    JSON_FIELD(SetChargingProfileReq, csChargingProfiles))
+
+/** @brief Single pass decoding binding for SetChargingProfile.conf message */
+JSON_BINDING_FIELDS(SetChargingProfileConf, nullptr, JSON_ENUM_FIELD(SetChargingProfileConf, status, ChargingProfileStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -27,7 +27,7 @@ namespace types
 {
 
 /** @brief Helper to convert a enum class GenericStatusEnumType enum to string */
-const EnumToStringFromString<GenericStatusEnumType> GenericStatusEnumTypeHelper = {{GenericStatusEnumType::Accepted, "Accepted"},
+constexpr EnumToStringFromString<GenericStatusEnumType> GenericStatusEnumTypeHelper = {{GenericStatusEnumType::Accepted, "Accepted"},
                                                                                    {GenericStatusEnumType::Rejected, "Rejected"}};
 
 } // namespace types
@@ -72,5 +72,11 @@ bool SignCertificateConfConverter::toJson(const SignCertificateConf& data, rapid
     return true;
 }
 
+/** @brief Single pass decoding binding for SignCertificate.req message */
+JSON_BINDING_FIELDS(SignCertificateReq, nullptr, JSON_FIELD(SignCertificateReq, csr))
+
+/** @brief Single pass decoding binding for SignCertificate.conf message */
+JSON_BINDING_FIELDS(SignCertificateConf, nullptr, JSON_ENUM_FIELD(SignCertificateConf, status, GenericStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class FirmwareStatusEnumType enum to string */
-const EnumToStringFromString<FirmwareStatusEnumType> FirmwareStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<FirmwareStatusEnumType> FirmwareStatusEnumTypeHelper = {
     {FirmwareStatusEnumType::Downloaded, "Downloaded"},
     {FirmwareStatusEnumType::DownloadFailed, "DownloadFailed"},
     {FirmwareStatusEnumType::Downloading, "Downloading"},
@@ -89,5 +89,14 @@ bool SignedFirmwareStatusNotificationConfConverter::toJson(const SignedFirmwareS
     return true;
 }
 
+/** @brief Single pass decoding binding for SignedFirmwareStatusNotification.req message */
+JSON_BINDING_FIELDS(SignedFirmwareStatusNotificationReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(SignedFirmwareStatusNotificationReq, status, FirmwareStatusEnumTypeHelper),
+                    JSON_FIELD(SignedFirmwareStatusNotificationReq, requestId))
+
+/** @brief Single pass decoding binding for SignedFirmwareStatusNotification.conf message */
+JSON_BINDING_EMPTY(SignedFirmwareStatusNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
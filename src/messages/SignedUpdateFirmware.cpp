@@ -28,7 +28,7 @@ namespace types
 {
 
 /** @brief Helper to convert a UpdateFirmwareStatusEnumType enum to string */
-const EnumToStringFromString<UpdateFirmwareStatusEnumType> UpdateFirmwareStatusEnumTypeHelper = {
+constexpr EnumToStringFromString<UpdateFirmwareStatusEnumType> UpdateFirmwareStatusEnumTypeHelper = {
     {UpdateFirmwareStatusEnumType::Accepted, "Accepted"},
     {UpdateFirmwareStatusEnumType::Rejected, "Rejected"},
     {UpdateFirmwareStatusEnumType::AcceptedCanceled, "AcceptedCanceled"},
@@ -72,14 +72,13 @@ bool SignedUpdateFirmwareReqConverter::toJson(const SignedUpdateFirmwareReq& dat
     fill(json, "retries", data.retries);
     fill(json, "retryInterval", data.retryInterval);
 
-    rapidjson::Document firmware;
-    firmware.Parse("{}");
+    rapidjson::Document firmware(rapidjson::kObjectType, &json.GetAllocator());
     fill(firmware, "location", data.firmware.location);
     fill(firmware, "retrieveDateTime", data.firmware.retrieveDateTime);
     fill(firmware, "installDateTime", data.firmware.installDateTime);
     fill(firmware, "signingCertificate", data.firmware.signingCertificate);
     fill(firmware, "signature", data.firmware.signature);
-    json.AddMember(rapidjson::StringRef("firmware"), firmware.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("firmware"), firmware.Move(), json.GetAllocator());
     return true;
 }
 
@@ -102,5 +101,41 @@ bool SignedUpdateFirmwareConfConverter::toJson(const SignedUpdateFirmwareConf& d
     return true;
 }
 
+/** @brief Check the location of a SignedUpdateFirmware.req message */
+static bool checkSignedUpdateFirmwareReq(void* data, std::string& error_message)
+{
+    const SignedUpdateFirmwareReq& request = *reinterpret_cast<SignedUpdateFirmwareReq*>(data);
+    ocpp::websockets::Url          url(request.firmware.location);
+    bool                           ret = url.isValid();
+    if (!ret)
+    {
+        error_message = "location parameter is not a valid URL";
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for FirmwareType type */
+JSON_BINDING(FirmwareType)
+JSON_BINDING_FIELDS(FirmwareType,
+                    nullptr,
+                    JSON_FIELD(FirmwareType, location),
+                    JSON_FIELD(FirmwareType, retrieveDateTime),
+                    JSON_FIELD(FirmwareType, installDateTime),
+                    JSON_FIELD(FirmwareType, signingCertificate),
+                    JSON_FIELD(FirmwareType, signature))
+
+/** @brief Single pass decoding binding for SignedUpdateFirmware.req message */
+JSON_BINDING_FIELDS(SignedUpdateFirmwareReq,
+                    &checkSignedUpdateFirmwareReq,
+                    JSON_FIELD(SignedUpdateFirmwareReq, retries),
+                    JSON_FIELD(SignedUpdateFirmwareReq, retryInterval),
+                    JSON_FIELD(SignedUpdateFirmwareReq, requestId),
+                    JSON_FIELD(SignedUpdateFirmwareReq, firmware))
+
+/** @brief Single pass decoding binding for SignedUpdateFirmware.conf message */
+JSON_BINDING_FIELDS(SignedUpdateFirmwareConf,
+                    nullptr,
+                    JSON_ENUM_FIELD(SignedUpdateFirmwareConf, status, UpdateFirmwareStatusEnumTypeHelper))
+
 } // namespace messages
 } // namespace ocpp
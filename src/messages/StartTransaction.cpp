@@ -80,15 +80,28 @@ bool StartTransactionConfConverter::fromJson(const rapidjson::Value& json,
 bool StartTransactionConfConverter::toJson(const StartTransactionConf& data, rapidjson::Document& json)
 {
     IdTagInfoConverter id_tag_info_converter;
-    id_tag_info_converter.setAllocator(allocator);
 
-    rapidjson::Document id_tag_info;
-    id_tag_info.Parse("{}");
-    bool ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
+    rapidjson::Document id_tag_info(rapidjson::kObjectType, &json.GetAllocator());
+    bool                ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
+    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), json.GetAllocator());
     fill(json, "transactionId", data.transactionId);
     return ret;
 }
 
+/** @brief Single pass decoding binding for StartTransaction.req message */
+JSON_BINDING_FIELDS(StartTransactionReq,
+                    nullptr,
+                    JSON_FIELD(StartTransactionReq, connectorId),
+                    JSON_FIELD(StartTransactionReq, idTag),
+                    JSON_FIELD(StartTransactionReq, meterStart),
+                    JSON_FIELD(StartTransactionReq, reservationId),
+                    JSON_FIELD(StartTransactionReq, timestamp))
+
+/** @brief Single pass decoding binding for StartTransaction.conf message */
+JSON_BINDING_FIELDS(StartTransactionConf,
+                    nullptr,
+                    JSON_FIELD(StartTransactionConf, idTagInfo),
+                    JSON_FIELD(StartTransactionConf, transactionId))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a ChargePointErrorCode enum to string */
-const EnumToStringFromString<ChargePointErrorCode> ChargePointErrorCodeHelper = {
+constexpr EnumToStringFromString<ChargePointErrorCode> ChargePointErrorCodeHelper = {
     {ChargePointErrorCode::ConnectorLockFailure, "ConnectorLockFailure"},
     {ChargePointErrorCode::EVCommunicationError, "EVCommunicationError"},
     {ChargePointErrorCode::GroundFailure, "GroundFailure"},
@@ -45,7 +45,7 @@ const EnumToStringFromString<ChargePointErrorCode> ChargePointErrorCodeHelper =
     {ChargePointErrorCode::WeakSignal, "WeakSignal"}};
 
 /** @brief Helper to convert a ChargePointStatus enum to string */
-const EnumToStringFromString<ChargePointStatus> ChargePointStatusHelper = {{ChargePointStatus::Available, "Available"},
+constexpr EnumToStringFromString<ChargePointStatus> ChargePointStatusHelper = {{ChargePointStatus::Available, "Available"},
                                                                            {ChargePointStatus::Charging, "Charging"},
                                                                            {ChargePointStatus::Faulted, "Faulted"},
                                                                            {ChargePointStatus::Finishing, "Finishing"},
@@ -71,8 +71,8 @@ bool StatusNotificationReqConverter::fromJson(const rapidjson::Value& json,
     extract(json, "info", data.info);
     data.status = ChargePointStatusHelper.fromString(json["status"].GetString());
     ret         = ret && extract(json, "timestamp", data.timestamp, error_message);
-    extract(json, "info", data.vendorId);
-    extract(json, "info", data.vendorErrorCode);
+    extract(json, "vendorId", data.vendorId);
+    extract(json, "vendorErrorCode", data.vendorErrorCode);
     if (!ret)
     {
         error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
@@ -96,6 +96,23 @@ bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, r
     return true;
 }
 
+/** @copydoc bool IMessageConverter<DataType>::serialize(const DataType&, JsonWriter&) */
+bool StatusNotificationReqConverter::serialize(const StatusNotificationReq& data, JsonWriter& writer)
+{
+    writer.StartObject();
+    write(writer, "connectorId", data.connectorId);
+    write(writer, "errorCode", ChargePointErrorCodeHelper.toString(data.errorCode));
+    write(writer, "status", ChargePointStatusHelper.toString(data.status));
+    write(writer, "timestamp", data.timestamp);
+    if (data.errorCode != ChargePointErrorCode::NoError)
+    {
+        write(writer, "info", data.info);
+        write(writer, "vendorId", data.vendorId);
+        write(writer, "vendorErrorCode", data.vendorErrorCode);
+    }
+    return writer.EndObject();
+}
+
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, const char*&, std::string&) */
 bool StatusNotificationConfConverter::fromJson(const rapidjson::Value& json,
                                                StatusNotificationConf& data,
@@ -117,5 +134,19 @@ bool StatusNotificationConfConverter::toJson(const StatusNotificationConf& data,
     return true;
 }
 
+/** @brief Single pass decoding binding for StatusNotification.req message */
+JSON_BINDING_FIELDS(StatusNotificationReq,
+                    nullptr,
+                    JSON_FIELD(StatusNotificationReq, connectorId),
+                    JSON_ENUM_FIELD(StatusNotificationReq, errorCode, ChargePointErrorCodeHelper),
+                    JSON_FIELD(StatusNotificationReq, info),
+                    JSON_ENUM_FIELD(StatusNotificationReq, status, ChargePointStatusHelper),
+                    JSON_FIELD(StatusNotificationReq, timestamp),
+                    JSON_FIELD(StatusNotificationReq, vendorId),
+                    JSON_FIELD(StatusNotificationReq, vendorErrorCode))
+
+/** @brief Single pass decoding binding for StatusNotification.conf message */
+JSON_BINDING_EMPTY(StatusNotificationConf)
+
 } // namespace messages
 } // namespace ocpp
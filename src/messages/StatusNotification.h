@@ -62,7 +62,7 @@ struct StatusNotificationConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(StatusNotification)
+MESSAGE_CONVERTERS_WITH_REQ_SERIALIZER(StatusNotification)
 
 } // namespace messages
 } // namespace ocpp
@@ -30,7 +30,7 @@ namespace types
 {
 
 /** @brief Helper to convert a Reason enum to string */
-const EnumToStringFromString<Reason> ReasonHelper = {{Reason::DeAuthorized, "DeAuthorized"},
+constexpr EnumToStringFromString<Reason> ReasonHelper = {{Reason::DeAuthorized, "DeAuthorized"},
                                                      {Reason::EmergencyStop, "EmergencyStop"},
                                                      {Reason::EVDisconnected, "EVDisconnected"},
                                                      {Reason::HardReset, "HardReset"},
@@ -89,15 +89,13 @@ bool StopTransactionReqConverter::toJson(const StopTransactionReq& data, rapidjs
     {
         rapidjson::Value    transactionData(rapidjson::kArrayType);
         MeterValueConverter metervalue_converter;
-        metervalue_converter.setAllocator(allocator);
         for (const MeterValue& meter_value : data.transactionData)
         {
-            rapidjson::Document value;
-            value.Parse("{}");
+            rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
             ret = ret && metervalue_converter.toJson(meter_value, value);
-            transactionData.PushBack(value.Move(), *allocator);
+            transactionData.PushBack(value.Move(), json.GetAllocator());
         }
-        json.AddMember(rapidjson::StringRef("transactionData"), transactionData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("transactionData"), transactionData.Move(), json.GetAllocator());
     }
     return ret;
 }
@@ -124,15 +122,26 @@ bool StopTransactionConfConverter::toJson(const StopTransactionConf& data, rapid
     if (data.idTagInfo.isSet())
     {
         IdTagInfoConverter id_tag_info_converter;
-        id_tag_info_converter.setAllocator(allocator);
 
-        rapidjson::Document id_tag_info;
-        id_tag_info.Parse("{}");
+        rapidjson::Document id_tag_info(rapidjson::kObjectType, &json.GetAllocator());
         ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-        json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), json.GetAllocator());
     }
     return ret;
 }
 
+/** @brief Single pass decoding binding for StopTransaction.req message */
+JSON_BINDING_FIELDS(StopTransactionReq,
+                    nullptr,
+                    JSON_FIELD(StopTransactionReq, idTag),
+                    JSON_FIELD(StopTransactionReq, meterStop),
+                    JSON_FIELD(StopTransactionReq, timestamp),
+                    JSON_FIELD(StopTransactionReq, transactionId),
+                    JSON_ENUM_FIELD(StopTransactionReq, reason, ReasonHelper),
+                    JSON_FIELD(StopTransactionReq, transactionData))
+
+/** @brief Single pass decoding binding for StopTransaction.conf message */
+JSON_BINDING_FIELDS(StopTransactionConf, nullptr, JSON_FIELD(StopTransactionConf, idTagInfo))
+
 } // namespace messages
 } // namespace ocpp
@@ -26,7 +26,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a MessageTrigger enum to string */
-const EnumToStringFromString<MessageTrigger> MessageTriggerHelper = {
+constexpr EnumToStringFromString<MessageTrigger> MessageTriggerHelper = {
     {MessageTrigger::BootNotification, "BootNotification"},
     {MessageTrigger::DiagnosticsStatusNotification, "DiagnosticsStatusNotification"},
     {MessageTrigger::FirmwareStatusNotification, "FirmwareStatusNotification"},
@@ -35,7 +35,7 @@ const EnumToStringFromString<MessageTrigger> MessageTriggerHelper = {
     {MessageTrigger::StatusNotification, "StatusNotification"}};
 
 /** @brief Helper to convert a TriggerMessageStatus enum to string */
-const EnumToStringFromString<TriggerMessageStatus> TriggerMessageStatusHelper = {{TriggerMessageStatus::Accepted, "Accepted"},
+constexpr EnumToStringFromString<TriggerMessageStatus> TriggerMessageStatusHelper = {{TriggerMessageStatus::Accepted, "Accepted"},
                                                                                  {TriggerMessageStatus::NotImplemented, "NotImplemented"},
                                                                                  {TriggerMessageStatus::Rejected, "Rejected"}};
 
@@ -86,5 +86,14 @@ bool TriggerMessageConfConverter::toJson(const TriggerMessageConf& data, rapidjs
     return true;
 }
 
+/** @brief Single pass decoding binding for TriggerMessage.req message */
+JSON_BINDING_FIELDS(TriggerMessageReq,
+                    nullptr,
+                    JSON_ENUM_FIELD(TriggerMessageReq, requestedMessage, MessageTriggerHelper),
+                    JSON_FIELD(TriggerMessageReq, connectorId))
+
+/** @brief Single pass decoding binding for TriggerMessage.conf message */
+JSON_BINDING_FIELDS(TriggerMessageConf, nullptr, JSON_ENUM_FIELD(TriggerMessageConf, status, TriggerMessageStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -28,7 +28,7 @@ namespace types
 {
 
 /** @brief Helper to convert a UnlockStatus enum to string */
-const EnumToStringFromString<UnlockStatus> UnlockStatusHelper = {
+constexpr EnumToStringFromString<UnlockStatus> UnlockStatusHelper = {
     {UnlockStatus::Unlocked, "Unlocked"}, {UnlockStatus::UnlockFailed, "UnlockFailed"}, {UnlockStatus::NotSupported, "NotSupported"}};
 
 } // namespace types
@@ -77,5 +77,23 @@ bool UnlockConnectorConfConverter::toJson(const UnlockConnectorConf& data, rapid
     return true;
 }
 
+/** @brief Check the connector id of an UnlockConnector.req message */
+static bool checkUnlockConnectorReq(void* data, std::string& error_message)
+{
+    const UnlockConnectorReq& request = *reinterpret_cast<UnlockConnectorReq*>(data);
+    bool                      ret     = (request.connectorId > 0);
+    if (!ret)
+    {
+        error_message = "connectorId parameter must be > 0";
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for UnlockConnector.req message */
+JSON_BINDING_FIELDS(UnlockConnectorReq, &checkUnlockConnectorReq, JSON_FIELD(UnlockConnectorReq, connectorId))
+
+/** @brief Single pass decoding binding for UnlockConnector.conf message */
+JSON_BINDING_FIELDS(UnlockConnectorConf, nullptr, JSON_ENUM_FIELD(UnlockConnectorConf, status, UnlockStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
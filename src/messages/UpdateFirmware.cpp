@@ -78,5 +78,29 @@ bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf& data, rapidjs
     return true;
 }
 
+/** @brief Check the location of an UpdateFirmware.req message */
+static bool checkUpdateFirmwareReq(void* data, std::string& error_message)
+{
+    const UpdateFirmwareReq& request = *reinterpret_cast<UpdateFirmwareReq*>(data);
+    ocpp::websockets::Url    url(request.location);
+    bool                     ret = url.isValid();
+    if (!ret)
+    {
+        error_message = "location parameter is not a valid URL";
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for UpdateFirmware.req message */
+JSON_BINDING_FIELDS(UpdateFirmwareReq,
+                    &checkUpdateFirmwareReq,
+                    JSON_FIELD(UpdateFirmwareReq, location),
+                    JSON_FIELD(UpdateFirmwareReq, retries),
+                    JSON_FIELD(UpdateFirmwareReq, retrieveDate),
+                    JSON_FIELD(UpdateFirmwareReq, retryInterval))
+
+/** @brief Single pass decoding binding for UpdateFirmware.conf message */
+JSON_BINDING_EMPTY(UpdateFirmwareConf)
+
 } // namespace messages
 } // namespace ocpp
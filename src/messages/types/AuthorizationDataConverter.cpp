@@ -55,15 +55,16 @@ bool AuthorizationDataConverter::toJson(const ocpp::types::AuthorizationData& da
     fill(json, "idTag", data.idTag);
     if (data.idTagInfo.isSet())
     {
-        IdTagInfoConverter id_tag_info_converter;
-        id_tag_info_converter.setAllocator(allocator);
-        rapidjson::Document value;
-        value.Parse("{}");
+        IdTagInfoConverter  id_tag_info_converter;
+        rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
         ret = id_tag_info_converter.toJson(data.idTagInfo, value);
-        json.AddMember(rapidjson::StringRef("idTagInfo"), value.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("idTagInfo"), value.Move(), json.GetAllocator());
     }
     return ret;
 }
 
+/** @brief Single pass decoding binding for AuthorizationData type */
+JSON_BINDING_FIELDS(AuthorizationData, nullptr, JSON_FIELD(AuthorizationData, idTag), JSON_FIELD(AuthorizationData, idTagInfo))
+
 } // namespace messages
 } // namespace ocpp
@@ -45,6 +45,9 @@ class AuthorizationDataConverter : public IMessageConverter<ocpp::types::Authori
     bool toJson(const ocpp::types::AuthorizationData& data, rapidjson::Document& json) override;
 };
 
+/** @brief Single pass decoding binding for AuthorizationData type */
+JSON_BINDING(ocpp::types::AuthorizationData)
+
 } // namespace messages
 } // namespace ocpp
 
@@ -27,7 +27,7 @@ namespace ocpp
 namespace types
 {
 /** @brief Helper to convert a enum class HashAlgorithmEnumType enum to string */
-const EnumToStringFromString<HashAlgorithmEnumType> HashAlgorithmEnumTypeHelper = {
+constexpr EnumToStringFromString<HashAlgorithmEnumType> HashAlgorithmEnumTypeHelper = {
     {HashAlgorithmEnumType::SHA256, "SHA256"}, {HashAlgorithmEnumType::SHA384, "SHA384"}, {HashAlgorithmEnumType::SHA512, "SHA512"}};
 
 } // namespace types
@@ -63,5 +63,13 @@ bool CertificateHashDataTypeConverter::toJson(const ocpp::types::CertificateHash
     return true;
 }
 
+/** @brief Single pass decoding binding for CertificateHashDataType type */
+JSON_BINDING_FIELDS(CertificateHashDataType,
+                    nullptr,
+                    JSON_ENUM_FIELD(CertificateHashDataType, hashAlgorithm, HashAlgorithmEnumTypeHelper),
+                    JSON_FIELD(CertificateHashDataType, issuerNameHash),
+                    JSON_FIELD(CertificateHashDataType, issuerKeyHash),
+                    JSON_FIELD(CertificateHashDataType, serialNumber))
+
 } // namespace messages
 } // namespace ocpp
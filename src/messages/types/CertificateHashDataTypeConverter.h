@@ -45,6 +45,9 @@ class CertificateHashDataTypeConverter : public IMessageConverter<ocpp::types::C
     bool toJson(const ocpp::types::CertificateHashDataType& data, rapidjson::Document& json) override;
 };
 
+/** @brief Single pass decoding binding for CertificateHashDataType type */
+JSON_BINDING(ocpp::types::CertificateHashDataType)
+
 } // namespace messages
 } // namespace ocpp
 
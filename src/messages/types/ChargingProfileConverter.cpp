@@ -77,14 +77,25 @@ bool ChargingProfileConverter::toJson(const ocpp::types::ChargingProfile& data,
     fill(json, "validTo", data.validTo);
 
     ChargingScheduleConverter charging_schedule_converter;
-    charging_schedule_converter.setAllocator(allocator);
-    rapidjson::Document charging_schedule;
-    charging_schedule.Parse("{}");
-    bool ret = charging_schedule_converter.toJson(data.chargingSchedule, charging_schedule);
-    json.AddMember(rapidjson::StringRef("chargingSchedule"), charging_schedule.Move(), *allocator);
+    rapidjson::Document       charging_schedule(rapidjson::kObjectType, &json.GetAllocator());
+    bool                      ret = charging_schedule_converter.toJson(data.chargingSchedule, charging_schedule);
+    json.AddMember(rapidjson::StringRef("chargingSchedule"), charging_schedule.Move(), json.GetAllocator());
 
     return ret;
 }
 
+/** @brief Single pass decoding binding for ChargingProfile type */
+JSON_BINDING_FIELDS(ChargingProfile,
+                    nullptr,
+                    JSON_FIELD(ChargingProfile, chargingProfileId),
+                    JSON_FIELD(ChargingProfile, transactionId),
+                    JSON_FIELD(ChargingProfile, stackLevel),
+                    JSON_ENUM_FIELD(ChargingProfile, chargingProfilePurpose, ChargingProfilePurposeTypeHelper),
+                    JSON_ENUM_FIELD(ChargingProfile, chargingProfileKind, ChargingProfileKindTypeHelper),
+                    JSON_ENUM_FIELD(ChargingProfile, recurrencyKind, RecurrencyKindTypeHelper),
+                    JSON_FIELD(ChargingProfile, validFrom),
+                    JSON_FIELD(ChargingProfile, validTo),
+                    JSON_FIELD(ChargingProfile, chargingSchedule))
+
 } // namespace messages
 } // namespace ocpp
@@ -45,6 +45,9 @@ class ChargingProfileConverter : public IMessageConverter<ocpp::types::ChargingP
     bool toJson(const ocpp::types::ChargingProfile& data, rapidjson::Document& json) override;
 };
 
+/** @brief Single pass decoding binding for ChargingProfile type */
+JSON_BINDING(ocpp::types::ChargingProfile)
+
 } // namespace messages
 } // namespace ocpp
 
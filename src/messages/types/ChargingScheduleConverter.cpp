@@ -79,17 +79,45 @@ bool ChargingScheduleConverter::toJson(const ocpp::types::ChargingSchedule& data
     rapidjson::Value chargingSchedulePeriod(rapidjson::kArrayType);
     for (const ChargingSchedulePeriod& schedule_period : data.chargingSchedulePeriod)
     {
-        rapidjson::Document value;
-        value.Parse("{}");
+        rapidjson::Document value(rapidjson::kObjectType, &json.GetAllocator());
         fill(value, "startPeriod", schedule_period.startPeriod);
         fill(value, "limit", schedule_period.limit);
         fill(value, "numberPhases", schedule_period.numberPhases);
-        chargingSchedulePeriod.PushBack(value.Move(), *allocator);
+        chargingSchedulePeriod.PushBack(value.Move(), json.GetAllocator());
     }
-    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod.Move(), json.GetAllocator());
 
     return true;
 }
 
+/** @brief Check the number of phases of a charging schedule period */
+static bool checkChargingSchedulePeriod(void* data, std::string& error_message)
+{
+    bool                          ret    = true;
+    const ChargingSchedulePeriod& period = *reinterpret_cast<ChargingSchedulePeriod*>(data);
+    if (period.numberPhases.isSet() && ((period.numberPhases == 0u) || (period.numberPhases > 3u)))
+    {
+        error_message = "numberPhases parameter must be in interval [1;3]";
+        ret           = false;
+    }
+    return ret;
+}
+
+/** @brief Single pass decoding binding for ChargingSchedulePeriod type */
+JSON_BINDING_FIELDS(ChargingSchedulePeriod,
+                    &checkChargingSchedulePeriod,
+                    JSON_FIELD(ChargingSchedulePeriod, startPeriod),
+                    JSON_FIELD(ChargingSchedulePeriod, limit),
+                    JSON_FIELD(ChargingSchedulePeriod, numberPhases))
+
+/** @brief Single pass decoding binding for ChargingSchedule type */
+JSON_BINDING_FIELDS(ChargingSchedule,
+                    nullptr,
+                    JSON_FIELD(ChargingSchedule, duration),
+                    JSON_FIELD(ChargingSchedule, startSchedule),
+                    JSON_ENUM_FIELD(ChargingSchedule, chargingRateUnit, ChargingRateUnitTypeHelper),
+                    JSON_FIELD(ChargingSchedule, chargingSchedulePeriod),
+                    JSON_FIELD(ChargingSchedule, minChargingRate))
+
 } // namespace messages
 } // namespace ocpp
@@ -45,6 +45,12 @@ class ChargingScheduleConverter : public IMessageConverter<ocpp::types::Charging
     bool toJson(const ocpp::types::ChargingSchedule& data, rapidjson::Document& json) override;
 };
 
+/** @brief Single pass decoding binding for ChargingSchedule type */
+JSON_BINDING(ocpp::types::ChargingSchedule)
+
+/** @brief Single pass decoding binding for ChargingSchedulePeriod type */
+JSON_BINDING(ocpp::types::ChargingSchedulePeriod)
+
 } // namespace messages
 } // namespace ocpp
 
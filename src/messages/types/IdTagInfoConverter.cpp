@@ -57,5 +57,12 @@ bool IdTagInfoConverter::toJson(const ocpp::types::IdTagInfo& data, rapidjson::D
     return true;
 }
 
+/** @brief Single pass decoding binding for IdTagInfo type */
+JSON_BINDING_FIELDS(IdTagInfo,
+                    nullptr,
+                    JSON_FIELD(IdTagInfo, expiryDate),
+                    JSON_FIELD(IdTagInfo, parentIdTag),
+                    JSON_ENUM_FIELD(IdTagInfo, status, AuthorizationStatusHelper))
+
 } // namespace messages
 } // namespace ocpp
@@ -42,6 +42,9 @@ class IdTagInfoConverter : public IMessageConverter<ocpp::types::IdTagInfo>
     bool toJson(const ocpp::types::IdTagInfo& data, rapidjson::Document& json) override;
 };
 
+/** @brief Single pass decoding binding for IdTagInfo type */
+JSON_BINDING(ocpp::types::IdTagInfo)
+
 } // namespace messages
 } // namespace ocpp
 
@@ -86,8 +86,7 @@ bool MeterValueConverter::toJson(const ocpp::types::MeterValue& data, rapidjson:
     rapidjson::Value sampledValue(rapidjson::kArrayType);
     for (const SampledValue& sampled_value : data.sampledValue)
     {
-        rapidjson::Document sampled;
-        sampled.Parse("{}");
+        rapidjson::Document sampled(rapidjson::kObjectType, &json.GetAllocator());
         fill(sampled, "value", sampled_value.value);
         if (sampled_value.context.isSet())
         {
@@ -113,12 +112,70 @@ bool MeterValueConverter::toJson(const ocpp::types::MeterValue& data, rapidjson:
         {
             fill(sampled, "unit", UnitOfMeasureHelper.toString(sampled_value.unit));
         }
-        sampledValue.PushBack(sampled.Move(), *allocator);
+        sampledValue.PushBack(sampled.Move(), json.GetAllocator());
     }
-    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue.Move(), json.GetAllocator());
 
     return true;
 }
 
+/** @copydoc bool IMessageConverter<ocpp::types::MeterValue>::serialize(const ocpp::types::MeterValue&,
+ *                                                                     JsonWriter&) */
+bool MeterValueConverter::serialize(const ocpp::types::MeterValue& data, JsonWriter& writer)
+{
+    writer.StartObject();
+    write(writer, "timestamp", data.timestamp);
+
+    writer.Key("sampledValue");
+    writer.StartArray();
+    for (const SampledValue& sampled_value : data.sampledValue)
+    {
+        writer.StartObject();
+        write(writer, "value", sampled_value.value);
+        if (sampled_value.context.isSet())
+        {
+            write(writer, "context", ReadingContextHelper.toString(sampled_value.context));
+        }
+        if (sampled_value.format.isSet())
+        {
+            write(writer, "format", ValueFormatHelper.toString(sampled_value.format));
+        }
+        if (sampled_value.measurand.isSet())
+        {
+            write(writer, "measurand", MeasurandHelper.toString(sampled_value.measurand));
+        }
+        if (sampled_value.phase.isSet())
+        {
+            write(writer, "phase", PhaseHelper.toString(sampled_value.phase));
+        }
+        if (sampled_value.location.isSet())
+        {
+            write(writer, "location", LocationHelper.toString(sampled_value.location));
+        }
+        if (sampled_value.unit.isSet())
+        {
+            write(writer, "unit", UnitOfMeasureHelper.toString(sampled_value.unit));
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    return writer.EndObject();
+}
+
+/** @brief Single pass decoding binding for SampledValue type */
+JSON_BINDING_FIELDS(SampledValue,
+                    nullptr,
+                    JSON_FIELD(SampledValue, value),
+                    JSON_ENUM_FIELD(SampledValue, context, ReadingContextHelper),
+                    JSON_ENUM_FIELD(SampledValue, format, ValueFormatHelper),
+                    JSON_ENUM_FIELD(SampledValue, measurand, MeasurandHelper),
+                    JSON_ENUM_FIELD(SampledValue, phase, PhaseHelper),
+                    JSON_ENUM_FIELD(SampledValue, location, LocationHelper),
+                    JSON_ENUM_FIELD(SampledValue, unit, UnitOfMeasureHelper))
+
+/** @brief Single pass decoding binding for MeterValue type */
+JSON_BINDING_FIELDS(MeterValue, nullptr, JSON_FIELD(MeterValue, timestamp), JSON_FIELD(MeterValue, sampledValue))
+
 } // namespace messages
 } // namespace ocpp
@@ -43,8 +43,18 @@ class MeterValueConverter : public IMessageConverter<ocpp::types::MeterValue>
     /** @copydoc bool IMessageConverter<ocpp::types::MeterValue>::toJson(const ocpp::types::MeterValue&,
      *                                                                  rapidjson::Document&) */
     bool toJson(const ocpp::types::MeterValue& data, rapidjson::Document& json) override;
+
+    /** @copydoc bool IMessageConverter<ocpp::types::MeterValue>::serialize(const ocpp::types::MeterValue&,
+     *                                                                     JsonWriter&) */
+    bool serialize(const ocpp::types::MeterValue& data, JsonWriter& writer) override;
 };
 
+/** @brief Single pass decoding binding for MeterValue type */
+JSON_BINDING(ocpp::types::MeterValue)
+
+/** @brief Single pass decoding binding for SampledValue type */
+JSON_BINDING(ocpp::types::SampledValue)
+
 } // namespace messages
 } // namespace ocpp
 
@@ -22,6 +22,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "json.h"
 
 #include <chrono>
+#include <functional>
 #include <string>
 
 namespace ocpp
@@ -36,6 +37,16 @@ class IRpc
     // Forward declarations
     class IListener;
     class ISpy;
+    class IPayload;
+
+    /**
+     * @brief Callback to notify the end of an asynchronous call
+     * @param received true if a response has been received, false on error or timeout
+     * @param response JSON response received (empty if no response), its strings may point into the received
+     *                 frame which is recycled once the callback returns : it is only valid during the callback
+     *                 and must be copied (not moved or swapped) to be kept
+     */
+    typedef std::function<void(bool received, const rapidjson::Document& response)> CallCallback;
 
     /** @brief Destructor */
     virtual ~IRpc() { }
@@ -59,6 +70,57 @@ class IRpc
                       rapidjson::Document&       response,
                       std::chrono::milliseconds  timeout = std::chrono::seconds(2)) = 0;
 
+    /**
+     * @brief Call a remote action without waiting for its response
+     * @param action Remote action
+     * @param payload JSON payload for the action
+     * @param callback Function to call when the response has been received or on timeout,
+     *                 it is called from the RPC internal threads and must not block
+     * @param timeout Response timeout
+     * @return true if the request has been sent or queued and the callback will be called, false otherwise
+     */
+    virtual bool callAsync(const std::string&         action,
+                           const rapidjson::Document& payload,
+                           CallCallback               callback,
+                           std::chrono::milliseconds  timeout = std::chrono::seconds(2)) = 0;
+
+    /**
+     * @brief Call a remote action and wait for its response, the payload is serialized directly into the CALL message
+     * @param action Remote action
+     * @param payload Payload for the action
+     * @param response JSON response received
+     * @param timeout Response timeout
+     * @return true if a response has been received, false otherwise
+     */
+    virtual bool call(const std::string&        action,
+                      const IPayload&           payload,
+                      rapidjson::Document&      response,
+                      std::chrono::milliseconds timeout = std::chrono::seconds(2))
+    {
+        // Default implementation : go through a JSON document
+        rapidjson::Document json;
+        return (payload.toDocument(json) && call(action, json, response, timeout));
+    }
+
+    /**
+     * @brief Call a remote action without waiting for its response, the payload is serialized directly into the CALL message
+     * @param action Remote action
+     * @param payload Payload for the action
+     * @param callback Function to call when the response has been received or on timeout,
+     *                 it is called from the RPC internal threads and must not block
+     * @param timeout Response timeout
+     * @return true if the request has been sent or queued and the callback will be called, false otherwise
+     */
+    virtual bool callAsync(const std::string&        action,
+                           const IPayload&           payload,
+                           CallCallback              callback,
+                           std::chrono::milliseconds timeout = std::chrono::seconds(2))
+    {
+        // Default implementation : go through a JSON document
+        rapidjson::Document json;
+        return (payload.toDocument(json) && callAsync(action, json, callback, timeout));
+    }
+
     /**
      * @brief Register a listener to the RPC events
      * @param listener Listener object
@@ -87,17 +149,52 @@ class IRpc
         /**
          * @brief Called when a CALL message has been received
          * @param action Action
-         * @param payload JSON payload for the action
+         * @param payload JSON payload for the action, as received (not parsed)
+         * @param size Size in bytes of the JSON payload
          * @param response JSON response to send
          * @param error_code Standard error code, set to nullptr if no error
          * @param error_msg Additionnal error message, empty if no error
          * @return true if the call is accepted, false otherwise
          */
-        virtual bool rpcCallReceived(const std::string&      action,
-                                     const rapidjson::Value& payload,
-                                     rapidjson::Document&    response,
-                                     const char*&            error_code,
-                                     std::string&            error_message) = 0;
+        virtual bool rpcCallReceived(const std::string&   action,
+                                     const char*          payload,
+                                     size_t               size,
+                                     rapidjson::Document& response,
+                                     const char*&         error_code,
+                                     std::string&         error_message) = 0;
+    };
+
+    /** @brief Interface for the payloads which can be serialized without building a JSON document */
+    class IPayload
+    {
+      public:
+        /** @brief Destructor */
+        virtual ~IPayload() { }
+
+        /**
+         * @brief Serialize the payload
+         * @param writer JSON writer to use (the payload must be written as a single JSON value)
+         * @return true if the payload has been serialized, false otherwise
+         */
+        virtual bool serialize(rapidjson::Writer<rapidjson::StringBuffer>& writer) const = 0;
+
+        /**
+         * @brief Convert the payload to a JSON document
+         * @param json JSON document to fill
+         * @return true if the payload has been converted, false otherwise
+         */
+        bool toDocument(rapidjson::Document& json) const
+        {
+            rapidjson::StringBuffer                    buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            bool                                       ret = serialize(writer);
+            if (ret)
+            {
+                json.Parse(buffer.GetString(), buffer.GetSize());
+                ret = !json.HasParseError();
+            }
+            return ret;
+        }
     };
 
     /** @brief Interface for the RPC clients spies */
@@ -17,32 +17,132 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "RpcBase.h"
+#include "Timer.h"
+#include "WorkStealingExecutor.h"
 
+#include <algorithm>
 #include <functional>
-#include <sstream>
 
 namespace ocpp
 {
 namespace rpc
 {
 
-/** @brief RPC call type */
-static constexpr const char* CALL = "2";
-/** @brief RPC call result type */
-static constexpr const char* CALLRESULT = "3";
-/** @brief RPC call error type */
-static constexpr const char* CALLERROR = "4";
+/** @brief Initial capacity of the buffer used to serialize the outgoing frames */
+static constexpr size_t FRAME_BUFFER_CAPACITY = 1024u;
+
+/** @brief Maximum number of incomming call requests processed by a reception job before yielding to the other connections */
+static constexpr unsigned int MAX_CALLS_PER_RX_JOB = 16u;
+
+/** @brief Maximum number of recycled messages kept in the pool */
+static constexpr size_t MAX_POOLED_MESSAGES = 256u;
+
+/** @brief Copy a JSON value including its strings (strings parsed in place are only referenced by rapidjson's copy) */
+static void copyValue(rapidjson::Value& dest, const rapidjson::Value& src, rapidjson::Document::AllocatorType& allocator)
+{
+    if (src.IsString())
+    {
+        dest.SetString(src.GetString(), src.GetStringLength(), allocator);
+    }
+    else if (src.IsObject())
+    {
+        dest.SetObject();
+        for (auto it = src.MemberBegin(); it != src.MemberEnd(); ++it)
+        {
+            rapidjson::Value name(it->name.GetString(), it->name.GetStringLength(), allocator);
+            rapidjson::Value value;
+            copyValue(value, it->value, allocator);
+            dest.AddMember(name, value, allocator);
+        }
+    }
+    else if (src.IsArray())
+    {
+        dest.SetArray();
+        dest.Reserve(src.Size(), allocator);
+        for (const rapidjson::Value& item : src.GetArray())
+        {
+            rapidjson::Value value;
+            copyValue(value, item, allocator);
+            dest.PushBack(value, allocator);
+        }
+    }
+    else
+    {
+        dest.CopyFrom(src, allocator);
+    }
+}
+
+/** @brief Serializer for the outgoing frames */
+struct FrameWriter
+{
+    FrameWriter() : buffer(nullptr, FRAME_BUFFER_CAPACITY), writer(buffer) { }
+    /** @brief Serialized frame */
+    rapidjson::StringBuffer buffer;
+    /** @brief JSON writer */
+    rapidjson::Writer<rapidjson::StringBuffer> writer;
+};
+
+/** @brief Get the frame serializer of the calling thread ready for a new frame,
+ *         its buffer is reused by all the frames serialized in this thread so a frame
+ *         must be sent before serializing the next one */
+static FrameWriter& frameWriter()
+{
+    thread_local FrameWriter frame_writer;
+    frame_writer.buffer.Clear();
+    frame_writer.writer.Reset(frame_writer.buffer);
+    return frame_writer;
+}
+
+/** @brief Payload stored in a JSON document */
+class DocumentPayload : public IRpc::IPayload
+{
+  public:
+    /** @brief Constructor */
+    DocumentPayload(const rapidjson::Document& document) : m_document(document) { }
+
+    /** @copydoc bool IPayload::serialize(rapidjson::Writer<rapidjson::StringBuffer>&) const */
+    bool serialize(rapidjson::Writer<rapidjson::StringBuffer>& writer) const override { return m_document.Accept(writer); }
+
+  private:
+    /** @brief JSON document */
+    const rapidjson::Document& m_document;
+};
+
+/** @brief Pool of recycled messages shared by all the connections */
+std::vector<std::unique_ptr<RpcBase::RpcMessage>> RpcBase::s_messages_pool;
+/** @brief Mutex for concurrent access to the pool of recycled messages */
+std::mutex RpcBase::s_messages_pool_mutex;
 
 /** @brief Constructor */
-RpcBase::RpcBase()
-    : m_rpc_listener(nullptr), m_spies(), m_transaction_id(0), m_call_mutex(), m_requests_queue(), m_results_queue(), m_rx_thread(nullptr)
+RpcBase::RpcBase(ocpp::helpers::ITimerPool* timer_pool, ocpp::helpers::WorkStealingExecutor* rx_executor)
+    : m_rpc_listener(nullptr),
+      m_spies(),
+      m_transaction_id(0),
+      m_strict_ordering(true),
+      m_pending_calls_mutex(),
+      m_pending_calls(),
+      m_queued_calls(),
+      m_timer_pool(timer_pool),
+      m_timers_mutex(),
+      m_free_timers(),
+      m_requests_queue(),
+      m_rx_started(false),
+      m_rx_thread(nullptr),
+      m_rx_executor(rx_executor),
+      m_rx_mutex(),
+      m_rx_cond(),
+      m_rx_job_scheduled(false)
 {
 }
 
 /** @brief Destructor */
 RpcBase::~RpcBase()
 {
-    stop();
+    // The pending calls have been aborted by the derived class, only the timers are left
+    for (ocpp::helpers::Timer* timer : m_free_timers)
+    {
+        delete timer;
+    }
 }
 
 /** @copydoc bool IRpc::call(const std::string&, const rapidjson::Document&, rapidjson::Document&, std::chrono::milliseconds) */
@@ -50,77 +150,78 @@ bool RpcBase::call(const std::string&         action,
                    const rapidjson::Document& payload,
                    rapidjson::Document&       response,
                    std::chrono::milliseconds  timeout)
+{
+    return call(action, DocumentPayload(payload), response, timeout);
+}
+
+/** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCallback, std::chrono::milliseconds) */
+bool RpcBase::callAsync(const std::string& action, const rapidjson::Document& payload, CallCallback callback, std::chrono::milliseconds timeout)
+{
+    return callAsync(action, DocumentPayload(payload), callback, timeout);
+}
+
+/** @copydoc bool IRpc::call(const std::string&, const IPayload&, rapidjson::Document&, std::chrono::milliseconds) */
+bool RpcBase::call(const std::string& action, const IPayload& payload, rapidjson::Document& response, std::chrono::milliseconds timeout)
 {
     bool ret = false;
 
     // Check connection state
     if (isConnected())
     {
-        // Only one RPC request/response at a time
-        std::lock_guard<std::mutex> call_lock(m_call_mutex);
-
-        // Serialize message
-        rapidjson::StringBuffer                    buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        payload.Accept(writer);
-
-        std::stringstream serialized_message;
-        serialized_message << "[";
-        serialized_message << CALL << ", ";
-        serialized_message << "\"" << m_transaction_id << "\", ";
-        serialized_message << "\"" << action << "\", ";
-        serialized_message << buffer.GetString();
-        serialized_message << "]";
-
-        // Initialize call context
-        std::stringstream id;
-        id << m_transaction_id;
-
         // Send message
-        std::string msg = serialized_message.str();
-        if (send(msg))
-        {
-            // Wait for response
-            std::stringstream expected_id;
-            expected_id << m_transaction_id;
-            RpcMessage* rpc_message = nullptr;
-            auto        wait_time   = std::chrono::steady_clock().now() + timeout;
-            do
+        std::shared_ptr<PendingCall> pending_call = prepareCall(action, payload, timeout);
+        if (pending_call && sendCall(pending_call))
+        {
+            // Wait for response, the timeout starts when the message is sent and not while
+            // it is queued behind the calls in flight in strict ordering mode
+            std::unique_lock<std::mutex> lock(m_pending_calls_mutex);
+            while (!pending_call->completed && (std::chrono::steady_clock::now() < pending_call->deadline))
             {
-                // Compute timeout
-                auto now       = std::chrono::steady_clock().now();
-                auto left_time = std::chrono::duration_cast<std::chrono::milliseconds>(wait_time - now);
-                if (left_time.count() >= 0)
+                if (pending_call->deadline == std::chrono::steady_clock::time_point::max())
                 {
-                    // Wait for a message
-                    ret = m_results_queue.pop(rpc_message, left_time.count());
-                    if (ret)
-                    {
-                        // Check id
-                        if (rpc_message->unique_id != expected_id.str())
-                        {
-                            // Wrong message
-                            delete rpc_message;
-                            rpc_message = nullptr;
-                        }
-                    }
+                    pending_call->cond_var.wait(lock);
                 }
-            } while (ret && (rpc_message == nullptr));
-
-            // Extract response
-            if (rpc_message)
+                else
+                {
+                    pending_call->cond_var.wait_until(lock, pending_call->deadline);
+                }
+            }
+            if (pending_call->completed)
             {
-                response.CopyFrom(rpc_message->payload, response.GetAllocator());
-                delete rpc_message;
+                // Extract response
+                if (pending_call->succeeded)
+                {
+                    copyValue(response, pending_call->response->document, response.GetAllocator());
+                    releaseMessage(std::move(pending_call->response));
+                    ret = true;
+                }
             }
             else
             {
-                ret = false;
+                // No response received
+                lock.unlock();
+                cancelPendingCall(pending_call);
             }
         }
+    }
+
+    return ret;
+}
 
-        // Update transaction id
-        m_transaction_id++;
+/** @copydoc bool IRpc::callAsync(const std::string&, const IPayload&, CallCallback, std::chrono::milliseconds) */
+bool RpcBase::callAsync(const std::string& action, const IPayload& payload, CallCallback callback, std::chrono::milliseconds timeout)
+{
+    bool ret = false;
+
+    // Check connection state, timeouts can only be handled with a timer
+    if (m_timer_pool && isConnected())
+    {
+        // Send message
+        std::shared_ptr<PendingCall> pending_call = prepareCall(action, payload, timeout, callback);
+        if (pending_call)
+        {
+            ret = sendCall(pending_call);
+        }
     }
 
     return ret;
@@ -144,18 +245,25 @@ void RpcBase::registerSpy(IRpc::ISpy& spy)
 void RpcBase::start()
 {
     // Check if already started
-    if (!m_rx_thread)
+    if (!m_rx_started)
     {
         // Initialize transaction id sequence
         m_transaction_id = std::rand();
 
         // Flush queues
-        m_requests_queue.clear();
+        RpcMessage* rpc_message = nullptr;
         m_requests_queue.setEnable(true);
-        m_results_queue.clear();
+        while (m_requests_queue.pop(rpc_message, 0))
+        {
+            releaseMessage(std::unique_ptr<RpcMessage>(rpc_message));
+        }
+        m_rx_started = true;
 
-        // Start reception thread
-        m_rx_thread = new std::thread(std::bind(&RpcBase::rxThread, this));
+        // Start reception thread, incomming requests are processed in the executor otherwise
+        if (!m_rx_executor)
+        {
+            m_rx_thread = new std::thread(std::bind(&RpcBase::rxThread, this));
+        }
     }
 }
 
@@ -163,37 +271,46 @@ void RpcBase::start()
 void RpcBase::stop()
 {
     // Check if already started
-    if (m_rx_thread)
+    if (m_rx_started)
     {
-        // Stop reception thread
+        {
+            std::lock_guard<std::mutex> lock(m_rx_mutex);
+            m_rx_started = false;
+        }
         m_requests_queue.setEnable(false);
-        m_rx_thread->join();
-        delete m_rx_thread;
-        m_rx_thread = nullptr;
+        if (m_rx_thread)
+        {
+            // Stop reception thread
+            m_rx_thread->join();
+            delete m_rx_thread;
+            m_rx_thread = nullptr;
+        }
+        else
+        {
+            // Wait for the end of the reception job
+            std::unique_lock<std::mutex> lock(m_rx_mutex);
+            m_rx_cond.wait(lock, [this] { return !m_rx_job_scheduled; });
+        }
     }
+
+    // Release waiting callers
+    abortPendingCalls();
 }
 
 /** @brief Process received data */
 void RpcBase::processReceivedData(const void* data, size_t size)
 {
-    // Decode received data
-    std::string received_data(reinterpret_cast<const char*>(data), size);
+    // Store received data in a recycled message
+    std::unique_ptr<RpcMessage> rpc_message = allocateMessage();
+    rpc_message->frame.assign(reinterpret_cast<const char*>(data), size);
     for (ISpy* spy : m_spies)
     {
-        spy->rcpMessageReceived(received_data);
+        spy->rcpMessageReceived(rpc_message->frame);
     }
 
     // RPC frame must be a JSON array
-    bool                valid = false;
-    rapidjson::Document rpc_frame;
-    try
-    {
-        rpc_frame.Parse(received_data.c_str());
-        valid = !rpc_frame.HasParseError();
-    }
-    catch (const std::exception&)
-    {
-    }
+    const rapidjson::Document& rpc_frame = rpc_message->document;
+    bool                       valid     = rpc_message->parse();
     if (valid && rpc_frame.IsArray() && (rpc_frame.Size() >= 3))
     {
         // Extract message type
@@ -229,18 +346,18 @@ void RpcBase::processReceivedData(const void* data, size_t size)
                 if (unique_id_value.IsString())
                 {
                     // Decode message
-                    std::string unique_id = unique_id_value.GetString();
+                    rpc_message->unique_id.assign(unique_id_value.GetString(), unique_id_value.GetStringLength());
                     switch (msg_type)
                     {
                         case MessageType::CALL:
-                            valid = decodeCall(unique_id, rpc_frame[2], rpc_frame[3]);
+                            valid = decodeCall(rpc_message);
                             break;
                         case MessageType::CALLRESULT:
-                            valid = decodeCallResult(unique_id, rpc_frame[2]);
+                            valid = decodeCallResult(rpc_message);
                             break;
                         case MessageType::CALLERROR:
                         default:
-                            valid = decodeCallError(unique_id, rpc_frame[2], rpc_frame[3], rpc_frame[4]);
+                            valid = decodeCallError(rpc_message);
                             break;
                     }
                     if (!valid)
@@ -267,32 +384,51 @@ void RpcBase::processReceivedData(const void* data, size_t size)
     {
         sendCallError("", RPC_ERROR_PROTOCOL, "");
     }
+
+    // Recycle the message if it has not been kept by the decoding
+    releaseMessage(std::move(rpc_message));
 }
 
 /** @brief Send a message throug the websocket connection */
-bool RpcBase::send(const std::string& msg)
+bool RpcBase::send(const char* msg, size_t size)
 {
     // Notify spy
-    for (ISpy* spy : m_spies)
+    if (!m_spies.empty())
     {
-        spy->rcpMessageSent(msg);
+        std::string spied_msg(msg, size);
+        for (ISpy* spy : m_spies)
+        {
+            spy->rcpMessageSent(spied_msg);
+        }
     }
 
     // Send message
-    return doSend(msg);
+    return doSend(msg, size);
 }
 
 /** @brief Decode a CALL message */
-bool RpcBase::decodeCall(const std::string& unique_id, const rapidjson::Value& action, const rapidjson::Value& payload)
+bool RpcBase::decodeCall(std::unique_ptr<RpcMessage>& rpc_message)
 {
     bool ret = false;
 
     // Check types
-    if (action.IsString() && payload.IsObject())
+    const rapidjson::Value& action = rpc_message->document[2];
+    if (action.IsString() && rpc_message->payload)
     {
-        // Add request to the queue
-        RpcMessage* msg = new RpcMessage(unique_id, action.GetString(), payload);
-        m_requests_queue.push(msg);
+        // Add request to the queue, the payload stays in the received frame
+        rpc_message->action.assign(action.GetString(), action.GetStringLength());
+        m_requests_queue.push(rpc_message.release());
+        if (m_rx_executor)
+        {
+            std::unique_lock<std::mutex> lock(m_rx_mutex);
+            scheduleRxJob();
+            if (m_rx_started && !m_rx_job_scheduled)
+            {
+                // The executor is full, reject the queued requests so that the peer retries later
+                lock.unlock();
+                rejectQueuedCalls();
+            }
+        }
 
         ret = true;
     }
@@ -301,16 +437,16 @@ bool RpcBase::decodeCall(const std::string& unique_id, const rapidjson::Value& a
 }
 
 /** @brief Decode a CALLRESULT message */
-bool RpcBase::decodeCallResult(const std::string& unique_id, const rapidjson::Value& payload)
+bool RpcBase::decodeCallResult(std::unique_ptr<RpcMessage>& rpc_message)
 {
     bool ret = false;
 
     // Check types
-    if (payload.IsObject())
+    if (rpc_message->document[2].IsObject())
     {
-        // Add result to the queue
-        RpcMessage* msg = new RpcMessage(unique_id, payload);
-        m_results_queue.push(msg);
+        // Route result to the corresponding call
+        rpc_message->extractResult();
+        completePendingCall(true, rpc_message);
 
         ret = true;
     }
@@ -319,39 +455,360 @@ bool RpcBase::decodeCallResult(const std::string& unique_id, const rapidjson::Va
 }
 
 /** @brief Decode a CALLERROR message */
-bool RpcBase::decodeCallError(const std::string&      unique_id,
-                              const rapidjson::Value& error,
-                              const rapidjson::Value& message,
-                              const rapidjson::Value& payload)
+bool RpcBase::decodeCallError(std::unique_ptr<RpcMessage>& rpc_message)
 {
     bool ret = false;
 
     // Check types
-    if (error.IsString() && message.IsString() && payload.IsObject())
+    const rapidjson::Document& rpc_frame = rpc_message->document;
+    if (rpc_frame[2].IsString() && rpc_frame[3].IsString() && rpc_frame[4].IsObject())
     {
-        (void)unique_id;
+        // Route error to the corresponding call
+        completePendingCall(false, rpc_message);
+
         ret = true;
     }
 
     return ret;
 }
 
+/** @brief Get a message from the pool or allocate a new one */
+std::unique_ptr<RpcBase::RpcMessage> RpcBase::allocateMessage()
+{
+    std::unique_ptr<RpcMessage> rpc_message;
+    {
+        std::lock_guard<std::mutex> lock(s_messages_pool_mutex);
+        if (!s_messages_pool.empty())
+        {
+            rpc_message = std::move(s_messages_pool.back());
+            s_messages_pool.pop_back();
+        }
+    }
+    if (!rpc_message)
+    {
+        rpc_message = std::make_unique<RpcMessage>();
+    }
+    return rpc_message;
+}
+
+/** @brief Give back a message to the pool */
+void RpcBase::releaseMessage(std::unique_ptr<RpcMessage> rpc_message)
+{
+    if (rpc_message)
+    {
+        rpc_message->clear();
+
+        std::lock_guard<std::mutex> lock(s_messages_pool_mutex);
+        if (s_messages_pool.size() < MAX_POOLED_MESSAGES)
+        {
+            s_messages_pool.push_back(std::move(rpc_message));
+        }
+    }
+}
+
 /** @brief Send a CALLERROR message */
 void RpcBase::sendCallError(const std::string& unique_id, const char* error, const std::string& message)
 {
     // Serialize message
-    std::stringstream serialized_message;
-    serialized_message << "[";
-    serialized_message << CALLERROR << ", ";
-    serialized_message << "\"" << unique_id << "\", ";
-    serialized_message << "\"" << error << "\", ";
-    serialized_message << "\"" << message << "\", ";
-    serialized_message << "{}";
-    serialized_message << "]";
+    FrameWriter& frame = frameWriter();
+    frame.writer.StartArray();
+    frame.writer.Uint(static_cast<unsigned int>(MessageType::CALLERROR));
+    frame.writer.String(unique_id.c_str(), static_cast<rapidjson::SizeType>(unique_id.size()));
+    frame.writer.String(error);
+    frame.writer.String(message.c_str(), static_cast<rapidjson::SizeType>(message.size()));
+    frame.writer.StartObject();
+    frame.writer.EndObject();
+    frame.writer.EndArray();
 
     // Send message
-    std::string msg = serialized_message.str();
-    send(msg);
+    send(frame.buffer.GetString(), frame.buffer.GetSize());
+}
+
+/** @brief Allocate a unique identifier and serialize a CALL message */
+std::shared_ptr<RpcBase::PendingCall> RpcBase::prepareCall(const std::string&        action,
+                                                           const IPayload&           payload,
+                                                           std::chrono::milliseconds timeout,
+                                                           CallCallback              callback)
+{
+    std::shared_ptr<PendingCall> pending_call;
+
+    // Allocate a unique identifier
+    std::string unique_id = std::to_string(m_transaction_id++);
+
+    // Serialize message
+    FrameWriter& frame = frameWriter();
+    frame.writer.StartArray();
+    frame.writer.Uint(static_cast<unsigned int>(MessageType::CALL));
+    frame.writer.String(unique_id.c_str(), static_cast<rapidjson::SizeType>(unique_id.size()));
+    frame.writer.String(action.c_str(), static_cast<rapidjson::SizeType>(action.size()));
+    if (payload.serialize(frame.writer) && frame.writer.EndArray() && frame.writer.IsComplete())
+    {
+        // The message is kept until it has been sent, the timer of an asynchronous call
+        // is released with the call so that it is never released while it is being armed
+        pending_call = std::shared_ptr<PendingCall>(
+            new PendingCall(unique_id, std::string(frame.buffer.GetString(), frame.buffer.GetSize()), timeout),
+            [this](PendingCall* call) { releaseCall(call); });
+        if (callback)
+        {
+            pending_call->callback = callback;
+
+            // Get a timer from the free timers or create a new one
+            {
+                std::lock_guard<std::mutex> lock(m_timers_mutex);
+                if (!m_free_timers.empty())
+                {
+                    pending_call->timer = m_free_timers.back();
+                    m_free_timers.pop_back();
+                }
+            }
+            if (!pending_call->timer)
+            {
+                pending_call->timer = new ocpp::helpers::Timer(*m_timer_pool, "RPC asynchronous call");
+            }
+            std::weak_ptr<PendingCall> weak_pending_call = pending_call;
+            pending_call->timer->setCallback([this, weak_pending_call] { asyncCallTimeout(weak_pending_call); });
+        }
+    }
+
+    return pending_call;
+}
+
+/** @brief Destroy a call request and release its timer */
+void RpcBase::releaseCall(PendingCall* pending_call)
+{
+    // The timer is kept for the next calls, it may be released from its own callback so it can't be destroyed here
+    ocpp::helpers::Timer* timer = pending_call->timer;
+    if (timer)
+    {
+        timer->stop();
+        std::lock_guard<std::mutex> lock(m_timers_mutex);
+        m_free_timers.push_back(timer);
+    }
+    delete pending_call;
+}
+
+/** @brief Arm the timer of an asynchronous call at its deadline */
+void RpcBase::armCallTimer(const std::shared_ptr<PendingCall>& pending_call)
+{
+    // Must be called without m_pending_calls_mutex locked since the timer callback is called with the timers locked
+    if (pending_call->timer)
+    {
+        pending_call->timer->start(pending_call->timeout, true);
+    }
+}
+
+/** @brief Send a CALL message or queue it if another call is in flight in strict ordering mode */
+bool RpcBase::sendCall(const std::shared_ptr<PendingCall>& pending_call)
+{
+    bool ret = true;
+
+    // Register the call before sending it so that an early response can't be missed
+    bool send_now = false;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+        if (m_strict_ordering && (!m_pending_calls.empty() || !m_queued_calls.empty()))
+        {
+            // Wait for the calls in flight to end
+            m_queued_calls.push_back(pending_call);
+        }
+        else
+        {
+            pending_call->deadline                 = std::chrono::steady_clock::now() + pending_call->timeout;
+            m_pending_calls[pending_call->unique_id] = pending_call;
+            send_now                               = true;
+        }
+    }
+
+    // Send message
+    if (send_now)
+    {
+        armCallTimer(pending_call);
+    }
+    if (send_now && !send(pending_call->message.c_str(), pending_call->message.size()))
+    {
+        // Unregister the call
+        {
+            std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+            m_pending_calls.erase(pending_call->unique_id);
+            pending_call->completed = true;
+        }
+        sendQueuedCalls();
+        ret = false;
+    }
+
+    return ret;
+}
+
+/** @brief Send the queued CALL messages which are allowed to be sent */
+void RpcBase::sendQueuedCalls()
+{
+    bool send_next = true;
+    while (send_next)
+    {
+        // Look for the next call to send
+        std::shared_ptr<PendingCall> pending_call;
+        {
+            std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+            if (!m_queued_calls.empty() && (!m_strict_ordering || m_pending_calls.empty()))
+            {
+                pending_call = m_queued_calls.front();
+                m_queued_calls.pop_front();
+
+                pending_call->deadline                 = std::chrono::steady_clock::now() + pending_call->timeout;
+                m_pending_calls[pending_call->unique_id] = pending_call;
+                if (!pending_call->callback)
+                {
+                    // Wakeup the caller so that it starts waiting for the deadline
+                    pending_call->cond_var.notify_one();
+                }
+            }
+        }
+
+        // Send message
+        if (pending_call)
+        {
+            armCallTimer(pending_call);
+            if (!send(pending_call->message.c_str(), pending_call->message.size()))
+            {
+                // Notify failure
+                {
+                    std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+                    m_pending_calls.erase(pending_call->unique_id);
+                    pending_call->completed = true;
+                }
+                notifyCallCompleted(pending_call, false);
+            }
+        }
+        else
+        {
+            send_next = false;
+        }
+    }
+}
+
+/** @brief Complete a pending call request with the received response */
+void RpcBase::completePendingCall(bool succeeded, std::unique_ptr<RpcMessage>& rpc_message)
+{
+    // Look for the corresponding call, responses to unknown or timed out calls are dropped
+    std::shared_ptr<PendingCall> pending_call;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+        auto                        it = m_pending_calls.find(rpc_message->unique_id);
+        if (it != m_pending_calls.end())
+        {
+            pending_call = it->second;
+            m_pending_calls.erase(it);
+
+            if (succeeded)
+            {
+                // The response is given to the caller without copy
+                pending_call->response = std::move(rpc_message);
+            }
+            pending_call->succeeded = succeeded;
+            pending_call->completed = true;
+        }
+    }
+    if (pending_call)
+    {
+        // Notify caller
+        notifyCallCompleted(pending_call, succeeded);
+
+        // Next calls can now be sent
+        sendQueuedCalls();
+    }
+}
+
+/** @brief Notify the end of a call request */
+void RpcBase::notifyCallCompleted(const std::shared_ptr<PendingCall>& pending_call, bool succeeded)
+{
+    if (pending_call->callback)
+    {
+        if (pending_call->response)
+        {
+            pending_call->callback(succeeded, pending_call->response->document);
+            releaseMessage(std::move(pending_call->response));
+        }
+        else
+        {
+            rapidjson::Document empty_payload;
+            pending_call->callback(succeeded, empty_payload);
+        }
+    }
+    else
+    {
+        pending_call->cond_var.notify_one();
+    }
+}
+
+/** @brief Remove a call request which has not been completed */
+void RpcBase::cancelPendingCall(const std::shared_ptr<PendingCall>& pending_call)
+{
+    bool was_in_flight = false;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+        if (!pending_call->completed)
+        {
+            pending_call->completed = true;
+            was_in_flight           = (m_pending_calls.erase(pending_call->unique_id) != 0);
+            if (!was_in_flight)
+            {
+                m_queued_calls.erase(std::find(m_queued_calls.begin(), m_queued_calls.end(), pending_call));
+            }
+        }
+    }
+    if (was_in_flight)
+    {
+        // Next calls can now be sent
+        sendQueuedCalls();
+    }
+}
+
+/** @brief Handle the timeout of an asynchronous call */
+void RpcBase::asyncCallTimeout(const std::weak_ptr<PendingCall>& weak_pending_call)
+{
+    // Check that the call is still in flight
+    std::shared_ptr<PendingCall> pending_call = weak_pending_call.lock();
+    bool                         expired      = false;
+    if (pending_call)
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+        if (!pending_call->completed && (m_pending_calls.erase(pending_call->unique_id) != 0))
+        {
+            pending_call->completed = true;
+            expired                 = true;
+        }
+    }
+
+    // Notify timeout
+    if (expired)
+    {
+        notifyCallCompleted(pending_call, false);
+        sendQueuedCalls();
+    }
+}
+
+/** @brief Abort all the pending call requests */
+void RpcBase::abortPendingCalls()
+{
+    std::vector<std::shared_ptr<PendingCall>> aborted_calls;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls_mutex);
+        for (auto& pending_call : m_pending_calls)
+        {
+            aborted_calls.push_back(pending_call.second);
+        }
+        aborted_calls.insert(aborted_calls.end(), m_queued_calls.begin(), m_queued_calls.end());
+        for (auto& pending_call : aborted_calls)
+        {
+            pending_call->completed = true;
+        }
+        m_pending_calls.clear();
+        m_queued_calls.clear();
+    }
+    for (const auto& pending_call : aborted_calls)
+    {
+        notifyCallCompleted(pending_call, false);
+    }
 }
 
 /** @brief Reception thread */
@@ -361,41 +818,279 @@ void RpcBase::rxThread()
     RpcMessage* rpc_message = nullptr;
     while (m_requests_queue.pop(rpc_message))
     {
-        // Notify call
-        rapidjson::Document response;
-        std::string         error;
-        const char*         error_code = nullptr;
-        response.Parse("{}");
-        if (m_rpc_listener->rpcCallReceived(rpc_message->action, rpc_message->payload, response, error_code, error))
-        {
-            // Serialize message
-            rapidjson::StringBuffer                    buffer;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-            response.Accept(writer);
-
-            std::stringstream serialized_message;
-            serialized_message << "[";
-            serialized_message << CALLRESULT << ", ";
-            serialized_message << "\"" << rpc_message->unique_id << "\", ";
-            serialized_message << buffer.GetString();
-            serialized_message << "]";
-
-            // Send message
-            std::string msg = serialized_message.str();
-            send(msg);
+        processCall(rpc_message);
+    }
+}
+
+/** @brief Reception job executed in the shared executor */
+void RpcBase::rxJob()
+{
+    bool done = false;
+    while (!done)
+    {
+        // Process a limited number of requests to share the executor's threads between the connections
+        RpcMessage*  rpc_message = nullptr;
+        unsigned int count       = 0;
+        while ((count < MAX_CALLS_PER_RX_JOB) && m_requests_queue.pop(rpc_message, 0))
+        {
+            processCall(rpc_message);
+            count++;
+        }
+
+        // Reschedule if requests are left, the job is queued behind the other connections' jobs.
+        // If the executor is full or stopping, the requests are processed in this job so that
+        // they are never left without a scheduled job
+        std::lock_guard<std::mutex> lock(m_rx_mutex);
+        if (m_rx_started && !m_requests_queue.empty())
+        {
+            done = m_rx_executor->post(std::bind(&RpcBase::rxJob, this));
         }
         else
         {
-            // Error
-            if (!error_code)
+            m_rx_job_scheduled = false;
+            m_rx_cond.notify_all();
+            done = true;
+        }
+    }
+}
+
+/** @brief Schedule a reception job if none is already scheduled, m_rx_mutex must be locked */
+void RpcBase::scheduleRxJob()
+{
+    if (m_rx_started && !m_rx_job_scheduled)
+    {
+        m_rx_job_scheduled = m_rx_executor->post(std::bind(&RpcBase::rxJob, this));
+    }
+}
+
+/** @brief Reject the queued call requests with a CALLERROR */
+void RpcBase::rejectQueuedCalls()
+{
+    RpcMessage* rpc_message = nullptr;
+    while (m_requests_queue.pop(rpc_message, 0))
+    {
+        sendCallError(rpc_message->unique_id, RPC_ERROR_INTERNAL, "Too many pending requests");
+        releaseMessage(std::unique_ptr<RpcMessage>(rpc_message));
+    }
+}
+
+/** @brief Process an incomming call request */
+void RpcBase::processCall(RpcMessage* rpc_message)
+{
+    // Notify call
+    rapidjson::Document response;
+    std::string         error;
+    const char*         error_code = nullptr;
+    response.Parse("{}");
+    if (m_rpc_listener->rpcCallReceived(
+            rpc_message->action, rpc_message->payload, rpc_message->payload_size, response, error_code, error))
+    {
+        // Serialize message
+        FrameWriter& frame = frameWriter();
+        frame.writer.StartArray();
+        frame.writer.Uint(static_cast<unsigned int>(MessageType::CALLRESULT));
+        frame.writer.String(rpc_message->unique_id.c_str(), static_cast<rapidjson::SizeType>(rpc_message->unique_id.size()));
+        response.Accept(frame.writer);
+        frame.writer.EndArray();
+
+        // Send message
+        send(frame.buffer.GetString(), frame.buffer.GetSize());
+    }
+    else
+    {
+        // Error
+        if (!error_code)
+        {
+            error_code = RPC_ERROR_GENERIC;
+        }
+        sendCallError(rpc_message->unique_id, error_code, error);
+    }
+
+    // Recycle message
+    releaseMessage(std::unique_ptr<RpcMessage>(rpc_message));
+}
+
+/** @brief SAX handler building the document of a CALL frame without parsing its payload into JSON values :
+ *         the payload is replaced by an empty object and located inside the frame so that it can be
+ *         decoded in a single pass by the message handlers */
+class CallFrameHandler
+{
+  public:
+    /** @brief Constructor */
+    CallFrameHandler(rapidjson::Document& document, const rapidjson::StringStream& stream)
+        : m_document(document), m_stream(stream), m_depth(0), m_elements(0), m_payload_start(0), m_payload_end(0)
+    {
+    }
+
+    /** @brief Start offset of the payload in the frame */
+    size_t payloadStart() const { return m_payload_start; }
+    /** @brief Size of the payload in the frame, 0 if the frame has no object payload */
+    size_t payloadSize() const { return (m_payload_end - m_payload_start); }
+
+    // rapidjson handler interface
+
+    bool Null() { return isPayload() || (element() && m_document.Null()); }
+    bool Bool(bool b) { return isPayload() || (element() && m_document.Bool(b)); }
+    bool Int(int i) { return isPayload() || (element() && m_document.Int(i)); }
+    bool Uint(unsigned i) { return isPayload() || (element() && m_document.Uint(i)); }
+    bool Int64(int64_t i) { return isPayload() || (element() && m_document.Int64(i)); }
+    bool Uint64(uint64_t i) { return isPayload() || (element() && m_document.Uint64(i)); }
+    bool Double(double d) { return isPayload() || (element() && m_document.Double(d)); }
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        return isPayload() || (element() && m_document.RawNumber(str, length, copy));
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        return isPayload() || (element() && m_document.String(str, length, copy));
+    }
+    bool Key(const char* str, rapidjson::SizeType length, bool copy) { return isPayload() || m_document.Key(str, length, copy); }
+    bool StartObject()
+    {
+        bool ret = true;
+        if ((m_depth == 1u) && (m_elements == PAYLOAD_INDEX))
+        {
+            // Payload starts at the opening brace which has just been read
+            m_payload_start = m_stream.Tell() - 1u;
+        }
+        else if (!isPayload())
+        {
+            ret = m_document.StartObject();
+        }
+        m_depth++;
+        return ret;
+    }
+    bool EndObject(rapidjson::SizeType member_count)
+    {
+        bool ret = true;
+        m_depth--;
+        if ((m_depth == 1u) && (m_elements == PAYLOAD_INDEX))
+        {
+            // Payload ends at the closing brace which has just been read
+            m_payload_end = m_stream.Tell();
+            ret           = m_document.StartObject() && m_document.EndObject(0) && element();
+        }
+        else if (!isPayload())
+        {
+            ret = m_document.EndObject(member_count) && element();
+        }
+        return ret;
+    }
+    bool StartArray()
+    {
+        bool ret = isPayload() || m_document.StartArray();
+        m_depth++;
+        return ret;
+    }
+    bool EndArray(rapidjson::SizeType element_count)
+    {
+        m_depth--;
+        return isPayload() || (m_document.EndArray(element_count) && element());
+    }
+
+  private:
+    /** @brief Index of the payload in a CALL frame */
+    static constexpr size_t PAYLOAD_INDEX = 3u;
+
+    /** @brief Document to fill */
+    rapidjson::Document& m_document;
+    /** @brief Stream of the frame */
+    const rapidjson::StringStream& m_stream;
+    /** @brief Current nesting depth */
+    size_t m_depth;
+    /** @brief Number of elements of the frame */
+    size_t m_elements;
+    /** @brief Start offset of the payload in the frame */
+    size_t m_payload_start;
+    /** @brief End offset of the payload in the frame */
+    size_t m_payload_end;
+
+    /** @brief Indicate if the current value is inside the payload */
+    bool isPayload() const { return ((m_depth > 1u) && (m_elements == PAYLOAD_INDEX) && (m_payload_start != 0)); }
+    /** @brief Count the values ending at the frame level */
+    bool element()
+    {
+        if (m_depth == 1u)
+        {
+            m_elements++;
+        }
+        return true;
+    }
+};
+
+/** @brief Indicate if a frame is a CALL frame : [2, ... */
+static bool isCallFrame(const std::string& frame)
+{
+    size_t pos = frame.find_first_not_of(" \t\r\n");
+    if ((pos != std::string::npos) && (frame[pos] == '['))
+    {
+        pos = frame.find_first_not_of(" \t\r\n", pos + 1u);
+        if ((pos != std::string::npos) && (frame[pos] == '2') && ((pos + 1u) < frame.size()))
+        {
+            char next = frame[pos + 1u];
+            return ((next == ',') || (next == ' ') || (next == '\t') || (next == '\r') || (next == '\n'));
+        }
+    }
+    return false;
+}
+
+/** @brief Parse the received frame, in place except for the CALL frames whose payload is kept as text */
+bool RpcBase::RpcMessage::parse()
+{
+    bool ret = false;
+    payload  = nullptr;
+    try
+    {
+        if (isCallFrame(frame))
+        {
+            // The payload must stay intact to be decoded by the message handlers
+            rapidjson::StringStream stream(frame.c_str());
+            CallFrameHandler        handler(document, stream);
+            rapidjson::Reader       reader;
+            auto                    generator = [&](rapidjson::Document&)
             {
-                error_code = RPC_ERROR_GENERIC;
+                ret = !reader.Parse(stream, handler).IsError();
+                return ret;
+            };
+            document.Populate(generator);
+            if (ret && (handler.payloadSize() != 0))
+            {
+                payload      = frame.c_str() + handler.payloadStart();
+                payload_size = handler.payloadSize();
             }
-            sendCallError(rpc_message->unique_id, error_code, error);
         }
+        else
+        {
+            document.ParseInsitu(&frame[0]);
+            ret = !document.HasParseError();
+        }
+    }
+    catch (const std::exception&)
+    {
+    }
+    return ret;
+}
 
-        // Free resources
-        delete rpc_message;
+/** @brief Make the payload of a CALLRESULT the root of the document */
+void RpcBase::RpcMessage::extractResult()
+{
+    // The values are allocated in a memory pool and never freed individually,
+    // the frame array is just left unreferenced in the pool
+    rapidjson::Value payload_value;
+    payload_value.Swap(document[2]);
+    static_cast<rapidjson::Value&>(document).Swap(payload_value);
+}
+
+/** @brief Release the parsed values before recycling the message */
+void RpcBase::RpcMessage::clear()
+{
+    document.SetNull();
+    allocator.Clear();
+    payload      = nullptr;
+    payload_size = 0;
+    if (frame.capacity() > MAX_RECYCLED_FRAME_SIZE)
+    {
+        std::string().swap(frame);
     }
 }
 
@@ -22,13 +22,24 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 #include "Queue.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace ocpp
 {
+namespace helpers
+{
+class ITimerPool;
+class Timer;
+class WorkStealingExecutor;
+} // namespace helpers
+
 namespace rpc
 {
 
@@ -36,10 +47,16 @@ namespace rpc
 class RpcBase : public IRpc
 {
   public:
-    /** @brief Constructor */
-    RpcBase();
+    /**
+     * @brief Constructor
+     * @param timer_pool Optional. Timer pool used to handle the timeouts of the asynchronous calls,
+     *                   asynchronous calls are not available without it
+     * @param rx_executor Optional. Executor used to process the incomming call requests,
+     *                    a reception thread is created for the connection without it
+     */
+    RpcBase(ocpp::helpers::ITimerPool* timer_pool = nullptr, ocpp::helpers::WorkStealingExecutor* rx_executor = nullptr);
 
-    /** @brief Destructor */
+    /** @brief Destructor, the derived classes must stop the RPC operations in their own destructor */
     virtual ~RpcBase();
 
     // IRpc interface
@@ -50,16 +67,48 @@ class RpcBase : public IRpc
               rapidjson::Document&       response,
               std::chrono::milliseconds  timeout = std::chrono::seconds(2)) override;
 
+    /** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCallback, std::chrono::milliseconds) */
+    bool callAsync(const std::string&         action,
+                   const rapidjson::Document& payload,
+                   CallCallback               callback,
+                   std::chrono::milliseconds  timeout = std::chrono::seconds(2)) override;
+
+    /** @copydoc bool IRpc::call(const std::string&, const IPayload&, rapidjson::Document&, std::chrono::milliseconds) */
+    bool call(const std::string&        action,
+              const IPayload&           payload,
+              rapidjson::Document&      response,
+              std::chrono::milliseconds timeout = std::chrono::seconds(2)) override;
+
+    /** @copydoc bool IRpc::callAsync(const std::string&, const IPayload&, CallCallback, std::chrono::milliseconds) */
+    bool callAsync(const std::string&        action,
+                   const IPayload&           payload,
+                   CallCallback              callback,
+                   std::chrono::milliseconds timeout = std::chrono::seconds(2)) override;
+
     /** @copydoc void IRpc::registerListener(IListener&) */
     void registerListener(IRpc::IListener& listener) override;
 
     /** @copydoc void IRpc::registerSpy(ISpy&) */
     void registerSpy(IRpc::ISpy& spy) override;
 
+    /**
+     * @brief Select the call requests ordering mode
+     * @param strict_ordering If true, only one call request can be in flight at a time (default),
+     *                        if false, several call requests can be in flight at the same time
+     *                        and their responses are routed using their unique identifier
+     */
+    void setStrictOrdering(bool strict_ordering) { m_strict_ordering = strict_ordering; }
+
+    /**
+     * @brief Indicate if the strict ordering mode is enabled
+     * @return true if only one call request can be in flight at a time, false otherwise
+     */
+    bool isStrictOrdering() const { return m_strict_ordering; }
+
   protected:
     /** @brief Start RPC operations */
     void start();
-    /** @brief Stop RPC operations */
+    /** @brief Stop RPC operations, the pending call requests are aborted and their callbacks are called */
     void stop();
     /** @brief Process received data */
     void processReceivedData(const void* data, size_t size);
@@ -69,9 +118,10 @@ class RpcBase : public IRpc
     /**
      * @brief Send data through the websocket connection
      * @param msg Message to send
+     * @param size Size of the message in bytes
      * @return true if the message has been sent, false otherwise
      */
-    virtual bool doSend(const std::string& msg) = 0;
+    virtual bool doSend(const char* msg, size_t size) = 0;
 
   private:
     /** @brief Message types */
@@ -83,21 +133,88 @@ class RpcBase : public IRpc
         INVALID    = 5
     };
 
-    /** @brief RPC message */
+    /** @brief RPC message, the received frame is parsed in place and the messages are recycled through a pool */
     struct RpcMessage
     {
-        RpcMessage(const std::string& _unique_id, const char* _action, const rapidjson::Value& _payload)
-            : unique_id(_unique_id), action(_action), payload()
+        /** @brief Size of the buffer used to store the parsed JSON values without dynamic allocation */
+        static constexpr size_t VALUES_BUFFER_SIZE = 4096u;
+        /** @brief Size of the memory chunks allocated when the values buffer is full */
+        static constexpr size_t VALUES_CHUNK_SIZE = 4096u;
+        /** @brief Maximum capacity of the frame buffer kept when the message is recycled */
+        static constexpr size_t MAX_RECYCLED_FRAME_SIZE = 16384u;
+
+        RpcMessage()
+            : frame(),
+              values_buffer(),
+              allocator(values_buffer, sizeof(values_buffer), VALUES_CHUNK_SIZE),
+              document(&allocator),
+              unique_id(),
+              action(),
+              payload(nullptr),
+              payload_size(0)
         {
-            payload.CopyFrom(_payload, payload.GetAllocator());
         }
-        RpcMessage(const std::string& _unique_id, const rapidjson::Value& _payload) : unique_id(_unique_id), action(), payload()
+        /** @brief Parse the received frame, in place except for the CALL frames whose payload is kept as text */
+        bool parse();
+        /** @brief Make the payload of a CALLRESULT the root of the document */
+        void extractResult();
+        /** @brief Release the parsed values before recycling the message */
+        void clear();
+
+        /** @brief Received frame, the parsed strings point inside this buffer */
+        std::string frame;
+        /** @brief Buffer for the parsed JSON values */
+        char values_buffer[VALUES_BUFFER_SIZE];
+        /** @brief Allocator for the parsed JSON values */
+        rapidjson::MemoryPoolAllocator<> allocator;
+        /** @brief Parsed frame */
+        rapidjson::Document document;
+        /** @brief Unique identifier */
+        std::string unique_id;
+        /** @brief Action of a CALL message */
+        std::string action;
+        /** @brief Payload of a CALL message, not parsed : JSON text inside the frame */
+        const char* payload;
+        /** @brief Size in bytes of the payload of a CALL message */
+        size_t payload_size;
+    };
+
+    /** @brief Call request waiting for its response */
+    struct PendingCall
+    {
+        PendingCall(const std::string& _unique_id, std::string&& _message, std::chrono::milliseconds _timeout)
+            : unique_id(_unique_id),
+              message(std::move(_message)),
+              timeout(_timeout),
+              deadline(std::chrono::steady_clock::time_point::max()),
+              callback(),
+              timer(nullptr),
+              completed(false),
+              succeeded(false),
+              cond_var(),
+              response()
         {
-            payload.CopyFrom(_payload, payload.GetAllocator());
         }
-        const std::string   unique_id;
-        const std::string   action;
-        rapidjson::Document payload;
+        /** @brief Unique identifier */
+        const std::string unique_id;
+        /** @brief Serialized CALL message */
+        std::string message;
+        /** @brief Response timeout */
+        const std::chrono::milliseconds timeout;
+        /** @brief Response deadline, computed when the message is sent */
+        std::chrono::steady_clock::time_point deadline;
+        /** @brief Completion callback for asynchronous calls */
+        CallCallback callback;
+        /** @brief Timer armed at the deadline of an asynchronous call */
+        ocpp::helpers::Timer* timer;
+        /** @brief Indicate that the call is over */
+        bool completed;
+        /** @brief Indicate that the response is a CALLRESULT */
+        bool succeeded;
+        /** @brief Condition variable to wakeup the caller */
+        std::condition_variable cond_var;
+        /** @brief Received CALLRESULT message, the root of its document is the response payload */
+        std::unique_ptr<RpcMessage> response;
     };
 
     /** @brief RPC listener */
@@ -105,36 +222,109 @@ class RpcBase : public IRpc
     /** @brief RPC spies */
     std::vector<IRpc::ISpy*> m_spies;
     /** @brief Transaction id */
-    int m_transaction_id;
-    /** @brief Mutex for concurrent call access */
-    std::mutex m_call_mutex;
+    std::atomic<int> m_transaction_id;
+    /** @brief Indicate if only one call request can be in flight at a time */
+    bool m_strict_ordering;
+    /** @brief Mutex for concurrent access to the pending call requests */
+    std::mutex m_pending_calls_mutex;
+    /** @brief Call requests in flight indexed by unique identifier */
+    std::unordered_map<std::string, std::shared_ptr<PendingCall>> m_pending_calls;
+    /** @brief Call requests waiting to be sent in strict ordering mode */
+    std::deque<std::shared_ptr<PendingCall>> m_queued_calls;
+    /** @brief Timer pool used to handle the timeouts of the asynchronous calls */
+    ocpp::helpers::ITimerPool* m_timer_pool;
+    /** @brief Mutex for concurrent access to the timers of the asynchronous calls */
+    std::mutex m_timers_mutex;
+    /** @brief Timers of the asynchronous calls which are not in use, kept to be reused by the next calls */
+    std::vector<ocpp::helpers::Timer*> m_free_timers;
+    /** @brief Pool of recycled messages shared by all the connections */
+    static std::vector<std::unique_ptr<RpcMessage>> s_messages_pool;
+    /** @brief Mutex for concurrent access to the pool of recycled messages */
+    static std::mutex s_messages_pool_mutex;
+
     /** @brief Queue for incomming call requests */
     ocpp::helpers::Queue<RpcMessage*> m_requests_queue;
-    /** @brief Queue for incomming call results */
-    ocpp::helpers::Queue<RpcMessage*> m_results_queue;
+    /** @brief Indicate that the incomming call requests are processed */
+    bool m_rx_started;
     /** @brief Reception thread */
     std::thread* m_rx_thread;
+    /** @brief Executor shared between connections to process incomming call requests, replaces the reception thread */
+    ocpp::helpers::WorkStealingExecutor* m_rx_executor;
+    /** @brief Mutex for the scheduling of the reception jobs */
+    std::mutex m_rx_mutex;
+    /** @brief Condition variable to wait for the end of the reception job */
+    std::condition_variable m_rx_cond;
+    /** @brief Indicate that a reception job is scheduled in the executor */
+    bool m_rx_job_scheduled;
 
     /** @brief Send a message through the websocket connection */
-    bool send(const std::string& msg);
+    bool send(const char* msg, size_t size);
 
     /** @brief Decode a CALL message */
-    bool decodeCall(const std::string& unique_id, const rapidjson::Value& action, const rapidjson::Value& payload);
+    bool decodeCall(std::unique_ptr<RpcMessage>& rpc_message);
 
     /** @brief Decode a CALLRESULT message */
-    bool decodeCallResult(const std::string& unique_id, const rapidjson::Value& payload);
+    bool decodeCallResult(std::unique_ptr<RpcMessage>& rpc_message);
 
     /** @brief Decode a CALLERROR message */
-    bool decodeCallError(const std::string&      unique_id,
-                         const rapidjson::Value& error,
-                         const rapidjson::Value& message,
-                         const rapidjson::Value& payload);
+    bool decodeCallError(std::unique_ptr<RpcMessage>& rpc_message);
+
+    /** @brief Get a message from the pool or allocate a new one */
+    static std::unique_ptr<RpcMessage> allocateMessage();
+
+    /** @brief Give back a message to the pool */
+    static void releaseMessage(std::unique_ptr<RpcMessage> rpc_message);
 
     /** @brief Send a CALLERROR message */
     void sendCallError(const std::string& unique_id, const char* error, const std::string& message);
 
+    /** @brief Allocate a unique identifier and serialize a CALL message, a timer is attached to the asynchronous calls */
+    std::shared_ptr<PendingCall> prepareCall(const std::string&        action,
+                                             const IPayload&           payload,
+                                             std::chrono::milliseconds timeout,
+                                             CallCallback              callback = nullptr);
+
+    /** @brief Destroy a call request and release its timer */
+    void releaseCall(PendingCall* pending_call);
+
+    /** @brief Arm the timer of an asynchronous call at its deadline */
+    void armCallTimer(const std::shared_ptr<PendingCall>& pending_call);
+
+    /** @brief Send a CALL message or queue it if another call is in flight in strict ordering mode */
+    bool sendCall(const std::shared_ptr<PendingCall>& pending_call);
+
+    /** @brief Send the queued CALL messages which are allowed to be sent */
+    void sendQueuedCalls();
+
+    /** @brief Complete a pending call request with the received response */
+    void completePendingCall(bool succeeded, std::unique_ptr<RpcMessage>& rpc_message);
+
+    /** @brief Notify the end of a call request */
+    void notifyCallCompleted(const std::shared_ptr<PendingCall>& pending_call, bool succeeded);
+
+    /** @brief Remove a call request which has not been completed */
+    void cancelPendingCall(const std::shared_ptr<PendingCall>& pending_call);
+
+    /** @brief Handle the timeout of an asynchronous call */
+    void asyncCallTimeout(const std::weak_ptr<PendingCall>& weak_pending_call);
+
+    /** @brief Abort all the pending call requests */
+    void abortPendingCalls();
+
     /** @brief Reception thread */
     void rxThread();
+
+    /** @brief Reception job executed in the shared executor */
+    void rxJob();
+
+    /** @brief Schedule a reception job if none is already scheduled, m_rx_mutex must be locked */
+    void scheduleRxJob();
+
+    /** @brief Reject the queued call requests with a CALLERROR */
+    void rejectQueuedCalls();
+
+    /** @brief Process an incomming call request */
+    void processCall(RpcMessage* rpc_message);
 };
 
 } // namespace rpc
@@ -29,8 +29,8 @@ namespace rpc
 {
 
 /** @brief Constructor */
-RpcClient::RpcClient(ocpp::websockets::IWebsocketClient& websocket, const std::string& protocol)
-    : RpcBase(), m_protocol(protocol), m_websocket(websocket), m_listener(nullptr), m_started(false)
+RpcClient::RpcClient(ocpp::websockets::IWebsocketClient& websocket, const std::string& protocol, ocpp::helpers::ITimerPool* timer_pool)
+    : RpcBase(timer_pool), m_protocol(protocol), m_websocket(websocket), m_listener(nullptr), m_started(false)
 {
     m_websocket.registerListener(*this);
 }
@@ -39,6 +39,10 @@ RpcClient::RpcClient(ocpp::websockets::IWebsocketClient& websocket, const std::s
 RpcClient::~RpcClient()
 {
     stop();
+
+    // Abort the pending calls even if the client has not been started,
+    // their callbacks can't be called anymore once the client is destroyed
+    RpcBase::stop();
 }
 
 /** @brief Start the client */
@@ -134,11 +138,11 @@ void RpcClient::wsClientDataReceived(const void* data, size_t size)
 
 // RpcBase interface
 
-/** @copydoc bool RpcBase::doSend(const std::string&) */
-bool RpcClient::doSend(const std::string& msg)
+/** @copydoc bool RpcBase::doSend(const char*, size_t) */
+bool RpcClient::doSend(const char* msg, size_t size)
 {
     // Send message
-    return m_websocket.send(msg.c_str(), msg.size());
+    return m_websocket.send(msg, size);
 }
 
 } // namespace rpc
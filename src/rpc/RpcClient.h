@@ -35,7 +35,7 @@ class RpcClient : public RpcBase, public ocpp::websockets::IWebsocketClient::ILi
     class IListener;
 
     /** @brief Constructor */
-    RpcClient(ocpp::websockets::IWebsocketClient& websocket, const std::string& protocol);
+    RpcClient(ocpp::websockets::IWebsocketClient& websocket, const std::string& protocol, ocpp::helpers::ITimerPool* timer_pool = nullptr);
 
     /** @brief Destructor */
     virtual ~RpcClient();
@@ -103,8 +103,8 @@ class RpcClient : public RpcBase, public ocpp::websockets::IWebsocketClient::ILi
     };
 
   protected:
-    /** @copydoc bool RpcBase::doSend(const std::string&) */
-    bool doSend(const std::string& msg) override;
+    /** @copydoc bool RpcBase::doSend(const char*, size_t) */
+    bool doSend(const char* msg, size_t size) override;
 
   private:
     /** @brief Protocol version */
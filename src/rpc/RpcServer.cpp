@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "RpcServer.h"
 
+#include <algorithm>
 #include <filesystem>
 
 namespace ocpp
@@ -26,8 +27,11 @@ namespace rpc
 {
 
 /** @brief Constructor */
-RpcServer::RpcServer(ocpp::websockets::IWebsocketServer& websocket, const std::string& protocol)
-    : m_protocol(protocol), m_websocket(websocket), m_listener(nullptr), m_started(false)
+RpcServer::RpcServer(ocpp::websockets::IWebsocketServer&  websocket,
+                     const std::string&                    protocol,
+                     ocpp::helpers::ITimerPool*            timer_pool,
+                     ocpp::helpers::WorkStealingExecutor* rx_executor)
+    : m_protocol(protocol), m_websocket(websocket), m_timer_pool(timer_pool), m_rx_executor(rx_executor), m_listener(nullptr), m_started(false), m_clients_mutex(), m_clients()
 {
     m_websocket.registerListener(*this);
 }
@@ -71,6 +75,21 @@ bool RpcServer::stop()
         // Disconnect from websocket
         ret       = m_websocket.stop();
         m_started = false;
+
+        // Stop the clients which are still referenced by the listener
+        std::vector<std::weak_ptr<Client>> clients;
+        {
+            std::lock_guard<std::mutex> lock(m_clients_mutex);
+            clients.swap(m_clients);
+        }
+        for (auto& client : clients)
+        {
+            std::shared_ptr<Client> rpc_client = client.lock();
+            if (rpc_client)
+            {
+                rpc_client->stop();
+            }
+        }
     }
 
     return ret;
@@ -103,7 +122,16 @@ void RpcServer::wsClientConnected(const char* uri, std::shared_ptr<ocpp::websock
     std::string           chargepoint_id = uri_path.filename();
 
     // Instanciate client
-    std::shared_ptr<Client> rpc_client(new Client(client));
+    std::shared_ptr<Client> rpc_client(new Client(client, m_timer_pool, m_rx_executor));
+    if (m_rx_executor)
+    {
+        std::lock_guard<std::mutex> lock(m_clients_mutex);
+        m_clients.erase(std::remove_if(m_clients.begin(),
+                                       m_clients.end(),
+                                       [](const std::weak_ptr<Client>& c) { return c.expired(); }),
+                        m_clients.end());
+        m_clients.push_back(rpc_client);
+    }
 
     // Notify connection
     m_listener->rpcClientConnected(chargepoint_id, rpc_client);
@@ -116,7 +144,10 @@ void RpcServer::wsServerError()
 }
 
 /** @brief Constructor */
-RpcServer::Client::Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket) : RpcBase(), m_websocket(websocket)
+RpcServer::Client::Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket,
+                          ocpp::helpers::ITimerPool*                                   timer_pool,
+                          ocpp::helpers::WorkStealingExecutor*                         rx_executor)
+    : RpcBase(timer_pool, rx_executor), m_websocket(websocket)
 {
     // Start processing
     m_websocket->registerListener(*this);
@@ -139,6 +170,12 @@ bool RpcServer::Client::disconnect(bool notify_disconnected)
     return m_websocket->disconnect(notify_disconnected);
 }
 
+/** @brief Stop processing the incomming requests */
+void RpcServer::Client::stop()
+{
+    RpcBase::stop();
+}
+
 // IRpc interface
 
 /** @copydoc bool IRpc::isConnected() */
@@ -170,11 +207,11 @@ void RpcServer::Client::wsClientDataReceived(const void* data, size_t size)
 
 // RpxBase interface
 
-/** @copydoc bool RpcBase::doSend(const std::string&) */
-bool RpcServer::Client::doSend(const std::string& msg)
+/** @copydoc bool RpcBase::doSend(const char*, size_t) */
+bool RpcServer::Client::doSend(const char* msg, size_t size)
 {
     // Send message
-    return m_websocket->send(msg.c_str(), msg.size());
+    return m_websocket->send(msg, size);
 }
 
 } // namespace rpc
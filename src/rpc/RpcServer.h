@@ -23,6 +23,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Queue.h"
 #include "RpcBase.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace ocpp
 {
 namespace rpc
@@ -37,7 +41,10 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
     class IListener;
 
     /** @brief Constructor */
-    RpcServer(ocpp::websockets::IWebsocketServer& websocket, const std::string& protocol);
+    RpcServer(ocpp::websockets::IWebsocketServer&  websocket,
+              const std::string&                    protocol,
+              ocpp::helpers::ITimerPool*            timer_pool  = nullptr,
+              ocpp::helpers::WorkStealingExecutor* rx_executor = nullptr);
 
     /** @brief Destructor */
     virtual ~RpcServer();
@@ -107,7 +114,9 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
     {
       public:
         /** @brief Constructor */
-        Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket);
+        Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket,
+               ocpp::helpers::ITimerPool*                                   timer_pool  = nullptr,
+               ocpp::helpers::WorkStealingExecutor*                         rx_executor = nullptr);
         /** @brief Destructor */
         virtual ~Client();
 
@@ -118,6 +127,9 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
          */
         bool disconnect(bool notify_disconnected = true);
 
+        /** @brief Stop processing the incomming requests, the client won't use the server's executor anymore */
+        void stop();
+
         // IRpc interface
 
         /** @copydoc bool IRpc::isConnected() */
@@ -135,8 +147,8 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
         void wsClientDataReceived(const void* data, size_t size) override;
 
       protected:
-        /** @copydoc bool RpcBase::doSend(const std::string&) */
-        bool doSend(const std::string& msg) override;
+        /** @copydoc bool RpcBase::doSend(const char*, size_t) */
+        bool doSend(const char* msg, size_t size) override;
 
       private:
         /** @brief Websocket connection */
@@ -148,10 +160,18 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
     const std::string m_protocol;
     /** @brief Websocket connection */
     ocpp::websockets::IWebsocketServer& m_websocket;
+    /** @brief Timer pool for the asynchronous calls of the clients */
+    ocpp::helpers::ITimerPool* m_timer_pool;
+    /** @brief Executor to process the incomming call requests of the clients, nullptr if each client has its own thread */
+    ocpp::helpers::WorkStealingExecutor* m_rx_executor;
     /** @brief Listener */
     IListener* m_listener;
     /** @brief Started state */
     bool m_started;
+    /** @brief Mutex for concurrent access to the clients */
+    std::mutex m_clients_mutex;
+    /** @brief Connected clients, they must be stopped before the executor is released */
+    std::vector<std::weak_ptr<Client>> m_clients;
 };
 
 } // namespace rpc
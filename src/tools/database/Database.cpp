@@ -27,7 +27,10 @@ namespace database
 {
 
 /** @brief Constructor */
-Database::Database() : m_db(nullptr) { }
+Database::Database()
+    : m_db(nullptr), m_mutex(std::make_shared<std::recursive_mutex>()), m_transaction_level(0), m_rollback_requested(false)
+{
+}
 /** @brief Destructor */
 Database::~Database()
 {
@@ -35,7 +38,7 @@ Database::~Database()
 }
 
 /** @brief Open a database */
-bool Database::open(const std::string& database_path)
+bool Database::open(const std::string& database_path, bool wal_mode, const std::string& synchronous)
 {
     bool ret = false;
 
@@ -46,6 +49,19 @@ bool Database::open(const std::string& database_path)
         if (sqlite3_open_v2(database_path.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) ==
             SQLITE_OK)
         {
+            // Journal mode, the setting is persistent in the database file
+            if (wal_mode)
+            {
+                exec("PRAGMA journal_mode=WAL;");
+            }
+
+            // Durability level, the setting applies only to the current connection
+            if ((synchronous == "OFF") || (synchronous == "NORMAL") || (synchronous == "FULL") || (synchronous == "EXTRA"))
+            {
+                std::string pragma = "PRAGMA synchronous=" + synchronous + ";";
+                exec(pragma.c_str());
+            }
+
             ret = true;
         }
     }
@@ -109,10 +125,35 @@ std::string Database::lastError() const
     return error;
 }
 
+/** @brief Get the id of the last inserted row */
+int64_t Database::lastInsertRowId() const
+{
+    int64_t id = 0;
+    if (m_db)
+    {
+        id = sqlite3_last_insert_rowid(m_db);
+    }
+    return id;
+}
+
+/** @brief Execute a single SQL statement */
+bool Database::exec(const char* sql)
+{
+    bool ret = false;
+    if (m_db)
+    {
+        ret = (sqlite3_exec(m_db, sql, nullptr, nullptr, nullptr) == SQLITE_OK);
+    }
+    return ret;
+}
+
 // Database::Query
 
 /** @brief Constructor */
-Database::Query::Query(Database& database, sqlite3_stmt* stmt) : m_database(database), m_stmt(stmt), m_has_rows(false) { }
+Database::Query::Query(Database& database, sqlite3_stmt* stmt)
+    : m_database(database), m_stmt(stmt), m_has_rows(false), m_mutex(database.m_mutex)
+{
+}
 /** @brief Destructor */
 Database::Query::~Query()
 {
@@ -249,7 +290,8 @@ bool Database::Query::exec()
     m_has_rows = false;
 
     // Execute query
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_DONE)
     {
         ret = true;
@@ -277,7 +319,8 @@ bool Database::Query::next()
     bool ret = false;
 
     // Execute next step
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_ROW)
     {
         ret = true;
@@ -358,5 +401,80 @@ std::string Database::Query::getString(int column) const
     return value;
 }
 
+// Database::Transaction
+
+/** @brief Constructor, starts the transaction */
+Database::Transaction::Transaction(Database& database) : m_database(database), m_lock(*database.m_mutex), m_started(false)
+{
+    if (m_database.m_transaction_level == 0)
+    {
+        // Outermost transaction
+        m_started = m_database.exec("BEGIN;");
+        if (m_started)
+        {
+            m_database.m_transaction_level  = 1u;
+            m_database.m_rollback_requested = false;
+        }
+    }
+    else
+    {
+        // Nested transaction
+        m_database.m_transaction_level++;
+        m_started = true;
+    }
+}
+
+/** @brief Destructor, rolls back the transaction if it has not been commited */
+Database::Transaction::~Transaction()
+{
+    end(false);
+}
+
+/** @brief Commit the transaction */
+bool Database::Transaction::commit()
+{
+    return end(true);
+}
+
+/** @brief End the transaction */
+bool Database::Transaction::end(bool commit)
+{
+    bool ret = false;
+
+    if (m_started)
+    {
+        m_started = false;
+        if (!commit)
+        {
+            m_database.m_rollback_requested = true;
+        }
+        m_database.m_transaction_level--;
+        if (m_database.m_transaction_level == 0)
+        {
+            // Outermost transaction
+            if (m_database.m_rollback_requested)
+            {
+                m_database.exec("ROLLBACK;");
+            }
+            else
+            {
+                ret = m_database.exec("COMMIT;");
+                if (!ret)
+                {
+                    m_database.exec("ROLLBACK;");
+                }
+            }
+        }
+        else
+        {
+            // Nested transaction, the outermost one will perform the commit
+            ret = commit;
+        }
+        m_lock.unlock();
+    }
+
+    return ret;
+}
+
 } // namespace database
 } // namespace ocpp
@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,7 @@ class Database
   public:
     // Forward declaration
     class Query;
+    class Transaction;
 
     /** @brief Constructor */
     Database();
@@ -48,9 +50,11 @@ class Database
     /**
      * @brief Open a database
      * @param database_path Path to the database file
+     * @param wal_mode Enable the write-ahead log journal mode
+     * @param synchronous Durability level of the writes : OFF, NORMAL, FULL or EXTRA (empty = SQLite default)
      * @return true if the database exists, false otherwise
      */
-    bool open(const std::string& database_path);
+    bool open(const std::string& database_path, bool wal_mode = false, const std::string& synchronous = "");
 
     /**
      * @brief Close the database
@@ -71,6 +75,13 @@ class Database
      */
     std::string lastError() const;
 
+    /**
+     * @brief Get the id of the last inserted row
+     *        (must be called within the same transaction as the insert query to avoid interleaving with other threads)
+     * @return Id of the last inserted row, 0 if no row has been inserted
+     */
+    int64_t lastInsertRowId() const;
+
     /** @brief Represent a query to be executed on the database */
     class Query
     {
@@ -256,11 +267,67 @@ class Database
         sqlite3_stmt* m_stmt;
         /** @brief Indicate if the query result has rows to extract data */
         bool m_has_rows;
+        /** @brief Mutex of the database (kept alive since the query can outlive the database object) */
+        std::shared_ptr<std::recursive_mutex> m_mutex;
+    };
+
+    /**
+     * @brief Scoped transaction : all the queries executed by the owning thread until commit() are written at once,
+     *        they are rolled back if the transaction is destroyed without having been commited.
+     *        Nested transactions are merged into the outermost one, which is rolled back if any of them is not commited.
+     *
+     *        The transaction holds the lock of the database connection for its whole scope : the queries from other
+     *        threads on the same Database object block until the transaction ends, and everything written to it in
+     *        the meantime by the owning thread (including logs) is rolled back with it. A LogDatabase must then
+     *        use its own Database object (on another file) to avoid being blocked by long transactions.
+     */
+    class Transaction
+    {
+      public:
+        /**
+         * @brief Constructor, starts the transaction
+         * @param database Database to use
+         */
+        Transaction(Database& database);
+        /** @brief Destructor, rolls back the transaction if it has not been commited */
+        virtual ~Transaction();
+
+        /**
+         * @brief Commit the transaction
+         * @return true if the transaction has been commited, false otherwise
+         */
+        bool commit();
+
+        /**
+         * @brief Indicate if the transaction has been started
+         * @return true if the transaction has been started, false otherwise
+         */
+        bool isStarted() const { return m_started; }
+
+      private:
+        /** @brief Associated database */
+        Database& m_database;
+        /** @brief Lock on the database */
+        std::unique_lock<std::recursive_mutex> m_lock;
+        /** @brief Indicate if the transaction has been started */
+        bool m_started;
+
+        /** @brief End the transaction */
+        bool end(bool commit);
     };
 
   private:
     /** @brief Database handle */
     sqlite3* m_db;
+    /** @brief Mutex to serialize the queries with the transactions */
+    std::shared_ptr<std::recursive_mutex> m_mutex;
+    /** @brief Nesting level of the current transaction */
+    unsigned int m_transaction_level;
+    /** @brief Indicate that a nested transaction has not been commited */
+    bool m_rollback_requested;
+
+    /** @brief Execute a single SQL statement */
+    bool exec(const char* sql);
 };
 
 } // namespace database
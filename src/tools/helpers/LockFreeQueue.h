@@ -0,0 +1,312 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/**
+ * @brief Bounded lock-free message queue for inter-thread communication with a single consumer thread,
+ *        items are stored in a ring buffer : pushing and popping never take a lock, the consumer only
+ *        parks on a condition variable (and producers only signal it) when the queue is empty
+ *        Same interface as the Queue class
+ * @tparam ItemType Type of the items (must be default constructible)
+ * @tparam CAPACITY Maximum number of items in the queue (must be a power of 2)
+ * @tparam MULTI_PRODUCERS Indicate if items can be pushed concurrently by several threads
+ */
+template <typename ItemType, size_t CAPACITY, bool MULTI_PRODUCERS>
+class LockFreeQueue
+{
+    static_assert((CAPACITY != 0) && ((CAPACITY & (CAPACITY - 1u)) == 0), "Capacity must be a power of 2");
+
+  public:
+    /**
+     * @brief Constructor
+     * @param spin_count Number of retries of the consumer before parking when the queue is empty
+     */
+    LockFreeQueue(unsigned int spin_count = 0)
+        : m_enqueue_pos(0),
+          m_dequeue_pos(0),
+          m_cells(new Cell[CAPACITY]),
+          m_spin_count(spin_count),
+          m_enabled(true),
+          m_consumer_parked(false),
+          m_mutex(),
+          m_cond_var()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    /** @brief Destructor */
+    virtual ~LockFreeQueue() { }
+
+    /**
+     * @brief Get the maximum number of items in the queue
+     * @return Maximum number of items in the queue
+     */
+    size_t capacity() const { return CAPACITY; }
+
+    /**
+     * @brief Get the size of the queue
+     * @return Size of the queue in number of items
+     */
+    size_t size() const { return count(); }
+
+    /**
+     * @brief Indicate if the queue is empty
+     * @return true if the queue is empty, false otherwise
+     */
+    bool empty() const { return (count() == 0); }
+
+    /**
+     * @brief Indicate if the queue is full
+     * @return true if the queue is full, false otherwise
+     */
+    bool full() const { return (count() == CAPACITY); }
+
+    /**
+     * @brief Get the number of items in the queue
+     *        (the value is a snapshot which can be outdated when producers and consumer are running)
+     * @return Number of items in the queue
+     */
+    size_t count() const
+    {
+        size_t dequeue_pos = m_dequeue_pos.load(std::memory_order_acquire);
+        size_t enqueue_pos = m_enqueue_pos.load(std::memory_order_acquire);
+        size_t ret         = ((enqueue_pos > dequeue_pos) ? (enqueue_pos - dequeue_pos) : 0);
+        return ((ret > CAPACITY) ? CAPACITY : ret);
+    }
+
+    /**
+     * @brief Adds an item to the queue
+     * @param item Item to add
+     * @return true if the item has been added, fale if the maximum capacity has been reached
+     */
+    bool push(const ItemType& item)
+    {
+        bool ret = false;
+
+        // Reserve a cell
+        size_t pos  = m_enqueue_pos.load(std::memory_order_relaxed);
+        Cell*  cell = nullptr;
+        while (!ret)
+        {
+            cell         = &m_cells[pos & (CAPACITY - 1u)];
+            size_t  seq  = cell->sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0)
+            {
+                // Cell is free
+                if constexpr (MULTI_PRODUCERS)
+                {
+                    ret = m_enqueue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed);
+                }
+                else
+                {
+                    m_enqueue_pos.store(pos + 1u, std::memory_order_relaxed);
+                    ret = true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Queue is full
+                break;
+            }
+            else
+            {
+                // Cell has been reserved by another producer
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        if (ret)
+        {
+            // Publish item
+            cell->item = item;
+            cell->sequence.store(pos + 1u, std::memory_order_release);
+
+            // Wakeup the consumer only if it is parked
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_consumer_parked.load(std::memory_order_relaxed))
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cond_var.notify_one();
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Get an item from the queue (must be called from the consumer thread)
+     * @param item Item retrieved from the queue
+     * @param ms_timeout Max wait time in milliseconds
+     * @return true if the item has been retrieved, false if the timeout has been reached
+     */
+    bool pop(ItemType& item, unsigned int ms_timeout = std::numeric_limits<unsigned int>::max())
+    {
+        return (popBatch(&item, 1u, ms_timeout) == 1u);
+    }
+
+    /**
+     * @brief Get several items from the queue at once (must be called from the consumer thread)
+     * @param items Array to store the items retrieved from the queue
+     * @param max_count Maximum number of items to retrieve
+     * @param ms_timeout Max wait time in milliseconds for the first item
+     * @return Number of items retrieved, 0 if the timeout has been reached
+     */
+    size_t popBatch(ItemType* items, size_t max_count, unsigned int ms_timeout = std::numeric_limits<unsigned int>::max())
+    {
+        size_t ret = 0;
+
+        if (m_enabled)
+        {
+            // Check for available items
+            ret = tryPop(items, max_count);
+            if ((ret == 0) && (ms_timeout != 0))
+            {
+                // Spin
+                for (unsigned int i = 0; (ret == 0) && (i < m_spin_count) && m_enabled; i++)
+                {
+                    ret = tryPop(items, max_count);
+                }
+
+                // Park
+                if (ret == 0)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_consumer_parked.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    m_cond_var.wait_for(lock,
+                                        std::chrono::milliseconds(ms_timeout),
+                                        [this, &ret, items, max_count]
+                                        {
+                                            ret = (m_enabled ? tryPop(items, max_count) : 0);
+                                            return (!m_enabled || (ret != 0));
+                                        });
+                    m_consumer_parked.store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /** @brief Clear the contents of the queue (must be called from the consumer thread) */
+    void clear()
+    {
+        ItemType item;
+        while (tryPop(&item, 1u) != 0)
+        {
+        }
+    }
+
+    /**
+     * @brief Update the state of the queue
+     * @param enabled If true messages can be received,
+     *                if false abort current waiting operation
+     *                and disable further message reception
+     */
+    void setEnable(bool enabled)
+    {
+        // Update state
+        m_enabled = enabled;
+
+        // Wakeup waiting thread
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond_var.notify_all();
+    }
+
+  private:
+    /** @brief Cell of the ring buffer */
+    struct Cell
+    {
+        /** @brief Sequence number : position + 1 when the cell holds an item, position of the next lap when it is free */
+        std::atomic<size_t> sequence;
+        /** @brief Item */
+        ItemType item;
+    };
+
+    /** @brief Position of the next item to push */
+    alignas(64) std::atomic<size_t> m_enqueue_pos;
+    /** @brief Position of the next item to pop */
+    alignas(64) std::atomic<size_t> m_dequeue_pos;
+    /** @brief Ring buffer */
+    alignas(64) std::unique_ptr<Cell[]> m_cells;
+    /** @brief Number of retries of the consumer before parking */
+    const unsigned int m_spin_count;
+    /** @brief Indicate that the queue is enabled */
+    std::atomic<bool> m_enabled;
+    /** @brief Indicate that the consumer is parked */
+    std::atomic<bool> m_consumer_parked;
+    /** @brief Mutex for the consumer parking */
+    std::mutex m_mutex;
+    /** @brief Condition variable for the consumer parking */
+    std::condition_variable m_cond_var;
+
+    /** @brief Retrieve the available items without waiting */
+    size_t tryPop(ItemType* items, size_t max_count)
+    {
+        size_t count = 0;
+        size_t pos   = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (count < max_count)
+        {
+            Cell& cell = m_cells[pos & (CAPACITY - 1u)];
+            if (cell.sequence.load(std::memory_order_acquire) != (pos + 1u))
+            {
+                break;
+            }
+            items[count] = std::move(cell.item);
+            cell.sequence.store(pos + CAPACITY, std::memory_order_release);
+            count++;
+            pos++;
+        }
+        if (count != 0)
+        {
+            m_dequeue_pos.store(pos, std::memory_order_release);
+        }
+        return count;
+    }
+};
+
+/** @brief Bounded lock-free queue with multiple producer threads and a single consumer thread */
+template <typename ItemType, size_t CAPACITY>
+using MpscQueue = LockFreeQueue<ItemType, CAPACITY, true>;
+
+/** @brief Bounded lock-free queue with a single producer thread and a single consumer thread */
+template <typename ItemType, size_t CAPACITY>
+using SpscQueue = LockFreeQueue<ItemType, CAPACITY, false>;
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // LOCKFREEQUEUE_H
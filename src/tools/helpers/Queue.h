@@ -37,15 +37,21 @@ class Queue
 {
   public:
     /** @brief Constructor */
-    Queue() : m_mutex(), m_cond_var(), m_queue(), m_enabled(true) { }
+    Queue() : m_mutex(), m_cond_var(), m_queue(), m_enabled(true), m_waiting_count(0) { }
     /** @brief Destructor */
     virtual ~Queue() { }
 
+    /**
+     * @brief Get the maximum number of items in the queue
+     * @return Maximum number of items in the queue
+     */
+    size_t capacity() const { return MAX_SIZE; }
+
     /**
      * @brief Get the size of the queue
      * @return Size of the queue in number of items
      */
-    size_t size() const { return MAX_SIZE; }
+    size_t size() const { return count(); }
 
     /**
      * @brief Indicate if the queue is empty
@@ -79,7 +85,7 @@ class Queue
      * @brief Get the number of items in the queue
      * @return Number of items in the queue
      */
-    size_t count()
+    size_t count() const
     {
         // Lock queue
         std::unique_lock<std::mutex> lock(m_mutex);
@@ -108,7 +114,10 @@ class Queue
             m_queue.push(item);
 
             // Wakeup waiting thread
-            m_cond_var.notify_one();
+            if (m_waiting_count != 0)
+            {
+                m_cond_var.notify_one();
+            }
             ret = true;
         }
 
@@ -123,20 +132,39 @@ class Queue
      */
     bool pop(ItemType& item, unsigned int ms_timeout = std::numeric_limits<unsigned int>::max())
     {
-        bool ret = false;
+        return (popBatch(&item, 1u, ms_timeout) == 1u);
+    }
+
+    /**
+     * @brief Get several items from the queue at once
+     * @param items Array to store the items retrieved from the queue
+     * @param max_count Maximum number of items to retrieve
+     * @param ms_timeout Max wait time in milliseconds for the first item
+     * @return Number of items retrieved, 0 if the timeout has been reached
+     */
+    size_t popBatch(ItemType* items, size_t max_count, unsigned int ms_timeout = std::numeric_limits<unsigned int>::max())
+    {
+        size_t ret = 0;
 
         // Lock queue
         std::unique_lock<std::mutex> lock(m_mutex);
 
         // Wait for an item
-        if (m_cond_var.wait_for(lock, std::chrono::milliseconds(ms_timeout), [this] { return (!m_enabled || !m_queue.empty()); }))
+        m_waiting_count++;
+        bool available =
+            m_cond_var.wait_for(lock, std::chrono::milliseconds(ms_timeout), [this] { return (!m_enabled || !m_queue.empty()); });
+        m_waiting_count--;
+        if (available)
         {
-            // Retrieve item
+            // Retrieve items
             if (m_enabled)
             {
-                item = m_queue.front();
-                m_queue.pop();
-                ret = true;
+                while ((ret < max_count) && !m_queue.empty())
+                {
+                    items[ret] = std::move(m_queue.front());
+                    m_queue.pop();
+                    ret++;
+                }
             }
         }
 
@@ -183,6 +211,8 @@ class Queue
     std::queue<ItemType> m_queue;
     /** @brief Indicate that the queue is enabled */
     bool m_enabled;
+    /** @brief Number of threads waiting for an item */
+    unsigned int m_waiting_count;
 };
 
 } // namespace helpers
@@ -0,0 +1,194 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TASK_H
+#define TASK_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/**
+ * @brief Move-only callable without parameters and return value,
+ *        small callables are stored inline to avoid any dynamic allocation
+ */
+class Task
+{
+  public:
+    /** @brief Size in bytes of the inline storage */
+    static constexpr size_t INLINE_SIZE = 6u * sizeof(void*);
+
+    /** @brief Constructor of an empty task */
+    Task() : m_operations(nullptr), m_storage() { }
+
+    /** @brief Constructor of an empty task */
+    Task(std::nullptr_t) : Task() { }
+
+    /** @brief Constructor from any callable object */
+    template <typename Function,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, Task> &&
+                                          !std::is_same_v<std::decay_t<Function>, std::nullptr_t>>>
+    Task(Function&& function) : m_operations(&Storage<std::decay_t<Function>>::operations), m_storage()
+    {
+        Storage<std::decay_t<Function>>::create(m_storage, std::forward<Function>(function));
+    }
+
+    /** @brief Move constructor */
+    Task(Task&& other) noexcept : m_operations(other.m_operations), m_storage()
+    {
+        if (m_operations)
+        {
+            m_operations->move(m_storage, other.m_storage);
+            other.m_operations = nullptr;
+        }
+    }
+
+    /** @brief Move assignment operator */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            m_operations = other.m_operations;
+            if (m_operations)
+            {
+                m_operations->move(m_storage, other.m_storage);
+                other.m_operations = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    /** @brief Release the stored callable */
+    Task& operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    /** @brief Destructor */
+    ~Task() { reset(); }
+
+    // Not copyable
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    /** @brief Indicate if the task holds a callable */
+    explicit operator bool() const { return (m_operations != nullptr); }
+
+    /** @brief Indicate if the callable is stored inline (no dynamic allocation) */
+    bool isInline() const { return (m_operations && m_operations->is_inline); }
+
+    /** @brief Execute the task */
+    void operator()() { m_operations->invoke(m_storage); }
+
+  private:
+    /** @brief Inline storage */
+    using Buffer = std::aligned_storage_t<INLINE_SIZE, alignof(std::max_align_t)>;
+
+    /** @brief Operations on a stored callable */
+    struct Operations
+    {
+        /** @brief Execute the callable */
+        void (*invoke)(Buffer& storage);
+        /** @brief Move the callable to an empty storage */
+        void (*move)(Buffer& dest, Buffer& src);
+        /** @brief Destroy the callable */
+        void (*destroy)(Buffer& storage);
+        /** @brief Indicate if the callable is stored inline */
+        bool is_inline;
+    };
+
+    /** @brief Storage of a callable : inline if it fits in the buffer and can be moved without exception, allocated otherwise */
+    template <typename Function,
+              bool IsInline = ((sizeof(Function) <= INLINE_SIZE) && (alignof(Function) <= alignof(std::max_align_t)) &&
+                               std::is_nothrow_move_constructible_v<Function>)>
+    struct Storage
+    {
+        /** @brief Access to the stored callable */
+        static Function* get(Buffer& storage) { return std::launder(reinterpret_cast<Function*>(&storage)); }
+        /** @brief Store a callable */
+        template <typename F>
+        static void create(Buffer& storage, F&& function)
+        {
+            new (&storage) Function(std::forward<F>(function));
+        }
+        /** @brief Execute the stored callable */
+        static void invoke(Buffer& storage) { (*get(storage))(); }
+        /** @brief Move the stored callable */
+        static void move(Buffer& dest, Buffer& src)
+        {
+            new (&dest) Function(std::move(*get(src)));
+            get(src)->~Function();
+        }
+        /** @brief Destroy the stored callable */
+        static void destroy(Buffer& storage) { get(storage)->~Function(); }
+
+        /** @brief Operations table */
+        static constexpr Operations operations = {&invoke, &move, &destroy, true};
+    };
+
+    /** @brief Storage of a callable which doesn't fit in the inline buffer */
+    template <typename Function>
+    struct Storage<Function, false>
+    {
+        /** @brief Access to the pointer to the allocated callable */
+        static Function*& get(Buffer& storage) { return *std::launder(reinterpret_cast<Function**>(&storage)); }
+        /** @brief Store a callable */
+        template <typename F>
+        static void create(Buffer& storage, F&& function)
+        {
+            new (&storage) Function*(new Function(std::forward<F>(function)));
+        }
+        /** @brief Execute the stored callable */
+        static void invoke(Buffer& storage) { (*get(storage))(); }
+        /** @brief Move the stored callable */
+        static void move(Buffer& dest, Buffer& src) { new (&dest) Function*(get(src)); }
+        /** @brief Destroy the stored callable */
+        static void destroy(Buffer& storage) { delete get(storage); }
+
+        /** @brief Operations table */
+        static constexpr Operations operations = {&invoke, &move, &destroy, false};
+    };
+
+    /** @brief Operations on the stored callable (nullptr = empty task) */
+    const Operations* m_operations;
+    /** @brief Storage of the callable */
+    Buffer m_storage;
+
+    /** @brief Destroy the stored callable */
+    void reset()
+    {
+        if (m_operations)
+        {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+};
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // TASK_H
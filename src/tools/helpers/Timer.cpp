@@ -30,7 +30,10 @@ Timer::Timer(ITimerPool& pool, const char* name)
       m_name(name),
       m_single_shot(false),
       m_interval(std::chrono::milliseconds(0)),
-      m_wake_up_time_point(std::chrono::time_point<std::chrono::system_clock>::min()),
+      m_wake_up_time_point(std::chrono::time_point<std::chrono::steady_clock>::min()),
+      m_pool_index(0),
+      m_start_id(0),
+      m_callback_pending(false),
       m_started(false),
       m_callback()
 {
@@ -41,6 +44,7 @@ Timer::Timer(ITimerPool& pool, const char* name)
 Timer::~Timer()
 {
     stop();
+    m_pool.unregisterTimer(this);
 }
 
 /** @brief Start the timer with the specified interval */
@@ -57,7 +61,7 @@ bool Timer::start(std::chrono::milliseconds interval, bool single_shot)
         // Configure timer
         m_interval           = interval;
         m_single_shot        = single_shot;
-        m_wake_up_time_point = std::chrono::system_clock::now() + m_interval;
+        m_wake_up_time_point = std::chrono::steady_clock::now() + m_interval;
 
         // Add timer to the list
         m_pool.addTimer(this);
@@ -92,7 +96,7 @@ bool Timer::restart(std::chrono::milliseconds interval, bool single_shot)
     // Configure timer
     m_interval           = interval;
     m_single_shot        = single_shot;
-    m_wake_up_time_point = std::chrono::system_clock::now() + m_interval;
+    m_wake_up_time_point = std::chrono::steady_clock::now() + m_interval;
 
     // Add timer to the list
     m_pool.addTimer(this);
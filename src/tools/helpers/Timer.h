@@ -20,6 +20,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define TIMER_H
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 namespace ocpp
@@ -112,8 +114,14 @@ class Timer
     bool m_single_shot;
     /** @brief Wake uo interval */
     std::chrono::milliseconds m_interval;
-    /** @brief Next wakeup time point */
-    std::chrono::time_point<std::chrono::system_clock> m_wake_up_time_point;
+    /** @brief Next wakeup time point (monotonic clock so that the timers are not affected by system time changes) */
+    std::chrono::time_point<std::chrono::steady_clock> m_wake_up_time_point;
+    /** @brief Position in the active timers of the pool (valid only when the timer is started) */
+    std::size_t m_pool_index;
+    /** @brief Id given by the pool on each start */
+    uint64_t m_start_id;
+    /** @brief Indicate that a call of the callback is pending in the pool's executor */
+    bool m_callback_pending;
     /** @brief Indicate if the timer is started */
     bool m_started;
     /** @brief Callback */
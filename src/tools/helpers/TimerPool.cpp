@@ -18,6 +18,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "TimerPool.h"
 #include "Timer.h"
+#include "WorkerThreadPool.h"
+
+#include <algorithm>
 
 namespace ocpp
 {
@@ -25,12 +28,21 @@ namespace helpers
 {
 
 /** @brief Constructor */
-TimerPool::TimerPool()
-    : m_stop(false),
+TimerPool::TimerPool(std::shared_ptr<WorkerThreadPool> executor, std::chrono::milliseconds coalescing_window)
+    : m_executor(executor),
+      m_coalescing_window(coalescing_window),
+      m_next_start_id(1u),
+      m_pending_jobs(0),
+      m_registered_timers(),
+      m_stats_fired(0),
+      m_stats_coalesced(0),
+      m_stats_total_lateness(0),
+      m_stats_max_lateness(0),
+      m_stop(false),
       m_update_wakeup_time(false),
       m_wakeup_mutex(),
       m_wakeup_cond(),
-      m_wake_up_time_point(std::chrono::system_clock::now() + std::chrono::hours(2400u)),
+      m_wake_up_time_point(std::chrono::steady_clock::now() + std::chrono::hours(2400u)),
       m_thread(std::bind(&TimerPool::threadLoop, this)),
       m_timers(),
       m_active_timers()
@@ -44,6 +56,10 @@ TimerPool::~TimerPool()
     m_stop = true;
     m_wakeup_cond.notify_one();
     m_thread.join();
+
+    // Wait for the callbacks queued in the executor
+    std::unique_lock<std::mutex> lock(m_wakeup_mutex);
+    m_wakeup_cond.wait(lock, [this] { return (m_pending_jobs == 0); });
 }
 
 /** @copydoc Timer* ITimerPool::createTimer(const char*) */
@@ -58,13 +74,10 @@ Timer* TimerPool::getTimer(const std::string& timer_name)
     Timer* timer = nullptr;
 
     std::lock_guard<std::mutex> lock(m_wakeup_mutex);
-    for (Timer* t : m_timers)
+    auto                        iter = m_timers.find(timer_name);
+    if (iter != m_timers.end())
     {
-        if (t->m_name == timer_name)
-        {
-            timer = t;
-            break;
-        }
+        timer = iter->second;
     }
     return timer;
 }
@@ -90,31 +103,163 @@ void TimerPool::threadLoop()
         }
         else
         {
-            // Timer has elapsed
-            Timer* timer = m_active_timers.front();
-            if (timer->m_single_shot)
+            // Timers have elapsed
+            std::vector<ExpiredTimer> expired_timers = collectExpiredTimers();
+
+            // New wakeup time point
+            computeNextWakeupTimepoint();
+            m_update_wakeup_time = false;
+
+            // Notify user
+            if (m_executor)
             {
-                // Single shot : remove timer from the list
-                m_active_timers.pop_front();
+                if (!expired_timers.empty())
+                {
+                    m_pending_jobs++;
+                    m_executor->post(
+                        [this, expired_timers]
+                        {
+                            callCallbacks(expired_timers);
 
-                // Timer is now stopped
-                timer->m_started = false;
+                            std::lock_guard<std::mutex> lock(m_wakeup_mutex);
+                            m_pending_jobs--;
+                            m_wakeup_cond.notify_all();
+                        });
+                }
             }
             else
             {
-                // Periodic : compute next wakeup time point
-                timer->m_wake_up_time_point += timer->m_interval;
+                callCallbacks(expired_timers);
             }
+        }
+    }
+}
 
-            // New wakeup time point
-            computeNextWakeupTimepoint();
+/** @brief Collect the expired timers and update their state */
+std::vector<TimerPool::ExpiredTimer> TimerPool::collectExpiredTimers()
+{
+    std::vector<ExpiredTimer> expired_timers;
+
+    // Only the elapsed timers are collected, a periodic timer with a period shorter than the coalescing window is collected once
+    auto   limit      = std::chrono::steady_clock::now();
+    size_t max_timers = m_active_timers.size();
+    while (!m_active_timers.empty() && (m_active_timers.front()->m_wake_up_time_point <= limit) && (expired_timers.size() < max_timers))
+    {
+        Timer* timer = m_active_timers.front();
+        if (timer->m_callback_pending)
+        {
+            // Previous expiry not handled yet
+            m_stats_coalesced++;
+        }
+        else
+        {
+            expired_timers.push_back({timer, timer->m_start_id, timer->m_wake_up_time_point});
+            timer->m_callback_pending = (m_executor != nullptr);
+        }
+        if (timer->m_single_shot)
+        {
+            // Single shot : remove timer from the heap
+            removeTimer(timer);
 
+            // Timer is now stopped
+            timer->m_started = false;
+        }
+        else
+        {
+            // Periodic : compute next wakeup time point
+            timer->m_wake_up_time_point += timer->m_interval;
+            siftDown(0);
+        }
+    }
+
+    return expired_timers;
+}
+
+/** @brief Call the callbacks of the expired timers (from the executor's thread if any) */
+void TimerPool::callCallbacks(const std::vector<ExpiredTimer>& expired_timers)
+{
+    for (const ExpiredTimer& expired_timer : expired_timers)
+    {
+        // Check that the timer has not been destroyed or restarted since its expiry
+        std::function<void()> callback;
+        lock();
+        if (isExpiryValid(expired_timer))
+        {
+            if (m_executor)
+            {
+                // The timer can be modified during the call
+                callback = expired_timer.timer->m_callback;
+            }
+            else
+            {
+                // Called under the lock from the pool's thread, no copy needed
+                updateStats(expired_timer.expiry);
+                expired_timer.timer->m_callback();
+            }
+        }
+        unlock();
+
+        if (m_executor)
+        {
             // Notify user
-            timer->m_callback();
+            if (callback)
+            {
+                updateStats(expired_timer.expiry);
+                callback();
+            }
+
+            // Next expirations can be handled
+            lock();
+            if (isExpiryValid(expired_timer))
+            {
+                expired_timer.timer->m_callback_pending = false;
+            }
+            unlock();
         }
     }
 }
 
+/** @brief Check that an expired timer has not been destroyed or restarted since its expiry */
+bool TimerPool::isExpiryValid(const ExpiredTimer& expired_timer) const
+{
+    return ((m_registered_timers.find(expired_timer.timer) != m_registered_timers.end()) &&
+            (expired_timer.timer->m_start_id == expired_timer.start_id));
+}
+
+/** @brief Update the lateness statistics */
+void TimerPool::updateStats(const std::chrono::time_point<std::chrono::steady_clock>& expiry)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (now > expiry)
+    {
+        uint64_t lateness = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - expiry).count());
+        m_stats_total_lateness += lateness;
+        uint64_t max_lateness = m_stats_max_lateness;
+        while ((lateness > max_lateness) && !m_stats_max_lateness.compare_exchange_weak(max_lateness, lateness)) { }
+    }
+    m_stats_fired++;
+}
+
+/** @brief Get the statistics on the timers expirations */
+TimerPoolStats TimerPool::stats() const
+{
+    TimerPoolStats stats;
+    stats.fired         = m_stats_fired;
+    stats.coalesced     = m_stats_coalesced;
+    stats.mean_lateness = std::chrono::microseconds((stats.fired == 0) ? 0 : (m_stats_total_lateness / stats.fired));
+    stats.max_lateness  = std::chrono::microseconds(m_stats_max_lateness);
+    return stats;
+}
+
+/** @brief Reset the statistics on the timers expirations */
+void TimerPool::resetStats()
+{
+    m_stats_fired          = 0;
+    m_stats_coalesced      = 0;
+    m_stats_total_lateness = 0;
+    m_stats_max_lateness   = 0;
+}
+
 /** @brief Compute next wakeup time point */
 void TimerPool::computeNextWakeupTimepoint()
 {
@@ -122,21 +267,116 @@ void TimerPool::computeNextWakeupTimepoint()
     if (m_active_timers.empty())
     {
         // Next wakeup in 100days
-        m_wake_up_time_point = std::chrono::system_clock::now() + std::chrono::hours(2400u);
+        m_wake_up_time_point = std::chrono::steady_clock::now() + std::chrono::hours(2400u);
     }
     else
     {
-        // Re-order timer list
-        m_active_timers.sort([](const Timer* a, const Timer* b) { return (a->m_wake_up_time_point < b->m_wake_up_time_point); });
+        // Top of the heap, delayed to the latest expiry within the coalescing window
+        // so that the timers of the window are handled at once without any of them elapsing early
         m_wake_up_time_point = m_active_timers.front()->m_wake_up_time_point;
+        if (m_coalescing_window.count() != 0)
+        {
+            m_wake_up_time_point = latestWakeupTimepoint(0, m_wake_up_time_point + m_coalescing_window);
+        }
+    }
+}
+
+/** @brief Get the latest wakeup time point which is not after a limit in the sub-heap of a timer */
+std::chrono::time_point<std::chrono::steady_clock>
+    TimerPool::latestWakeupTimepoint(std::size_t index, const std::chrono::time_point<std::chrono::steady_clock>& limit) const
+{
+    // The children of a timer wake up after it, only the sub-heaps starting before the limit are visited
+    std::chrono::time_point<std::chrono::steady_clock> latest = m_active_timers[index]->m_wake_up_time_point;
+    for (std::size_t child = 2u * index + 1u; (child <= (2u * index + 2u)) && (child < m_active_timers.size()); child++)
+    {
+        if (m_active_timers[child]->m_wake_up_time_point <= limit)
+        {
+            latest = std::max(latest, latestWakeupTimepoint(child, limit));
+        }
+    }
+    return latest;
+}
+
+/** @brief Move a timer up in the heap until its parent wakes up before it */
+void TimerPool::siftUp(std::size_t index)
+{
+    Timer* timer = m_active_timers[index];
+    while (index > 0)
+    {
+        std::size_t parent = (index - 1u) / 2u;
+        if (m_active_timers[parent]->m_wake_up_time_point <= timer->m_wake_up_time_point)
+        {
+            break;
+        }
+        place(m_active_timers[parent], index);
+        index = parent;
+    }
+    place(timer, index);
+}
+
+/** @brief Move a timer down in the heap until its children wake up after it */
+void TimerPool::siftDown(std::size_t index)
+{
+    Timer*      timer = m_active_timers[index];
+    std::size_t count = m_active_timers.size();
+    while (true)
+    {
+        // Earliest child
+        std::size_t child = 2u * index + 1u;
+        if (child >= count)
+        {
+            break;
+        }
+        if (((child + 1u) < count) && (m_active_timers[child + 1u]->m_wake_up_time_point < m_active_timers[child]->m_wake_up_time_point))
+        {
+            child++;
+        }
+        if (timer->m_wake_up_time_point <= m_active_timers[child]->m_wake_up_time_point)
+        {
+            break;
+        }
+        place(m_active_timers[child], index);
+        index = child;
     }
+    place(timer, index);
+}
+
+/** @brief Place a timer at the given position of the heap */
+void TimerPool::place(Timer* timer, std::size_t index)
+{
+    m_active_timers[index] = timer;
+    timer->m_pool_index    = index;
 }
 
 /** @copydoc void ITimerPool::addTimer(Timer*) */
 void TimerPool::registerTimer(Timer* timer)
 {
     std::lock_guard<std::mutex> lock(m_wakeup_mutex);
-    m_timers.push_back(timer);
+    m_registered_timers.insert(timer);
+    if (!timer->m_name.empty())
+    {
+        m_timers.emplace(timer->m_name, timer);
+    }
+}
+
+/** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+void TimerPool::unregisterTimer(Timer* timer)
+{
+    lock();
+    m_registered_timers.erase(timer);
+    if (!timer->m_name.empty())
+    {
+        auto range = m_timers.equal_range(timer->m_name);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (iter->second == timer)
+            {
+                m_timers.erase(iter);
+                break;
+            }
+        }
+    }
+    unlock();
 }
 
 /** @copydoc void ITimerPool::lock() */
@@ -169,23 +409,40 @@ void TimerPool::addTimer(Timer* timer)
         m_wakeup_cond.notify_one();
     }
 
-    // Add timer to the list
+    // Add timer to the heap
+    timer->m_start_id         = m_next_start_id++;
+    timer->m_callback_pending = false;
     m_active_timers.push_back(timer);
+    siftUp(m_active_timers.size() - 1u);
 }
 
 /** @copydoc void ITimerPool::removeTimer(Timer*) */
 void TimerPool::removeTimer(Timer* timer)
 {
-    // Check if the timer is the next timer to wakeup
-    if (timer == m_active_timers.front())
+    // Check if the timer is the next timer to wakeup or the one defining the wakeup time point of the coalesced timers
+    std::size_t index = timer->m_pool_index;
+    if ((index == 0) || (timer->m_wake_up_time_point == m_wake_up_time_point))
     {
         // Trigger update of wakeup timepoint
         m_update_wakeup_time = true;
         m_wakeup_cond.notify_one();
     }
 
-    // Remove timer from the list
-    m_active_timers.remove(timer);
+    // Replace the timer with the last one of the heap
+    Timer* last = m_active_timers.back();
+    m_active_timers.pop_back();
+    if (last != timer)
+    {
+        place(last, index);
+        if ((index > 0) && (last->m_wake_up_time_point < m_active_timers[(index - 1u) / 2u]->m_wake_up_time_point))
+        {
+            siftUp(index);
+        }
+        else
+        {
+            siftDown(index);
+        }
+    }
 }
 
 } // namespace helpers
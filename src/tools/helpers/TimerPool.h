@@ -21,12 +21,17 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "ITimerPool.h"
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
-#include <list>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace ocpp
 {
@@ -34,15 +39,46 @@ namespace helpers
 {
 
 class Timer;
+class WorkerThreadPool;
 
-/** @brief Handle a pool of timers */
+/** @brief Statistics on the timers expirations */
+struct TimerPoolStats
+{
+    /** @brief Number of callbacks called */
+    uint64_t fired;
+    /** @brief Number of expirations merged with a pending call of the same timer's callback */
+    uint64_t coalesced;
+    /** @brief Mean delay between the scheduled expiry and the call of the callback */
+    std::chrono::microseconds mean_lateness;
+    /** @brief Maximum delay between the scheduled expiry and the call of the callback */
+    std::chrono::microseconds max_lateness;
+};
+
+/**
+ * @brief Handle a pool of timers
+ *
+ * The active timers are stored in a binary min-heap ordered by wakeup time point :
+ * the next timer to elapse is found in O(1), start / stop / restart are done in O(log n).
+ * Named timers are indexed in a hash table for O(1) lookups.
+ *
+ * By default the callbacks are called from the pool's thread. When an executor is given, the callbacks
+ * are called from the executor's threads so that a slow callback does not delay the other timers :
+ * the objects used by a callback must then stay valid until the end of the callback even if the timer
+ * has been stopped or destroyed meanwhile.
+ */
 class TimerPool : public ITimerPool
 {
     friend class Timer;
 
   public:
-    /** @brief Constructor */
-    TimerPool();
+    /**
+     * @brief Constructor
+     * @param executor Executor to call the callbacks from (nullptr = callbacks are called from the pool's thread)
+     * @param coalescing_window Timers elapsing within this window after the next expiry are handled at the same time,
+     *                          at the latest of their expiries (the timers never elapse before their expiry)
+     */
+    TimerPool(std::shared_ptr<WorkerThreadPool> executor          = nullptr,
+              std::chrono::milliseconds         coalescing_window = std::chrono::milliseconds(0));
     /** @brief Destructor */
     virtual ~TimerPool();
 
@@ -52,7 +88,46 @@ class TimerPool : public ITimerPool
     /** @copydoc Timer* ITimerPool::getTimer(const std::string&) */
     Timer* getTimer(const std::string& timer_name) override;
 
+    /**
+     * @brief Get the statistics on the timers expirations
+     * @return Statistics since the creation of the pool or the last reset
+     */
+    TimerPoolStats stats() const;
+
+    /** @brief Reset the statistics on the timers expirations */
+    void resetStats();
+
   private:
+    /** @brief Expired timer waiting for the call of its callback */
+    struct ExpiredTimer
+    {
+        /** @brief Timer */
+        Timer* timer;
+        /** @brief Start id of the timer when it has expired */
+        uint64_t start_id;
+        /** @brief Scheduled expiry */
+        std::chrono::time_point<std::chrono::steady_clock> expiry;
+    };
+
+    /** @brief Executor to call the callbacks from */
+    std::shared_ptr<WorkerThreadPool> m_executor;
+    /** @brief Coalescing window of the expirations */
+    const std::chrono::milliseconds m_coalescing_window;
+    /** @brief Id of the next timer start, allow to detect if a timer has been restarted after its expiry */
+    uint64_t m_next_start_id;
+    /** @brief Number of batches of callbacks queued in the executor */
+    unsigned int m_pending_jobs;
+    /** @brief All the registered timers */
+    std::unordered_set<Timer*> m_registered_timers;
+    /** @brief Number of callbacks called */
+    std::atomic<uint64_t> m_stats_fired;
+    /** @brief Number of coalesced expirations */
+    std::atomic<uint64_t> m_stats_coalesced;
+    /** @brief Sum of the lateness of the callbacks in microseconds */
+    std::atomic<uint64_t> m_stats_total_lateness;
+    /** @brief Maximum lateness of the callbacks in microseconds */
+    std::atomic<uint64_t> m_stats_max_lateness;
+
     /** @brief Indicate that the timers must stop */
     bool m_stop;
     /** @brief Indicate that the next wakeup time has changed */
@@ -62,21 +137,40 @@ class TimerPool : public ITimerPool
     /** @brief Wakeup condition */
     std::condition_variable m_wakeup_cond;
     /** @brief Next wakeup time point */
-    std::chrono::time_point<std::chrono::system_clock> m_wake_up_time_point;
+    std::chrono::time_point<std::chrono::steady_clock> m_wake_up_time_point;
     /** @brief Timers thread */
     std::thread m_thread;
-    /** @brief List of registered timers */
-    std::list<Timer*> m_timers;
-    /** @brief List of active timers */
-    std::list<Timer*> m_active_timers;
+    /** @brief Registered timers with a name */
+    std::unordered_multimap<std::string, Timer*> m_timers;
+    /** @brief Active timers as a binary min-heap on their wakeup time point */
+    std::vector<Timer*> m_active_timers;
 
     /** @brief Timers thread loop */
     void threadLoop();
     /** @brief Compute next wakeup time point */
     void computeNextWakeupTimepoint();
+    /** @brief Get the latest wakeup time point which is not after a limit in the sub-heap of a timer */
+    std::chrono::time_point<std::chrono::steady_clock> latestWakeupTimepoint(
+        std::size_t index, const std::chrono::time_point<std::chrono::steady_clock>& limit) const;
+    /** @brief Collect the expired timers and update their state */
+    std::vector<ExpiredTimer> collectExpiredTimers();
+    /** @brief Call the callbacks of the expired timers (from the executor's thread if any) */
+    void callCallbacks(const std::vector<ExpiredTimer>& expired_timers);
+    /** @brief Check that an expired timer has not been destroyed or restarted since its expiry */
+    bool isExpiryValid(const ExpiredTimer& expired_timer) const;
+    /** @brief Update the lateness statistics */
+    void updateStats(const std::chrono::time_point<std::chrono::steady_clock>& expiry);
+    /** @brief Move a timer up in the heap until its parent wakes up before it */
+    void siftUp(std::size_t index);
+    /** @brief Move a timer down in the heap until its children wake up after it */
+    void siftDown(std::size_t index);
+    /** @brief Place a timer at the given position of the heap */
+    void place(Timer* timer, std::size_t index);
 
     /** @copydoc void ITimerPool::addTimer(Timer*) */
     void registerTimer(Timer* timer) override;
+    /** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+    void unregisterTimer(Timer* timer) override;
     /** @copydoc void ITimerPool::lock() */
     void lock() override;
     /** @copydoc void ITimerPool::unlock() */
@@ -0,0 +1,214 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "WorkStealingExecutor.h"
+#include "Logger.h"
+
+#include <exception>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief Executor owning the current thread (nullptr = not an executor thread) */
+static thread_local const WorkStealingExecutor* current_executor = nullptr;
+/** @brief Index of the worker running on the current thread */
+static thread_local size_t current_worker = 0;
+
+/** @brief Constructor */
+WorkStealingExecutor::WorkStealingExecutor(size_t thread_count, size_t max_pending_tasks)
+    : m_stop(false),
+      m_workers(),
+      m_shared_mutex(),
+      m_shared_tasks(),
+      m_pending_tasks(0),
+      m_max_pending_tasks(max_pending_tasks),
+      m_idle_mutex(),
+      m_idle_cond()
+{
+    // Default to the number of hardware threads
+    if (thread_count == 0)
+    {
+        thread_count = std::thread::hardware_concurrency();
+        if (thread_count == 0)
+        {
+            thread_count = 1u;
+        }
+    }
+
+    // Create threads
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_workers.push_back(new Worker());
+    }
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_workers[i]->thread = std::thread(std::bind(&WorkStealingExecutor::workerThread, this, i));
+    }
+}
+
+/** @brief Destructor */
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+    // Stop threads, they exit once all the pending tasks have been executed
+    // and no more tasks can be posted
+    {
+        std::lock_guard<std::mutex> lock(m_idle_mutex);
+        m_stop = true;
+    }
+    m_idle_cond.notify_all();
+
+    // Wait end of all the threads before releasing any of the workers : a thread may
+    // still be stealing from the queues of the others until it stops
+    for (Worker* worker : m_workers)
+    {
+        worker->thread.join();
+    }
+
+    // Release resources
+    for (Worker* worker : m_workers)
+    {
+        delete worker;
+    }
+}
+
+/** @brief Queue a task for execution */
+bool WorkStealingExecutor::post(Task task)
+{
+    // Queue task, it is counted as pending only once it is in its queue
+    // so that a woken up thread always finds a task to execute
+    {
+        std::lock_guard<std::mutex> lock(m_idle_mutex);
+        if (m_stop || ((m_max_pending_tasks != 0) && (m_pending_tasks >= m_max_pending_tasks)))
+        {
+            return false;
+        }
+        if (current_executor == this)
+        {
+            // Own queue for the executor's threads
+            Worker&                     worker = *m_workers[current_worker];
+            std::lock_guard<std::mutex> worker_lock(worker.mutex);
+            worker.tasks.push_back(std::move(task));
+        }
+        else
+        {
+            // Shared queue otherwise
+            std::lock_guard<std::mutex> shared_lock(m_shared_mutex);
+            m_shared_tasks.push_back(std::move(task));
+        }
+        m_pending_tasks++;
+    }
+
+    // Wakeup an idle thread
+    m_idle_cond.notify_one();
+
+    return true;
+}
+
+/** @brief Worker thread */
+void WorkStealingExecutor::workerThread(size_t index)
+{
+    current_executor = this;
+    current_worker   = index;
+
+    // Thread loop
+    Task task;
+    while (true)
+    {
+        // Wait for a task and reserve it
+        {
+            std::unique_lock<std::mutex> lock(m_idle_mutex);
+            m_idle_cond.wait(lock, [this] { return (m_stop || (m_pending_tasks != 0)); });
+            if (m_pending_tasks == 0)
+            {
+                // Stopping and no more tasks to execute
+                break;
+            }
+            m_pending_tasks--;
+        }
+
+        // Get the reserved task : each reservation matches a queued task, but the queues are scanned one
+        // after the other so another thread may take the task from a queue which has not been scanned yet
+        // while the remaining task is in a queue already scanned, the scan is then done again
+        while (!nextTask(index, task)) { }
+
+        // Execute task
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR << "Exception in executor task : " << e.what();
+        }
+        catch (...)
+        {
+            LOG_ERROR << "Unknown exception in executor task";
+        }
+        task = nullptr;
+    }
+}
+
+/** @brief Get the next task to execute, from the own queue of the worker first, then from the shared queue and the other workers */
+bool WorkStealingExecutor::nextTask(size_t index, Task& task)
+{
+    bool ret = false;
+
+    // Own queue first, oldest task first to preserve the posting order
+    Worker& worker = *m_workers[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty())
+        {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            ret = true;
+        }
+    }
+
+    // Shared queue, oldest task first
+    if (!ret)
+    {
+        std::lock_guard<std::mutex> lock(m_shared_mutex);
+        if (!m_shared_tasks.empty())
+        {
+            task = std::move(m_shared_tasks.front());
+            m_shared_tasks.pop_front();
+            ret = true;
+        }
+    }
+
+    // Steal from the other queues, newest task first to limit contention with their owner
+    for (size_t i = 1; !ret && (i < m_workers.size()); i++)
+    {
+        Worker&                     victim = *m_workers[(index + i) % m_workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+} // namespace helpers
+} // namespace ocpp
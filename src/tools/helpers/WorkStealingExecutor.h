@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WORKSTEALINGEXECUTOR_H
+#define WORKSTEALINGEXECUTOR_H
+
+#include "Task.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief Fixed size pool of threads executing tasks, idle threads steal the pending tasks of the busy ones */
+class WorkStealingExecutor
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param thread_count Number of threads (0 = number of hardware threads)
+     * @param max_pending_tasks Maximum number of tasks waiting for execution (0 = no limit)
+     */
+    WorkStealingExecutor(size_t thread_count = 0, size_t max_pending_tasks = 0);
+    /** @brief Destructor, the pending tasks are executed before the threads stop */
+    virtual ~WorkStealingExecutor();
+
+    /**
+     * @brief Get the number of threads of the executor
+     * @return Number of threads
+     */
+    size_t threadCount() const { return m_workers.size(); }
+
+    /**
+     * @brief Get the maximum number of tasks waiting for execution
+     * @return Maximum number of tasks waiting for execution (0 = no limit)
+     */
+    size_t maxPendingTasks() const { return m_max_pending_tasks; }
+
+    /**
+     * @brief Queue a task for execution
+     *        A task posted from one of the executor's thread is queued on this thread,
+     *        other tasks are queued on a shared queue and are executed in the posting order
+     * @param task Task to execute (small callables are queued without dynamic allocation)
+     * @return true if the task has been queued, false if the executor is stopping or if
+     *         the maximum number of pending tasks has been reached (the caller must then
+     *         execute the task by itself or retry later)
+     */
+    bool post(Task task);
+
+  private:
+    /** @brief Worker thread with its own task queue */
+    struct Worker
+    {
+        /** @brief Constructor */
+        Worker() : mutex(), tasks(), thread() { }
+        /** @brief Mutex for concurrent access to the task queue */
+        std::mutex mutex;
+        /** @brief Pending tasks */
+        std::deque<Task> tasks;
+        /** @brief Thread */
+        std::thread thread;
+    };
+
+    /** @brief Indicate that the threads must stop */
+    bool m_stop;
+    /** @brief Worker threads */
+    std::vector<Worker*> m_workers;
+    /** @brief Mutex for concurrent access to the shared task queue */
+    std::mutex m_shared_mutex;
+    /** @brief Tasks posted from outside the executor */
+    std::deque<Task> m_shared_tasks;
+    /** @brief Number of queued tasks which have not been reserved yet by a thread */
+    size_t m_pending_tasks;
+    /** @brief Maximum number of pending tasks (0 = no limit) */
+    const size_t m_max_pending_tasks;
+    /** @brief Mutex for the idle threads wakeup */
+    std::mutex m_idle_mutex;
+    /** @brief Condition variable for the idle threads wakeup */
+    std::condition_variable m_idle_cond;
+
+    /** @brief Worker thread */
+    void workerThread(size_t index);
+    /** @brief Get the next task to execute, from the own queue of the worker first, then from the shared queue and the other workers */
+    bool nextTask(size_t index, Task& task);
+};
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // WORKSTEALINGEXECUTOR_H
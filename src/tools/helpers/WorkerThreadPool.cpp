@@ -24,48 +24,35 @@ namespace helpers
 {
 
 /** @brief Constructor */
-WorkerThreadPool::WorkerThreadPool(size_t thread_count) : m_stop(false), m_threads(), m_job_queue()
+WorkerThreadPool::WorkerThreadPool(size_t thread_count) : m_executor()
 {
-    // Create thread
-    for (size_t i = 0; i < thread_count; i++)
+    // Create threads
+    if (thread_count != 0)
     {
-        m_threads.push_back(new std::thread(std::bind(&WorkerThreadPool::workerThread, this)));
+        m_executor = std::make_unique<WorkStealingExecutor>(thread_count);
     }
 }
 
 /** @brief Destructor */
 WorkerThreadPool::~WorkerThreadPool()
 {
-    // Stop threads
-    m_stop = true;
-    m_job_queue.setEnable(false);
-
-    // Wait end of thread an release resources
-    for (std::thread* thread : m_threads)
-    {
-        thread->join();
-        delete thread;
-    }
+    // Stop threads and release resources
+    m_executor.reset();
 }
 
-/** @brief Worker thread */
-void WorkerThreadPool::workerThread()
+/** @brief Compute the number of worker threads to use for the stack */
+size_t WorkerThreadPool::computeThreadCount(size_t configured_count)
 {
-    std::shared_ptr<IJob> job;
-
-    // Thread loop
-    while (!m_stop)
+    size_t thread_count = configured_count;
+    if (thread_count == 0)
     {
-        // Wait for a job
-        if (m_job_queue.pop(job))
-        {
-            // Execute job
-            job->run();
-
-            // Release resources
-            job.reset();
-        }
+        thread_count = std::thread::hardware_concurrency();
+    }
+    if (thread_count < MIN_THREAD_COUNT)
+    {
+        thread_count = MIN_THREAD_COUNT;
     }
+    return thread_count;
 }
 
 } // namespace helpers
@@ -19,17 +19,14 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef WORKERTHREADPOOL_H
 #define WORKERTHREADPOOL_H
 
-#include "Queue.h"
+#include "Task.h"
+#include "WorkStealingExecutor.h"
 
 #include <chrono>
 #include <condition_variable>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
-#include <optional>
-#include <thread>
-#include <vector>
 
 namespace ocpp
 {
@@ -52,7 +49,10 @@ class JobBase : public IJob
 {
   public:
     /** @brief Constructor */
-    JobBase(const std::function<ReturnType()>& func) : success(true), end_of_job_mutex(), end_of_job_var(), end(false), function(func) { }
+    JobBase(std::function<ReturnType()>&& func)
+        : success(true), end_of_job_mutex(), end_of_job_var(), end(false), function(std::move(func))
+    {
+    }
 
     /** @brief Destructor */
     virtual ~JobBase() { }
@@ -67,6 +67,17 @@ class JobBase : public IJob
     bool end;
     /** @brief Function to execute */
     std::function<ReturnType()> function;
+
+  protected:
+    /** @brief Notify end of job */
+    void notifyEnd()
+    {
+        {
+            std::lock_guard<std::mutex> lock(end_of_job_mutex);
+            end = true;
+        }
+        end_of_job_var.notify_all();
+    }
 };
 
 /** @brief Job for a worker thread */
@@ -94,8 +105,7 @@ class Job : public JobBase<ReturnType>
         }
 
         // Notify end of job
-        this->end = true;
-        this->end_of_job_var.notify_all();
+        this->notifyEnd();
     }
 
     /** @brief Returned value */
@@ -103,7 +113,7 @@ class Job : public JobBase<ReturnType>
 
   private:
     /** @brief Constructor */
-    Job(const std::function<ReturnType()>& func) : JobBase<ReturnType>(func), ret_value() { }
+    Job(std::function<ReturnType()>&& func) : JobBase<ReturnType>(std::move(func)), ret_value() { }
 };
 
 /** @brief Job for a worker thread without return value */
@@ -131,13 +141,12 @@ class Job<void> : public JobBase<void>
         }
 
         // Notify end of job
-        this->end = true;
-        this->end_of_job_var.notify_all();
+        this->notifyEnd();
     }
 
   private:
     /** @brief Constructor */
-    Job(const std::function<void()>& func) : JobBase<void>(func) { }
+    Job(std::function<void()>&& func) : JobBase<void>(std::move(func)) { }
 };
 
 /** @brief Allow to wait on asynchronous execution of a function */
@@ -149,25 +158,25 @@ class Waiter
 
   public:
     /** @brief Get the returned value */
-    const ReturnType& value() const { return (dynamic_cast<Job<ReturnType>*>(m_job.get()))->ret_value; }
+    const ReturnType& value() const { return m_job->ret_value; }
 
     /** @brief Indicate the job did execute without uncatched exception */
-    bool success() { return (dynamic_cast<Job<ReturnType>*>(m_job.get()))->success; }
+    bool success() { return m_job->success; }
 
     /** @brief Wait for completion */
     bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24u))
     {
-        Job<ReturnType>*             job = dynamic_cast<Job<ReturnType>*>(m_job.get());
+        Job<ReturnType>*             job = m_job.get();
         std::unique_lock<std::mutex> lock(job->end_of_job_mutex);
         return job->end_of_job_var.wait_for(lock, timeout, [job] { return job->end; });
     }
 
   private:
     /** @brief Constructor */
-    Waiter(const std::shared_ptr<IJob>& job) : m_job(job) { }
+    Waiter(const std::shared_ptr<Job<ReturnType>>& job) : m_job(job) { }
 
     /** @brief Associated job */
-    std::shared_ptr<IJob> m_job;
+    std::shared_ptr<Job<ReturnType>> m_job;
 };
 
 /** @brief Allow to wait on asynchronous execution of a function withour return value */
@@ -179,64 +188,107 @@ class Waiter<void>
 
   public:
     /** @brief Indicate the job did execute without uncatched exception */
-    bool success() { return (dynamic_cast<Job<void>*>(m_job.get()))->success; }
+    bool success() { return m_job->success; }
 
     /** @brief Wait for completion */
     bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24u))
     {
-        Job<void>*                   job = dynamic_cast<Job<void>*>(m_job.get());
+        Job<void>*                   job = m_job.get();
         std::unique_lock<std::mutex> lock(job->end_of_job_mutex);
         return job->end_of_job_var.wait_for(lock, timeout, [job] { return job->end; });
     }
 
   private:
     /** @brief Constructor */
-    Waiter(const std::shared_ptr<IJob>& job) : m_job(job) { }
+    Waiter(const std::shared_ptr<Job<void>>& job) : m_job(job) { }
 
     /** @brief Associated job */
-    std::shared_ptr<IJob> m_job;
+    std::shared_ptr<Job<void>> m_job;
 };
 
-/** @brief Handle a pool of worker threads */
+/**
+ * @brief Handle a pool of worker threads
+ *        Each thread has its own job queue and idle threads steal the pending jobs of the busy ones
+ */
 class WorkerThreadPool
 {
   public:
+    /** @brief Minimum number of threads for the stack : 1 for the asynchronous timer operations + 1 for the asynchronous jobs/responses */
+    static constexpr size_t MIN_THREAD_COUNT = 2u;
+
     /**
      * @brief Constructor
-     * @param thread_count Number of worker threads
+     * @param thread_count Number of worker threads (0 = no thread, the jobs are executed only by derived classes)
      */
     WorkerThreadPool(size_t thread_count);
     /** @brief Destructor */
     virtual ~WorkerThreadPool();
 
-    /** @brief Run a function in a worker thread */
+    /**
+     * @brief Compute the number of worker threads to use for the stack
+     * @param configured_count Configured number of threads (0 = number of hardware threads)
+     * @return Number of threads, at least MIN_THREAD_COUNT
+     */
+    static size_t computeThreadCount(size_t configured_count);
+
+    /**
+     * @brief Get the number of worker threads
+     * @return Number of worker threads
+     */
+    size_t threadCount() const { return (m_executor ? m_executor->threadCount() : 0u); }
+
+    /**
+     * @brief Run a function in a worker thread
+     * @param func Function to execute
+     * @return Waiter on the execution of the function, if the function can't be queued
+     *         the execution is immediately ended without success
+     */
     template <typename ReturnType>
     Waiter<ReturnType> run(std::function<ReturnType()> func)
     {
-        // Create job
-        std::shared_ptr<IJob> job(new Job<ReturnType>(func));
+        // Create job, the job and its reference counter are allocated at once
+        struct SharedJob : public Job<ReturnType>
+        {
+            SharedJob(std::function<ReturnType()>&& f) : Job<ReturnType>(std::move(f)) { }
+        };
+        std::shared_ptr<Job<ReturnType>> job = std::make_shared<SharedJob>(std::move(func));
 
-        // Add the job to the queue
-        queue(job);
+        // Add the job to the queue, if it can't be queued it ends immediately without success
+        if (!queue(job))
+        {
+            job->success = false;
+            job->notifyEnd();
+        }
 
         // Create the waiter object
         return Waiter<ReturnType>(job);
     }
 
+    /**
+     * @brief Run a function in a worker thread without waiting for its completion,
+     *        no waiter state is allocated and small functions are queued without dynamic allocation
+     * @param func Function to execute
+     * @return true if the function has been queued, false otherwise
+     */
+    template <typename Function>
+    bool post(Function&& func)
+    {
+        return queueTask(Task(std::forward<Function>(func)));
+    }
+
   protected:
     /** @brief Add a job to the queue */
-    virtual void queue(const std::shared_ptr<IJob>& job) { m_job_queue.push(job); }
+    virtual bool queue(const std::shared_ptr<IJob>& job)
+    {
+        return queueTask(Task([job] { job->run(); }));
+    }
+
+    /** @brief Add a task to the queue */
+    virtual bool queueTask(Task&& task) { return (m_executor ? m_executor->post(std::move(task)) : false); }
 
   private:
-    /** @brief Indicate that the threads must stop */
-    bool m_stop;
-    /** @brief Worker threads */
-    std::vector<std::thread*> m_threads;
-    /** @brief Job queue */
-    Queue<std::shared_ptr<IJob>> m_job_queue;
-
-    /** @brief Worker thread */
-    void workerThread();
+    /** @brief Executor running the jobs */
+    std::unique_ptr<WorkStealingExecutor> m_executor;
 };
 
 } // namespace helpers
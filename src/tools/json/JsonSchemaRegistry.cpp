@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JsonSchemaRegistry.h"
+
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Mutex to protect concurrent access to the loaded schemas */
+static std::mutex s_schemas_mutex;
+/** @brief Loaded schemas indexed by file path */
+static std::unordered_map<std::string, std::shared_ptr<const rapidjson::SchemaDocument>> s_schemas;
+/** @brief Loaded schema trees indexed by file path (nullptr if the schema cannot be represented as a tree) */
+static std::unordered_map<std::string, std::shared_ptr<const JsonSchemaTree>> s_trees;
+
+/** @brief Get the compiled schema corresponding to a JSON schema file */
+std::shared_ptr<const rapidjson::SchemaDocument> JsonSchemaRegistry::get(const std::string& schema_file)
+{
+    std::shared_ptr<const rapidjson::SchemaDocument> schema;
+
+    // The lock is held during the loading so that simultaneous requests
+    // for the same schema (reconnection storm) lead to a single load
+    std::lock_guard<std::mutex> lock(s_schemas_mutex);
+    auto                        it = s_schemas.find(schema_file);
+    if (it != s_schemas.end())
+    {
+        schema = it->second;
+    }
+    else
+    {
+        schema = load(schema_file);
+        if (schema)
+        {
+            s_schemas[schema_file] = schema;
+        }
+    }
+
+    return schema;
+}
+
+/** @brief Get the tree representation of a JSON schema file used by the single pass decoders */
+std::shared_ptr<const JsonSchemaTree> JsonSchemaRegistry::getTree(const std::string& schema_file)
+{
+    std::lock_guard<std::mutex> lock(s_schemas_mutex);
+    auto                        it = s_trees.find(schema_file);
+    if (it == s_trees.end())
+    {
+        // Schemas which cannot be represented are also cached to avoid reading them again
+        it = s_trees.emplace(schema_file, loadTree(schema_file)).first;
+    }
+    return it->second;
+}
+
+/** @brief Get the number of schemas currently loaded */
+size_t JsonSchemaRegistry::size()
+{
+    std::lock_guard<std::mutex> lock(s_schemas_mutex);
+    return s_schemas.size();
+}
+
+/** @brief Release all the loaded schemas */
+void JsonSchemaRegistry::clear()
+{
+    std::lock_guard<std::mutex> lock(s_schemas_mutex);
+    s_schemas.clear();
+    s_trees.clear();
+}
+
+/** @brief Load and compile a JSON schema file */
+std::shared_ptr<const rapidjson::SchemaDocument> JsonSchemaRegistry::load(const std::string& schema_file)
+{
+    std::shared_ptr<const rapidjson::SchemaDocument> schema;
+
+    rapidjson::Document schema_doc;
+    if (read(schema_file, schema_doc))
+    {
+        // Compile schema
+        schema = std::make_shared<const rapidjson::SchemaDocument>(schema_doc);
+    }
+
+    return schema;
+}
+
+/** @brief Load a JSON schema file and build its tree representation */
+std::shared_ptr<const JsonSchemaTree> JsonSchemaRegistry::loadTree(const std::string& schema_file)
+{
+    std::shared_ptr<JsonSchemaTree> tree;
+
+    rapidjson::Document schema_doc;
+    if (read(schema_file, schema_doc))
+    {
+        std::string error;
+        tree = std::make_shared<JsonSchemaTree>();
+        if (!tree->init(schema_doc, error))
+        {
+            tree.reset();
+        }
+    }
+
+    return tree;
+}
+
+/** @brief Read and parse a JSON schema file */
+bool JsonSchemaRegistry::read(const std::string& schema_file, rapidjson::Document& schema_doc)
+{
+    bool ret = false;
+
+    // Open schema file
+    std::ifstream file;
+    file.open(schema_file);
+    if (!file.fail())
+    {
+        // Read the whole file
+        std::string     json;
+        char            buffer[256u];
+        std::streamsize size;
+        do
+        {
+            size         = file.readsome(buffer, sizeof(buffer) - 1u);
+            buffer[size] = 0;
+            json.append(buffer);
+        } while (size != 0);
+
+        // Parse JSON schema
+        schema_doc.Parse(json.c_str());
+        ret = (schema_doc.GetParseError() == rapidjson::ParseErrorCode::kParseErrorNone);
+    }
+
+    return ret;
+}
+
+} // namespace json
+} // namespace ocpp
@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JSONSCHEMAREGISTRY_H
+#define JSONSCHEMAREGISTRY_H
+
+#include "JsonSchemaTree.h"
+#include "json.h"
+
+#include <memory>
+#include <string>
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Process-wide cache of the compiled JSON schemas
+ *
+ *  Each schema file is read and compiled only once, the resulting schema document
+ *  is immutable and shared between all the validators which are using it
+ */
+class JsonSchemaRegistry
+{
+  public:
+    /** @brief Get the compiled schema corresponding to a JSON schema file,
+     *         the schema is loaded on first use
+     *  @param schema_file Path to the JSON schema file
+     *  @return Compiled schema if the file is a valid JSON schema, nullptr otherwise
+     */
+    static std::shared_ptr<const rapidjson::SchemaDocument> get(const std::string& schema_file);
+
+    /** @brief Get the tree representation of a JSON schema file used by the single pass decoders,
+     *         the tree is built on first use
+     *  @param schema_file Path to the JSON schema file
+     *  @return Tree representation if the file is a valid JSON schema using only the supported keywords, nullptr otherwise
+     */
+    static std::shared_ptr<const JsonSchemaTree> getTree(const std::string& schema_file);
+
+    /** @brief Get the number of schemas currently loaded */
+    static size_t size();
+
+    /** @brief Release all the loaded schemas and schema trees (schemas still in use stay valid until they are released by their users) */
+    static void clear();
+
+  private:
+    /** @brief Load and compile a JSON schema file */
+    static std::shared_ptr<const rapidjson::SchemaDocument> load(const std::string& schema_file);
+    /** @brief Load a JSON schema file and build its tree representation */
+    static std::shared_ptr<const JsonSchemaTree> loadTree(const std::string& schema_file);
+    /** @brief Read and parse a JSON schema file */
+    static bool read(const std::string& schema_file, rapidjson::Document& schema_doc);
+};
+
+} // namespace json
+} // namespace ocpp
+
+#endif // JSONSCHEMAREGISTRY_H
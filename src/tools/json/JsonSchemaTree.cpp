@@ -0,0 +1,346 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JsonSchemaTree.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Constructor */
+JsonSchemaTree::JsonSchemaTree() : m_nodes() { }
+
+/** @brief Destructor */
+JsonSchemaTree::~JsonSchemaTree() { }
+
+/** @brief Build the tree from a JSON schema */
+bool JsonSchemaTree::init(const rapidjson::Value& schema, std::string& error)
+{
+    m_nodes.clear();
+    bool ret = (build(schema, error) != nullptr);
+    if (!ret)
+    {
+        m_nodes.clear();
+    }
+    return ret;
+}
+
+/** @brief Build the node corresponding to a schema */
+const JsonSchemaTree::Node* JsonSchemaTree::build(const rapidjson::Value& schema, std::string& error)
+{
+    if (!schema.IsObject())
+    {
+        error = "Schema is not an object";
+        return nullptr;
+    }
+
+    m_nodes.emplace_back();
+    Node& node = m_nodes.back();
+
+    // Type of the value
+    auto it = schema.FindMember("type");
+    if (it != schema.MemberEnd())
+    {
+        if (!it->value.IsString())
+        {
+            error = "Unsupported type definition";
+            return nullptr;
+        }
+        std::string type = it->value.GetString();
+        if (type == "null")
+        {
+            node.types = NullType;
+        }
+        else if (type == "boolean")
+        {
+            node.types = BooleanType;
+        }
+        else if (type == "integer")
+        {
+            node.types = IntegerType;
+        }
+        else if (type == "number")
+        {
+            node.types = NumberType | IntegerType;
+        }
+        else if (type == "string")
+        {
+            node.types = StringType;
+        }
+        else if (type == "array")
+        {
+            node.types = ArrayType;
+        }
+        else if (type == "object")
+        {
+            node.types = ObjectType;
+        }
+        else
+        {
+            error = "Unknown type : " + type;
+            return nullptr;
+        }
+    }
+
+    for (auto& member : schema.GetObject())
+    {
+        std::string keyword = member.name.GetString();
+        if (keyword == "type")
+        {
+            // Already handled
+        }
+        else if (keyword == "properties")
+        {
+            if (!member.value.IsObject() || (member.value.MemberCount() > MAX_PROPERTIES))
+            {
+                error = "Unsupported properties definition";
+                return nullptr;
+            }
+            for (auto& property : member.value.GetObject())
+            {
+                const Node* property_node = build(property.value, error);
+                if (!property_node)
+                {
+                    return nullptr;
+                }
+                node.properties.push_back({property.name.GetString(), property_node, false});
+            }
+        }
+        else if (keyword == "additionalProperties")
+        {
+            // Only meaningful for objects, the OCPP schemas also use it on strings
+            if (!member.value.IsBool())
+            {
+                error = "Unsupported additionalProperties definition";
+                return nullptr;
+            }
+            node.additional_properties = member.value.GetBool();
+        }
+        else if (keyword == "required")
+        {
+            // Handled once all the properties are known
+            if (!member.value.IsArray())
+            {
+                error = "Unsupported required definition";
+                return nullptr;
+            }
+        }
+        else if (keyword == "items")
+        {
+            const Node* items_node = build(member.value, error);
+            if (!items_node)
+            {
+                return nullptr;
+            }
+            node.items = items_node;
+        }
+        else if (keyword == "additionalItems")
+        {
+            // Only meaningful when the items are described with an array of schemas which is not supported
+            if (!member.value.IsBool())
+            {
+                error = "Unsupported additionalItems definition";
+                return nullptr;
+            }
+        }
+        else if (keyword == "minItems")
+        {
+            if (!member.value.IsUint())
+            {
+                error = "Unsupported minItems definition";
+                return nullptr;
+            }
+            node.min_items = member.value.GetUint();
+        }
+        else if (keyword == "maxLength")
+        {
+            // Ignored when not an unsigned integer as done by the JSON schema validator (the OCPP schemas
+            // sometimes define it as a string)
+            if (member.value.IsUint())
+            {
+                node.max_length = member.value.GetUint();
+            }
+        }
+        else if (keyword == "multipleOf")
+        {
+            if (!member.value.IsNumber() || (member.value.GetDouble() <= 0.))
+            {
+                error = "Unsupported multipleOf definition";
+                return nullptr;
+            }
+            node.multiple_of = member.value.GetDouble();
+        }
+        else if (keyword == "enum")
+        {
+            if (!member.value.IsArray())
+            {
+                error = "Unsupported enum definition";
+                return nullptr;
+            }
+            for (auto& value : member.value.GetArray())
+            {
+                if (!value.IsString())
+                {
+                    error = "Only string enums are supported";
+                    return nullptr;
+                }
+                node.enum_values.emplace_back(value.GetString(), value.GetStringLength());
+            }
+        }
+        else if ((keyword == "$schema") || (keyword == "id") || (keyword == "title") || (keyword == "description") ||
+                 (keyword == "comment") || (keyword == "format"))
+        {
+            // Annotations, not used for validation
+        }
+        else
+        {
+            error = "Unsupported keyword : " + keyword;
+            return nullptr;
+        }
+    }
+
+    // Required properties, the ones which are not listed in the properties can be of any type
+    it = schema.FindMember("required");
+    if (it != schema.MemberEnd())
+    {
+        for (auto& required : it->value.GetArray())
+        {
+            if (!required.IsString())
+            {
+                error = "Unsupported required definition";
+                return nullptr;
+            }
+            int index = node.findProperty(required.GetString(), required.GetStringLength());
+            if (index < 0)
+            {
+                if (node.properties.size() == MAX_PROPERTIES)
+                {
+                    error = "Too many properties";
+                    return nullptr;
+                }
+                m_nodes.emplace_back();
+                node.properties.push_back({required.GetString(), &m_nodes.back(), false});
+                index = static_cast<int>(node.properties.size() - 1u);
+            }
+            node.properties[index].required = true;
+            node.required_mask |= (static_cast<uint64_t>(1u) << index);
+        }
+    }
+
+    return &node;
+}
+
+/** @brief Look for a property */
+int JsonSchemaTree::Node::findProperty(const char* name, size_t length) const
+{
+    for (size_t i = 0; i < properties.size(); i++)
+    {
+        const std::string& property = properties[i].name;
+        if ((property.size() == length) && (memcmp(property.c_str(), name, length) == 0))
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/** @brief Check if a value is a multiple of a divisor (same check as the rapidjson validator) */
+static bool isMultipleOf(double value, double divisor)
+{
+    double a = std::abs(value);
+    double q = std::floor(a / divisor);
+    double r = a - q * divisor;
+    return (r <= 0.);
+}
+
+/** @brief Check an integer value against the schema */
+const char* JsonSchemaTree::Node::checkInteger(int64_t value) const
+{
+    if ((types & (IntegerType | NumberType)) == 0)
+    {
+        return "type";
+    }
+    if ((multiple_of != 0.) && !isMultipleOf(static_cast<double>(value), multiple_of))
+    {
+        return "multipleOf";
+    }
+    return nullptr;
+}
+
+/** @brief Check a floating point value against the schema */
+const char* JsonSchemaTree::Node::checkNumber(double value) const
+{
+    if ((types & NumberType) == 0)
+    {
+        return "type";
+    }
+    if ((multiple_of != 0.) && !isMultipleOf(value, multiple_of))
+    {
+        return "multipleOf";
+    }
+    return nullptr;
+}
+
+/** @brief Check a string value against the schema */
+const char* JsonSchemaTree::Node::checkString(const char* value, size_t length) const
+{
+    if ((types & StringType) == 0)
+    {
+        return "type";
+    }
+    if (max_length != SIZE_MAX)
+    {
+        // The length is expressed in characters : count the UTF-8 code points
+        size_t count = 0;
+        for (size_t i = 0; (i < length) && (count <= max_length); i++)
+        {
+            if ((static_cast<unsigned char>(value[i]) & 0xC0u) != 0x80u)
+            {
+                count++;
+            }
+        }
+        if (count > max_length)
+        {
+            return "maxLength";
+        }
+    }
+    if (!enum_values.empty())
+    {
+        bool found = false;
+        for (const std::string& enum_value : enum_values)
+        {
+            if ((enum_value.size() == length) && (memcmp(enum_value.c_str(), value, length) == 0))
+            {
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            return "enum";
+        }
+    }
+    return nullptr;
+}
+
+} // namespace json
+} // namespace ocpp
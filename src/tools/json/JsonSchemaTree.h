@@ -0,0 +1,159 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JSONSCHEMATREE_H
+#define JSONSCHEMATREE_H
+
+#include "json.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Tree representation of a JSON schema to validate a JSON value while walking through it (SAX events)
+ *
+ *  Only the keywords used by the OCPP schemas are supported : type, properties, additionalProperties,
+ *  required, items, additionalItems, minItems, enum, maxLength and multipleOf. Annotations (title, format, ...) are ignored
+ *  as in the rapidjson validator, and schemas using any other keyword are rejected
+ */
+class JsonSchemaTree
+{
+  public:
+    /** @brief Maximum number of properties of an object */
+    static constexpr size_t MAX_PROPERTIES = 64u;
+
+    /** @brief JSON types (bitmask) */
+    enum Type : unsigned int
+    {
+        /** @brief null */
+        NullType = 0x01u,
+        /** @brief boolean */
+        BooleanType = 0x02u,
+        /** @brief integer */
+        IntegerType = 0x04u,
+        /** @brief number (includes integer) */
+        NumberType = 0x08u,
+        /** @brief string */
+        StringType = 0x10u,
+        /** @brief array */
+        ArrayType = 0x20u,
+        /** @brief object */
+        ObjectType = 0x40u,
+        /** @brief Any type */
+        AnyType = 0x7Fu
+    };
+
+    // Forward declaration
+    struct Node;
+
+    /** @brief Property of an object */
+    struct Property
+    {
+        /** @brief Name */
+        std::string name;
+        /** @brief Schema of the property's value */
+        const Node* node;
+        /** @brief Indicate if the property is required */
+        bool required;
+    };
+
+    /** @brief Schema of a JSON value */
+    struct Node
+    {
+        /** @brief Allowed types */
+        unsigned int types = AnyType;
+        /** @brief Properties (object) */
+        std::vector<Property> properties;
+        /** @brief Mask of the required properties (object) */
+        uint64_t required_mask = 0;
+        /** @brief Indicate if properties which are not listed are allowed (object) */
+        bool additional_properties = true;
+        /** @brief Schema of the items (array, nullptr = any value) */
+        const Node* items = nullptr;
+        /** @brief Minimum number of items (array) */
+        size_t min_items = 0;
+        /** @brief Maximum length in characters (string) */
+        size_t max_length = SIZE_MAX;
+        /** @brief Allowed values (string, empty = any value) */
+        std::vector<std::string> enum_values;
+        /** @brief Divisor of the value (number, 0 = none) */
+        double multiple_of = 0.;
+
+        /**
+         * @brief Look for a property
+         * @param name Name of the property
+         * @param length Length of the name
+         * @return Index of the property if found, -1 otherwise
+         */
+        int findProperty(const char* name, size_t length) const;
+        /**
+         * @brief Check an integer value against the schema
+         * @param value Value to check
+         * @return Invalid keyword if the value is invalid, nullptr otherwise
+         */
+        const char* checkInteger(int64_t value) const;
+        /**
+         * @brief Check a floating point value against the schema
+         * @param value Value to check
+         * @return Invalid keyword if the value is invalid, nullptr otherwise
+         */
+        const char* checkNumber(double value) const;
+        /**
+         * @brief Check a string value against the schema
+         * @param value Value to check
+         * @param length Length in bytes of the value
+         * @return Invalid keyword if the value is invalid, nullptr otherwise
+         */
+        const char* checkString(const char* value, size_t length) const;
+    };
+
+    /** @brief Constructor */
+    JsonSchemaTree();
+
+    /** @brief Destructor */
+    virtual ~JsonSchemaTree();
+
+    /**
+     * @brief Build the tree from a JSON schema
+     * @param schema JSON schema
+     * @param error Error message if the schema cannot be represented
+     * @return true if the tree has been built, false otherwise
+     */
+    bool init(const rapidjson::Value& schema, std::string& error);
+
+    /** @brief Get the schema of the root value */
+    const Node* root() const { return (m_nodes.empty() ? nullptr : &m_nodes.front()); }
+
+  private:
+    /** @brief Nodes (their address does not change when new nodes are added) */
+    std::deque<Node> m_nodes;
+
+    /** @brief Build the node corresponding to a schema */
+    const Node* build(const rapidjson::Value& schema, std::string& error);
+};
+
+} // namespace json
+} // namespace ocpp
+
+#endif // JSONSCHEMATREE_H
@@ -17,8 +17,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "JsonValidator.h"
+#include "JsonSchemaRegistry.h"
 
-#include <fstream>
+#include <unordered_map>
 
 namespace ocpp
 {
@@ -26,7 +27,7 @@ namespace json
 {
 
 /** @brief Constructor */
-JsonValidator::JsonValidator() : m_schema(nullptr), m_validator(nullptr), m_last_error() { }
+JsonValidator::JsonValidator() : m_schema(), m_last_error() { }
 
 /** @brief Destructor */
 JsonValidator::~JsonValidator() { }
@@ -36,34 +37,12 @@ bool JsonValidator::init(const std::string& schema_file)
 {
     bool ret = false;
 
-    // Open schema file
-    std::ifstream file;
-    file.open(schema_file);
-    if (!file.fail())
+    // Get the compiled schema
+    m_schema = JsonSchemaRegistry::get(schema_file);
+    if (m_schema)
     {
-        // Read the whole file
-        std::string     json;
-        char            buffer[256u];
-        std::streamsize size;
-        do
-        {
-            size         = file.readsome(buffer, sizeof(buffer) - 1u);
-            buffer[size] = 0;
-            json.append(buffer);
-        } while (size != 0);
-
-        // Parse JSON schema
-        rapidjson::Document schema_doc;
-        schema_doc.Parse(json.c_str());
-        rapidjson::ParseErrorCode error = schema_doc.GetParseError();
-        if (error == rapidjson::ParseErrorCode ::kParseErrorNone)
-        {
-            // Instanciate validator
-            m_schema     = std::make_unique<rapidjson::SchemaDocument>(schema_doc);
-            m_validator  = std::make_unique<rapidjson::SchemaValidator>(*(m_schema.get()));
-            m_last_error = "";
-            ret          = true;
-        }
+        m_last_error = "";
+        ret          = true;
     }
 
     return ret;
@@ -74,13 +53,31 @@ bool JsonValidator::isValid(const rapidjson::Value& json_document)
 {
     bool ret = false;
 
-    if (m_validator.get())
+    if (m_schema)
     {
-        m_validator->Reset();
-        ret = json_document.Accept((*(m_validator.get())));
+        // Schema validators are not thread safe and hold a state during
+        // validation : each thread uses its own validator for each schema
+        struct ThreadValidator
+        {
+            std::weak_ptr<const rapidjson::SchemaDocument> schema;
+            std::unique_ptr<rapidjson::SchemaValidator>    validator;
+        };
+        thread_local std::unordered_map<const rapidjson::SchemaDocument*, ThreadValidator> thread_validators;
+
+        ThreadValidator& thread_validator = thread_validators[m_schema.get()];
+        if (thread_validator.schema.expired())
+        {
+            // New schema or schema which has been released and whose address is reused
+            thread_validator.schema    = m_schema;
+            thread_validator.validator = std::make_unique<rapidjson::SchemaValidator>(*m_schema);
+        }
+        rapidjson::SchemaValidator& validator = *thread_validator.validator;
+
+        validator.Reset();
+        ret = json_document.Accept(validator);
         if (!ret)
         {
-            const char* invalid_keyword = m_validator->GetInvalidSchemaKeyword();
+            const char* invalid_keyword = validator.GetInvalidSchemaKeyword();
             if (invalid_keyword)
             {
                 m_last_error = "Error on keyword : " + std::string(invalid_keyword);
@@ -38,7 +38,8 @@ class JsonValidator
     /** @brief Destructor */
     virtual ~JsonValidator();
 
-    /** @brief Initialize the validator with a specific JSON schema file */
+    /** @brief Initialize the validator with a specific JSON schema file
+     *         (the compiled schema is shared with the other validators using the same file) */
     bool init(const std::string& schema_file);
 
     /** @brief Validate a JSON document according to the schema file */
@@ -48,10 +49,8 @@ class JsonValidator
     const std::string& lastError() const;
 
   private:
-    /** @brief Schema document */
-    std::unique_ptr<rapidjson::SchemaDocument> m_schema;
-    /** @brief Schema validator */
-    std::unique_ptr<rapidjson::SchemaValidator> m_validator;
+    /** @brief Shared schema document */
+    std::shared_ptr<const rapidjson::SchemaDocument> m_schema;
     /** @brief Last error message */
     std::string m_last_error;
 };
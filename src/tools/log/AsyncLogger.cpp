@@ -0,0 +1,352 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AsyncLogger.h"
+#include "LogDatabase.h"
+#include "Logger.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace ocpp
+{
+namespace log
+{
+
+/** @brief Maximum number of records to write to the console and to the databases at once */
+static constexpr size_t MAX_RECORDS_PER_BATCH = 256u;
+/** @brief Maximum time to wait for new records */
+static constexpr std::chrono::milliseconds WAIT_TIMEOUT = std::chrono::milliseconds(50);
+
+/** @brief Indicate if the current thread is the background thread of an asynchronous logger */
+static thread_local bool is_background_thread = false;
+
+/** @brief Constructor */
+AsyncLogger::AsyncLogger()
+    : m_slots(),
+      m_mask(0),
+      m_enqueue_pos(0),
+      m_dequeue_pos(0),
+      m_written(0),
+      m_dropped(0),
+      m_producers(0),
+      m_policy(LogOverflowPolicy::DROP),
+      m_thread(nullptr),
+      m_running(false),
+      m_sleeping(false),
+      m_mutex(),
+      m_wakeup_cond(),
+      m_written_cond()
+{
+}
+
+/** @brief Destructor */
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+/** @brief Start the background thread */
+bool AsyncLogger::start(size_t queue_size, LogOverflowPolicy policy)
+{
+    bool ret = false;
+
+    // Check if the thread is already running
+    if (!m_thread)
+    {
+        // Allocate the ring buffer
+        size_t size = 2u;
+        while (size < queue_size)
+        {
+            size <<= 1u;
+        }
+        if (!m_slots || (size != (m_mask + 1u)))
+        {
+            m_slots.reset(new Slot[size]);
+            for (size_t i = 0; i < size; i++)
+            {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            m_mask        = size - 1u;
+            m_enqueue_pos = 0;
+            m_dequeue_pos = 0;
+            m_written     = 0;
+        }
+        m_policy = policy;
+
+        // Start thread
+        m_running = true;
+        m_thread  = new std::thread(std::bind(&AsyncLogger::process, this));
+        ret       = true;
+    }
+
+    return ret;
+}
+
+/** @brief Stop the background thread after having written all the pending records */
+bool AsyncLogger::stop()
+{
+    bool ret = false;
+
+    // Check if the thread is running
+    if (m_thread)
+    {
+        // Stop thread
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+            m_wakeup_cond.notify_one();
+        }
+        m_thread->join();
+        delete m_thread;
+        m_thread = nullptr;
+
+        // Wait for the producers which were already logging when the thread stopped
+        // to publish their records, then write them
+        while (m_producers != 0)
+        {
+            std::this_thread::yield();
+        }
+        std::string console_output;
+        writeRecords(console_output);
+
+        ret = true;
+    }
+
+    return ret;
+}
+
+/** @brief Queue a log record */
+bool AsyncLogger::log(std::time_t                         timestamp,
+                      unsigned int                        level,
+                      const char*                         level_str,
+                      const char*                         filename,
+                      const char*                         line,
+                      const std::shared_ptr<LogDatabase>& database,
+                      std::string                         message)
+{
+    bool ret = false;
+
+    // Declare the producer before checking the running state so that stop()
+    // waits for the record to be published
+    m_producers++;
+    if (m_running)
+    {
+        // Try to queue the record, the background thread must never wait for itself
+        bool queued = push(timestamp, level, level_str, filename, line, database, message);
+        while (!queued && (m_policy == LogOverflowPolicy::BLOCK) && m_running && !is_background_thread)
+        {
+            std::this_thread::yield();
+            queued = push(timestamp, level, level_str, filename, line, database, message);
+        }
+        if (queued)
+        {
+            // Wake up the background thread only if it is waiting
+            if (m_sleeping)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_wakeup_cond.notify_one();
+            }
+        }
+        else
+        {
+            m_dropped++;
+        }
+        ret = true;
+    }
+    m_producers--;
+
+    return ret;
+}
+
+/** @brief Wait until all the records queued before the call have been written */
+void AsyncLogger::flush()
+{
+    if (m_running && !is_background_thread)
+    {
+        size_t                       target = m_enqueue_pos;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeup_cond.notify_one();
+        m_written_cond.wait(lock, [this, target] { return (m_written >= target) || !m_running; });
+    }
+}
+
+/** @brief Try to queue a record */
+bool AsyncLogger::push(std::time_t                         timestamp,
+                       unsigned int                        level,
+                       const char*                         level_str,
+                       const char*                         filename,
+                       const char*                         line,
+                       const std::shared_ptr<LogDatabase>& database,
+                       std::string&                        message)
+{
+    // Reserve a slot
+    Slot*  slot = nullptr;
+    size_t pos  = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (!slot)
+    {
+        Slot*     candidate = &m_slots[pos & m_mask];
+        size_t    sequence  = candidate->sequence.load(std::memory_order_acquire);
+        ptrdiff_t diff      = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+        if (diff == 0)
+        {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+            {
+                slot = candidate;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Queue is full
+            return false;
+        }
+        else
+        {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Fill the record and publish it
+    Record& record   = slot->record;
+    record.timestamp = timestamp;
+    record.level     = level;
+    record.level_str = level_str;
+    record.filename  = filename;
+    record.line      = line;
+    record.database  = database;
+    record.message.assign(message);
+    slot->sequence.store(pos + 1u, std::memory_order_release);
+
+    return true;
+}
+
+/** @brief Write all the queued records */
+size_t AsyncLogger::writeRecords(std::string& console_output)
+{
+    size_t                          count = 0;
+    std::string                     file_line;
+    bool                            empty = false;
+    std::vector<LogDatabase::Entry> entries;
+    std::shared_ptr<LogDatabase>    entries_database;
+    while (!empty)
+    {
+        // Get the next record
+        Slot&  slot     = m_slots[m_dequeue_pos & m_mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        empty           = (sequence != (m_dequeue_pos + 1u));
+        if (!empty)
+        {
+            Record& record = slot.record;
+
+            // Console
+            char    date[32];
+            std::tm now_tm;
+            localtime_r(&record.timestamp, &now_tm);
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%T", &now_tm);
+            file_line.assign(record.filename);
+            file_line += ":";
+            file_line += record.line;
+            console_output += record.level_str;
+            console_output += " - [";
+            console_output += date;
+            console_output += "] - ";
+            console_output += file_line;
+            console_output += " - ";
+            console_output += record.message;
+            console_output += '\n';
+
+            // Database, the consecutive inserts of a batch into the same database are grouped in a single transaction
+            if (record.database)
+            {
+                if (record.database != entries_database)
+                {
+                    if (entries_database)
+                    {
+                        entries_database->log(entries);
+                        entries.clear();
+                    }
+                    entries_database = record.database;
+                }
+                entries.push_back({record.timestamp, record.level, file_line, std::move(record.message)});
+                record.database.reset();
+            }
+
+            // Release the slot
+            slot.sequence.store(m_dequeue_pos + m_mask + 1u, std::memory_order_release);
+            m_dequeue_pos++;
+            count++;
+        }
+
+        // Write the console output and the database inserts by batches
+        if (empty || ((count % MAX_RECORDS_PER_BATCH) == 0))
+        {
+            if (entries_database)
+            {
+                entries_database->log(entries);
+                entries.clear();
+                entries_database.reset();
+            }
+            if (!console_output.empty())
+            {
+                LOG_OUTPUT << console_output << std::flush;
+                console_output.clear();
+            }
+        }
+    }
+
+    // Notify flush requests
+    if (count != 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_written = m_dequeue_pos;
+        m_written_cond.notify_all();
+    }
+
+    return count;
+}
+
+/** @brief Background thread */
+void AsyncLogger::process()
+{
+    is_background_thread = true;
+
+    std::string console_output;
+    while (m_running)
+    {
+        if (writeRecords(console_output) == 0)
+        {
+            // Wait for new records
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_sleeping = true;
+            Slot& slot = m_slots[m_dequeue_pos & m_mask];
+            if (m_running && (slot.sequence.load(std::memory_order_acquire) != (m_dequeue_pos + 1u)))
+            {
+                m_wakeup_cond.wait_for(lock, WAIT_TIMEOUT);
+            }
+            m_sleeping = false;
+        }
+    }
+
+    // Write the last records
+    writeRecords(console_output);
+}
+
+} // namespace log
+} // namespace ocpp
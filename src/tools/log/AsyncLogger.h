@@ -0,0 +1,178 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ASYNCLOGGER_H
+#define ASYNCLOGGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ocpp
+{
+namespace log
+{
+
+class LogDatabase;
+
+/** @brief Behavior of the asynchronous logger when its queue is full */
+enum class LogOverflowPolicy
+{
+    /** @brief The log record is dropped and counted */
+    DROP,
+    /** @brief The producer waits until there is room in the queue */
+    BLOCK
+};
+
+/**
+ * @brief Asynchronous log backend
+ *        Producers push their records in a bounded lock-free ring buffer (multiple producers, single consumer)
+ *        and a background thread writes them by batches to the console and to the log databases
+ */
+class AsyncLogger
+{
+  public:
+    /** @brief Constructor */
+    AsyncLogger();
+    /** @brief Destructor */
+    virtual ~AsyncLogger();
+
+    /**
+     * @brief Start the background thread
+     * @param queue_size Number of records in the queue (rounded up to the next power of 2)
+     * @param policy Behavior when the queue is full
+     * @return true if the background thread has been started, false otherwise
+     */
+    bool start(size_t queue_size, LogOverflowPolicy policy);
+
+    /**
+     * @brief Stop the background thread after having written all the pending records
+     * @return true if the background thread has been stopped, false otherwise
+     */
+    bool stop();
+
+    /** @brief Indicate if the background thread is running */
+    bool isRunning() const { return m_running; }
+
+    /**
+     * @brief Queue a log record
+     * @param timestamp Timestamp in UNIX format of the record
+     * @param level Log level
+     * @param level_str Log level string
+     * @param filename File which generated the log (must have a static storage duration)
+     * @param line Code line which generated the log (must have a static storage duration)
+     * @param database Database to store the record (can be nullptr)
+     * @param message Log message
+     * @return true if the record has been queued or dropped, false if the background thread is not running
+     */
+    bool log(std::time_t                         timestamp,
+             unsigned int                        level,
+             const char*                         level_str,
+             const char*                         filename,
+             const char*                         line,
+             const std::shared_ptr<LogDatabase>& database,
+             std::string                         message);
+
+    /** @brief Wait until all the records queued before the call have been written */
+    void flush();
+
+    /** @brief Number of records dropped because the queue was full */
+    uint64_t droppedRecords() const { return m_dropped; }
+
+  private:
+    /** @brief Log record */
+    struct Record
+    {
+        /** @brief Timestamp in UNIX format */
+        std::time_t timestamp;
+        /** @brief Log level */
+        unsigned int level;
+        /** @brief Log level string */
+        const char* level_str;
+        /** @brief File name */
+        const char* filename;
+        /** @brief Code line */
+        const char* line;
+        /** @brief Log database */
+        std::shared_ptr<LogDatabase> database;
+        /** @brief Log message */
+        std::string message;
+    };
+
+    /** @brief Slot of the ring buffer */
+    struct Slot
+    {
+        /** @brief Sequence number used to synchronize producers and consumer */
+        std::atomic<size_t> sequence;
+        /** @brief Record */
+        Record record;
+    };
+
+    /** @brief Ring buffer */
+    std::unique_ptr<Slot[]> m_slots;
+    /** @brief Mask to compute the index of a slot from a position */
+    size_t m_mask;
+    /** @brief Next position to write */
+    alignas(64) std::atomic<size_t> m_enqueue_pos;
+    /** @brief Next position to read (only accessed by the consumer) */
+    alignas(64) size_t m_dequeue_pos;
+    /** @brief Number of records written */
+    std::atomic<size_t> m_written;
+    /** @brief Number of records dropped */
+    std::atomic<uint64_t> m_dropped;
+    /** @brief Number of producers currently queuing a record */
+    std::atomic<size_t> m_producers;
+    /** @brief Behavior when the queue is full */
+    LogOverflowPolicy m_policy;
+
+    /** @brief Background thread */
+    std::thread* m_thread;
+    /** @brief Indicate if the background thread is running */
+    std::atomic<bool> m_running;
+    /** @brief Indicate that the background thread is waiting for records */
+    std::atomic<bool> m_sleeping;
+    /** @brief Mutex for the wake up of the background thread and the flush requests */
+    std::mutex m_mutex;
+    /** @brief Condition to wake up the background thread */
+    std::condition_variable m_wakeup_cond;
+    /** @brief Condition to signal that records have been written */
+    std::condition_variable m_written_cond;
+
+    /** @brief Try to queue a record */
+    bool push(std::time_t                         timestamp,
+              unsigned int                        level,
+              const char*                         level_str,
+              const char*                         filename,
+              const char*                         line,
+              const std::shared_ptr<LogDatabase>& database,
+              std::string&                        message);
+    /** @brief Write all the queued records */
+    size_t writeRecords(std::string& console_output);
+    /** @brief Background thread */
+    void process();
+};
+
+} // namespace log
+} // namespace ocpp
+
+#endif // ASYNCLOGGER_H
@@ -17,7 +17,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "LogDatabase.h"
+#include "Logger.h"
 
+#include <filesystem>
 #include <sstream>
 
 using namespace ocpp::database;
@@ -29,7 +31,7 @@ namespace log
 
 /** @brief Constructor */
 LogDatabase::LogDatabase(ocpp::database::Database& database, const std::string& table_name, unsigned int max_entries)
-    : m_database(database), m_insert_query()
+    : m_database(database), m_mutex(), m_insert_query()
 {
     initDatabaseTable(table_name, max_entries);
 }
@@ -40,6 +42,7 @@ LogDatabase::~LogDatabase() { }
 /** @brief Add a log entry */
 void LogDatabase::log(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_insert_query)
     {
         m_insert_query->reset();
@@ -51,6 +54,57 @@ void LogDatabase::log(std::time_t timestamp, unsigned int level, const std::stri
     }
 }
 
+/** @brief Add log entries in a single transaction */
+void LogDatabase::log(const std::vector<Entry>& entries)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_insert_query)
+    {
+        Database::Transaction transaction(m_database);
+        for (const auto& entry : entries)
+        {
+            m_insert_query->reset();
+            m_insert_query->bind(0, entry.timestamp);
+            m_insert_query->bind(1, entry.level);
+            m_insert_query->bind(2, entry.file);
+            m_insert_query->bind(3, entry.message);
+            m_insert_query->exec();
+        }
+        transaction.commit();
+    }
+}
+
+/** @brief Close the log database */
+void LogDatabase::close()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_insert_query.reset();
+}
+
+/** @brief Get the path of the log database of a stack */
+std::string LogDatabase::path(const std::string& database_path, const std::string& log_database_path)
+{
+    std::string ret = log_database_path;
+
+    // The logs must not be stored in the stack's database since they would be blocked by its transactions
+    std::filesystem::path db_path(database_path);
+    std::error_code       error;
+    if (!ret.empty() && std::filesystem::absolute(db_path, error).lexically_normal() ==
+                            std::filesystem::absolute(std::filesystem::path(ret), error).lexically_normal())
+    {
+        LOG_ERROR << "The log database must not be the stack's database, using the default log database path instead";
+        ret.clear();
+    }
+    if (ret.empty() && !database_path.empty())
+    {
+        std::filesystem::path log_path = db_path;
+        log_path.replace_filename(db_path.stem().string() + "_logs" + db_path.extension().string());
+        ret = log_path.string();
+    }
+
+    return ret;
+}
+
 /** @brief Initialize the database table */
 void LogDatabase::initDatabaseTable(const std::string& table_name, unsigned int max_entries)
 {
@@ -69,10 +123,21 @@ void LogDatabase::initDatabaseTable(const std::string& table_name, unsigned int
     {
         query->exec();
     }
+
+    // Rotation : since ids are strictly increasing, only the entries older than the last max_entries ids
+    // are removed on each insert which is done through the primary key index in constant time whatever
+    // the size of the table (the trigger is re-created to replace the one of previous versions and
+    // to take into account a change of the maximum number of entries)
+    std::stringstream drop_trigger_query;
+    drop_trigger_query << "DROP TRIGGER IF EXISTS delete_oldest_" << table_name << ";";
+    query = m_database.query(drop_trigger_query.str());
+    if (query.get())
+    {
+        query->exec();
+    }
     std::stringstream trigger_query;
-    trigger_query << "CREATE TRIGGER delete_oldest_" << table_name << " AFTER INSERT ON " << table_name << " WHEN ((SELECT count() FROM "
-                  << table_name << ") > " << max_entries << ") BEGIN DELETE FROM " << table_name << " WHERE ROWID IN (SELECT ROWID FROM "
-                  << table_name << " LIMIT 1);END;";
+    trigger_query << "CREATE TRIGGER delete_oldest_" << table_name << " AFTER INSERT ON " << table_name << " BEGIN DELETE FROM "
+                  << table_name << " WHERE [id] <= (NEW.[id] - " << max_entries << ");END;";
     query = m_database.query(trigger_query.str());
     if (query.get())
     {
@@ -22,6 +22,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Database.h"
 
 #include <chrono>
+#include <mutex>
+#include <vector>
 
 namespace ocpp
 {
@@ -32,6 +34,19 @@ namespace log
 class LogDatabase
 {
   public:
+    /** @brief Log entry */
+    struct Entry
+    {
+        /** @brief Timestamp in UNIX format */
+        std::time_t timestamp;
+        /** @brief Log level */
+        unsigned int level;
+        /** @brief File which generated the log */
+        std::string file;
+        /** @brief Log message */
+        std::string message;
+    };
+
     /** @brief Constructor */
     LogDatabase(ocpp::database::Database& database, const std::string& table_name, unsigned int max_entries);
 
@@ -47,9 +62,36 @@ class LogDatabase
      */
     void log(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message);
 
+    /**
+     * @brief Add log entries in a single transaction
+     * @param entries Log entries
+     */
+    void log(const std::vector<Entry>& entries);
+
+    /**
+     * @brief Get the database storing the logs
+     * @return Database storing the logs
+     */
+    ocpp::database::Database& database() { return m_database; }
+
+    /** @brief Close the log database : the database storing the logs won't be accessed anymore and the next entries are ignored */
+    void close();
+
+    /**
+     * @brief Get the path of the log database of a stack
+     *        (when it is not configured or when it is the path of the stack's database, the logs are stored
+     *        next to the stack's database in a file with the same name and a "_logs" suffix)
+     * @param database_path Path to the stack's database
+     * @param log_database_path Configured path to the log database
+     * @return Path of the log database
+     */
+    static std::string path(const std::string& database_path, const std::string& log_database_path);
+
   private:
     /** @brief Database to store the logs */
     ocpp::database::Database& m_database;
+    /** @brief Mutex to protect the accesses to the database */
+    std::mutex m_mutex;
 
     /** @brief Query to insert a log */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
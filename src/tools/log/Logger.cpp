@@ -29,24 +29,29 @@ namespace log
 {
 
 /** @brief Loggers */
-std::map<std::string, std::unique_ptr<LogDatabase>> Logger::m_loggers;
+std::map<std::string, std::shared_ptr<LogDatabase>> Logger::m_loggers;
+/** @brief Mutex to protect the loggers */
+std::mutex Logger::m_loggers_mutex;
 /** @brief Default logger */
-LogDatabase* Logger::m_default_logger = nullptr;
+std::shared_ptr<LogDatabase> Logger::m_default_logger;
+/** @brief Asynchronous logger (must be destroyed before the loggers to write its pending logs) */
+AsyncLogger Logger::m_async_logger;
 
 /** @brief Constructor with default logger */
 Logger::Logger(const char* level_str, unsigned int level, const char* filename, const char* line)
-    : m_log_output(), m_log_database(m_default_logger), m_level_str(level_str), m_level(level), m_filename(filename), m_line(line)
+    : m_log_output(), m_log_database(std::atomic_load(&m_default_logger)), m_level_str(level_str), m_level(level), m_filename(filename), m_line(line)
 {
 }
 
 /** @brief Constructor */
 Logger::Logger(const char* name, const char* level_str, unsigned int level, const char* filename, const char* line)
-    : m_log_output(), m_log_database(nullptr), m_level_str(level_str), m_level(level), m_filename(filename), m_line(line)
+    : m_log_output(), m_log_database(), m_level_str(level_str), m_level(level), m_filename(filename), m_line(line)
 {
-    auto iter = m_loggers.find(name);
+    std::lock_guard<std::mutex> lock(m_loggers_mutex);
+    auto                        iter = m_loggers.find(name);
     if (iter != m_loggers.end())
     {
-        m_log_database = iter->second.get();
+        m_log_database = iter->second;
     }
 }
 
@@ -55,51 +60,133 @@ Logger::~Logger()
 {
     static std::mutex mutex;
 
-    std::time_t       now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-    std::stringstream file_line;
-    file_line << m_filename << ":" << m_line;
+    // Asynchronous mode : the log will be written by the background thread
+    std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    if (!m_async_logger.log(now, m_level, m_level_str, m_filename, m_line, m_log_database, m_log_output.str()))
     {
-        std::lock_guard<std::mutex> lock(mutex);
-
-        std::tm now_tm;
-        localtime_r(&now, &now_tm);
-        LOG_OUTPUT << m_level_str << " - [" << std::put_time(&now_tm, "%Y-%m-%dT%T") << "] - " << file_line.str() << " - "
-                   << m_log_output.str() << std::endl;
-    }
-    if (m_log_database)
-    {
-        m_log_database->log(now, m_level, file_line.str(), m_log_output.str());
+        std::stringstream file_line;
+        file_line << m_filename << ":" << m_line;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            std::tm now_tm;
+            localtime_r(&now, &now_tm);
+            LOG_OUTPUT << m_level_str << " - [" << std::put_time(&now_tm, "%Y-%m-%dT%T") << "] - " << file_line.str() << " - "
+                       << m_log_output.str() << std::endl;
+        }
+        if (m_log_database)
+        {
+            m_log_database->log(now, m_level, file_line.str(), m_log_output.str());
+        }
     }
 }
 
 /** @brief Register the default logger */
 void Logger::registerDefaultLogger(ocpp::database::Database& database, unsigned int max_entries)
 {
-    auto iter = m_loggers.find(DEFAULT_LOG_NAME);
+    std::lock_guard<std::mutex> lock(m_loggers_mutex);
+    auto                        iter = m_loggers.find(DEFAULT_LOG_NAME);
     if (iter == m_loggers.end())
     {
-        m_default_logger = new LogDatabase(database, DEFAULT_LOG_NAME, max_entries);
-        m_loggers.emplace(DEFAULT_LOG_NAME, m_default_logger);
+        auto logger = std::make_shared<LogDatabase>(database, DEFAULT_LOG_NAME, max_entries);
+        m_loggers.emplace(DEFAULT_LOG_NAME, logger);
+        std::atomic_store(&m_default_logger, logger);
     }
 }
 
 /** @brief Unregister the default logger */
 void Logger::unregisterDefaultLogger()
 {
-    auto iter = m_loggers.find(DEFAULT_LOG_NAME);
-    if (iter != m_loggers.end())
+    std::vector<std::shared_ptr<LogDatabase>> loggers;
     {
-        m_loggers.erase(iter);
+        std::lock_guard<std::mutex> lock(m_loggers_mutex);
+        auto                        iter = m_loggers.find(DEFAULT_LOG_NAME);
+        if (iter != m_loggers.end())
+        {
+            loggers.push_back(iter->second);
+            std::atomic_store(&m_default_logger, std::shared_ptr<LogDatabase>());
+            m_loggers.erase(iter);
+        }
     }
+    closeLoggers(loggers);
 }
 
 /** @brief Register a logger */
 void Logger::registerLogger(ocpp::database::Database& database, const std::string& name, unsigned int max_entries)
 {
-    auto iter = m_loggers.find(name);
+    std::lock_guard<std::mutex> lock(m_loggers_mutex);
+    auto                        iter = m_loggers.find(name);
     if (iter == m_loggers.end())
     {
-        m_loggers.emplace(name, new LogDatabase(database, name, max_entries));
+        m_loggers.emplace(name, std::make_shared<LogDatabase>(database, name, max_entries));
+    }
+}
+
+/** @brief Unregister all the loggers storing their logs in a database */
+void Logger::unregisterLoggers(ocpp::database::Database& database)
+{
+    std::vector<std::shared_ptr<LogDatabase>> loggers;
+    {
+        std::lock_guard<std::mutex> lock(m_loggers_mutex);
+        auto                        iter = m_loggers.begin();
+        while (iter != m_loggers.end())
+        {
+            if (&iter->second->database() == &database)
+            {
+                if (iter->second == std::atomic_load(&m_default_logger))
+                {
+                    std::atomic_store(&m_default_logger, std::shared_ptr<LogDatabase>());
+                }
+                loggers.push_back(iter->second);
+                iter = m_loggers.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+    closeLoggers(loggers);
+}
+
+/** @brief Start the asynchronous mode */
+bool Logger::startAsyncMode(size_t queue_size, LogOverflowPolicy policy)
+{
+    return m_async_logger.start(queue_size, policy);
+}
+
+/** @brief Stop the asynchronous mode after having written the pending logs */
+bool Logger::stopAsyncMode()
+{
+    return m_async_logger.stop();
+}
+
+/** @brief Wait until the pending logs have been written */
+void Logger::flush()
+{
+    m_async_logger.flush();
+}
+
+/** @brief Number of logs dropped because the asynchronous queue was full */
+uint64_t Logger::droppedLogs()
+{
+    return m_async_logger.droppedRecords();
+}
+
+/** @brief Write the pending logs of the unregistered loggers and close them */
+void Logger::closeLoggers(const std::vector<std::shared_ptr<LogDatabase>>& loggers)
+{
+    if (!loggers.empty())
+    {
+        // The new logs can't refer to the loggers anymore, write the pending ones
+        m_async_logger.flush();
+
+        // The logs still referring to the loggers (logs in progress when they were unregistered)
+        // will be ignored since they may be written after the destruction of the database
+        for (const auto& logger : loggers)
+        {
+            logger->close();
+        }
     }
 }
 
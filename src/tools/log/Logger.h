@@ -19,12 +19,15 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include "AsyncLogger.h"
 #include "FilenameMacro.h"
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace ocpp
 {
@@ -148,12 +151,36 @@ class Logger
     static void unregisterDefaultLogger();
     /** @brief Register a logger */
     static void registerLogger(ocpp::database::Database& database, const std::string& name, unsigned int max_entries);
+    /**
+     * @brief Unregister all the loggers storing their logs in a database, their pending logs are written
+     *        and the database won't be accessed anymore by the loggers once this function returns
+     * @param database Database storing the logs
+     */
+    static void unregisterLoggers(ocpp::database::Database& database);
+
+    /**
+     * @brief Start the asynchronous mode : logs are queued and written to the console
+     *        and to the databases by a background thread
+     * @param queue_size Maximum number of logs waiting to be written
+     * @param policy Behavior when the queue is full
+     * @return true if the asynchronous mode has been started, false otherwise
+     */
+    static bool startAsyncMode(size_t queue_size = 4096u, LogOverflowPolicy policy = LogOverflowPolicy::DROP);
+    /**
+     * @brief Stop the asynchronous mode after having written the pending logs
+     * @return true if the asynchronous mode has been stopped, false otherwise
+     */
+    static bool stopAsyncMode();
+    /** @brief Wait until the pending logs have been written (asynchronous mode only) */
+    static void flush();
+    /** @brief Number of logs dropped because the asynchronous queue was full */
+    static uint64_t droppedLogs();
 
   private:
     /** @brief Log output */
     std::stringstream m_log_output;
     /** @brief Log database */
-    LogDatabase* m_log_database;
+    std::shared_ptr<LogDatabase> m_log_database;
     /** @brief Log level */
     const char* m_level_str;
     /** @brief Log level */
@@ -164,9 +191,16 @@ class Logger
     const char* m_line;
 
     /** @brief Loggers */
-    static std::map<std::string, std::unique_ptr<LogDatabase>> m_loggers;
-    /** @brief Default logger */
-    static LogDatabase* m_default_logger;
+    static std::map<std::string, std::shared_ptr<LogDatabase>> m_loggers;
+    /** @brief Mutex to protect the loggers */
+    static std::mutex m_loggers_mutex;
+    /** @brief Default logger (must be accessed through std::atomic_load/std::atomic_store) */
+    static std::shared_ptr<LogDatabase> m_default_logger;
+    /** @brief Asynchronous logger */
+    static AsyncLogger m_async_logger;
+
+    /** @brief Write the pending logs of the unregistered loggers and close them */
+    static void closeLoggers(const std::vector<std::shared_ptr<LogDatabase>>& loggers);
 };
 
 /** @brief Null logger */
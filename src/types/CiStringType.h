@@ -19,6 +19,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef CISTRINGTYPE_H
 #define CISTRINGTYPE_H
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
 
 namespace ocpp
@@ -26,171 +29,244 @@ namespace ocpp
 namespace types
 {
 
-/** @brief Interface for the strings with a size limit */
-class ICiStringType
+// Forward declaration
+template <size_t MAX_STRING_SIZE>
+class CiStringType;
+
+/** @brief Type-erased view on a string with a size limit, it allows to read and assign
+ *         any CiStringType<> instance without knowing its size limit */
+class CiStringView
 {
   public:
-    /** @brief Destructor */
-    virtual ~ICiStringType() { }
+    /**
+     * @brief Constructor
+     * @param string String to view
+     */
+    template <size_t MAX_STRING_SIZE>
+    constexpr CiStringView(CiStringType<MAX_STRING_SIZE>& string) : m_string(string.m_string), m_size(string.m_size), m_max(MAX_STRING_SIZE)
+    {
+    }
 
     /**
      * @brief Get the size limit of the string
      * @return Size limit in bytes of the string
      */
-    virtual size_t max() const = 0;
+    constexpr size_t max() const { return m_max; }
+
     /**
      * @brief Assign a new value to the string
      * @param value New string value
-     * @return true if the new value respects the max string size, false otherwise
+     * @param size Size in bytes of the new value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
      */
-    virtual bool assign(const std::string& value) = 0;
-
-    /**
-     * @brief Implicit conversion operator
-     * @return Underlying string
-     */
-    virtual operator const std::string&() const = 0;
+    constexpr bool assign(const char* value, size_t size)
+    {
+        bool ret = (size <= m_max);
+        if (!ret)
+        {
+            size = m_max;
+        }
+        for (size_t i = 0; i < size; i++)
+        {
+            m_string[i] = value[i];
+        }
+        m_string[size] = 0;
+        m_size         = static_cast<uint16_t>(size);
+        return ret;
+    }
 
     /**
-     * @brief Implicit compare operator
-     * @param value Value to compare
-     * @return true is the 2 string are identicals, false otherwise
+     * @brief Assign a new value to the string
+     * @param value New string value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
      */
-    virtual bool operator==(const std::string& value) const = 0;
+    bool assign(const char* value) { return assign(value, strlen(value)); }
 
     /**
-     * @brief Implicit compare operator
-     * @param value Value to compare
-     * @return false is the 2 string are identicals, true otherwise
+     * @brief Assign a new value to the string
+     * @param value New string value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
      */
-    virtual bool operator!=(const std::string& value) const = 0;
+    bool assign(const std::string& value) { return assign(value.c_str(), value.size()); }
 
     /**
      * @brief Get the underlying string
-     * @return Underlying string
+     * @return Copy of the underlying string
      */
-    virtual const std::string& str() const = 0;
+    std::string str() const { return std::string(m_string, m_size); }
 
     /**
      * @brief Get the underlying string as a C char array
      * @return Underlying string
      */
-    virtual const char* c_str() const = 0;
+    constexpr const char* c_str() const { return m_string; }
 
     /**
      * @brief Indicate if the string is empty
      * @return true if the string is empty
      */
-    virtual bool empty() const = 0;
+    constexpr bool empty() const { return (m_size == 0); }
 
     /**
      * @brief Get the size of the string
      * @return Size of the string in bytes
      */
-    virtual size_t size() const = 0;
+    constexpr size_t size() const { return m_size; }
+
+  private:
+    /** @brief Storage of the viewed string */
+    char* m_string;
+    /** @brief Size of the viewed string */
+    uint16_t& m_size;
+    /** @brief Size limit of the viewed string */
+    size_t m_max;
 };
 
-/** @brief Represent a string with a size limit */
+/** @brief Represent a string with a size limit
+ *
+ *  The string is stored inline in a fixed size buffer : it never allocates memory and
+ *  can be copied and moved as a plain array of bytes. The size limit of the OCPP strings
+ *  is at most 500 bytes.
+ */
 template <size_t MAX_STRING_SIZE>
-class CiStringType : public ICiStringType
+class CiStringType
 {
+    static_assert(MAX_STRING_SIZE <= UINT16_MAX, "Size limit of the string is too big");
+
   public:
     /** @brief Default constructor */
-    CiStringType() : m_string() { }
+    CiStringType() : m_size(0) { m_string[0] = 0; }
 
     /**
-     * @brief Copy constructor
-     * @param copy String to copy
+     * @brief Constructor from a string literal, its size is checked at compile time
+     * @param value String literal
      */
-    CiStringType(const CiStringType& copy) : m_string(copy.m_string) { }
-
-    /** @brief Destructor */
-    virtual ~CiStringType() { }
+    template <size_t SIZE>
+    constexpr CiStringType(const char (&value)[SIZE]) : m_size(SIZE - 1u), m_string()
+    {
+        static_assert(SIZE <= (MAX_STRING_SIZE + 1u), "String literal exceeds the size limit of the string");
+        for (size_t i = 0; i < SIZE; i++)
+        {
+            m_string[i] = value[i];
+        }
+        m_size = static_cast<uint16_t>(std::char_traits<char>::length(m_string));
+    }
 
     /**
      * @brief Get the size limit of the string
      * @return Size limit in bytes of the string
      */
-    size_t max() const override { return MAX_STRING_SIZE; }
+    static constexpr size_t max() { return MAX_STRING_SIZE; }
 
     /**
      * @brief Assign a new value to the string
      * @param value New string value
-     * @return true if the new value respects the max string size, false otherwise
+     * @param size Size in bytes of the new value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
      */
-    bool assign(const std::string& value) override
-    {
-        bool ret = false;
-        if (value.size() <= MAX_STRING_SIZE)
-        {
-            m_string = value;
-            ret      = true;
-        }
-        else
-        {
-            m_string = value.substr(0, MAX_STRING_SIZE);
-        }
-        return ret;
-    }
+    constexpr bool assign(const char* value, size_t size) { return CiStringView(*this).assign(value, size); }
 
     /**
-     * @brief Copy operator
-     * @param copy String to copy
-     * @return Reference to itself
+     * @brief Assign a new value to the string
+     * @param value New string value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
      */
-    CiStringType& operator=(const CiStringType& copy)
-    {
-        m_string = copy.m_string;
-        return *this;
-    }
+    bool assign(const char* value) { return assign(value, strlen(value)); }
+
+    /**
+     * @brief Assign a new value to the string
+     * @param value New string value
+     * @return true if the new value respects the max string size, false otherwise (the value is truncated)
+     */
+    bool assign(const std::string& value) { return assign(value.c_str(), value.size()); }
 
     /**
      * @brief Implicit conversion operator
-     * @return Underlying string
+     * @return Copy of the underlying string
      */
-    operator const std::string&() const override { return m_string; }
+    operator std::string() const { return str(); }
 
     /**
      * @brief Implicit compare operator
      * @param value Value to compare
      * @return true is the 2 string are identicals, false otherwise
      */
-    bool operator==(const std::string& value) const override { return (value == m_string); }
+    bool operator==(const std::string& value) const { return ((value.size() == m_size) && (memcmp(value.c_str(), m_string, m_size) == 0)); }
 
     /**
      * @brief Implicit compare operator
      * @param value Value to compare
      * @return false is the 2 string are identicals, true otherwise
      */
-    bool operator!=(const std::string& value) const override { return (value != m_string); }
+    bool operator!=(const std::string& value) const { return !operator==(value); }
+
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return true is the 2 string are identicals, false otherwise
+     */
+    bool operator==(const char* value) const { return (strcmp(value, m_string) == 0); }
+
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return false is the 2 string are identicals, true otherwise
+     */
+    bool operator!=(const char* value) const { return !operator==(value); }
+
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return true is the 2 string are identicals, false otherwise
+     */
+    template <size_t OTHER_MAX_STRING_SIZE>
+    bool operator==(const CiStringType<OTHER_MAX_STRING_SIZE>& value) const
+    {
+        return ((value.size() == m_size) && (memcmp(value.c_str(), m_string, m_size) == 0));
+    }
+
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return false is the 2 string are identicals, true otherwise
+     */
+    template <size_t OTHER_MAX_STRING_SIZE>
+    bool operator!=(const CiStringType<OTHER_MAX_STRING_SIZE>& value) const
+    {
+        return !operator==(value);
+    }
 
     /**
      * @brief Get the underlying string
-     * @return Underlying string
+     * @return Copy of the underlying string
      */
-    const std::string& str() const override { return m_string; }
+    std::string str() const { return std::string(m_string, m_size); }
 
     /**
      * @brief Get the underlying string as a C char array
      * @return Underlying string
      */
-    const char* c_str() const override { return m_string.c_str(); }
+    constexpr const char* c_str() const { return m_string; }
 
     /**
      * @brief Indicate if the string is empty
      * @return true if the string is empty
      */
-    bool empty() const override { return m_string.empty(); }
+    constexpr bool empty() const { return (m_size == 0); }
 
     /**
      * @brief Get the size of the string
      * @return Size of the string in bytes
      */
-    size_t size() const override { return m_string.size(); }
+    constexpr size_t size() const { return m_size; }
 
   private:
-    /** @brief Underlying string */
-    std::string m_string;
+    friend class CiStringView;
+
+    /** @brief Size of the string */
+    uint16_t m_size;
+    /** @brief Underlying string (null terminated) */
+    char m_string[MAX_STRING_SIZE + 1u];
 };
 
 } // namespace types
@@ -20,8 +20,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DATETIME_H
 
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
 #include <string>
 
 namespace ocpp
@@ -29,61 +30,113 @@ namespace ocpp
 namespace types
 {
 
-/** @brief Date and time representation (ISO-8601 for string representation) */
+/** @brief Date and time representation with a millisecond precision (RFC 3339 / ISO-8601 for string representation)
+ *
+ *  The string conversions are locale independant and do not allocate memory except
+ *  for the std::string based helpers
+ */
 class DateTime
 {
   public:
-    /** @brief Instanciate a date and time object with the current date and time
+    /** @brief Size of the buffer needed to store the longest string representation (including the terminating null character) */
+    static constexpr size_t STRING_BUFFER_SIZE = 25u;
+
+    /** @brief Instanciate a date and time object with the current date and time (second precision)
      *  @return Instanciated date and time
      */
     static DateTime now() { return DateTime(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())); }
 
     /** @brief Default constructor */
-    DateTime() : m_datetime(0) { }
+    DateTime() : m_datetime(0), m_millisecond(0) { }
 
     /** @brief Constructor from std::time_t */
-    DateTime(const std::time_t& init) : m_datetime(init) { }
+    DateTime(const std::time_t& init) : m_datetime(init), m_millisecond(0) { }
+
+    /** @brief Constructor from std::time_t and a number of milliseconds [0-999] */
+    DateTime(const std::time_t& init, unsigned int millisecond) : m_datetime(init), m_millisecond(millisecond % 1000u) { }
 
     /**
      * @brief Copy constructor
      * @param copy Object to copy
      */
-    DateTime(const DateTime& copy) : m_datetime(copy.m_datetime) { }
+    DateTime(const DateTime& copy) = default;
 
     /**
      * @brief Assignment operator
      * @param copy Object to copy
      * @return Reference to itself
      */
-    DateTime& operator=(const DateTime& copy)
-    {
-        m_datetime = copy.m_datetime;
-        return (*this);
-    }
+    DateTime& operator=(const DateTime& copy) = default;
 
     /**
-     * @brief Assign a new value from a string representation in UTC time
+     * @brief Assign a new value from a string representation (RFC 3339), UTC time is used when
+     *        the string doesn't specify an offset to UTC
      * @param value String representation
-     * @return true if the new value respects the max string size, false otherwise
+     * @return true if the string representation is valid, false otherwise
      */
-    bool assign(const std::string& value)
+    bool assign(const std::string& value) { return assign(value.c_str(), value.size()); }
+
+    /**
+     * @brief Assign a new value from a string representation (RFC 3339) : YYYY-MM-DDThh:mm:ss[.fraction][Z|+hh:mm|-hh:mm],
+     *        UTC time is used when the string doesn't specify an offset to UTC. Fractional seconds
+     *        are truncated to the millisecond
+     * @param value String representation (doesn't need to be null terminated)
+     * @param size Size in bytes of the string representation
+     * @return true if the string representation is valid, false otherwise (the value is then left unchanged)
+     */
+    bool assign(const char* value, size_t size)
     {
-        bool               ret = false;
-        std::istringstream ss(value);
-        std::tm            t = {};
-        ss >> std::get_time(&t, "%Y-%m-%dT%TZ");
-        if (ss.fail())
+        const char* p      = value;
+        const char* end    = value + size;
+        int         year   = 0;
+        int         month  = 0;
+        int         day    = 0;
+        int         hour   = 0;
+        int         minute = 0;
+        int         second = 0;
+
+        // Date and time
+        bool ret = parseNumber(p, end, 4u, year) && parseChar(p, end, '-') && parseNumber(p, end, 2u, month) && parseChar(p, end, '-') &&
+                   parseNumber(p, end, 2u, day) && (parseChar(p, end, 'T') || parseChar(p, end, 't') || parseChar(p, end, ' ')) &&
+                   parseNumber(p, end, 2u, hour) && parseChar(p, end, ':') && parseNumber(p, end, 2u, minute) && parseChar(p, end, ':') &&
+                   parseNumber(p, end, 2u, second);
+        ret = ret && (month >= 1) && (month <= 12) && (day >= 1) && (day <= daysInMonth(year, month)) && (hour <= 23) && (minute <= 59) &&
+              (second <= 60);
+
+        // Fractional seconds
+        unsigned int millisecond = 0;
+        if (ret && parseChar(p, end, '.'))
         {
-            ss.clear();
-            ss.str(value);
-            ss >> std::get_time(&t, "%Y-%m-%dT%T");
+            ret                = ((p != end) && isDigit(*p));
+            unsigned int scale = 100u;
+            while ((p != end) && isDigit(*p))
+            {
+                millisecond += scale * static_cast<unsigned int>(*p - '0');
+                scale /= 10u;
+                p++;
+            }
         }
-        if (!ss.fail())
+
+        // Offset to UTC
+        int offset = 0;
+        if (ret && (p != end))
+        {
+            if (!parseChar(p, end, 'Z') && !parseChar(p, end, 'z'))
+            {
+                int sign = ((*p == '-') ? -1 : 1);
+                int hours   = 0;
+                int minutes = 0;
+                ret = (parseChar(p, end, '+') || parseChar(p, end, '-')) && parseNumber(p, end, 2u, hours) && parseChar(p, end, ':') &&
+                      parseNumber(p, end, 2u, minutes) && (hours <= 23) && (minutes <= 59);
+                offset = sign * (hours * 3600 + minutes * 60);
+            }
+            ret = ret && (p == end);
+        }
+
+        if (ret)
         {
-            m_datetime = std::mktime(&t);
-            m_datetime += t.tm_gmtoff;
-            m_datetime -= (t.tm_isdst * 3600);
-            ret = true;
+            m_datetime = static_cast<std::time_t>(daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset);
+            m_millisecond = millisecond;
         }
         return ret;
     }
@@ -136,45 +189,108 @@ class DateTime
      */
     bool operator>=(const std::time_t& value) const { return (m_datetime >= value); }
 
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return true if the 2 date and time are identicals, false otherwise
+     */
+    bool operator==(const DateTime& value) const { return ((m_datetime == value.m_datetime) && (m_millisecond == value.m_millisecond)); }
+
+    /**
+     * @brief Compare operator
+     * @param value Value to compare
+     * @return false if the 2 date and time are identicals, true otherwise
+     */
+    bool operator!=(const DateTime& value) const { return !(*this == value); }
+
     /**
      * @brief Compare operator
      * @param value Value to compare
      * @return true if the value to compare is greater, false otherwise
      */
-    bool operator<(const DateTime& value) const { return (m_datetime < value.m_datetime); }
+    bool operator<(const DateTime& value) const
+    {
+        return ((m_datetime < value.m_datetime) || ((m_datetime == value.m_datetime) && (m_millisecond < value.m_millisecond)));
+    }
 
     /**
      * @brief Compare operator
      * @param value Value to compare
      * @return true if the value to compare is lower, false otherwise
      */
-    bool operator>(const DateTime& value) const { return (m_datetime > value.m_datetime); }
+    bool operator>(const DateTime& value) const { return (value < *this); }
 
     /**
      * @brief Compare operator
      * @param value Value to compare
      * @return true if the value to compare is greater, false otherwise
      */
-    bool operator<=(const DateTime& value) const { return (m_datetime <= value.m_datetime); }
+    bool operator<=(const DateTime& value) const { return !(value < *this); }
 
     /**
      * @brief Compare operator
      * @param value Value to compare
      * @return true if the value to compare is lower, false otherwise
      */
-    bool operator>=(const DateTime& value) const { return (m_datetime >= value.m_datetime); }
+    bool operator>=(const DateTime& value) const { return !(*this < value); }
 
     /**
-     * @brief Get the string representation (ISO-8601) of the date and time
-     * @return String representation (ISO-8601) of the date and time
+     * @brief Get the string representation (RFC 3339) of the date and time in UTC time
+     * @return String representation (RFC 3339) of the date and time
      */
     std::string str() const
     {
-        std::ostringstream ss;
-        std::tm            t = {};
-        gmtime_r(&m_datetime, &t);
-        ss << std::put_time(&t, "%Y-%m-%dT%TZ");
-        return ss.str();
+        char buffer[STRING_BUFFER_SIZE];
+        return std::string(buffer, format(buffer, sizeof(buffer)));
+    }
+
+    /**
+     * @brief Write the string representation (RFC 3339) of the date and time in UTC time : YYYY-MM-DDThh:mm:ssZ,
+     *        or YYYY-MM-DDThh:mm:ss.sssZ when the number of milliseconds is not null
+     * @param buffer Buffer to write to, the string representation is null terminated
+     * @param size Size in bytes of the buffer (STRING_BUFFER_SIZE is always enough)
+     * @return Size in bytes of the string representation (without the terminating null character),
+     *         0 if the buffer is too small or if the year is outside the [0-9999] range
+     */
+    size_t format(char* buffer, size_t size) const
+    {
+        size_t  ret     = 0;
+        int64_t days    = static_cast<int64_t>(m_datetime) / 86400;
+        int64_t seconds = static_cast<int64_t>(m_datetime) % 86400;
+        if (seconds < 0)
+        {
+            days--;
+            seconds += 86400;
+        }
+        int64_t year;
+        int     month;
+        int     day;
+        civilFromDays(days, year, month, day);
+
+        size_t length = ((m_millisecond != 0) ? 24u : 20u);
+        if ((year >= 0) && (year <= 9999) && (size > length))
+        {
+            formatNumber(&buffer[0], 4u, static_cast<unsigned int>(year));
+            buffer[4] = '-';
+            formatNumber(&buffer[5], 2u, static_cast<unsigned int>(month));
+            buffer[7] = '-';
+            formatNumber(&buffer[8], 2u, static_cast<unsigned int>(day));
+            buffer[10] = 'T';
+            formatNumber(&buffer[11], 2u, static_cast<unsigned int>(seconds / 3600));
+            buffer[13] = ':';
+            formatNumber(&buffer[14], 2u, static_cast<unsigned int>((seconds / 60) % 60));
+            buffer[16] = ':';
+            formatNumber(&buffer[17], 2u, static_cast<unsigned int>(seconds % 60));
+            if (m_millisecond != 0)
+            {
+                buffer[19] = '.';
+                formatNumber(&buffer[20], 3u, m_millisecond);
+            }
+            buffer[length - 1u] = 'Z';
+            buffer[length]      = 0;
+            ret                 = length;
+        }
+        return ret;
     }
 
     /**
@@ -183,15 +299,94 @@ class DateTime
      */
     std::time_t timestamp() const { return m_datetime; }
 
+    /**
+     * @brief Get the number of milliseconds of the date and time
+     * @return Number of milliseconds [0-999]
+     */
+    unsigned int millisecond() const { return m_millisecond; }
+
     /**
      * @brief Indicate if a date and time is empty = EPOCH
      * @return true if the date and time is empty, false otherwise
      */
-    bool empty() const { return (m_datetime == 0); }
+    bool empty() const { return ((m_datetime == 0) && (m_millisecond == 0)); }
 
   private:
-    /** @brief Underlying date and time in local time */
+    /** @brief Underlying date and time as a UNIX timestamp */
     std::time_t m_datetime;
+    /** @brief Number of milliseconds */
+    unsigned int m_millisecond;
+
+    /** @brief Indicate if a character is a decimal digit */
+    static bool isDigit(char c) { return ((c >= '0') && (c <= '9')); }
+
+    /** @brief Parse a fixed size decimal number */
+    static bool parseNumber(const char*& p, const char* end, size_t digits, int& value)
+    {
+        bool ret = (static_cast<size_t>(end - p) >= digits);
+        value    = 0;
+        for (size_t i = 0; ret && (i < digits); i++)
+        {
+            ret   = isDigit(*p);
+            value = value * 10 + (*p - '0');
+            p++;
+        }
+        return ret;
+    }
+
+    /** @brief Parse an expected character */
+    static bool parseChar(const char*& p, const char* end, char c)
+    {
+        bool ret = ((p != end) && (*p == c));
+        if (ret)
+        {
+            p++;
+        }
+        return ret;
+    }
+
+    /** @brief Write a fixed size decimal number */
+    static void formatNumber(char* buffer, size_t digits, unsigned int value)
+    {
+        for (size_t i = digits; i > 0; i--)
+        {
+            buffer[i - 1u] = static_cast<char>('0' + (value % 10u));
+            value /= 10u;
+        }
+    }
+
+    /** @brief Number of days in a month of a year */
+    static int daysInMonth(int year, int month)
+    {
+        static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        bool             leap   = (((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0)));
+        return (((month == 2) && leap) ? 29 : days[month - 1]);
+    }
+
+    /** @brief Number of days since EPOCH of a date in the proleptic Gregorian calendar */
+    static int64_t daysFromCivil(int year, int month, int day)
+    {
+        int64_t  y   = year - ((month <= 2) ? 1 : 0);
+        int64_t  era = ((y >= 0) ? y : (y - 399)) / 400;
+        unsigned yoe = static_cast<unsigned>(y - era * 400);
+        unsigned doy = static_cast<unsigned>((153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1);
+        unsigned doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;
+        return era * 146097 + static_cast<int64_t>(doe) - 719468;
+    }
+
+    /** @brief Date in the proleptic Gregorian calendar of a number of days since EPOCH */
+    static void civilFromDays(int64_t days, int64_t& year, int& month, int& day)
+    {
+        days += 719468;
+        int64_t  era = ((days >= 0) ? days : (days - 146096)) / 146097;
+        unsigned doe = static_cast<unsigned>(days - era * 146097);
+        unsigned yoe = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u;
+        unsigned doy = doe - (365u * yoe + yoe / 4u - yoe / 100u);
+        unsigned mp  = (5u * doy + 2u) / 153u;
+        day          = static_cast<int>(doy - (153u * mp + 2u) / 5u + 1u);
+        month        = static_cast<int>((mp < 10u) ? (mp + 3u) : (mp - 9u));
+        year         = static_cast<int64_t>(yoe) + era * 400 + ((month <= 2) ? 1 : 0);
+    }
 };
 
 } // namespace types
@@ -21,7 +21,12 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "String.h"
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace ocpp
@@ -29,63 +34,182 @@ namespace ocpp
 namespace types
 {
 
-/** @brief Helper class for string to enum conversion */
+/** @brief Helper class for string to enum conversion
+ *
+ *  The conversion tables are built by a constexpr constructor so that the helpers are constant
+ *  initialized and do not need any dynamic allocation :
+ *  - enum to string : the strings are indexed by the underlying value of the enum,
+ *  - string to enum : the strings are stored in an open addressing hash table whose hash seed
+ *    is chosen so that each string is found on its first probe whenever possible.
+ *
+ *  The underlying values of the enums must be lower than MAX_VALUES (default numbering of the enum values),
+ *  the helpers must be declared constexpr so that any other value is rejected at compile time
+ */
 template <typename EnumType>
 class EnumToStringFromString
 {
   public:
+    /** @brief Maximum number of values of an enum */
+    static constexpr size_t MAX_VALUES = 32u;
+
     /** @brief Constructor */
-    EnumToStringFromString(std::initializer_list<std::pair<EnumType, const char*>> mapping)
+    constexpr EnumToStringFromString(std::initializer_list<std::pair<EnumType, const char*>> mapping)
+        : m_strings(), m_sizes(), m_slots(), m_seed(0), m_default_value()
     {
-        for (auto& it : mapping)
+        // Enum to string table
+        const char* default_string = nullptr;
+        for (const auto& it : mapping)
+        {
+            // Not a constant expression : fails to compile when the helper is declared constexpr
+            size_t index = static_cast<size_t>(it.first);
+            if (index >= MAX_VALUES)
+            {
+                throw std::out_of_range("Enum value exceeds EnumToStringFromString::MAX_VALUES");
+            }
+            m_strings[index] = it.second;
+            m_sizes[index]   = length(it.second);
+
+            // Same default value as the former std::map based implementation : the smallest string
+            if (!default_string || (compare(it.second, default_string) < 0))
+            {
+                default_string  = it.second;
+                m_default_value = it.first;
+            }
+        }
+
+        // Look for a seed without collisions, the last one tried is kept otherwise
+        for (uint32_t seed = 0; seed < MAX_SEEDS; seed++)
         {
-            m_enum_to_string[it.first]  = it.second;
-            m_string_to_enum[it.second] = it.first;
+            if (buildHashTable(seed))
+            {
+                break;
+            }
         }
     }
 
-    /** @brief Get the string representation of the enum value */
-    std::string toString(EnumType value) const
+    /** @brief Get the string representation of the enum value (empty string if unknown) */
+    constexpr const char* toString(EnumType value) const
     {
-        std::string ret;
-        auto        it = m_enum_to_string.find(value);
-        if (it != m_enum_to_string.end())
+        const char* ret   = "";
+        size_t      index = static_cast<size_t>(value);
+        if ((index < MAX_VALUES) && m_strings[index])
         {
-            ret = it->second;
+            ret = m_strings[index];
         }
         return ret;
     }
 
     /** @brief Get the value represented by a string */
-    EnumType fromString(const std::string& str) const
+    constexpr EnumType fromString(std::string_view str) const
     {
-        EnumType ret = m_string_to_enum.begin()->second;
-        auto     it  = m_string_to_enum.find(str);
-        if (it != m_string_to_enum.end())
-        {
-            ret = it->second;
-        }
+        EnumType ret = m_default_value;
+        fromString(str, ret);
         return ret;
     }
 
     /** @brief Get the value represented by a string */
-    bool fromString(const std::string& str, EnumType& val) const
+    constexpr bool fromString(std::string_view str, EnumType& val) const
     {
-        bool ret = false;
-        auto it  = m_string_to_enum.find(str);
-        if (it != m_string_to_enum.end())
+        bool   ret  = false;
+        size_t slot = hash(str.data(), str.size(), m_seed);
+        for (size_t i = 0; !ret && (i < HASH_TABLE_SIZE) && (m_slots[slot] != 0); i++)
         {
-            val = it->second;
-            ret = true;
+            size_t index = m_slots[slot] - 1u;
+            if ((m_sizes[index] == str.size()) && (compare(m_strings[index], str.data(), str.size()) == 0))
+            {
+                val = static_cast<EnumType>(index);
+                ret = true;
+            }
+            slot = (slot + 1u) & (HASH_TABLE_SIZE - 1u);
         }
         return ret;
     }
 
   private:
-    /** @brief Map for enum to string conversion */
-    std::map<EnumType, std::string> m_enum_to_string;
-    /** @brief Map for string to enum conversion */
-    std::map<std::string, EnumType> m_string_to_enum;
+    /** @brief Size of the hash table (power of 2) */
+    static constexpr size_t HASH_TABLE_SIZE = 4u * MAX_VALUES;
+    /** @brief Maximum number of hash seeds to try */
+    static constexpr uint32_t MAX_SEEDS = 256u;
+
+    /** @brief Strings indexed by enum value */
+    const char* m_strings[MAX_VALUES];
+    /** @brief Sizes of the strings indexed by enum value */
+    size_t m_sizes[MAX_VALUES];
+    /** @brief Hash table : enum value + 1, 0 if the slot is empty */
+    uint8_t m_slots[HASH_TABLE_SIZE];
+    /** @brief Hash seed */
+    uint32_t m_seed;
+    /** @brief Value returned when a string is unknown */
+    EnumType m_default_value;
+
+    /** @brief Fill the hash table using a seed, returns true if there is no collision */
+    constexpr bool buildHashTable(uint32_t seed)
+    {
+        bool ret = true;
+        m_seed   = seed;
+        for (size_t slot = 0; slot < HASH_TABLE_SIZE; slot++)
+        {
+            m_slots[slot] = 0;
+        }
+        for (size_t index = 0; index < MAX_VALUES; index++)
+        {
+            if (m_strings[index])
+            {
+                size_t slot = hash(m_strings[index], m_sizes[index], seed);
+                while (m_slots[slot] != 0)
+                {
+                    // Collision : linear probing
+                    ret  = false;
+                    slot = (slot + 1u) & (HASH_TABLE_SIZE - 1u);
+                }
+                m_slots[slot] = static_cast<uint8_t>(index + 1u);
+            }
+        }
+        return ret;
+    }
+
+    /** @brief Seeded FNV-1a hash of a string, reduced to a slot of the hash table */
+    static constexpr size_t hash(const char* str, size_t size, uint32_t seed)
+    {
+        uint32_t h = 2166136261u ^ (seed * 16777619u);
+        for (size_t i = 0; i < size; i++)
+        {
+            h ^= static_cast<uint8_t>(str[i]);
+            h *= 16777619u;
+        }
+        h ^= (h >> 15u);
+        return static_cast<size_t>(h & (HASH_TABLE_SIZE - 1u));
+    }
+
+    /** @brief Length of a null terminated string */
+    static constexpr size_t length(const char* str)
+    {
+        size_t ret = 0;
+        while (str[ret] != 0)
+        {
+            ret++;
+        }
+        return ret;
+    }
+
+    /** @brief Compare a null terminated string with a string of known size (same result sign as strcmp) */
+    static constexpr int compare(const char* str1, const char* str2, size_t size2)
+    {
+        int    ret = 0;
+        size_t i   = 0;
+        for (; (ret == 0) && (i < size2); i++)
+        {
+            ret = static_cast<int>(static_cast<uint8_t>(str1[i])) - static_cast<int>(static_cast<uint8_t>(str2[i]));
+        }
+        if ((ret == 0) && (str1[i] != 0))
+        {
+            ret = 1;
+        }
+        return ret;
+    }
+
+    /** @brief Compare 2 null terminated strings (same result sign as strcmp) */
+    static constexpr int compare(const char* str1, const char* str2) { return compare(str1, str2, length(str2)); }
 };
 
 /** @brief Helper function to get an enum list from a CSL string */
@@ -33,7 +33,7 @@ class Optional
     Optional() : m_value(), m_is_set(false) { }
 
     /** @brief Copy constructor */
-    Optional(const Optional& copy) : m_value(copy.m_value), m_is_set(copy.m_is_set) { }
+    Optional(const Optional& copy) = default;
 
     /** @brief Assignment constructor */
     Optional(const T& value) : m_value(value), m_is_set(true) { }
@@ -46,12 +46,7 @@ class Optional
      * @param copy Optional value to copy
      * @return This instance
      */
-    Optional& operator=(const Optional& copy)
-    {
-        m_value  = copy.m_value;
-        m_is_set = copy.m_is_set;
-        return (*this);
-    }
+    Optional& operator=(const Optional& copy) = default;
 
     /**
      * @brief Copy operator
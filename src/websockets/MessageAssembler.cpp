@@ -0,0 +1,94 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MessageAssembler.h"
+
+#include <algorithm>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Constructor */
+MessageAssembler::MessageAssembler(size_t max_message_size)
+    : m_max_message_size(max_message_size), m_buffer(), m_completed(false), m_message(nullptr), m_message_size(0)
+{
+}
+
+/** @brief Destructor */
+MessageAssembler::~MessageAssembler() { }
+
+/** @brief Process a received chunk */
+MessageAssembler::Status MessageAssembler::push(const void* data, size_t size, bool final)
+{
+    Status status = Status::INCOMPLETE;
+
+    // Discard previous message
+    if (m_completed)
+    {
+        reset();
+    }
+
+    size_t message_size = m_buffer.size() + size;
+    if (message_size > m_max_message_size)
+    {
+        // Drop the whole message
+        reset();
+        status = Status::TOO_LARGE;
+    }
+    else if (final && m_buffer.empty())
+    {
+        // Whole message in a single chunk, no copy needed
+        m_message      = data;
+        m_message_size = size;
+        status         = Status::COMPLETE;
+    }
+    else
+    {
+        // Grow the buffer without going over the maximum message size
+        if (message_size > m_buffer.capacity())
+        {
+            m_buffer.reserve(std::min(std::max(message_size, 2u * m_buffer.capacity()), m_max_message_size));
+        }
+        const char* chunk = reinterpret_cast<const char*>(data);
+        m_buffer.insert(m_buffer.end(), chunk, chunk + size);
+
+        if (final)
+        {
+            m_completed    = true;
+            m_message      = m_buffer.data();
+            m_message_size = m_buffer.size();
+            status         = Status::COMPLETE;
+        }
+    }
+
+    return status;
+}
+
+/** @brief Drop any partially received message, the buffer memory is kept to be reused */
+void MessageAssembler::reset()
+{
+    m_buffer.clear();
+    m_completed    = false;
+    m_message      = nullptr;
+    m_message_size = 0;
+}
+
+} // namespace websockets
+} // namespace ocpp
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MESSAGEASSEMBLER_H
+#define MESSAGEASSEMBLER_H
+
+#include <cstddef>
+#include <vector>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Reassemble the chunks of a received websocket message with a bounded buffer */
+class MessageAssembler
+{
+  public:
+    /** @brief Result of the processing of a received chunk */
+    enum class Status
+    {
+        /** @brief More chunks are needed to complete the message */
+        INCOMPLETE,
+        /** @brief Message is complete and can be retrieved with data() and size() */
+        COMPLETE,
+        /** @brief Message exceeds the maximum allowed size, it has been dropped */
+        TOO_LARGE
+    };
+
+    /**
+     * @brief Constructor
+     * @param max_message_size Maximum size in bytes of a reassembled message
+     */
+    MessageAssembler(size_t max_message_size);
+
+    /** @brief Destructor */
+    virtual ~MessageAssembler();
+
+    /**
+     * @brief Process a received chunk
+     *        If the chunk is a whole message, it is not copied and data() directly points to it
+     * @param data Chunk data
+     * @param size Size of the chunk in bytes
+     * @param final Indicate if the chunk is the last one of the message
+     * @return Status of the message after the processing of the chunk
+     */
+    Status push(const void* data, size_t size, bool final);
+
+    /** @brief Data of the last completed message (valid until the next call to push() or reset()) */
+    const void* data() const { return m_message; }
+
+    /** @brief Size in bytes of the last completed message */
+    size_t size() const { return m_message_size; }
+
+    /** @brief Drop any partially received message, the buffer memory is kept to be reused */
+    void reset();
+
+    /** @brief Maximum size in bytes of a reassembled message */
+    size_t maxMessageSize() const { return m_max_message_size; }
+
+  private:
+    /** @brief Maximum size in bytes of a reassembled message */
+    const size_t m_max_message_size;
+    /** @brief Reassembly buffer, its capacity never exceeds the maximum message size */
+    std::vector<char> m_buffer;
+    /** @brief Indicate that the buffer contains a completed message to discard on next chunk */
+    bool m_completed;
+    /** @brief Last completed message */
+    const void* m_message;
+    /** @brief Size in bytes of the last completed message */
+    size_t m_message_size;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // MESSAGEASSEMBLER_H
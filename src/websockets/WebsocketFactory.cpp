@@ -26,15 +26,15 @@ namespace websockets
 {
 
 /** @brief Instanciate a client websocket */
-IWebsocketClient* WebsocketFactory::newClient()
+IWebsocketClient* WebsocketFactory::newClient(size_t max_message_size)
 {
-    return new LibWebsocketClient();
+    return new LibWebsocketClient(max_message_size);
 }
 
 /** @brief Instanciate a server websocket */
-IWebsocketServer* WebsocketFactory::newServer()
+IWebsocketServer* WebsocketFactory::newServer(unsigned int service_threads, size_t max_message_size)
 {
-    return new LibWebsocketServer();
+    return new LibWebsocketServer(service_threads, max_message_size);
 }
 
 } // namespace websockets
@@ -31,10 +31,16 @@ namespace websockets
 class WebsocketFactory
 {
   public:
-    /** @brief Instanciate a client websocket */
-    static IWebsocketClient* newClient();
-    /** @brief Instanciate a server websocket */
-    static IWebsocketServer* newServer();
+    /** @brief Default maximum size in bytes of a received message */
+    static constexpr size_t DEFAULT_MAX_MESSAGE_SIZE = 1024u * 1024u;
+
+    /** @brief Instanciate a client websocket
+     *  @param max_message_size Maximum size in bytes of a received message */
+    static IWebsocketClient* newClient(size_t max_message_size = DEFAULT_MAX_MESSAGE_SIZE);
+    /** @brief Instanciate a server websocket
+     *  @param service_threads Number of threads servicing the connections
+     *  @param max_message_size Maximum size in bytes of a received message */
+    static IWebsocketServer* newServer(unsigned int service_threads = 1u, size_t max_message_size = DEFAULT_MAX_MESSAGE_SIZE);
 };
 
 } // namespace websockets
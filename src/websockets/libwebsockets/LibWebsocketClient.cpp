@@ -31,7 +31,7 @@ namespace websockets
 thread_local LibWebsocketClient* client;
 
 /** @brief Constructor */
-LibWebsocketClient::LibWebsocketClient()
+LibWebsocketClient::LibWebsocketClient(size_t max_message_size)
     : IWebsocketClient(),
       m_listener(nullptr),
       m_thread(nullptr),
@@ -48,7 +48,8 @@ LibWebsocketClient::LibWebsocketClient()
       m_wsi(nullptr),
       m_retry_policy(),
       m_retry_count(0),
-      m_send_msgs()
+      m_send_msgs(),
+      m_rx_message(max_message_size)
 {
 }
 /** @brief Destructor */
@@ -356,13 +357,31 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
         }
 
         case LWS_CALLBACK_CLIENT_ESTABLISHED:
+            client->m_rx_message.reset();
             client->m_connected = true;
             client->m_listener->wsClientConnected();
             break;
 
         case LWS_CALLBACK_CLIENT_RECEIVE:
-            client->m_listener->wsClientDataReceived(in, len);
-            break;
+        {
+            // Reassemble fragmented messages
+            switch (client->m_rx_message.push(in, len, (lws_is_final_fragment(wsi) != 0)))
+            {
+                case MessageAssembler::Status::COMPLETE:
+                    client->m_listener->wsClientDataReceived(client->m_rx_message.data(), client->m_rx_message.size());
+                    break;
+
+                case MessageAssembler::Status::TOO_LARGE:
+                    // Close connection
+                    lws_close_reason(wsi, LWS_CLOSE_STATUS_MESSAGE_TOO_LARGE, nullptr, 0);
+                    ret = -1;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        break;
 
         case LWS_CALLBACK_CLIENT_WRITEABLE:
         {
@@ -20,6 +20,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define LIBWEBSOCKETCLIENT_H
 
 #include "IWebsocketClient.h"
+#include "MessageAssembler.h"
 #include "Queue.h"
 #include "Url.h"
 #include "libwebsockets.h"
@@ -37,8 +38,11 @@ namespace websockets
 class LibWebsocketClient : public IWebsocketClient
 {
   public:
-    /** @brief Constructor */
-    LibWebsocketClient();
+    /**
+     * @brief Constructor
+     * @param max_message_size Maximum size in bytes of a received message, bigger messages close the connection
+     */
+    LibWebsocketClient(size_t max_message_size = 1024u * 1024u);
     /** @brief Destructor */
     virtual ~LibWebsocketClient();
 
@@ -120,6 +124,8 @@ class LibWebsocketClient : public IWebsocketClient
 
     /** @brief Queue of messages to send */
     ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+    /** @brief Reassembly of the received messages */
+    MessageAssembler m_rx_message;
 
     /** @brief Internal thread */
     void process();
@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "LibWebsocketServer.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <iostream>
@@ -30,11 +31,19 @@ namespace websockets
 /** @brief Thread local server instance used when callbacks doesn't provide user data */
 thread_local LibWebsocketServer* server;
 
+/** @brief Maximum number of sent messages kept by a client to be reused */
+static constexpr size_t MAX_RECYCLED_MESSAGES = 4u;
+/** @brief Maximum size of a sent message kept to be reused */
+static constexpr size_t MAX_RECYCLED_MESSAGE_SIZE = 16384u;
+
 /** @brief Constructor */
-LibWebsocketServer::LibWebsocketServer()
+LibWebsocketServer::LibWebsocketServer(unsigned int service_threads, size_t max_message_size)
     : IWebsocketServer(),
       m_listener(nullptr),
-      m_thread(nullptr),
+      m_service_threads(std::max(service_threads, 1u)),
+      m_max_message_size(max_message_size),
+      m_threads(),
+      m_running_threads(0),
       m_end(false),
       m_url(),
       m_protocol(""),
@@ -43,6 +52,7 @@ LibWebsocketServer::LibWebsocketServer()
       m_wsi(nullptr),
       m_retry_policy(),
       m_protocols(),
+      m_clients_mutex(),
       m_clients()
 {
 }
@@ -62,8 +72,8 @@ bool LibWebsocketServer::start(const std::string&        url,
 {
     bool ret = false;
 
-    // Check if thread is alive and if a listener has been registered
-    if (!m_thread && m_listener)
+    // Check if threads are alive and if a listener has been registered
+    if (m_threads.empty() && m_listener)
     {
         // Check URL
         m_url = url;
@@ -108,6 +118,7 @@ bool LibWebsocketServer::start(const std::string&        url,
             }
             info.protocols             = &m_protocols[0];
             info.retry_and_idle_policy = &m_retry_policy;
+            info.count_threads         = m_service_threads;
             m_credentials              = credentials;
             if (m_url.protocol() == "wss")
             {
@@ -172,10 +183,15 @@ bool LibWebsocketServer::start(const std::string&        url,
             m_context = lws_create_context(&info);
             if (m_context)
             {
-                // Start server
-                m_end    = false;
-                m_thread = new std::thread(std::bind(&LibWebsocketServer::process, this));
-                ret      = true;
+                // Start server, libwebsockets may allow less threads than requested
+                int thread_count  = lws_get_count_threads(m_context);
+                m_end             = false;
+                m_running_threads = static_cast<unsigned int>(thread_count);
+                for (int tsi = 0; tsi < thread_count; tsi++)
+                {
+                    m_threads.emplace_back(std::bind(&LibWebsocketServer::process, this, tsi));
+                }
+                ret = true;
             }
         }
     }
@@ -188,23 +204,25 @@ bool LibWebsocketServer::stop()
 {
     bool ret = false;
 
-    // Check if thread is alive
-    if (m_thread)
+    // Check if threads are alive
+    if (!m_threads.empty())
     {
-        // Stop thread
+        // Stop threads
         m_end = true;
         lws_cancel_service(m_context);
-        if (std::this_thread::get_id() != m_thread->get_id())
-        {
-            m_thread->join();
-        }
-        else
+        for (std::thread& thread : m_threads)
         {
-            m_thread->detach();
+            if (std::this_thread::get_id() != thread.get_id())
+            {
+                thread.join();
+            }
+            else
+            {
+                thread.detach();
+            }
         }
-        delete m_thread;
-        m_thread = nullptr;
-        ret      = true;
+        m_threads.clear();
+        ret = true;
     }
 
     return ret;
@@ -216,8 +234,8 @@ void LibWebsocketServer::registerListener(IListener& listener)
     m_listener = &listener;
 }
 
-/** @brief Internal thread */
-void LibWebsocketServer::process()
+/** @brief Service thread */
+void LibWebsocketServer::process(int tsi)
 {
     // Save this pointer for further callbacks
     server = this;
@@ -226,16 +244,32 @@ void LibWebsocketServer::process()
     int ret = 0;
     while (!m_end && (ret >= 0))
     {
-        ret = lws_service(m_context, 0);
+        ret = lws_service_tsi(m_context, 0, tsi);
     }
-    if (!m_end)
+    if (!m_end.exchange(true))
     {
         stop();
         m_listener->wsServerError();
     }
 
-    // Destroy context
-    lws_context_destroy(m_context);
+    // Destroy context when all the service threads have ended
+    if (--m_running_threads == 0)
+    {
+        lws_context_destroy(m_context);
+    }
+}
+
+/** @brief Get the client corresponding to a socket */
+std::shared_ptr<LibWebsocketServer::IClient> LibWebsocketServer::findClient(struct lws* wsi)
+{
+    std::shared_ptr<IClient>    client;
+    std::lock_guard<std::mutex> lock(m_clients_mutex);
+    auto                        iter_client = m_clients.find(wsi);
+    if (iter_client != m_clients.end())
+    {
+        client = iter_client->second;
+    }
+    return client;
 }
 
 /** @brief libwebsockets event callback */
@@ -366,8 +400,11 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_ESTABLISHED:
         {
             // Instanciate a new client
-            std::shared_ptr<IClient> client(new Client(wsi));
-            server->m_clients[wsi] = client;
+            std::shared_ptr<IClient> client(new Client(wsi, server->m_max_message_size));
+            {
+                std::lock_guard<std::mutex> lock(server->m_clients_mutex);
+                server->m_clients[wsi] = client;
+            }
 
             // Notify connection
             char uri[lws_hdr_total_length(wsi, WSI_TOKEN_GET_URI) + 1];
@@ -381,11 +418,20 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
 
         case LWS_CALLBACK_CLOSED:
         {
-            // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            // Get and remove corresponding client
+            std::shared_ptr<IClient> client_ptr;
+            {
+                std::lock_guard<std::mutex> lock(server->m_clients_mutex);
+                auto                        iter_client = server->m_clients.find(wsi);
+                if (iter_client != server->m_clients.end())
+                {
+                    client_ptr = iter_client->second;
+                    server->m_clients.erase(iter_client);
+                }
+            }
+            if (client_ptr)
             {
-                Client* client = dynamic_cast<Client*>(iter_client->second.get());
+                Client* client = dynamic_cast<Client*>(client_ptr.get());
 
                 // Disconnect client
                 client->m_connected = false;
@@ -395,9 +441,6 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                 {
                     client->m_listener->wsClientDisconnected();
                 }
-
-                // Remove client
-                server->m_clients.erase(iter_client);
             }
         }
         break;
@@ -405,29 +448,21 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_SERVER_WRITEABLE:
         {
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            std::shared_ptr<IClient> client_ptr = server->findClient(wsi);
+            if (client_ptr)
             {
-                Client* client = dynamic_cast<Client*>(iter_client->second.get());
+                Client* client = dynamic_cast<Client*>(client_ptr.get());
                 if (client->m_connected)
                 {
-
                     // Send data if any ready
-                    SendMsg* msg = nullptr;
-                    if (client->m_send_msgs.pop(msg, 0))
+                    if (!client->writeMessage())
                     {
-                        if (lws_write(client->m_wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
+                        // Error
+                        client->disconnect(true);
+                        if (client->m_listener)
                         {
-                            // Error
-                            client->disconnect(true);
-                            if (client->m_listener)
-                            {
-                                client->m_listener->wsClientError();
-                            }
+                            client->m_listener->wsClientError();
                         }
-
-                        // Free message memory
-                        delete msg;
                     }
                 }
                 else
@@ -443,15 +478,34 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_RECEIVE:
         {
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            std::shared_ptr<IClient> client_ptr = server->findClient(wsi);
+            if (client_ptr)
             {
-                Client* client = dynamic_cast<Client*>(iter_client->second.get());
+                Client* client = dynamic_cast<Client*>(client_ptr.get());
 
-                // Notify client
-                if (client->m_listener)
+                // Reassemble fragmented messages
+                switch (client->m_rx_message.push(in, len, (lws_is_final_fragment(wsi) != 0)))
                 {
-                    client->m_listener->wsClientDataReceived(in, len);
+                    case MessageAssembler::Status::COMPLETE:
+                    {
+                        // Notify client
+                        if (client->m_listener)
+                        {
+                            client->m_listener->wsClientDataReceived(client->m_rx_message.data(), client->m_rx_message.size());
+                        }
+                    }
+                    break;
+
+                    case MessageAssembler::Status::TOO_LARGE:
+                    {
+                        // Close connection
+                        lws_close_reason(wsi, LWS_CLOSE_STATUS_MESSAGE_TOO_LARGE, nullptr, 0);
+                        ret = -1;
+                    }
+                    break;
+
+                    default:
+                        break;
                 }
             }
         }
@@ -465,7 +519,10 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
 }
 
 /** @brief Constructor */
-LibWebsocketServer::Client::Client(struct lws* wsi) : m_wsi(wsi), m_connected(true), m_listener(nullptr), m_send_msgs() { }
+LibWebsocketServer::Client::Client(struct lws* wsi, size_t max_message_size)
+    : m_wsi(wsi), m_connected(true), m_listener(nullptr), m_send_mutex(), m_send_msgs(), m_free_msgs(), m_rx_message(max_message_size)
+{
+}
 /** @brief Destructor */
 LibWebsocketServer::Client::~Client()
 {
@@ -493,11 +550,8 @@ bool LibWebsocketServer::Client::disconnect(bool notify_disconnected)
     }
 
     // Empty message queue
-    SendMsg* msg = nullptr;
-    while (m_send_msgs.pop(msg, 0))
-    {
-        delete msg;
-    }
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+    m_send_msgs.clear();
 
     return ret;
 }
@@ -516,9 +570,23 @@ bool LibWebsocketServer::Client::send(const void* data, size_t size)
     // Check if connected
     if (m_connected)
     {
-        // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
-        ret          = m_send_msgs.push(msg);
+        // Prepare data to send in a recycled message if any
+        {
+            std::lock_guard<std::mutex> lock(m_send_mutex);
+            std::unique_ptr<SendMsg>    msg;
+            if (m_free_msgs.empty())
+            {
+                msg = std::make_unique<SendMsg>();
+            }
+            else
+            {
+                msg = std::move(m_free_msgs.back());
+                m_free_msgs.pop_back();
+            }
+            msg->assign(data, size);
+            m_send_msgs.push_back(std::move(msg));
+        }
+        ret = true;
 
         // Schedule a send
         lws_callback_on_writable(m_wsi);
@@ -533,5 +601,37 @@ void LibWebsocketServer::Client::registerListener(IClient::IListener& listener)
     m_listener = &listener;
 }
 
+/** @brief Write the next queued message */
+bool LibWebsocketServer::Client::writeMessage()
+{
+    bool ret = true;
+
+    std::unique_lock<std::mutex> lock(m_send_mutex);
+    if (!m_send_msgs.empty())
+    {
+        // Write next message, only one write is allowed per writeable callback,
+        // the lock is released so that new messages can be queued meanwhile
+        std::unique_ptr<SendMsg> msg = std::move(m_send_msgs.front());
+        m_send_msgs.pop_front();
+        lock.unlock();
+        ret = (lws_write(m_wsi, msg->payload, msg->size, LWS_WRITE_TEXT) >= static_cast<int>(msg->size));
+        lock.lock();
+
+        // Keep the message buffer for the next messages
+        if ((m_free_msgs.size() < MAX_RECYCLED_MESSAGES) && (msg->capacity <= MAX_RECYCLED_MESSAGE_SIZE))
+        {
+            m_free_msgs.push_back(std::move(msg));
+        }
+
+        // Wait for the socket to be writable again if messages are left
+        if (ret && !m_send_msgs.empty())
+        {
+            lws_callback_on_writable(m_wsi);
+        }
+    }
+
+    return ret;
+}
+
 } // namespace websockets
 } // namespace ocpp
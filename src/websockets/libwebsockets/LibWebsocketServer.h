@@ -20,15 +20,19 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define LIBWEBSOCKETSERVER_H
 
 #include "IWebsocketServer.h"
-#include "Queue.h"
+#include "MessageAssembler.h"
 #include "Url.h"
 #include "libwebsockets.h"
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace ocpp
 {
@@ -39,8 +43,13 @@ namespace websockets
 class LibWebsocketServer : public IWebsocketServer
 {
   public:
-    /** @brief Constructor */
-    LibWebsocketServer();
+    /**
+     * @brief Constructor
+     * @param service_threads Number of threads servicing the connections, the connections are balanced
+     *                        between the threads (limited by the LWS_MAX_SMP setting of libwebsockets)
+     * @param max_message_size Maximum size in bytes of a received message, bigger messages close the connection
+     */
+    LibWebsocketServer(unsigned int service_threads = 1u, size_t max_message_size = 1024u * 1024u);
     /** @brief Destructor */
     virtual ~LibWebsocketServer();
 
@@ -58,24 +67,31 @@ class LibWebsocketServer : public IWebsocketServer
     void registerListener(IListener& listener) override;
 
   private:
-    /** @brief Message to send */
+    /** @brief Message to send, its buffer includes the LWS_PRE headroom needed by lws_write() and is recycled between messages */
     struct SendMsg
     {
         /** @brief Constructor */
-        SendMsg(const void* _data, size_t _size)
+        SendMsg() : data(), payload(nullptr), capacity(0), size(0) { }
+
+        /** @brief Copy the message data, the buffer is reallocated only if it is too small */
+        void assign(const void* _data, size_t _size)
         {
-            data    = new unsigned char[LWS_PRE + _size];
-            size    = _size;
-            payload = &data[LWS_PRE];
+            if (capacity < _size)
+            {
+                data     = std::make_unique<unsigned char[]>(LWS_PRE + _size);
+                payload  = &data[LWS_PRE];
+                capacity = _size;
+            }
+            size = _size;
             memcpy(payload, _data, size);
         }
-        /** @brief Destructor */
-        virtual ~SendMsg() { delete[] data; }
 
         /** @brief Data buffer */
-        unsigned char* data;
+        std::unique_ptr<unsigned char[]> data;
         /** @brief Payload start */
         unsigned char* payload;
+        /** @brief Payload capacity in bytes */
+        size_t capacity;
         /** @brief Size in bytes */
         size_t size;
     };
@@ -89,8 +105,9 @@ class LibWebsocketServer : public IWebsocketServer
         /**
          * @brief Constructor
          * @param wsi Client socket
+         * @param max_message_size Maximum size in bytes of a received message
         */
-        Client(struct lws* wsi);
+        Client(struct lws* wsi, size_t max_message_size);
         /** @brief Destructor */
         virtual ~Client();
 
@@ -113,16 +130,32 @@ class LibWebsocketServer : public IWebsocketServer
         bool m_connected;
         /** @brief Listener */
         IClient::IListener* m_listener;
+        /** @brief Mutex for concurrent access to the messages */
+        std::mutex m_send_mutex;
         /** @brief Queue of messages to send */
-        ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+        std::deque<std::unique_ptr<SendMsg>> m_send_msgs;
+        /** @brief Sent messages kept to be reused */
+        std::vector<std::unique_ptr<SendMsg>> m_free_msgs;
+        /** @brief Reassembly of the received messages */
+        MessageAssembler m_rx_message;
+
+        /** @brief Write the next queued message
+         *  @return true if the message has been written, false if a write error occured */
+        bool writeMessage();
     };
 
     /** @brief Listener */
     IListener* m_listener;
-    /** @brief Internal thread */
-    std::thread* m_thread;
-    /** @brief Indicate the end of processing to the thread */
-    bool m_end;
+    /** @brief Number of service threads requested */
+    unsigned int m_service_threads;
+    /** @brief Maximum size in bytes of a received message */
+    size_t m_max_message_size;
+    /** @brief Service threads */
+    std::vector<std::thread> m_threads;
+    /** @brief Number of service threads still running */
+    std::atomic<unsigned int> m_running_threads;
+    /** @brief Indicate the end of processing to the threads */
+    std::atomic<bool> m_end;
     /** @brief Connection URL */
     Url m_url;
     /** @brief Name of the protocol to use */
@@ -139,11 +172,17 @@ class LibWebsocketServer : public IWebsocketServer
     /** @brief Protocols */
     std::array<struct lws_protocols, 2u> m_protocols;
 
+    /** @brief Mutex for concurrent access to the connected clients from the service threads */
+    std::mutex m_clients_mutex;
     /** @brief Connected clients */
     std::map<struct lws*, std::shared_ptr<IClient>> m_clients;
 
-    /** @brief Internal thread */
-    void process();
+    /** @brief Service thread
+     *  @param tsi Thread service index */
+    void process(int tsi);
+
+    /** @brief Get the client corresponding to a socket */
+    std::shared_ptr<IClient> findClient(struct lws* wsi);
 
     /** @brief libwebsockets event callback */
     static int eventCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len);
@@ -0,0 +1,120 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+/*
+ * Common tools of the micro-benchmarks
+ *
+ * The number of dynamic allocations and the number of allocated bytes are counted by replacing
+ * the global allocation operators, so this header must be included by a single translation unit
+ * of each benchmark executable.
+ */
+
+/** @brief Number of allocations */
+static std::atomic<size_t> s_allocations(0);
+/** @brief Number of allocated bytes */
+static std::atomic<size_t> s_allocated_bytes(0);
+
+void* operator new(size_t size)
+{
+    s_allocations++;
+    s_allocated_bytes += size;
+    void* ptr = std::malloc(size ? size : 1u);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/** @brief Measure of a benchmarked operation */
+struct Measure
+{
+    /** @brief Duration per operation in ns */
+    double ns;
+    /** @brief Allocations per operation */
+    double allocs;
+    /** @brief Allocated bytes per operation */
+    double bytes;
+};
+
+/**
+ * @brief Measure an operation
+ * @param iterations Number of times the operation is executed
+ * @param function Operation, called with the index of the iteration (a first call with index 0 warms up the operation)
+ * @return Mean duration and allocations of the operation
+ */
+template <typename Function>
+inline Measure measure(size_t iterations, Function function)
+{
+    // Warm up
+    function(0);
+
+    size_t allocations = s_allocations;
+    size_t bytes       = s_allocated_bytes;
+    auto   start       = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        function(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    Measure result;
+    double count  = static_cast<double>(iterations);
+    result.ns     = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / count;
+    result.allocs = static_cast<double>(s_allocations - allocations) / count;
+    result.bytes  = static_cast<double>(s_allocated_bytes - bytes) / count;
+    return result;
+}
+
+/** @brief Width of a measure displayed as a column */
+static constexpr int MEASURE_WIDTH = 21;
+
+/** @brief Display the duration and the allocations of a measure as a column */
+inline void report(const Measure& measure)
+{
+    std::cout << std::fixed << std::setprecision(1) << std::setw(MEASURE_WIDTH - 11) << measure.ns << " ns" << std::setw(6)
+              << measure.allocs << " a";
+}
+
+/** @brief Display a named measure on its own line */
+inline void report(const char* name, const Measure& measure)
+{
+    std::cout << std::left << std::setw(42) << name << std::right;
+    report(measure);
+    std::cout << std::setw(10) << measure.bytes << " B" << std::endl;
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AuthentLocalList.h"
+#include "ChargePointConfigStub.h"
+#include "Database.h"
+#include "GenericMessagesConverter.h"
+#include "InternalConfigManager.h"
+#include "MessageDispatcherStub.h"
+#include "OcppConfigStub.h"
+#include "SendLocalList.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::config;
+using namespace ocpp::database;
+using namespace ocpp::messages;
+using namespace ocpp::types;
+
+/*
+ * Benchmark of the authentication local list updates
+ *
+ * A full update of the given number of entries is sent, first written directly in the current table,
+ * then using the double buffered tables. A differential update of a tenth of the entries follows.
+ * The 'wal' option opens the database in write-ahead log mode with normal synchronous writes,
+ * otherwise SQLite defaults are used (rollback journal, full synchronous writes).
+ * The 'legacy' option adds the insertion of the entries with one autocommitted query each as it was
+ * done by previous versions.
+ *
+ * Usage : bench_authent_locallist [entries=50000] [wal] [legacy]
+ */
+
+/** @brief Display the throughput of an update */
+static void display(const char* name, size_t entries, std::chrono::steady_clock::time_point start, bool success)
+{
+    auto   end = std::chrono::steady_clock::now();
+    auto   ms  = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    double eps = (static_cast<double>(entries) * 1000.) / static_cast<double>((ms == 0) ? 1 : ms);
+    std::cout << std::setw(14) << name << " : " << std::setw(8) << entries << " entries in " << std::setw(8) << ms << " ms => "
+              << std::setw(10) << static_cast<unsigned long>(eps) << " entries/s" << (success ? "" : " (failed)") << std::endl;
+}
+
+/** @brief Send a local list update */
+static bool sendLocalList(AuthentLocalList& local_list, int version, UpdateType type, size_t entries, size_t first_entry)
+{
+    SendLocalListReq send_req;
+    send_req.listVersion = version;
+    send_req.updateType  = type;
+    send_req.localAuthorizationList.resize(entries);
+    for (size_t i = 0; i < entries; i++)
+    {
+        AuthorizationData& auth_data = send_req.localAuthorizationList[i];
+        auth_data.idTag.assign("TAG" + std::to_string(first_entry + i));
+        auth_data.idTagInfo.value().status     = AuthorizationStatus::Accepted;
+        auth_data.idTagInfo.value().expiryDate = DateTime(DateTime::now().timestamp() + 3600);
+    }
+
+    SendLocalListConf send_resp;
+    const char*       error_code = nullptr;
+    std::string       error_message;
+    local_list.handleMessage(send_req, send_resp, error_code, error_message);
+    return (send_resp.status == UpdateStatus::Accepted);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t entries = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 50000u;
+    bool   wal     = false;
+    bool   legacy  = false;
+    for (int i = 2; i < argc; i++)
+    {
+        wal    = wal || (std::strcmp(argv[i], "wal") == 0);
+        legacy = legacy || (std::strcmp(argv[i], "legacy") == 0);
+    }
+
+    std::filesystem::path db_path = std::filesystem::temp_directory_path();
+    db_path.append("bench_authent_locallist.db");
+    std::filesystem::remove(db_path);
+
+    Database database;
+    database.open(db_path, wal, wal ? "NORMAL" : "");
+
+    ChargePointConfigStub    cp_config;
+    OcppConfigStub           ocpp_config;
+    InternalConfigManager    internal_config(database);
+    GenericMessagesConverter msg_converter;
+    MessageDispatcherStub    msg_dispatcher;
+    ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
+    ocpp_config.setConfigValue("LocalAuthListMaxLength", std::to_string(entries));
+    ocpp_config.setConfigValue("SendLocalListMaxLength", std::to_string(entries));
+    internal_config.initDatabaseTable();
+
+    AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+
+    // Previous versions
+    if (legacy)
+    {
+        auto query = database.query("INSERT INTO AuthentLocalList2 VALUES (NULL, ?, '', ?, 0);");
+        auto start = std::chrono::steady_clock::now();
+        bool ret   = (query != nullptr);
+        for (size_t i = 0; ret && (i < entries); i++)
+        {
+            query->bind(0, "TAG" + std::to_string(i));
+            query->bind(1, DateTime::now().timestamp() + 3600);
+            ret = query->exec();
+            query->reset();
+        }
+        display("legacy", entries, start, ret);
+        query = database.query("DELETE FROM AuthentLocalList2;");
+        query->exec();
+    }
+
+    // Single transaction
+    auto start = std::chrono::steady_clock::now();
+    bool ret   = sendLocalList(local_list, 1, UpdateType::Full, entries, 0);
+    display("full", entries, start, ret);
+
+    // Double buffered tables
+    cp_config.setConfigValue("AuthentLocalListDoubleBuffering", "true");
+    start = std::chrono::steady_clock::now();
+    ret   = sendLocalList(local_list, 2, UpdateType::Full, entries, 0);
+    display("double buffer", entries, start, ret);
+
+    // Differential update : half of the entries are updated, the other half is new
+    start = std::chrono::steady_clock::now();
+    ret   = sendLocalList(local_list, 3, UpdateType::Differential, entries / 10u, entries - entries / 20u);
+    display("differential", entries / 10u, start, ret);
+
+    database.close();
+    std::filesystem::remove(db_path);
+
+    return 0;
+}
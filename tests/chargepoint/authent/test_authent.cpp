@@ -56,7 +56,6 @@ static void setAuthorizeResponse(RpcStub& rpc, const IdTagInfo& tag_info)
     rapidjson::Document json_resp;
     json_resp.Parse("{}");
     AuthorizeConfConverter converter;
-    converter.setAllocator(&json_resp.GetAllocator());
     converter.toJson(resp, json_resp);
 
     rpc.setResponse(json_resp);
@@ -87,7 +86,7 @@ TEST_SUITE("Authentication component")
         GenericMessagesConverter msg_converter;
         MessageDispatcherStub    msg_dispatcher;
 
-        AuthentLocalList local_list(ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
 
         SendLocalListReq send_req;
         send_req.listVersion = 1;
@@ -55,6 +55,14 @@ TEST_SUITE("Authentication cache")
 
         cp_config.setConfigValue("AuthentCacheMaxEntriesCount", "5");
         ocpp_config.setConfigValue("AuthorizationCacheEnabled", "true");
+        SUBCASE("Database lookup")
+        {
+            cp_config.setConfigValue("AuthentInMemoryIndex", "false");
+        }
+        SUBCASE("In-memory index")
+        {
+            cp_config.setConfigValue("AuthentInMemoryIndex", "true");
+        }
 
         AuthentCache cache(cp_config, ocpp_config, database, msg_converter, msg_dispatcher);
 
@@ -178,6 +186,45 @@ TEST_SUITE("Authentication cache")
         CHECK(error_message.empty());
     }
 
+    TEST_CASE("Migration")
+    {
+        ChargePointConfigStub    cp_config;
+        OcppConfigStub           ocpp_config;
+        GenericMessagesConverter msg_converter;
+        MessageDispatcherStub    msg_dispatcher;
+
+        cp_config.setConfigValue("AuthentCacheMaxEntriesCount", "5");
+        cp_config.setConfigValue("AuthentInMemoryIndex", "true");
+        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "true");
+
+        // Table of a previous version : no unique index, duplicated tags
+        auto query = database.query("DROP INDEX AuthentCache_tag;");
+        REQUIRE(query);
+        CHECK(query->exec());
+        query = database.query("INSERT INTO AuthentCache VALUES (NULL, 'TAG1', '', NULL, 2);");
+        REQUIRE(query);
+        CHECK(query->exec());
+        query = database.query("INSERT INTO AuthentCache VALUES (NULL, 'TAG1', '', NULL, 0);");
+        REQUIRE(query);
+        CHECK(query->exec());
+
+        AuthentCache cache(cp_config, ocpp_config, database, msg_converter, msg_dispatcher);
+
+        // Most recent entry is kept
+        IdTagInfo tag_info;
+        CHECK(cache.check("TAG1", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Accepted);
+        query = database.query("SELECT COUNT(*) FROM AuthentCache WHERE tag='TAG1';");
+        REQUIRE(query);
+        CHECK(query->exec());
+        CHECK_EQ(query->getInt32(0), 1);
+
+        // Index has been created
+        query = database.query("INSERT INTO AuthentCache VALUES (NULL, 'TAG1', '', NULL, 0);");
+        REQUIRE(query);
+        CHECK_FALSE(query->exec());
+    }
+
     TEST_CASE("Cleanup")
     {
         CHECK(database.close());
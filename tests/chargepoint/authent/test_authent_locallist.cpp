@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "AuthentLocalList.h"
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ChargePointConfigStub.h"
 #include "Database.h"
 #include "GenericMessagesConverter.h"
 #include "GetLocalListVersion.h"
@@ -39,6 +40,22 @@ static constexpr const char* DATABASE_PATH = "/tmp/test.db";
 
 Database database;
 
+/** @brief Internal configuration which can fail to save the local list version */
+class FailingInternalConfigManager : public InternalConfigManager
+{
+  public:
+    FailingInternalConfigManager(Database& database) : InternalConfigManager(database), fail_version(false) { }
+    bool setKey(const std::string& key, const std::string& value) override
+    {
+        if (fail_version && (key == "LocalListVersion"))
+        {
+            return false;
+        }
+        return InternalConfigManager::setKey(key, value);
+    }
+    bool fail_version;
+};
+
 TEST_SUITE("Authentication local list")
 {
     TEST_CASE("Setup")
@@ -49,6 +66,7 @@ TEST_SUITE("Authentication local list")
 
     TEST_CASE("Full update")
     {
+        ChargePointConfigStub    cp_config;
         OcppConfigStub           ocpp_config;
         InternalConfigManager    internal_config(database);
         GenericMessagesConverter msg_converter;
@@ -59,7 +77,7 @@ TEST_SUITE("Authentication local list")
         ocpp_config.setConfigValue("SendLocalListMaxLength", "3");
         internal_config.initDatabaseTable();
 
-        AuthentLocalList local_list(ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
 
         // Check register to message handler
         CHECK(msg_dispatcher.hasHandler(GET_LOCAL_LIST_VERSION_ACTION));
@@ -199,6 +217,7 @@ TEST_SUITE("Authentication local list")
 
     TEST_CASE("Differential update")
     {
+        ChargePointConfigStub    cp_config;
         OcppConfigStub           ocpp_config;
         InternalConfigManager    internal_config(database);
         GenericMessagesConverter msg_converter;
@@ -207,9 +226,10 @@ TEST_SUITE("Authentication local list")
         ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
         ocpp_config.setConfigValue("LocalAuthListMaxLength", "5");
         ocpp_config.setConfigValue("SendLocalListMaxLength", "5");
+        cp_config.setConfigValue("AuthentInMemoryIndex", "true");
         internal_config.initDatabaseTable();
 
-        AuthentLocalList local_list(ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
 
         // Check version
         GetLocalListVersionReq  version_req;
@@ -312,10 +332,180 @@ TEST_SUITE("Authentication local list")
         CHECK_EQ(tag_info.parentIdTag.value().str(), "PARENT_TAG8");
         CHECK(tag_info.expiryDate.isSet());
         CHECK_EQ(tag_info.expiryDate.value().timestamp(), tag8_expiry);
+
+        // Check the loading of the in-memory index from the database
+        MessageDispatcherStub msg_dispatcher2;
+        AuthentLocalList      local_list2(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher2);
+        CHECK(local_list2.check("TAG5", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Accepted);
+        CHECK_FALSE(tag_info.parentIdTag.isSet());
+        CHECK_FALSE(tag_info.expiryDate.isSet());
+        CHECK_FALSE(local_list2.check("TAG6", tag_info));
+        CHECK_FALSE(local_list2.check("TAG7", tag_info));
+        CHECK(local_list2.check("TAG8", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Blocked);
+        CHECK_EQ(tag_info.parentIdTag.value().str(), "PARENT_TAG8");
+        CHECK_EQ(tag_info.expiryDate.value().timestamp(), tag8_expiry);
+    }
+
+    TEST_CASE("Double buffered full update")
+    {
+        ChargePointConfigStub    cp_config;
+        OcppConfigStub           ocpp_config;
+        InternalConfigManager    internal_config(database);
+        GenericMessagesConverter msg_converter;
+        MessageDispatcherStub    msg_dispatcher;
+
+        cp_config.setConfigValue("AuthentLocalListDoubleBuffering", "true");
+        ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
+        ocpp_config.setConfigValue("LocalAuthListMaxLength", "5");
+        ocpp_config.setConfigValue("SendLocalListMaxLength", "5");
+        internal_config.initDatabaseTable();
+
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+
+        // Full update with a duplicated tag, the last one is kept
+        SendLocalListReq send_req;
+        send_req.listVersion = 5;
+        send_req.updateType  = UpdateType::Full;
+        AuthorizationData auth_data;
+        auth_data.idTag.assign("TAG1");
+        auth_data.idTagInfo.value().status = AuthorizationStatus::Blocked;
+        send_req.localAuthorizationList.push_back(auth_data);
+        auth_data.idTag.assign("TAG2");
+        auth_data.idTagInfo.value().status = AuthorizationStatus::Invalid;
+        auth_data.idTagInfo.value().parentIdTag.value().assign("PARENT_TAG2");
+        send_req.localAuthorizationList.push_back(auth_data);
+        auth_data.idTag.assign("TAG1");
+        auth_data.idTagInfo.value().status = AuthorizationStatus::Accepted;
+        auth_data.idTagInfo.value().parentIdTag.clear();
+        send_req.localAuthorizationList.push_back(auth_data);
+        SendLocalListConf send_resp;
+        const char*       error_code = nullptr;
+        std::string       error_message;
+
+        CHECK(local_list.handleMessage(send_req, send_resp, error_code, error_message));
+        CHECK_EQ(send_resp.status, UpdateStatus::Accepted);
+
+        // Check contents
+        IdTagInfo tag_info;
+        CHECK(local_list.check("TAG1", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Accepted);
+        CHECK_FALSE(tag_info.parentIdTag.isSet());
+        CHECK(local_list.check("TAG2", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Invalid);
+        CHECK_EQ(tag_info.parentIdTag.value().str(), "PARENT_TAG2");
+        CHECK_FALSE(local_list.check("TAG5", tag_info));
+        CHECK_FALSE(local_list.check("TAG8", tag_info));
+
+        // Check that the tables have been swapped
+        std::string current_table;
+        CHECK(internal_config.getKey("LocalListTable", current_table));
+        CHECK_EQ(current_table, "1");
+        std::string list_version;
+        CHECK(internal_config.getKey("LocalListVersion", list_version));
+        CHECK_EQ(list_version, "5");
+        auto query = database.query("SELECT COUNT(*) FROM AuthentLocalList;");
+        REQUIRE(query);
+        CHECK(query->exec());
+        CHECK_EQ(query->getInt32(0), 0);
+
+        // Differential update on the new table
+        send_req.listVersion = 6;
+        send_req.updateType  = UpdateType::Differential;
+        send_req.localAuthorizationList.clear();
+        auth_data.idTag.assign("TAG2");
+        auth_data.idTagInfo.clear();
+        send_req.localAuthorizationList.push_back(auth_data);
+        auth_data.idTag.assign("TAG3");
+        auth_data.idTagInfo.value().status = AuthorizationStatus::Accepted;
+        send_req.localAuthorizationList.push_back(auth_data);
+
+        CHECK(local_list.handleMessage(send_req, send_resp, error_code, error_message));
+        CHECK_EQ(send_resp.status, UpdateStatus::Accepted);
+
+        CHECK(local_list.check("TAG1", tag_info));
+        CHECK_FALSE(local_list.check("TAG2", tag_info));
+        CHECK(local_list.check("TAG3", tag_info));
+        CHECK_EQ(tag_info.status, AuthorizationStatus::Accepted);
+
+        // Current table is restored at startup
+        MessageDispatcherStub msg_dispatcher2;
+        AuthentLocalList      local_list2(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher2);
+        CHECK(local_list2.check("TAG1", tag_info));
+        CHECK_FALSE(local_list2.check("TAG2", tag_info));
+        CHECK(local_list2.check("TAG3", tag_info));
+    }
+
+    TEST_CASE("Double buffered full update - version not saved")
+    {
+        ChargePointConfigStub        cp_config;
+        OcppConfigStub               ocpp_config;
+        FailingInternalConfigManager internal_config(database);
+        GenericMessagesConverter     msg_converter;
+        MessageDispatcherStub        msg_dispatcher;
+
+        cp_config.setConfigValue("AuthentLocalListDoubleBuffering", "true");
+        ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
+        ocpp_config.setConfigValue("LocalAuthListMaxLength", "5");
+        ocpp_config.setConfigValue("SendLocalListMaxLength", "5");
+        internal_config.initDatabaseTable();
+
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+
+        // The tables are not swapped when the version cannot be saved
+        internal_config.fail_version = true;
+        SendLocalListReq send_req;
+        send_req.listVersion = 7;
+        send_req.updateType  = UpdateType::Full;
+        AuthorizationData auth_data;
+        auth_data.idTag.assign("TAG9");
+        auth_data.idTagInfo.value().status = AuthorizationStatus::Accepted;
+        send_req.localAuthorizationList.push_back(auth_data);
+        SendLocalListConf send_resp;
+        const char*       error_code = nullptr;
+        std::string       error_message;
+
+        CHECK(local_list.handleMessage(send_req, send_resp, error_code, error_message));
+        CHECK_EQ(send_resp.status, UpdateStatus::Failed);
+
+        std::string current_table;
+        CHECK(internal_config.getKey("LocalListTable", current_table));
+        CHECK_EQ(current_table, "1");
+        std::string list_version;
+        CHECK(internal_config.getKey("LocalListVersion", list_version));
+        CHECK_EQ(list_version, "6");
+
+        IdTagInfo tag_info;
+        CHECK(local_list.check("TAG1", tag_info));
+        CHECK_FALSE(local_list.check("TAG9", tag_info));
+
+        GetLocalListVersionReq  version_req;
+        GetLocalListVersionConf version_resp;
+        CHECK(local_list.handleMessage(version_req, version_resp, error_code, error_message));
+        CHECK_EQ(version_resp.listVersion, 6);
+
+        // Same list at startup
+        MessageDispatcherStub msg_dispatcher2;
+        AuthentLocalList      local_list2(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher2);
+        CHECK(local_list2.check("TAG1", tag_info));
+        CHECK_FALSE(local_list2.check("TAG9", tag_info));
+
+        // Update once the version can be saved
+        internal_config.fail_version = false;
+        CHECK(local_list.handleMessage(send_req, send_resp, error_code, error_message));
+        CHECK_EQ(send_resp.status, UpdateStatus::Accepted);
+        CHECK(internal_config.getKey("LocalListTable", current_table));
+        CHECK_EQ(current_table, "0");
+        CHECK(internal_config.getKey("LocalListVersion", list_version));
+        CHECK_EQ(list_version, "7");
+        CHECK_FALSE(local_list.check("TAG1", tag_info));
+        CHECK(local_list.check("TAG9", tag_info));
     }
 
     TEST_CASE("Disabled")
     {
+        ChargePointConfigStub    cp_config;
         OcppConfigStub           ocpp_config;
         InternalConfigManager    internal_config(database);
         GenericMessagesConverter msg_converter;
@@ -326,7 +516,7 @@ TEST_SUITE("Authentication local list")
         ocpp_config.setConfigValue("SendLocalListMaxLength", "3");
         internal_config.initDatabaseTable();
 
-        AuthentLocalList local_list(ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
+        AuthentLocalList local_list(cp_config, ocpp_config, database, internal_config, msg_converter, msg_dispatcher);
 
         // Check version
         GetLocalListVersionReq  version_req;
@@ -0,0 +1,281 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RequestFifo.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ChargePointConfigStub.h"
+#include "Database.h"
+#include "doctest.h"
+
+#include <filesystem>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::config;
+using namespace ocpp::database;
+using namespace ocpp::messages;
+
+static constexpr const char* DATABASE_PATH = "/tmp/test_requestfifo.db";
+
+Database database;
+
+/** @brief Build a MeterValues request payload */
+static rapidjson::Document meterValues(int transaction_id, unsigned int count, unsigned int first_value)
+{
+    std::string json = "{\"connectorId\":1,";
+    if (transaction_id != 0)
+    {
+        json += "\"transactionId\":" + std::to_string(transaction_id) + ",";
+    }
+    json += "\"meterValue\":[";
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (i != 0)
+        {
+            json += ",";
+        }
+        json += "{\"timestamp\":\"2023-01-01T00:00:00Z\",\"sampledValue\":[{\"value\":\"" + std::to_string(first_value + i) + "\"}]}";
+    }
+    json += "]}";
+
+    rapidjson::Document payload;
+    payload.Parse(json.c_str());
+    return payload;
+}
+
+/** @brief Build a transaction request payload */
+static rapidjson::Document transaction(int transaction_id)
+{
+    rapidjson::Document payload;
+    payload.Parse(("{\"connectorId\":1,\"transactionId\":" + std::to_string(transaction_id) + "}").c_str());
+    return payload;
+}
+
+/** @brief Get the values of the meter values stored in a MeterValues request */
+static std::vector<std::string> values(const rapidjson::Document& payload)
+{
+    std::vector<std::string> ret;
+    for (const auto& meter_value : payload["meterValue"].GetArray())
+    {
+        ret.push_back(meter_value["sampledValue"][0]["value"].GetString());
+    }
+    return ret;
+}
+
+TEST_SUITE("Request FIFO")
+{
+    TEST_CASE("Setup")
+    {
+        std::filesystem::remove(DATABASE_PATH);
+        CHECK(database.open(DATABASE_PATH));
+    }
+
+    TEST_CASE("Standard operations")
+    {
+        ChargePointConfigStub cp_config;
+        cp_config.setConfigValue("RequestFifoMaxSize", "0");
+
+        RequestFifo fifo(cp_config, database);
+        fifo.initDatabaseTable();
+        CHECK(fifo.empty());
+
+        fifo.push(1u, "StartTransaction", transaction(-1));
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 10u));
+        fifo.push(2u, "MeterValues", meterValues(0, 1u, 20u));
+        fifo.push(1u, "StopTransaction", transaction(-1));
+        CHECK_EQ(fifo.size(), 4u);
+
+        // Single request access
+        unsigned int        connector_id = 0;
+        std::string         action;
+        rapidjson::Document payload;
+        CHECK(fifo.front(connector_id, action, payload));
+        CHECK_EQ(connector_id, 1u);
+        CHECK_EQ(action, "StartTransaction");
+        CHECK_EQ(payload["transactionId"].GetInt(), -1);
+        fifo.pop();
+        CHECK_EQ(fifo.size(), 3u);
+
+        // Batch access
+        std::vector<IRequestFifo::Request> requests;
+        CHECK_EQ(fifo.front(requests, 2u), 2u);
+        CHECK_EQ(requests[0].connector_id, 1u);
+        CHECK_EQ(requests[0].action, "MeterValues");
+        CHECK_EQ(values(requests[0].payload), std::vector<std::string>{"10"});
+        CHECK_EQ(requests[1].connector_id, 2u);
+        CHECK_EQ(requests[1].action, "MeterValues");
+        CHECK_EQ(values(requests[1].payload), std::vector<std::string>{"20"});
+        CHECK_EQ(fifo.size(), 3u);
+
+        // Out of order deletion
+        fifo.pop(requests[1].id);
+        CHECK_EQ(fifo.size(), 2u);
+        CHECK(fifo.front(connector_id, action, payload));
+        CHECK_EQ(action, "MeterValues");
+        CHECK_EQ(connector_id, 1u);
+
+        // Persistency
+        RequestFifo fifo2(cp_config, database);
+        fifo2.initDatabaseTable();
+        CHECK_EQ(fifo2.size(), 2u);
+        CHECK_EQ(fifo2.front(requests, 10u), 2u);
+        CHECK_EQ(requests[0].action, "MeterValues");
+        CHECK_EQ(requests[1].action, "StopTransaction");
+
+        fifo2.pop();
+        fifo2.pop();
+        CHECK(fifo2.empty());
+    }
+
+    TEST_CASE("Capacity management")
+    {
+        ChargePointConfigStub cp_config;
+        cp_config.setConfigValue("RequestFifoMaxSize", "4");
+
+        RequestFifo fifo(cp_config, database);
+        fifo.initDatabaseTable();
+        CHECK(fifo.empty());
+
+        // Fill the FIFO
+        fifo.push(1u, "StartTransaction", transaction(-1));
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 1u));
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 2u));
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 3u));
+        CHECK_EQ(fifo.size(), 4u);
+
+        // Oldest meter values are merged into the following ones
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 4u));
+        CHECK_EQ(fifo.size(), 4u);
+
+        std::vector<IRequestFifo::Request> requests;
+        CHECK_EQ(fifo.front(requests, 1u), 1u);
+        CHECK_EQ(requests[0].action, "StartTransaction");
+
+        // Next merges are spread over the FIFO
+        fifo.push(1u, "MeterValues", meterValues(-1, 1u, 5u));
+        CHECK_EQ(fifo.size(), 4u);
+        fifo.push(1u, "StopTransaction", transaction(-1));
+        CHECK_EQ(fifo.size(), 4u);
+
+        CHECK_EQ(fifo.front(requests, 10u), 4u);
+        CHECK_EQ(requests[0].action, "StartTransaction");
+        CHECK_EQ(requests[1].action, "MeterValues");
+        CHECK_EQ(values(requests[1].payload), std::vector<std::string>{"1", "2", "3", "4"});
+        CHECK_EQ(requests[2].action, "MeterValues");
+        CHECK_EQ(values(requests[2].payload), std::vector<std::string>{"5"});
+        CHECK_EQ(requests[3].action, "StopTransaction");
+
+        // Merged requests are persistent
+        RequestFifo fifo2(cp_config, database);
+        fifo2.initDatabaseTable();
+        CHECK_EQ(fifo2.front(requests, 10u), 4u);
+        CHECK_EQ(values(requests[1].payload), std::vector<std::string>{"1", "2", "3", "4"});
+        CHECK_EQ(values(requests[2].payload), std::vector<std::string>{"5"});
+
+        // Meter values which have been retrieved for sending are never merged
+        fifo2.pop();
+        fifo2.push(1u, "StartTransaction", transaction(-2));
+        CHECK_EQ(fifo2.size(), 4u);
+        fifo2.push(1u, "StopTransaction", transaction(-2));
+        CHECK_EQ(fifo2.size(), 5u);
+
+        // Transaction requests are never dropped
+        fifo2.push(1u, "StartTransaction", transaction(-3));
+        CHECK_EQ(fifo2.size(), 6u);
+
+        while (!fifo2.empty())
+        {
+            fifo2.pop();
+        }
+    }
+
+    TEST_CASE("Downsampling")
+    {
+        ChargePointConfigStub cp_config;
+        cp_config.setConfigValue("RequestFifoMaxSize", "2");
+
+        RequestFifo fifo(cp_config, database);
+        fifo.initDatabaseTable();
+        CHECK(fifo.empty());
+
+        // Meter values of different transactions are not merged
+        fifo.push(1u, "MeterValues", meterValues(5, 20u, 0u));
+        fifo.push(1u, "MeterValues", meterValues(6, 20u, 100u));
+        fifo.push(1u, "MeterValues", meterValues(6, 20u, 200u));
+        CHECK_EQ(fifo.size(), 2u);
+
+        std::vector<IRequestFifo::Request> requests;
+        CHECK_EQ(fifo.front(requests, 10u), 2u);
+        CHECK_EQ(requests[0].payload["transactionId"].GetInt(), 5);
+        CHECK_EQ(requests[1].payload["transactionId"].GetInt(), 6);
+
+        // Merged meter values are downsampled to stay under the limit
+        std::vector<std::string> merged = values(requests[1].payload);
+        CHECK_EQ(merged.size(), 20u);
+        CHECK_LE(merged.size(), RequestFifo::MAX_MERGED_METER_VALUES);
+        CHECK_EQ(merged.front(), "101");
+        CHECK_EQ(merged[1], "103");
+        CHECK_EQ(merged.back(), "219");
+
+        fifo.pop();
+        fifo.pop();
+        CHECK(fifo.empty());
+    }
+
+    TEST_CASE("Selected requests")
+    {
+        ChargePointConfigStub cp_config;
+        cp_config.setConfigValue("RequestFifoMaxSize", "3");
+
+        RequestFifo fifo(cp_config, database);
+        fifo.initDatabaseTable();
+        CHECK(fifo.empty());
+
+        fifo.push(2u, "MeterValues", meterValues(7, 1u, 1u));
+        fifo.push(2u, "MeterValues", meterValues(7, 1u, 2u));
+        fifo.push(1u, "StartTransaction", transaction(-1));
+
+        // Only the selected requests are retrieved
+        std::vector<IRequestFifo::Request> requests;
+        auto                               connector_1 = [](unsigned int connector_id, const std::string&)
+        { return ((connector_id == 1u) ? IRequestFifo::Selection::Select : IRequestFifo::Selection::Skip); };
+        CHECK_EQ(fifo.front(requests, 10u, connector_1), 1u);
+        CHECK_EQ(requests[0].action, "StartTransaction");
+        auto end = [](unsigned int, const std::string&) { return IRequestFifo::Selection::End; };
+        CHECK_EQ(fifo.front(requests, 10u, end), 0u);
+
+        // The skipped requests can still be merged
+        fifo.push(1u, "StopTransaction", transaction(-1));
+        CHECK_EQ(fifo.size(), 3u);
+        CHECK_EQ(fifo.front(requests, 10u), 3u);
+        CHECK_EQ(requests[0].action, "MeterValues");
+        CHECK_EQ(values(requests[0].payload), std::vector<std::string>{"1", "2"});
+        CHECK_EQ(requests[1].action, "StartTransaction");
+        CHECK_EQ(requests[2].action, "StopTransaction");
+
+        while (!fifo.empty())
+        {
+            fifo.pop();
+        }
+    }
+
+    TEST_CASE("Cleanup")
+    {
+        CHECK(database.close());
+        std::filesystem::remove(DATABASE_PATH);
+    }
+}
@@ -0,0 +1,341 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RequestFifoManager.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "AuthentManager.h"
+#include "ChargePointConfigStub.h"
+#include "ChargePointEventsHandlerStub.h"
+#include "Connectors.h"
+#include "Database.h"
+#include "GenericMessageSender.h"
+#include "InternalConfigManager.h"
+#include "MessageDispatcherStub.h"
+#include "MessagesConverter.h"
+#include "MeterValues.h"
+#include "OcppConfigStub.h"
+#include "RequestFifoStub.h"
+#include "RpcStub.h"
+#include "StartTransaction.h"
+#include "StatusManagerStub.h"
+#include "StopTransaction.h"
+#include "TestableTimerPool.h"
+#include "TestableWorkerThreadPool.h"
+#include "doctest.h"
+
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::config;
+using namespace ocpp::database;
+using namespace ocpp::helpers;
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+using namespace ocpp::types;
+
+static constexpr const char* DATABASE_PATH = "/tmp/test.db";
+
+Database                     database;
+ChargePointConfigStub        cp_config;
+OcppConfigStub               ocpp_config;
+InternalConfigManager        internal_config(database);
+ChargePointEventsHandlerStub event_handler;
+RpcStub                      rpc;
+TestableWorkerThreadPool     worker_pool;
+RequestFifoStub              requests_fifo;
+MessagesConverter            msgs_converter;
+MessageDispatcherStub        msg_dispatcher;
+GenericMessageSender         msg_sender(rpc, msgs_converter, std::chrono::milliseconds(1000));
+StatusManagerStub            status_mgr;
+
+/** @brief Queue a MeterValues request, the value identifies the request */
+static void pushMeterValues(unsigned int connector_id, int transaction_id, const std::string& value)
+{
+    std::string json = "{\"connectorId\":" + std::to_string(connector_id) + ",\"transactionId\":" + std::to_string(transaction_id) +
+                       ",\"meterValue\":[{\"timestamp\":\"2020-01-01T00:00:00Z\",\"sampledValue\":[{\"value\":\"" + value + "\"}]}]}";
+    rapidjson::Document payload;
+    payload.Parse(json.c_str());
+    requests_fifo.push(connector_id, METER_VALUES_ACTION, payload);
+}
+
+/** @brief Queue a StopTransaction request */
+static void pushStopTransaction(unsigned int connector_id, int transaction_id)
+{
+    std::string json = "{\"meterStop\":0,\"timestamp\":\"2020-01-01T00:00:00Z\",\"transactionId\":" + std::to_string(transaction_id) + "}";
+    rapidjson::Document payload;
+    payload.Parse(json.c_str());
+    requests_fifo.push(connector_id, STOP_TRANSACTION_ACTION, payload);
+}
+
+/** @brief Queue a StartTransaction request */
+static void pushStartTransaction(unsigned int connector_id, const std::string& id_tag)
+{
+    std::string json = "{\"connectorId\":" + std::to_string(connector_id) + ",\"idTag\":\"" + id_tag +
+                       "\",\"meterStart\":0,\"timestamp\":\"2020-01-01T00:00:00Z\"}";
+    rapidjson::Document payload;
+    payload.Parse(json.c_str());
+    requests_fifo.push(connector_id, START_TRANSACTION_ACTION, payload);
+}
+
+/** @brief Set the response to the next completed StartTransaction request */
+static void setStartTransactionResponse(int transaction_id)
+{
+    std::string json = "{\"idTagInfo\":{\"status\":\"Accepted\"},\"transactionId\":" + std::to_string(transaction_id) + "}";
+    rapidjson::Document response;
+    response.Parse(json.c_str());
+    rpc.setResponse(response);
+}
+
+/** @brief Get the identifier of a sent request : its MeterValues value or its action */
+static std::string requestId(const std::pair<std::string, std::unique_ptr<rapidjson::Document>>& call)
+{
+    std::string id = call.first;
+    if (id == METER_VALUES_ACTION)
+    {
+        id = (*call.second)["meterValue"][0]["sampledValue"][0]["value"].GetString();
+    }
+    return id;
+}
+
+/** @brief Wait for the replay to send the expected number of requests */
+static bool waitPendingCalls(size_t count)
+{
+    for (unsigned int i = 0; (i < 1000u) && (rpc.getPendingAsyncCallsCount() != count); i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+    }
+    return (rpc.getPendingAsyncCallsCount() == count);
+}
+
+/** @brief Wait for the end of a replay, the requests which are still in flight succeed */
+static void endReplay(std::thread& replay, const std::atomic<bool>& replay_done)
+{
+    while (!replay_done)
+    {
+        if (rpc.getPendingAsyncCallsCount() != 0)
+        {
+            rpc.completeAsyncCall(0u, true);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+    }
+    replay.join();
+}
+
+TEST_SUITE("Requests FIFO manager component")
+{
+    TEST_CASE("Setup")
+    {
+        std::filesystem::remove(DATABASE_PATH);
+        CHECK(database.open(DATABASE_PATH));
+
+        ocpp_config.setConfigValue("NumberOfConnectors", "2");
+        ocpp_config.setConfigValue("TransactionMessageAttempts", "3");
+        ocpp_config.setConfigValue("TransactionMessageRetryInterval", "10");
+        cp_config.setConfigValue("RequestFifoReplayDepth", "4");
+        cp_config.setConfigValue("AuthentCacheMaxEntriesCount", "5");
+        internal_config.initDatabaseTable();
+
+        status_mgr.forceRegistrationStatus(RegistrationStatus::Accepted);
+        rpc.setAsyncCallsDeferred(true);
+        rapidjson::Document response;
+        response.Parse("{}");
+        rpc.setResponse(response);
+    }
+
+    TEST_CASE("Pipelined replay with out of order responses")
+    {
+        TestableTimerPool timer_pool;
+        Connectors        connectors(ocpp_config, database, timer_pool);
+        connectors.initDatabaseTable();
+        AuthentManager     authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        RequestFifoManager fifo_mgr(
+            cp_config, ocpp_config, event_handler, timer_pool, worker_pool, connectors, msg_sender, requests_fifo, status_mgr, authent_mgr);
+
+        requests_fifo.clear();
+        rpc.clearCalls();
+        pushMeterValues(1u, 10, "tx10-1");
+        pushMeterValues(1u, 10, "tx10-2");
+        pushStopTransaction(1u, 10);
+        pushMeterValues(2u, 20, "tx20-1");
+        rpc.setConnected(true);
+
+        std::atomic<bool> replay_done = false;
+        std::thread       replay(
+            [&]
+            {
+                fifo_mgr.updateConnectionStatus(true);
+                replay_done = true;
+            });
+
+        // The MeterValues requests of both connectors are in flight, the StopTransaction request waits for
+        // the previous requests of its connector
+        CHECK(waitPendingCalls(3u));
+        const auto& calls = rpc.getCalls();
+        CHECK_EQ(calls.size(), 3u);
+        CHECK_EQ(requestId(calls[0]), "tx10-1");
+        CHECK_EQ(requestId(calls[1]), "tx10-2");
+        CHECK_EQ(requestId(calls[2]), "tx20-1");
+
+        // The responses are received in the reverse order
+        rpc.completeAsyncCall(2u, true);
+        rpc.completeAsyncCall(1u, true);
+        rpc.completeAsyncCall(0u, true);
+
+        CHECK(waitPendingCalls(1u));
+        CHECK_EQ(calls.size(), 4u);
+        CHECK_EQ(requestId(calls[3]), STOP_TRANSACTION_ACTION);
+        rpc.completeAsyncCall(0u, true);
+
+        endReplay(replay, replay_done);
+        CHECK(requests_fifo.empty());
+        CHECK_FALSE(timer_pool.getTimer("Requests FIFO")->isStarted());
+    }
+
+    TEST_CASE("Pipelined replay with a failed request")
+    {
+        TestableTimerPool timer_pool;
+        Connectors        connectors(ocpp_config, database, timer_pool);
+        connectors.initDatabaseTable();
+        AuthentManager     authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        RequestFifoManager fifo_mgr(
+            cp_config, ocpp_config, event_handler, timer_pool, worker_pool, connectors, msg_sender, requests_fifo, status_mgr, authent_mgr);
+
+        requests_fifo.clear();
+        rpc.clearCalls();
+        pushMeterValues(1u, 10, "tx10-1");
+        pushMeterValues(1u, 10, "tx10-2");
+        pushStopTransaction(1u, 10);
+        pushMeterValues(2u, 20, "tx20-1");
+        rpc.setConnected(true);
+
+        std::atomic<bool> replay_done = false;
+        std::thread       replay(
+            [&]
+            {
+                fifo_mgr.updateConnectionStatus(true);
+                replay_done = true;
+            });
+
+        // The first request of the transaction fails while the other ones succeed
+        CHECK(waitPendingCalls(3u));
+        const auto& calls = rpc.getCalls();
+        CHECK_EQ(calls.size(), 3u);
+        rpc.completeAsyncCall(2u, true);
+        rpc.completeAsyncCall(1u, true);
+        rpc.completeAsyncCall(0u, false);
+        endReplay(replay, replay_done);
+
+        // The StopTransaction request has not been sent and the failed request will be retried first
+        Timer* retry_timer = timer_pool.getTimer("Requests FIFO");
+        CHECK(retry_timer->isStarted());
+        CHECK_EQ(calls.size(), 3u);
+        CHECK_EQ(requests_fifo.size(), 2u);
+        std::string         action;
+        rapidjson::Document payload;
+        unsigned int        connector_id = 0;
+        CHECK(requests_fifo.front(connector_id, action, payload));
+        CHECK_EQ(connector_id, 1u);
+        CHECK_EQ(std::string(payload["meterValue"][0]["sampledValue"][0]["value"].GetString()), "tx10-1");
+
+        // Retry
+        retry_timer->stop();
+        replay_done = false;
+        replay      = std::thread(
+            [&]
+            {
+                fifo_mgr.updateConnectionStatus(true);
+                replay_done = true;
+            });
+        for (size_t i = 0; i < 2u; i++)
+        {
+            CHECK(waitPendingCalls(1u));
+            rpc.completeAsyncCall(0u, true);
+        }
+        endReplay(replay, replay_done);
+
+        CHECK_EQ(calls.size(), 5u);
+        CHECK_EQ(requestId(calls[3]), "tx10-1");
+        CHECK_EQ(requestId(calls[4]), STOP_TRANSACTION_ACTION);
+        CHECK(requests_fifo.empty());
+    }
+
+    TEST_CASE("Pipelined replay with transactions started on several connectors")
+    {
+        TestableTimerPool timer_pool;
+        Connectors        connectors(ocpp_config, database, timer_pool);
+        connectors.initDatabaseTable();
+        AuthentManager     authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        RequestFifoManager fifo_mgr(
+            cp_config, ocpp_config, event_handler, timer_pool, worker_pool, connectors, msg_sender, requests_fifo, status_mgr, authent_mgr);
+
+        // The transaction ids are not known yet
+        requests_fifo.clear();
+        rpc.clearCalls();
+        pushStartTransaction(1u, "TAG1");
+        pushMeterValues(1u, -1, "tx1-1");
+        pushStartTransaction(2u, "TAG2");
+        pushMeterValues(2u, -1, "tx2-1");
+        rpc.setConnected(true);
+
+        std::atomic<bool> replay_done = false;
+        std::thread       replay(
+            [&]
+            {
+                fifo_mgr.updateConnectionStatus(true);
+                replay_done = true;
+            });
+
+        // Both StartTransaction requests are in the same batch, their responses are received in the reverse order
+        CHECK(waitPendingCalls(2u));
+        const auto& calls = rpc.getCalls();
+        CHECK_EQ(calls.size(), 2u);
+        CHECK_EQ(calls[0].first, START_TRANSACTION_ACTION);
+        CHECK_EQ(calls[1].first, START_TRANSACTION_ACTION);
+        setStartTransactionResponse(102);
+        rpc.completeAsyncCall(1u, true);
+        setStartTransactionResponse(101);
+        rpc.completeAsyncCall(0u, true);
+
+        // Each MeterValues request uses the transaction id of its connector
+        rapidjson::Document response;
+        response.Parse("{}");
+        rpc.setResponse(response);
+        CHECK(waitPendingCalls(2u));
+        CHECK_EQ(calls.size(), 4u);
+        CHECK_EQ(requestId(calls[2]), "tx1-1");
+        CHECK_EQ((*calls[2].second)["transactionId"].GetInt(), 101);
+        CHECK_EQ(requestId(calls[3]), "tx2-1");
+        CHECK_EQ((*calls[3].second)["transactionId"].GetInt(), 102);
+        rpc.completeAsyncCall(1u, true);
+        rpc.completeAsyncCall(0u, true);
+
+        endReplay(replay, replay_done);
+        CHECK(requests_fifo.empty());
+        CHECK_EQ(connectors.getConnector(1u)->transaction_id_offline, 101);
+        CHECK_EQ(connectors.getConnector(2u)->transaction_id_offline, 102);
+    }
+
+    TEST_CASE("Cleanup")
+    {
+        rpc.setConnected(false);
+        CHECK(database.close());
+        std::filesystem::remove(DATABASE_PATH);
+    }
+}
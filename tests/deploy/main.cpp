@@ -39,8 +39,16 @@ class CentralSystemConfig : public ICentralSystemConfig
 
     /** @brief Path to the database to store persistent data */
     std::string databasePath() const override { return ""; }
+    /** @brief Enable the write-ahead log journal mode of the database */
+    bool databaseWalMode() const override { return true; }
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    std::string databaseSynchronousMode() const override { return "NORMAL"; }
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath() */
+    std::string logDatabasePath() const override { return ""; }
     /** @brief Path to the JSON schemas to validate the messages */
     std::string jsonSchemasPath() const override { return ""; }
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    unsigned int workerThreadCount() const override { return 0; }
 
     // Communication parameters
 
@@ -48,6 +56,14 @@ class CentralSystemConfig : public ICentralSystemConfig
     std::string listenUrl() const override { return "ws://localhost/ocpp"; }
     /** @brief Call request timeout */
     std::chrono::milliseconds callRequestTimeout() const override { return std::chrono::milliseconds(1000); }
+    /** @brief Allow several call requests to be in flight at the same time on a charge point connection */
+    bool callRequestsPipelining() const override { return false; }
+    /** @brief Number of threads shared by all the charge point connections to process the incoming call requests (0 = one thread per connection) */
+    unsigned int incomingCallsThreadCount() const override { return 0; }
+    /** @brief Number of threads servicing the websocket connections (TLS handshakes, encryption and frames processing) */
+    unsigned int webSocketServiceThreadCount() const override { return 1; }
+    /** @brief Maximum size in bytes of a received websocket message */
+    unsigned int webSocketMaxMessageSize() const override { return 262144; }
     /** @brief Websocket PING interval */
     std::chrono::seconds webSocketPingInterval() const override { return std::chrono::seconds(10); }
     /** @brief Boot notification retry interval */
@@ -117,8 +133,16 @@ class ChargePointConfig : public IChargePointConfig
 
     /** @brief Path to the database to store persistent data */
     std::string databasePath() const override { return ""; }
+    /** @brief Enable the write-ahead log journal mode of the database */
+    bool databaseWalMode() const override { return true; }
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    std::string databaseSynchronousMode() const override { return "NORMAL"; }
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath() */
+    std::string logDatabasePath() const override { return ""; }
     /** @brief Path to the JSON schemas to validate the messages */
     std::string jsonSchemasPath() const override { return ""; }
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    unsigned int workerThreadCount() const override { return 0; }
 
     // Communication parameters
 
@@ -132,6 +156,10 @@ class ChargePointConfig : public IChargePointConfig
     std::chrono::milliseconds retryInterval() const override { return std::chrono::milliseconds(1000); }
     /** @brief Call request timeout */
     std::chrono::milliseconds callRequestTimeout() const override { return std::chrono::milliseconds(1000); }
+    /** @brief Allow several call requests to be in flight at the same time */
+    bool callRequestsPipelining() const override { return false; }
+    /** @brief Maximum size in bytes of a received websocket message */
+    unsigned int webSocketMaxMessageSize() const override { return 1048576; }
     /** @brief Cipher list to use for TLSv1.2 connections */
     std::string tlsv12CipherList() const override { return ""; }
     /** @brief Cipher list to use for TLSv1.3 connections */
@@ -187,6 +215,17 @@ class ChargePointConfig : public IChargePointConfig
 
     /** @brief Maximum number of entries in the authentication cache */
     unsigned int authentCacheMaxEntriesCount() const override { return 100u; }
+    /** @brief Keep an in-memory index of the authentication cache and local list */
+    bool authentInMemoryIndex() const override { return false; }
+    /** @brief Build the new authentication local list in a separate table on full updates */
+    bool authentLocalListDoubleBuffering() const override { return false; }
+
+    // Requests FIFO
+
+    /** @brief Maximum number of requests in the transaction related requests FIFO (0 = no limit) */
+    unsigned int requestFifoMaxSize() const override { return 0u; }
+    /** @brief Maximum number of requests of the transaction related requests FIFO to send at the same time when replaying the FIFO */
+    unsigned int requestFifoReplayDepth() const override { return 1u; }
 
     // Log
 
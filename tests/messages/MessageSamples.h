@@ -0,0 +1,183 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MESSAGESAMPLES_H
+#define MESSAGESAMPLES_H
+
+#include "Authorize.h"
+#include "BootNotification.h"
+#include "CancelReservation.h"
+#include "CertificateSigned.h"
+#include "ChangeAvailability.h"
+#include "ChangeConfiguration.h"
+#include "ClearCache.h"
+#include "ClearChargingProfile.h"
+#include "DataTransfer.h"
+#include "DeleteCertificate.h"
+#include "DiagnosticsStatusNotification.h"
+#include "ExtendedTriggerMessage.h"
+#include "FirmwareStatusNotification.h"
+#include "GetCompositeSchedule.h"
+#include "GetConfiguration.h"
+#include "GetDiagnostics.h"
+#include "GetInstalledCertificateIds.h"
+#include "GetLocalListVersion.h"
+#include "GetLog.h"
+#include "Heartbeat.h"
+#include "InstallCertificate.h"
+#include "LogStatusNotification.h"
+#include "MeterValues.h"
+#include "RemoteStartTransaction.h"
+#include "RemoteStopTransaction.h"
+#include "ReserveNow.h"
+#include "Reset.h"
+#include "SecurityEventNotification.h"
+#include "SendLocalList.h"
+#include "SetChargingProfile.h"
+#include "SignCertificate.h"
+#include "SignedFirmwareStatusNotification.h"
+#include "SignedUpdateFirmware.h"
+#include "StartTransaction.h"
+#include "StatusNotification.h"
+#include "StopTransaction.h"
+#include "TriggerMessage.h"
+#include "UnlockConnector.h"
+#include "UpdateFirmware.h"
+
+/** @brief Sample payloads of all the messages, each entry is : SAMPLE(message type, request payload, response payload)
+ *         (the optional fields are set whenever possible) */
+#define MESSAGE_SAMPLES(SAMPLE) \
+    SAMPLE(Authorize, \
+           R"({"idTag": "idTag-0123456789"})", \
+           R"({"idTagInfo": {"expiryDate": "2021-06-01T10:12:35.000Z", "parentIdTag": "parentIdTag-01234567", "status": "Expired"}})") \
+    SAMPLE(BootNotification, \
+           R"({"chargePointVendor": "chargePointVendor-01", "chargePointModel": "chargePointModel-012", "chargePointSerialNumber": "chargePointSerialNumber-0", "chargeBoxSerialNumber": "chargeBoxSerialNumber-012", "firmwareVersion": "firmwareVersion-0123456789", "iccid": "iccid-0123456789", "imsi": "imsi-0123456789", "meterType": "meterType-0123456789", "meterSerialNumber": "meterSerialNumber-0123456"})", \
+           R"({"status": "Pending", "currentTime": "2021-06-01T10:12:35.000Z", "interval": 2})") \
+    SAMPLE(CancelReservation, \
+           R"({"reservationId": 2})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(CertificateSigned, \
+           R"({"certificateChain": "certificateChain-0123456789"})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(ChangeAvailability, \
+           R"({"connectorId": 2, "type": "Operative"})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(ChangeConfiguration, \
+           R"({"key": "key-0123456789", "value": "value-0123456789"})", \
+           R"({"status": "RebootRequired"})") \
+    SAMPLE(ClearCache, \
+           R"({})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(ClearChargingProfile, \
+           R"({"id": 2, "connectorId": 2, "chargingProfilePurpose": "TxDefaultProfile", "stackLevel": 2})", \
+           R"({"status": "Unknown"})") \
+    SAMPLE(DataTransfer, \
+           R"({"vendorId": "vendorId-0123456789", "messageId": "messageId-0123456789", "data": "data-0123456789"})", \
+           R"({"status": "UnknownMessageId", "data": "data-0123456789"})") \
+    SAMPLE(DeleteCertificate, \
+           R"({"certificateHashData": {"hashAlgorithm": "SHA384", "issuerNameHash": "issuerNameHash-0123456789", "issuerKeyHash": "issuerKeyHash-0123456789", "serialNumber": "serialNumber-0123456789"}})", \
+           R"({"status": "Failed"})") \
+    SAMPLE(DiagnosticsStatusNotification, \
+           R"({"status": "UploadFailed"})", \
+           R"({})") \
+    SAMPLE(ExtendedTriggerMessage, \
+           R"({"requestedMessage": "Heartbeat", "connectorId": 2})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(FirmwareStatusNotification, \
+           R"({"status": "Idle"})", \
+           R"({})") \
+    SAMPLE(GetCompositeSchedule, \
+           R"({"connectorId": 2, "duration": 2, "chargingRateUnit": "W"})", \
+           R"({"status": "Rejected", "connectorId": 2, "scheduleStart": "2021-06-01T10:12:35.000Z", "chargingSchedule": {"duration": 2, "startSchedule": "2021-06-01T10:12:35.000Z", "chargingRateUnit": "W", "chargingSchedulePeriod": [{"startPeriod": 2, "limit": 32.0, "numberPhases": 2}, {"startPeriod": 2, "limit": 32.0, "numberPhases": 2}], "minChargingRate": 32.0}})") \
+    SAMPLE(GetConfiguration, \
+           R"({"key": ["key-0123456789", "key-0123456789"]})", \
+           R"({"configurationKey": [{"key": "key-0123456789", "readonly": true, "value": "value-0123456789"}, {"key": "key-0123456789", "readonly": true, "value": "value-0123456789"}], "unknownKey": ["unknownKey-0123456789", "unknownKey-0123456789"]})") \
+    SAMPLE(GetDiagnostics, \
+           R"({"location": "ftp://ocpp.example.com/upload", "retries": 2, "retryInterval": 2, "startTime": "2021-06-01T10:12:35.000Z", "stopTime": "2021-06-01T10:12:35.000Z"})", \
+           R"({"fileName": "fileName-0123456789"})") \
+    SAMPLE(GetInstalledCertificateIds, \
+           R"({"certificateType": "ManufacturerRootCertificate"})", \
+           R"({"status": "NotFound", "certificateHashData": [{"hashAlgorithm": "SHA384", "issuerNameHash": "issuerNameHash-0123456789", "issuerKeyHash": "issuerKeyHash-0123456789", "serialNumber": "serialNumber-0123456789"}, {"hashAlgorithm": "SHA384", "issuerNameHash": "issuerNameHash-0123456789", "issuerKeyHash": "issuerKeyHash-0123456789", "serialNumber": "serialNumber-0123456789"}]})") \
+    SAMPLE(GetLocalListVersion, \
+           R"({})", \
+           R"({"listVersion": 2})") \
+    SAMPLE(GetLog, \
+           R"({"logType": "SecurityLog", "requestId": 2, "retries": 2, "retryInterval": 2, "log": {"remoteLocation": "ftp://ocpp.example.com/upload", "oldestTimestamp": "2021-06-01T10:12:35.000Z", "latestTimestamp": "2021-06-01T10:12:35.000Z"}})", \
+           R"({"status": "Rejected", "filename": "filename-0123456789"})") \
+    SAMPLE(Heartbeat, \
+           R"({})", \
+           R"({"currentTime": "2021-06-01T10:12:35.000Z"})") \
+    SAMPLE(InstallCertificate, \
+           R"({"certificateType": "ManufacturerRootCertificate", "certificate": "certificate-0123456789"})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(LogStatusNotification, \
+           R"({"status": "PermissionDenied", "requestId": 2})", \
+           R"({})") \
+    SAMPLE(MeterValues, \
+           R"({"connectorId": 1, "transactionId": 1234, "meterValue": [{"timestamp": "2021-06-01T10:12:35.000Z", "sampledValue": [{"value": "12345.6", "context": "Sample.Periodic", "measurand": "Energy.Active.Import.Register", "unit": "Wh"}, {"value": "7360.0", "context": "Sample.Periodic", "measurand": "Power.Active.Import", "unit": "W"}, {"value": "32.0", "context": "Sample.Periodic", "measurand": "Current.Import", "phase": "L1", "unit": "A"}, {"value": "230.0", "context": "Sample.Periodic", "measurand": "Voltage", "phase": "L1-N", "unit": "V"}]}]})", \
+           R"({})") \
+    SAMPLE(RemoteStartTransaction, \
+           R"({"connectorId": 2, "idTag": "idTag-0123456789", "chargingProfile": {"chargingProfileId": 2, "transactionId": 2, "stackLevel": 2, "chargingProfilePurpose": "TxDefaultProfile", "chargingProfileKind": "Recurring", "recurrencyKind": "Weekly", "validFrom": "2021-06-01T10:12:35.000Z", "validTo": "2021-06-01T10:12:35.000Z", "chargingSchedule": {"duration": 2, "startSchedule": "2021-06-01T10:12:35.000Z", "chargingRateUnit": "W", "chargingSchedulePeriod": [{"startPeriod": 2, "limit": 32.0, "numberPhases": 2}, {"startPeriod": 2, "limit": 32.0, "numberPhases": 2}], "minChargingRate": 32.0}}})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(RemoteStopTransaction, \
+           R"({"transactionId": 2})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(ReserveNow, \
+           R"({"connectorId": 2, "expiryDate": "2021-06-01T10:12:35.000Z", "idTag": "idTag-0123456789", "parentIdTag": "parentIdTag-01234567", "reservationId": 2})", \
+           R"({"status": "Occupied"})") \
+    SAMPLE(Reset, \
+           R"({"type": "Soft"})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(SecurityEventNotification, \
+           R"({"type": "type-0123456789", "timestamp": "2021-06-01T10:12:35.000Z", "techInfo": "techInfo-0123456789"})", \
+           R"({})") \
+    SAMPLE(SendLocalList, \
+           R"({"listVersion": 2, "localAuthorizationList": [{"idTag": "idTag-0123456789", "idTagInfo": {"expiryDate": "2021-06-01T10:12:35.000Z", "parentIdTag": "parentIdTag-01234567", "status": "Expired"}}, {"idTag": "idTag-0123456789", "idTagInfo": {"expiryDate": "2021-06-01T10:12:35.000Z", "parentIdTag": "parentIdTag-01234567", "status": "Expired"}}], "updateType": "Full"})", \
+           R"({"status": "NotSupported"})") \
+    SAMPLE(SetChargingProfile, \
+           R"({"connectorId": 2, "csChargingProfiles": {"chargingProfileId": 2, "transactionId": 2, "stackLevel": 2, "chargingProfilePurpose": "TxDefaultProfile", "chargingProfileKind": "Recurring", "recurrencyKind": "Weekly", "validFrom": "2021-06-01T10:12:35.000Z", "validTo": "2021-06-01T10:12:35.000Z", "chargingSchedule": {"duration": 2, "startSchedule": "2021-06-01T10:12:35.000Z", "chargingRateUnit": "W", "chargingSchedulePeriod": [{"startPeriod": 2, "limit": 32.0, "numberPhases": 2}, {"startPeriod": 2, "limit": 32.0, "numberPhases": 2}], "minChargingRate": 32.0}}})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(SignCertificate, \
+           R"({"csr": "csr-0123456789"})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(SignedFirmwareStatusNotification, \
+           R"({"status": "Installing", "requestId": 2})", \
+           R"({})") \
+    SAMPLE(SignedUpdateFirmware, \
+           R"({"retries": 2, "retryInterval": 2, "requestId": 2, "firmware": {"location": "ftp://ocpp.example.com/upload", "retrieveDateTime": "2021-06-01T10:12:35.000Z", "installDateTime": "2021-06-01T10:12:35.000Z", "signingCertificate": "signingCertificate-0123456789", "signature": "signature-0123456789"}})", \
+           R"({"status": "AcceptedCanceled"})") \
+    SAMPLE(StartTransaction, \
+           R"({"connectorId": 2, "idTag": "idTag-0123456789", "meterStart": 2, "reservationId": 2, "timestamp": "2021-06-01T10:12:35.000Z"})", \
+           R"({"idTagInfo": {"expiryDate": "2021-06-01T10:12:35.000Z", "parentIdTag": "parentIdTag-01234567", "status": "Expired"}, "transactionId": 2})") \
+    SAMPLE(StatusNotification, \
+           R"({"connectorId": 2, "errorCode": "OverCurrentFailure", "info": "info-0123456789", "status": "SuspendedEV", "timestamp": "2021-06-01T10:12:35.000Z", "vendorId": "vendorId-0123456789", "vendorErrorCode": "vendorErrorCode-0123456789"})", \
+           R"({})") \
+    SAMPLE(StopTransaction, \
+           R"({"idTag": "idTag-0123456789", "meterStop": 2, "timestamp": "2021-06-01T10:12:35.000Z", "transactionId": 2, "reason": "PowerLoss", "transactionData": [{"timestamp": "2021-06-01T10:12:35.000Z", "sampledValue": [{"value": "value-0123456789", "context": "Transaction.Begin", "format": "SignedData", "measurand": "Power.Reactive.Export", "phase": "L2-N", "location": "Inlet", "unit": "var"}, {"value": "value-0123456789", "context": "Transaction.Begin", "format": "SignedData", "measurand": "Power.Reactive.Export", "phase": "L2-N", "location": "Inlet", "unit": "var"}]}, {"timestamp": "2021-06-01T10:12:35.000Z", "sampledValue": [{"value": "value-0123456789", "context": "Transaction.Begin", "format": "SignedData", "measurand": "Power.Reactive.Export", "phase": "L2-N", "location": "Inlet", "unit": "var"}, {"value": "value-0123456789", "context": "Transaction.Begin", "format": "SignedData", "measurand": "Power.Reactive.Export", "phase": "L2-N", "location": "Inlet", "unit": "var"}]}]})", \
+           R"({"idTagInfo": {"expiryDate": "2021-06-01T10:12:35.000Z", "parentIdTag": "parentIdTag-01234567", "status": "Expired"}})") \
+    SAMPLE(TriggerMessage, \
+           R"({"requestedMessage": "Heartbeat", "connectorId": 2})", \
+           R"({"status": "Rejected"})") \
+    SAMPLE(UnlockConnector, \
+           R"({"connectorId": 2})", \
+           R"({"status": "UnlockFailed"})") \
+    SAMPLE(UpdateFirmware, \
+           R"({"location": "ftp://ocpp.example.com/upload", "retries": 2, "retrieveDate": "2021-06-01T10:12:35.000Z", "retryInterval": 2})", \
+           R"({})")
+
+#endif // MESSAGESAMPLES_H
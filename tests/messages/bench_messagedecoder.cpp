@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+#include "JsonSchemaRegistry.h"
+#include "JsonValidator.h"
+#include "MessageDecoder.h"
+#include "MessageSamples.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ocpp::json;
+using namespace ocpp::messages;
+
+/*
+ * Micro-benchmark of the decoding of the received payloads
+ *
+ * For each message, the JSON schema validation followed by the conversion with the message converter
+ * is compared with the single pass decoding, starting from an already parsed payload (as done by the
+ * messages dispatcher) and starting from the raw payload. The number of dynamic allocations per message
+ * is measured by replacing the global allocation operators.
+ *
+ * Usage : bench_messagedecoder [iterations=10000] [schemas_path]
+ */
+
+/** @brief Path to the JSON schemas */
+static std::string s_schemas_path = SCHEMAS_DIR;
+
+/** @brief Benchmark the decoding of a message */
+template <typename MessageType, typename ConverterType>
+static void bench(const std::string& name, const std::string& schema_file, const char* payload, size_t iterations)
+{
+    std::cout << std::left << std::setw(42) << name << std::right;
+
+    auto decoder = MessageDecoder::get(JsonSchemaRegistry::getTree(s_schemas_path + schema_file), JsonBinder<MessageType>::get());
+    JsonValidator validator;
+    if (!decoder || !validator.init(s_schemas_path + schema_file))
+    {
+        std::cout << "no single pass decoder" << std::endl;
+        return;
+    }
+
+    size_t              size = strlen(payload);
+    rapidjson::Document json;
+    json.Parse(payload);
+
+    const char*   error_code = nullptr;
+    std::string   error_message;
+    ConverterType converter;
+
+    // Validation then conversion of the parsed payload
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       MessageType message;
+                       return (validator.isValid(json) && converter.fromJson(json, message, error_code, error_message));
+                   }));
+    // Single pass decoding of the parsed payload
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       MessageType message;
+                       return decoder->decode(json, message, error_code, error_message);
+                   }));
+    // Parsing, validation then conversion of the raw payload
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       MessageType         message;
+                       rapidjson::Document doc;
+                       doc.Parse(payload, size);
+                       return (validator.isValid(doc) && converter.fromJson(doc, message, error_code, error_message));
+                   }));
+    // Single pass decoding of the raw payload
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       MessageType message;
+                       return decoder->decode(payload, size, message, error_code, error_message);
+                   }));
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 10000u;
+    if (argc > 2)
+    {
+        s_schemas_path = argv[2];
+        s_schemas_path += "/";
+    }
+
+    std::cout << std::left << std::setw(42) << "Message" << std::right << std::setw(MEASURE_WIDTH) << "validate+convert"
+              << std::setw(MEASURE_WIDTH) << "single pass" << std::setw(MEASURE_WIDTH) << "parse+valid+conv" << std::setw(MEASURE_WIDTH)
+              << "single pass (text)" << std::endl;
+
+#define BENCH_SAMPLE(MessageType, request, response)                                                                           \
+    bench<MessageType##Req, MessageType##ReqConverter>(#MessageType ".req", #MessageType ".json", request, iterations); \
+    bench<MessageType##Conf, MessageType##ConfConverter>(#MessageType ".conf", #MessageType "Response.json", response, iterations);
+
+    MESSAGE_SAMPLES(BENCH_SAMPLE)
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+#include "MessageSamples.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ocpp::messages;
+
+/*
+ * Micro-benchmark of the serialization of the sent payloads
+ *
+ * For each message, the conversion to a JSON document followed by its serialization is compared
+ * with the direct serialization by the message converter. The serialization buffer is reused
+ * between the messages as done by the RPC layer. The number of dynamic allocations per message
+ * is measured by replacing the global allocation operators.
+ *
+ * Usage : bench_messageserializer [iterations=10000]
+ */
+
+/** @brief Benchmark the serialization of a message */
+template <typename MessageType, typename ConverterType>
+static void bench(const std::string& name, const char* payload, size_t iterations)
+{
+    std::cout << std::left << std::setw(42) << name << std::right;
+
+    // Message to serialize
+    rapidjson::Document json;
+    json.Parse(payload);
+    MessageType   message;
+    ConverterType converter;
+    const char*   error_code = nullptr;
+    std::string   error_message;
+    bool                valid = !json.HasParseError();
+    try
+    {
+        valid = valid && converter.fromJson(json, message, error_code, error_message);
+    }
+    catch (const rapidjson::parse_exception&)
+    {
+        // Sample which doesn't match the message fields
+        valid = false;
+    }
+    if (!valid)
+    {
+        std::cout << "invalid sample" << std::endl;
+        return;
+    }
+
+    rapidjson::StringBuffer                    buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    // Conversion to a JSON document then serialization
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       buffer.Clear();
+                       writer.Reset(buffer);
+                       rapidjson::Document doc;
+                       doc.SetObject();
+                       return (converter.toJson(message, doc) && doc.Accept(writer));
+                   }));
+    // Direct serialization
+    report(measure(iterations,
+                   [&](size_t)
+                   {
+                       buffer.Clear();
+                       writer.Reset(buffer);
+                       return converter.serialize(message, writer);
+                   }));
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 10000u;
+
+    std::cout << std::left << std::setw(42) << "Message" << std::right << std::setw(MEASURE_WIDTH) << "document" << std::setw(MEASURE_WIDTH)
+              << "direct" << std::endl;
+
+#define BENCH_SAMPLE(MessageType, request, response)                                            \
+    bench<MessageType##Req, MessageType##ReqConverter>(#MessageType ".req", request, iterations); \
+    bench<MessageType##Conf, MessageType##ConfConverter>(#MessageType ".conf", response, iterations);
+
+    MESSAGE_SAMPLES(BENCH_SAMPLE)
+
+    return 0;
+}
@@ -0,0 +1,362 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GenericMessageHandler.h"
+#include "IRpc.h"
+#include "JsonSchemaRegistry.h"
+#include "JsonValidator.h"
+#include "MessageDecoder.h"
+#include "MessageDispatcher.h"
+#include "MessageSamples.h"
+#include "MessagesConverter.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <cstring>
+#include <set>
+
+using namespace ocpp::json;
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+using namespace ocpp::types;
+
+/** @brief Path to the JSON schemas */
+static const std::string SCHEMAS_PATH = SCHEMAS_DIR;
+
+/** @brief Schemas which cannot be used to decode their messages (invalid JSON schema or property names
+ *         which do not match the message fields) */
+static const std::set<std::string> UNDECODABLE_SCHEMAS = {"GetLogResponse.json", "SignedFirmwareStatusNotificationResponse.json"};
+
+/** @brief Parse a JSON document */
+static rapidjson::Document parse(const char* json)
+{
+    rapidjson::Document doc;
+    doc.Parse(json);
+    return doc;
+}
+
+/** @brief Serialize a message with its converter */
+template <typename MessageType, typename ConverterType>
+static std::string serialize(const MessageType& message)
+{
+    ConverterType       converter;
+    rapidjson::Document json;
+    json.SetObject();
+    converter.toJson(message, json);
+
+    rapidjson::StringBuffer                    buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    json.Accept(writer);
+    return buffer.GetString();
+}
+
+/** @brief Get the decoder of a message */
+template <typename MessageType>
+static std::shared_ptr<const MessageDecoder> getDecoder(const std::string& schema_file)
+{
+    return MessageDecoder::get(JsonSchemaRegistry::getTree(SCHEMAS_PATH + schema_file), JsonBinder<MessageType>::get());
+}
+
+/** @brief Check that decoding a payload gives the same message as validating and converting it */
+template <typename MessageType, typename ConverterType>
+static void checkDecoding(const std::string& schema_file, const char* payload)
+{
+    CAPTURE(schema_file);
+
+    auto decoder = getDecoder<MessageType>(schema_file);
+    if (UNDECODABLE_SCHEMAS.find(schema_file) != UNDECODABLE_SCHEMAS.end())
+    {
+        CHECK_FALSE(decoder);
+        return;
+    }
+    REQUIRE(decoder);
+
+    rapidjson::Document json = parse(payload);
+    REQUIRE_FALSE(json.HasParseError());
+
+    // Reference : validation then conversion
+    JsonValidator validator;
+    REQUIRE(validator.init(SCHEMAS_PATH + schema_file));
+    REQUIRE(validator.isValid(json));
+    MessageType   expected;
+    ConverterType converter;
+    const char*   error_code = nullptr;
+    std::string   error_message;
+    REQUIRE(converter.fromJson(json, expected, error_code, error_message));
+
+    // Single pass decoding of the parsed payload
+    MessageType from_dom;
+    CHECK(decoder->decode(json, from_dom, error_code, error_message));
+    CHECK_EQ(error_code, nullptr);
+    CHECK_EQ(serialize<MessageType, ConverterType>(from_dom), serialize<MessageType, ConverterType>(expected));
+
+    // Single pass decoding of the raw payload
+    MessageType from_text;
+    CHECK(decoder->decode(payload, strlen(payload), from_text, error_code, error_message));
+    CHECK_EQ(error_code, nullptr);
+    CHECK_EQ(serialize<MessageType, ConverterType>(from_text), serialize<MessageType, ConverterType>(expected));
+}
+
+/** @brief Check that a payload is rejected with the same error as the validator */
+template <typename MessageType>
+static void checkInvalid(const std::string& schema_file, const char* payload)
+{
+    CAPTURE(payload);
+
+    auto decoder = getDecoder<MessageType>(schema_file);
+    REQUIRE(decoder);
+
+    rapidjson::Document json = parse(payload);
+    JsonValidator       validator;
+    REQUIRE(validator.init(SCHEMAS_PATH + schema_file));
+    CHECK_FALSE(validator.isValid(json));
+
+    MessageType message;
+    const char* error_code = nullptr;
+    std::string error_message;
+    CHECK_FALSE(decoder->decode(json, message, error_code, error_message));
+    CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+    CHECK_EQ(error_message, validator.lastError());
+
+    error_code = nullptr;
+    error_message.clear();
+    CHECK_FALSE(decoder->decode(payload, strlen(payload), message, error_code, error_message));
+    CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+    CHECK_EQ(error_message, validator.lastError());
+}
+
+/** @brief Check that a valid payload is rejected by the conversion */
+template <typename MessageType>
+static void checkNotConverted(const std::string& schema_file, const char* payload, const std::string& expected_error)
+{
+    CAPTURE(payload);
+
+    auto decoder = getDecoder<MessageType>(schema_file);
+    REQUIRE(decoder);
+
+    rapidjson::Document json = parse(payload);
+    JsonValidator       validator;
+    REQUIRE(validator.init(SCHEMAS_PATH + schema_file));
+    CHECK(validator.isValid(json));
+
+    MessageType message;
+    const char* error_code = nullptr;
+    std::string error_message;
+    CHECK_FALSE(decoder->decode(json, message, error_code, error_message));
+    CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+    CHECK_EQ(error_message, expected_error);
+}
+
+/** @brief Heartbeat handler */
+class HeartbeatHandler : public GenericMessageHandler<HeartbeatReq, HeartbeatConf>
+{
+  public:
+    HeartbeatHandler(const GenericMessagesConverter& messages_converter)
+        : GenericMessageHandler<HeartbeatReq, HeartbeatConf>(HEARTBEAT_ACTION, messages_converter), calls(0)
+    {
+    }
+    bool handleMessage(const HeartbeatReq& request, HeartbeatConf& response, const char*& error_code, std::string& error_message) override
+    {
+        (void)request;
+        (void)error_code;
+        (void)error_message;
+        response.currentTime = DateTime(1622542355);
+        calls++;
+        return true;
+    }
+    unsigned int calls;
+};
+
+/** @brief Heartbeat handler without single pass decoding */
+class ValidatedHeartbeatHandler : public HeartbeatHandler
+{
+  public:
+    ValidatedHeartbeatHandler(const GenericMessagesConverter& messages_converter) : HeartbeatHandler(messages_converter) { }
+    bool enableSinglePassDecoding(const std::shared_ptr<const JsonSchemaTree>& schema) override
+    {
+        (void)schema;
+        return false;
+    }
+};
+
+/** @brief Dispatch the payloads given as JSON text to a heartbeat handler */
+static void checkDispatch(HeartbeatHandler& handler)
+{
+    MessageDispatcher dispatcher(SCHEMAS_PATH);
+    CHECK(dispatcher.registerHandler(HEARTBEAT_ACTION, handler));
+    CHECK_FALSE(dispatcher.registerHandler(HEARTBEAT_ACTION, handler));
+
+    // Valid payload
+    rapidjson::Document response;
+    response.SetObject();
+    const char* error_code = nullptr;
+    std::string error_message;
+    std::string payload    = " { } ";
+    CHECK(dispatcher.dispatchMessage(HEARTBEAT_ACTION, payload.c_str(), payload.size(), response, error_code, error_message));
+    CHECK_EQ(handler.calls, 1u);
+    CHECK(response.HasMember("currentTime"));
+
+    // Invalid payload is rejected before reaching the handler
+    payload = R"({"unknown": 1})";
+    CHECK_FALSE(dispatcher.dispatchMessage(HEARTBEAT_ACTION, payload.c_str(), payload.size(), response, error_code, error_message));
+    CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+    CHECK_EQ(error_message, "Error on keyword : additionalProperties");
+    CHECK_EQ(handler.calls, 1u);
+
+    // Only the given size is parsed
+    payload = R"({}, "trailing": 1})";
+    CHECK(dispatcher.dispatchMessage(HEARTBEAT_ACTION, payload.c_str(), 2u, response, error_code, error_message));
+    CHECK_EQ(handler.calls, 2u);
+
+    // Malformed payload
+    payload    = "{";
+    error_code = nullptr;
+    CHECK_FALSE(dispatcher.dispatchMessage(HEARTBEAT_ACTION, payload.c_str(), payload.size(), response, error_code, error_message));
+    REQUIRE(error_code);
+    CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_FORMATION_VIOLATION);
+    CHECK_EQ(handler.calls, 2u);
+}
+
+TEST_SUITE("MessageDecoder class test suite")
+{
+    TEST_CASE("All messages")
+    {
+        JsonSchemaRegistry::clear();
+
+#define CHECK_SAMPLE(MessageType, request, response)                                                  \
+    checkDecoding<MessageType##Req, MessageType##ReqConverter>(#MessageType ".json", request);        \
+    checkDecoding<MessageType##Conf, MessageType##ConfConverter>(#MessageType "Response.json", response);
+
+        MESSAGE_SAMPLES(CHECK_SAMPLE)
+    }
+
+    TEST_CASE("Shared decoders")
+    {
+        JsonSchemaRegistry::clear();
+
+        auto decoder = getDecoder<StatusNotificationReq>("StatusNotification.json");
+        CHECK(decoder);
+        CHECK_EQ(getDecoder<StatusNotificationReq>("StatusNotification.json"), decoder);
+        CHECK_FALSE(getDecoder<MeterValuesReq>("StatusNotification.json"));
+        CHECK_FALSE(getDecoder<StatusNotificationReq>("NotExisting.json"));
+
+        // Decoder does not match the message type
+        StatusNotificationReq request;
+        MeterValuesReq        other;
+        const char*           error_code = nullptr;
+        std::string           error_message;
+        rapidjson::Document   json = parse(R"({"connectorId": 1, "errorCode": "NoError", "status": "Available"})");
+        CHECK(decoder->decode(json, request, error_code, error_message));
+        CHECK_FALSE(decoder->decode(json, other, error_code, error_message));
+        CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_INTERNAL);
+    }
+
+    TEST_CASE("Invalid payloads")
+    {
+        JsonSchemaRegistry::clear();
+
+        // Missing required property
+        checkInvalid<StatusNotificationReq>("StatusNotification.json", R"({"connectorId": 1, "errorCode": "NoError"})");
+        // Wrong type
+        checkInvalid<StatusNotificationReq>("StatusNotification.json", R"({"connectorId": "1", "errorCode": "NoError", "status": "Available"})");
+        checkInvalid<StatusNotificationReq>("StatusNotification.json", R"({"connectorId": 1.5, "errorCode": "NoError", "status": "Available"})");
+        checkInvalid<StatusNotificationReq>("StatusNotification.json", R"([1, "NoError", "Available"])");
+        // Too long
+        checkInvalid<StatusNotificationReq>(
+            "StatusNotification.json",
+            R"({"connectorId": 1, "errorCode": "NoError", "status": "Available", "info": "012345678901234567890123456789012345678901234567890"})");
+        // Invalid enum value
+        checkInvalid<StatusNotificationReq>("StatusNotification.json", R"({"connectorId": 1, "errorCode": "NoError", "status": "Sleeping"})");
+        // Unknown property
+        checkInvalid<StatusNotificationReq>("StatusNotification.json",
+                                            R"({"connectorId": 1, "errorCode": "NoError", "status": "Available", "power": 22})");
+        // Not a multiple
+        checkInvalid<SetChargingProfileReq>(
+            "SetChargingProfile.json",
+            R"({"connectorId": 1, "csChargingProfiles": {"chargingProfileId": 1, "stackLevel": 0, "chargingProfilePurpose": "TxProfile", "chargingProfileKind": "Absolute", "chargingSchedule": {"chargingRateUnit": "A", "chargingSchedulePeriod": [{"startPeriod": 0, "limit": 16.05}]}}})");
+        // Invalid nested value
+        checkInvalid<MeterValuesReq>(
+            "MeterValues.json",
+            R"({"connectorId": 1, "meterValue": [{"timestamp": "2021-06-01T10:12:35.000Z", "sampledValue": [{"value": "1", "unit": "mWh"}]}]})");
+    }
+
+    TEST_CASE("Conversion errors")
+    {
+        JsonSchemaRegistry::clear();
+
+        checkNotConverted<StatusNotificationReq>("StatusNotification.json",
+                                                 R"({"connectorId": -1, "errorCode": "NoError", "status": "Available"})",
+                                                 "connectorId parameter is not an unsigned integer");
+        checkNotConverted<StatusNotificationReq>("StatusNotification.json",
+                                                 R"({"connectorId": 1, "errorCode": "NoError", "status": "Available", "timestamp": "now"})",
+                                                 "timestamp parameter is not a valid date-time object");
+        checkNotConverted<SetChargingProfileReq>(
+            "SetChargingProfile.json",
+            R"({"connectorId": 1, "csChargingProfiles": {"chargingProfileId": 1, "stackLevel": 0, "chargingProfilePurpose": "TxProfile", "chargingProfileKind": "Absolute", "chargingSchedule": {"chargingRateUnit": "A", "chargingSchedulePeriod": [{"startPeriod": 0, "limit": 16.0, "numberPhases": 4}]}}})",
+            "numberPhases parameter must be in interval [1;3]");
+        checkNotConverted<UnlockConnectorReq>("UnlockConnector.json", R"({"connectorId": 0})", "connectorId parameter must be > 0");
+        checkNotConverted<UpdateFirmwareReq>("UpdateFirmware.json",
+                                             R"({"location": "not an url", "retrieveDate": "2021-06-01T10:12:35.000Z"})",
+                                             "location parameter is not a valid URL");
+    }
+
+    TEST_CASE("Invalid JSON text")
+    {
+        JsonSchemaRegistry::clear();
+
+        auto decoder = getDecoder<StatusNotificationReq>("StatusNotification.json");
+        REQUIRE(decoder);
+
+        const char*           payload = R"({"connectorId": 1, "errorCode": "NoError", "status": "Available")";
+        StatusNotificationReq request;
+        const char*           error_code = nullptr;
+        std::string           error_message;
+        CHECK_FALSE(decoder->decode(payload, strlen(payload), request, error_code, error_message));
+        CHECK_EQ(std::string(error_code), IRpc::RPC_ERROR_FORMATION_VIOLATION);
+        CHECK_FALSE(error_message.empty());
+    }
+
+    TEST_CASE("Default values")
+    {
+        JsonSchemaRegistry::clear();
+
+        auto decoder = getDecoder<ExtendedTriggerMessageReq>("ExtendedTriggerMessage.json");
+        REQUIRE(decoder);
+
+        ExtendedTriggerMessageReq request;
+        const char*               error_code = nullptr;
+        std::string               error_message;
+        CHECK(decoder->decode(parse(R"({"requestedMessage": "Heartbeat"})"), request, error_code, error_message));
+        CHECK(request.connectorId.isSet());
+        CHECK_EQ(request.connectorId, 0u);
+    }
+
+    TEST_CASE("Dispatch")
+    {
+        JsonSchemaRegistry::clear();
+
+        // Single pass decoding
+        MessagesConverter messages_converter;
+        HeartbeatHandler  handler(messages_converter);
+        checkDispatch(handler);
+
+        // Validation followed by the conversion
+        ValidatedHeartbeatHandler validated_handler(messages_converter);
+        checkDispatch(validated_handler);
+    }
+}
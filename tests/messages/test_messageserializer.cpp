@@ -0,0 +1,211 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GenericMessageSender.h"
+#include "MessageSamples.h"
+#include "MessagesConverter.h"
+#include "RequestFifoStub.h"
+#include "RpcStub.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <set>
+
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+using namespace ocpp::types;
+
+/** @brief Samples which cannot be read by their converter (property names which do not match the message fields) */
+static const std::set<std::string> UNCONVERTIBLE_SAMPLES = {"GetLog.conf"};
+
+/** @brief Serialize a message through a JSON document */
+template <typename MessageType, typename ConverterType>
+static std::string serializeDocument(const MessageType& message)
+{
+    ConverterType       converter;
+    rapidjson::Document json;
+    json.SetObject();
+    REQUIRE(converter.toJson(message, json));
+
+    rapidjson::StringBuffer                    buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    json.Accept(writer);
+    return buffer.GetString();
+}
+
+/** @brief Serialize a message without building a JSON document */
+template <typename MessageType, typename ConverterType>
+static std::string serializeDirect(const MessageType& message)
+{
+    ConverterType                              converter;
+    rapidjson::StringBuffer                    buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    REQUIRE(converter.serialize(message, writer));
+    CHECK(writer.IsComplete());
+    return buffer.GetString();
+}
+
+/** @brief Check that the direct serialization of a message gives the same payload as its JSON document */
+template <typename MessageType, typename ConverterType>
+static void checkSerialization(const char* name, const char* payload)
+{
+    CAPTURE(name);
+    if (UNCONVERTIBLE_SAMPLES.find(name) != UNCONVERTIBLE_SAMPLES.end())
+    {
+        return;
+    }
+
+    rapidjson::Document json;
+    json.Parse(payload);
+    REQUIRE_FALSE(json.HasParseError());
+
+    MessageType   message;
+    ConverterType converter;
+    const char*   error_code = nullptr;
+    std::string   error_message;
+    REQUIRE(converter.fromJson(json, message, error_code, error_message));
+
+    CHECK_EQ(serializeDirect<MessageType, ConverterType>(message), serializeDocument<MessageType, ConverterType>(message));
+}
+
+/** @brief Convert a payload to its message */
+template <typename MessageType, typename ConverterType>
+static void convert(const char* payload, MessageType& message)
+{
+    rapidjson::Document json;
+    json.Parse(payload);
+    REQUIRE_FALSE(json.HasParseError());
+
+    ConverterType converter;
+    const char*   error_code = nullptr;
+    std::string   error_message;
+    REQUIRE(converter.fromJson(json, message, error_code, error_message));
+}
+
+TEST_SUITE("Message serializers test suite")
+{
+    TEST_CASE("All messages")
+    {
+#define CHECK_SAMPLE(MessageType, request, response)                                                 \
+    checkSerialization<MessageType##Req, MessageType##ReqConverter>(#MessageType ".req", request); \
+    checkSerialization<MessageType##Conf, MessageType##ConfConverter>(#MessageType ".conf", response);
+
+        MESSAGE_SAMPLES(CHECK_SAMPLE)
+    }
+
+    TEST_CASE("Optional fields")
+    {
+        StatusNotificationReq status_notification;
+        status_notification.connectorId = 1u;
+        status_notification.errorCode   = ChargePointErrorCode::NoError;
+        status_notification.status      = ChargePointStatus::Available;
+        status_notification.info.value().assign("not sent without error");
+        std::string payload = serializeDirect<StatusNotificationReq, StatusNotificationReqConverter>(status_notification);
+        CHECK_EQ(payload, R"({"connectorId":1,"errorCode":"NoError","status":"Available"})");
+        CHECK_EQ(payload, (serializeDocument<StatusNotificationReq, StatusNotificationReqConverter>(status_notification)));
+
+        MeterValuesReq meter_values;
+        meter_values.connectorId = 2u;
+        meter_values.meterValue.emplace_back();
+        meter_values.meterValue.back().timestamp = DateTime(1622542355);
+        meter_values.meterValue.back().sampledValue.emplace_back();
+        meter_values.meterValue.back().sampledValue.back().value = "1.5";
+        payload = serializeDirect<MeterValuesReq, MeterValuesReqConverter>(meter_values);
+        CHECK_EQ(payload, (serializeDocument<MeterValuesReq, MeterValuesReqConverter>(meter_values)));
+        CHECK_EQ(payload.find("transactionId"), std::string::npos);
+        CHECK_EQ(payload.find("measurand"), std::string::npos);
+    }
+
+    TEST_CASE("Converted fields")
+    {
+        StatusNotificationReq status_notification;
+        convert<StatusNotificationReq, StatusNotificationReqConverter>(
+            R"({"connectorId": 2, "errorCode": "OtherError", "info": "info", "status": "Faulted", "timestamp": "2021-06-01T10:12:35.000Z", "vendorId": "vendor", "vendorErrorCode": "E42"})",
+            status_notification);
+        CHECK_EQ(status_notification.info.value().str(), "info");
+        REQUIRE(status_notification.vendorId.isSet());
+        CHECK_EQ(status_notification.vendorId.value().str(), "vendor");
+        REQUIRE(status_notification.vendorErrorCode.isSet());
+        CHECK_EQ(status_notification.vendorErrorCode.value().str(), "E42");
+
+        SendLocalListReq send_local_list;
+        convert<SendLocalListReq, SendLocalListReqConverter>(
+            R"({"listVersion": 3, "localAuthorizationList": [{"idTag": "tag-1"}, {"idTag": "tag-2", "idTagInfo": {"status": "Blocked"}}], "updateType": "Differential"})",
+            send_local_list);
+        CHECK_EQ(send_local_list.listVersion, 3);
+        REQUIRE_EQ(send_local_list.localAuthorizationList.size(), 2u);
+        CHECK_EQ(send_local_list.localAuthorizationList[0].idTag.str(), "tag-1");
+        CHECK_FALSE(send_local_list.localAuthorizationList[0].idTagInfo.isSet());
+        CHECK_EQ(send_local_list.localAuthorizationList[1].idTag.str(), "tag-2");
+        REQUIRE(send_local_list.localAuthorizationList[1].idTagInfo.isSet());
+        CHECK_EQ(send_local_list.localAuthorizationList[1].idTagInfo.value().status, AuthorizationStatus::Blocked);
+
+        GetCompositeScheduleConf get_composite_schedule;
+        convert<GetCompositeScheduleConf, GetCompositeScheduleConfConverter>(
+            R"({"status": "Accepted", "connectorId": 1, "chargingSchedule": {"duration": 60, "chargingRateUnit": "A", "chargingSchedulePeriod": [{"startPeriod": 0, "limit": 16.0}]}})",
+            get_composite_schedule);
+        REQUIRE(get_composite_schedule.chargingSchedule.isSet());
+        const ChargingSchedule& charging_schedule = get_composite_schedule.chargingSchedule.value();
+        CHECK_EQ(charging_schedule.duration, 60);
+        CHECK_EQ(charging_schedule.chargingRateUnit, ChargingRateUnitType::A);
+        REQUIRE_EQ(charging_schedule.chargingSchedulePeriod.size(), 1u);
+        CHECK_EQ(charging_schedule.chargingSchedulePeriod[0].limit, 16.0f);
+    }
+
+    TEST_CASE("Sender")
+    {
+        RpcStub            rpc;
+        RequestFifoStub    request_fifo;
+        MessagesConverter  messages_converter;
+        GenericMessageSender sender(rpc, messages_converter, std::chrono::milliseconds(100));
+
+        HeartbeatReq  heartbeat_req;
+        HeartbeatConf heartbeat_conf;
+        rapidjson::Document response;
+        response.Parse(R"({"currentTime": "2021-06-01T10:12:35.000Z"})");
+
+        // Request serialized and sent
+        rpc.setConnected(true);
+        rpc.setResponse(response);
+        CHECK_EQ(sender.call(HEARTBEAT_ACTION, heartbeat_req, heartbeat_conf, &request_fifo), CallResult::Ok);
+        CHECK_EQ(heartbeat_conf.currentTime.timestamp(), 1622542355);
+        REQUIRE_EQ(rpc.getCalls().size(), 1u);
+        CHECK_EQ(rpc.getCalls()[0].first, HEARTBEAT_ACTION);
+        CHECK(rpc.getCalls()[0].second->IsObject());
+        CHECK(request_fifo.empty());
+
+        // Request queued inside the FIFO as a JSON document when it cannot be sent
+        StatusNotificationReq  status_req;
+        StatusNotificationConf status_conf;
+        status_req.connectorId = 1u;
+        status_req.errorCode   = ChargePointErrorCode::NoError;
+        status_req.status      = ChargePointStatus::Charging;
+        rpc.setConnected(false);
+        rpc.setCallWilFail(true);
+        CHECK_EQ(sender.call(STATUS_NOTIFICATION_ACTION, status_req, status_conf, &request_fifo, 1u), CallResult::Delayed);
+        REQUIRE_EQ(request_fifo.size(), 1u);
+
+        std::string         action;
+        unsigned int        connector_id = 0;
+        rapidjson::Document queued;
+        CHECK(request_fifo.front(connector_id, action, queued));
+        CHECK_EQ(connector_id, 1u);
+        CHECK_EQ(action, STATUS_NOTIFICATION_ACTION);
+        CHECK_EQ(std::string(queued["status"].GetString()), "Charging");
+    }
+}
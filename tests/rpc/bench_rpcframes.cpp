@@ -0,0 +1,169 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+#include "RpcBase.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace ocpp::rpc;
+
+/*
+ * Micro-benchmark of the RPC frames reception path
+ *
+ * Received MeterValues and StartTransaction CALL frames are decoded, queued and processed by the reception
+ * thread, and StartTransaction CALLRESULT frames are routed to the caller. The number of dynamic allocations
+ * and the number of allocated bytes per frame are measured by replacing the global allocation operators.
+ *
+ * Usage : bench_rpcframes [iterations=100000]
+ */
+
+/** @brief MeterValues CALL frame */
+static const char METERVALUES_CALL[] =
+    "[2, \"%ID%\", \"MeterValues\", {\"connectorId\": 1, \"transactionId\": 1234, \"meterValue\": [{\"timestamp\": "
+    "\"2021-06-01T10:12:35.000Z\", \"sampledValue\": [{\"value\": \"12345.6\", \"context\": \"Sample.Periodic\", \"measurand\": "
+    "\"Energy.Active.Import.Register\", \"unit\": \"Wh\"}, {\"value\": \"7360.0\", \"context\": \"Sample.Periodic\", \"measurand\": "
+    "\"Power.Active.Import\", \"unit\": \"W\"}, {\"value\": \"32.0\", \"context\": \"Sample.Periodic\", \"measurand\": "
+    "\"Current.Import\", \"phase\": \"L1\", \"unit\": \"A\"}, {\"value\": \"230.0\", \"context\": \"Sample.Periodic\", \"measurand\": "
+    "\"Voltage\", \"phase\": \"L1-N\", \"unit\": \"V\"}]}]}]";
+/** @brief StartTransaction CALL frame */
+static const char STARTTRANSACTION_CALL[] =
+    "[2, \"%ID%\", \"StartTransaction\", {\"connectorId\": 1, \"idTag\": \"0123456789ABCDEF\", \"meterStart\": 123456, "
+    "\"reservationId\": 42, \"timestamp\": \"2021-06-01T10:12:35.000Z\"}]";
+/** @brief StartTransaction CALLRESULT payload */
+static const char STARTTRANSACTION_RESULT[] =
+    "{\"idTagInfo\": {\"expiryDate\": \"2021-12-31T23:59:59.000Z\", \"parentIdTag\": \"PARENT01\", \"status\": \"Accepted\"}, "
+    "\"transactionId\": 1234}";
+
+/** @brief RPC implementation connected to a loopback link */
+class BenchRpc : public RpcBase, public IRpc::IListener
+{
+  public:
+    BenchRpc() : RpcBase(), m_responses(0), m_mutex(), m_cond() { registerListener(*this); }
+    virtual ~BenchRpc() { stop(); }
+
+    /** @brief Start processing */
+    void startRx() { start(); }
+    /** @brief Simulate the reception of a frame */
+    void receive(const std::string& frame) { processReceivedData(frame.c_str(), frame.size()); }
+    /** @brief Wait for the given number of responses to CALL messages */
+    void waitResponses(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this, count] { return (m_responses >= count); });
+    }
+
+    // IRpc interface
+    bool isConnected() const override { return true; }
+
+    // IRpc::IListener interface
+    void rpcDisconnected() override { }
+    void rpcError() override { }
+    bool rpcCallReceived(const std::string&, const char* payload, size_t size, rapidjson::Document& response, const char*&, std::string&) override
+    {
+        response.AddMember("status", rapidjson::StringRef("Accepted"), response.GetAllocator());
+        return ((size != 0) && (payload[0] == '{'));
+    }
+
+  protected:
+    /** @brief Loopback : CALL messages are answered immediately, responses to CALL messages are counted */
+    bool doSend(const char* data, size_t size) override
+    {
+        std::string msg(data, size);
+        if (msg.compare(0, 2, "[2") == 0)
+        {
+            size_t      start = msg.find('"') + 1u;
+            std::string id    = msg.substr(start, msg.find('"', start) - start);
+            receive("[3, \"" + id + "\", " + STARTTRANSACTION_RESULT + "]");
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_responses++;
+            m_cond.notify_all();
+        }
+        return true;
+    }
+
+  private:
+    size_t                  m_responses;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+};
+
+/** @brief Received CALL frames scenario */
+static void benchCall(const char* name, const char* frame_template, size_t iterations)
+{
+    BenchRpc rpc;
+    rpc.startRx();
+
+    std::string frame_template_str(frame_template);
+    size_t      id_pos = frame_template_str.find("%ID%");
+    std::string prefix = frame_template_str.substr(0, id_pos);
+    std::string suffix = frame_template_str.substr(id_pos + 4u);
+
+    // Frames are built before the measurement
+    std::vector<std::string> frames;
+    for (size_t i = 0; i < iterations; i++)
+    {
+        frames.push_back(prefix + std::to_string(i) + suffix);
+    }
+
+    size_t responses = 0;
+    report(name,
+           measure(iterations,
+                   [&](size_t i)
+                   {
+                       rpc.receive(frames[i]);
+                       rpc.waitResponses(++responses);
+                   }));
+}
+
+/** @brief Received CALLRESULT frames scenario */
+static void benchCallResult(const char* name, size_t iterations)
+{
+    BenchRpc rpc;
+    rpc.startRx();
+
+    rapidjson::Document payload;
+    payload.Parse("{}");
+
+    // The measure includes the sending of the CALL message
+    report(name,
+           measure(iterations,
+                   [&](size_t)
+                   {
+                       rapidjson::Document response;
+                       rpc.call("StartTransaction", payload, response);
+                   }));
+}
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 100000u;
+
+    benchCall("MeterValues CALL", METERVALUES_CALL, iterations);
+    benchCall("StartTransaction CALL", STARTTRANSACTION_CALL, iterations);
+    benchCallResult("StartTransaction CALLRESULT", iterations);
+
+    return 0;
+}
@@ -0,0 +1,276 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "IWebsocketServer.h"
+#include "RpcServer.h"
+#include "WorkStealingExecutor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ocpp::websockets;
+using namespace ocpp::rpc;
+using namespace ocpp::helpers;
+
+/*
+ * Benchmark of the RpcServer's incoming call requests processing
+ *
+ * N simulated charge points are connected to an RpcServer through an in-memory websocket layer.
+ * Each charge point sends its CALL requests one after the other (the next CALL is sent when the
+ * CALLRESULT of the previous one has been received) and the request handler simulates some
+ * processing time (database access for example).
+ *
+ * Usage : bench_rpcserver [charge_points=1000] [calls_per_charge_point=20] [rx_threads=0] [handler_us=100]
+ *         rx_threads = 0 => one reception thread per connection
+ *         rx_threads > 0 => shared executor with rx_threads threads
+ */
+
+/** @brief Read a value from /proc/self/status */
+static std::string procStatus(const std::string& field)
+{
+    std::string   ret = "n/a";
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, field.size() + 1u, field + ":") == 0)
+        {
+            ret = line.substr(field.size() + 1u);
+            ret.erase(0, ret.find_first_not_of(" \t"));
+        }
+    }
+    return ret;
+}
+
+/** @brief Shared benchmark state */
+struct BenchState
+{
+    unsigned int                                       calls_per_cp;
+    std::vector<std::chrono::steady_clock::time_point> sent;
+    std::vector<std::chrono::nanoseconds>              latencies;
+    std::atomic<unsigned int>                          completed;
+    std::mutex                                         end_mutex;
+    std::condition_variable                            end_var;
+};
+
+/** @brief In-memory websocket connection of a simulated charge point */
+class BenchWebsocketClient : public IWebsocketServer::IClient
+{
+  public:
+    BenchWebsocketClient(BenchState& state, unsigned int index) : m_state(state), m_index(index), m_listener(nullptr), m_next_call(0) { }
+
+    bool disconnect(bool notify_disconnected) override
+    {
+        (void)notify_disconnected;
+        return true;
+    }
+    bool isConnected() override { return true; }
+    void registerListener(IListener& listener) override { m_listener = &listener; }
+
+    /** @brief Called by the RPC server to send a CALLRESULT */
+    bool send(const void* data, size_t size) override
+    {
+        // Extract call index from the unique id : [3, "index", {...}]
+        std::string  msg(reinterpret_cast<const char*>(data), size);
+        size_t       start = msg.find('"') + 1u;
+        unsigned int call  = static_cast<unsigned int>(std::stoul(msg.substr(start, msg.find('"', start) - start)));
+        m_state.latencies[call] = std::chrono::steady_clock::now() - m_state.sent[call];
+
+        // Next call
+        if (m_next_call < m_state.calls_per_cp)
+        {
+            sendCall();
+        }
+        if (++m_state.completed == m_state.latencies.size())
+        {
+            std::lock_guard<std::mutex> lock(m_state.end_mutex);
+            m_state.end_var.notify_all();
+        }
+        return true;
+    }
+
+    /** @brief Send a CALL request to the RPC server */
+    void sendCall()
+    {
+        unsigned int call = m_index * m_state.calls_per_cp + m_next_call;
+        m_next_call++;
+
+        std::stringstream ss;
+        ss << "[2, \"" << call << "\", \"Heartbeat\", {}]";
+        std::string msg = ss.str();
+
+        m_state.sent[call] = std::chrono::steady_clock::now();
+        m_listener->wsClientDataReceived(msg.c_str(), msg.size());
+    }
+
+  private:
+    BenchState&  m_state;
+    unsigned int m_index;
+    IListener*   m_listener;
+    unsigned int m_next_call;
+};
+
+/** @brief In-memory websocket server */
+class BenchWebsocketServer : public IWebsocketServer
+{
+  public:
+    BenchWebsocketServer() : m_listener(nullptr) { }
+
+    bool start(const std::string& url, const std::string& protocol, const Credentials& credentials, std::chrono::milliseconds ping_interval)
+        override
+    {
+        (void)url;
+        (void)protocol;
+        (void)credentials;
+        (void)ping_interval;
+        return true;
+    }
+    bool stop() override { return true; }
+    void registerListener(IListener& listener) override { m_listener = &listener; }
+
+    /** @brief Simulate the connection of a charge point */
+    void connect(const std::string& uri, std::shared_ptr<IClient> client) { m_listener->wsClientConnected(uri.c_str(), client); }
+
+  private:
+    IListener* m_listener;
+};
+
+/** @brief Central system side : accept all the connections and answer to the requests */
+class BenchRpcListener : public RpcServer::IListener, public IRpc::IListener
+{
+  public:
+    BenchRpcListener(std::chrono::microseconds handler_duration) : m_handler_duration(handler_duration), m_clients(), m_mutex() { }
+
+    // RpcServer::IListener interface
+    bool rpcCheckCredentials(const std::string&, const std::string&, const std::string&) override { return true; }
+    void rpcClientConnected(const std::string&, std::shared_ptr<RpcServer::Client> client) override
+    {
+        client->registerListener(*this);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_clients.push_back(client);
+    }
+    void rpcServerError() override { }
+
+    // IRpc::IListener interface
+    void rpcDisconnected() override { }
+    void rpcError() override { }
+    bool rpcCallReceived(const std::string&, const char*, size_t, rapidjson::Document& response, const char*&, std::string&) override
+    {
+        if (m_handler_duration.count() != 0)
+        {
+            std::this_thread::sleep_for(m_handler_duration);
+        }
+        response.Parse("{\"currentTime\":\"2021-01-01T00:00:00Z\"}");
+        return true;
+    }
+
+    /** @brief Release the connections */
+    void clear() { m_clients.clear(); }
+
+  private:
+    std::chrono::microseconds                       m_handler_duration;
+    std::vector<std::shared_ptr<RpcServer::Client>> m_clients;
+    std::mutex                                      m_mutex;
+};
+
+int main(int argc, char* argv[])
+{
+    unsigned int cp_count     = (argc > 1) ? static_cast<unsigned int>(std::atoi(argv[1])) : 1000u;
+    unsigned int calls_per_cp = (argc > 2) ? static_cast<unsigned int>(std::atoi(argv[2])) : 20u;
+    unsigned int rx_threads   = (argc > 3) ? static_cast<unsigned int>(std::atoi(argv[3])) : 0u;
+    unsigned int handler_us   = (argc > 4) ? static_cast<unsigned int>(std::atoi(argv[4])) : 100u;
+
+    std::cout << "Charge points : " << cp_count << " - Calls per charge point : " << calls_per_cp
+              << " - Reception : " << (rx_threads ? std::to_string(rx_threads) + " shared threads" : "1 thread per connection")
+              << " - Handler duration : " << handler_us << "us" << std::endl;
+    std::cout << "Before connections : threads = " << procStatus("Threads") << " - RSS = " << procStatus("VmRSS") << std::endl;
+
+    BenchState state;
+    state.calls_per_cp = calls_per_cp;
+    state.sent.resize(cp_count * calls_per_cp);
+    state.latencies.resize(cp_count * calls_per_cp);
+    state.completed = 0;
+
+    std::unique_ptr<WorkStealingExecutor> executor;
+    if (rx_threads != 0)
+    {
+        executor = std::make_unique<WorkStealingExecutor>(rx_threads);
+    }
+    {
+        BenchWebsocketServer websocket;
+        RpcServer            server(websocket, "ocpp1.6", nullptr, executor.get());
+        BenchRpcListener     listener{std::chrono::microseconds(handler_us)};
+        server.registerServerListener(listener);
+        server.start("ws://127.0.0.1:8080/", IWebsocketServer::Credentials());
+
+        // Connect charge points
+        std::vector<std::shared_ptr<BenchWebsocketClient>> clients;
+        for (unsigned int i = 0; i < cp_count; i++)
+        {
+            clients.push_back(std::make_shared<BenchWebsocketClient>(state, i));
+            websocket.connect("/ocpp/CP" + std::to_string(i), clients.back());
+        }
+        std::cout << "Connected : threads = " << procStatus("Threads") << " - RSS = " << procStatus("VmRSS") << std::endl;
+
+        // Send the first call of each charge point, next ones are sent when the responses are received
+        auto start = std::chrono::steady_clock::now();
+        if (calls_per_cp != 0)
+        {
+            for (auto& client : clients)
+            {
+                client->sendCall();
+            }
+            std::unique_lock<std::mutex> lock(state.end_mutex);
+            state.end_var.wait(lock, [&state] { return (state.completed == state.latencies.size()); });
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        std::cout << "End of run : threads = " << procStatus("Threads") << " - RSS = " << procStatus("VmRSS") << std::endl;
+
+        // Statistics
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cout << "Duration : " << duration.count() << "ms";
+        if (!state.latencies.empty())
+        {
+            std::sort(state.latencies.begin(), state.latencies.end());
+            auto percentile = [&state](double p)
+            {
+                size_t index = static_cast<size_t>(p * static_cast<double>(state.latencies.size() - 1u));
+                return std::chrono::duration_cast<std::chrono::microseconds>(state.latencies[index]).count();
+            };
+            std::cout << " - Throughput : " << (state.latencies.size() * 1000u / std::max<long>(duration.count(), 1)) << " calls/s"
+                      << " - Latency : p50 = " << percentile(0.5) << "us - p99 = " << percentile(0.99)
+                      << "us - max = " << percentile(1.) << "us";
+        }
+        std::cout << std::endl;
+
+        server.stop();
+        listener.clear();
+    }
+
+    return 0;
+}
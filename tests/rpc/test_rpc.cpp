@@ -17,15 +17,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "RpcClient.h"
+#include "TimerPool.h"
 #include "WebsocketClientStub.h"
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <atomic>
 #include <cstring>
 #include <thread>
 
 using namespace ocpp::websockets;
 using namespace ocpp::rpc;
+using namespace ocpp::helpers;
 
 class RpcClientListener : public IRpc::IListener, public RpcClient::IListener
 {
@@ -57,21 +60,20 @@ class RpcClientListener : public IRpc::IListener, public RpcClient::IListener
     void rpcError() override { error = true; }
 
     /** @copydoc void IRpc::IListener::rpcCallReceived(const std::string&,
-                                                       const rapidjson::Value&,
+                                                       const char*,
+                                                       size_t,
                                                        rapidjson::Document&,
                                                        const char*&,
                                                        std::string&) */
-    bool rpcCallReceived(const std::string&      action,
-                         const rapidjson::Value& payload,
-                         rapidjson::Document&    response,
-                         const char*&            error_code,
-                         std::string&            error_message) override
+    bool rpcCallReceived(const std::string&   action,
+                         const char*          payload,
+                         size_t               size,
+                         rapidjson::Document& response,
+                         const char*&         error_code,
+                         std::string&         error_message) override
     {
         this->action = action;
-        rapidjson::StringBuffer                    buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        payload.Accept(writer);
-        this->payload = buffer.GetString();
+        this->payload.assign(payload, size);
         if (this->response)
         {
             response.Parse(this->response);
@@ -161,12 +163,15 @@ static constexpr const char* ACTION                        = "Heartbeat";
 static constexpr const char* CALL_PAYLOAD                  = "{\"id\":4}";
 static constexpr const char* CALLRESULT_PAYLOAD            = "{\"name\":\"bob\"}";
 static constexpr const char* CALLERROR_PAYLOAD             = "This is an error!";
-static constexpr const char* EXPECTED_CALL_MESSAGE_0       = "[2, \"0\", \"Heartbeat\", {\"id\":4}]";
-static constexpr const char* EXPECTED_CALL_MESSAGE_1       = "[2, \"1\", \"Heartbeat\", {\"id\":4}]";
-static constexpr const char* EXPECTED_CALL_MESSAGE_2       = "[2, \"2\", \"Heartbeat\", {\"id\":4}]";
-static constexpr const char* EXPECTED_CALLRESULT_MESSAGE_1 = "[3, \"1\", {\"name\":\"bob\"}]";
-static constexpr const char* EXPECTED_CALLRESULT_MESSAGE_2 = "[3, \"2\", {\"name\":\"bob\"}]";
-static constexpr const char* EXPECTED_CALLERROR_MESSAGE_1  = "[4, \"1\", \"NotImplemented\", \"This is an error!\", {}]";
+static constexpr const char* EXPECTED_CALL_MESSAGE_0       = "[2,\"0\",\"Heartbeat\",{\"id\":4}]";
+static constexpr const char* EXPECTED_CALL_MESSAGE_1       = "[2,\"1\",\"Heartbeat\",{\"id\":4}]";
+static constexpr const char* EXPECTED_CALL_MESSAGE_2       = "[2,\"2\",\"Heartbeat\",{\"id\":4}]";
+static constexpr const char* EXPECTED_CALLRESULT_MESSAGE_1 = "[3,\"1\",{\"name\":\"bob\"}]";
+static constexpr const char* EXPECTED_CALLRESULT_MESSAGE_2 = "[3,\"2\",{\"name\":\"bob\"}]";
+static constexpr const char* EXPECTED_CALLERROR_MESSAGE_1  = "[4,\"1\",\"NotImplemented\",\"This is an error!\",{}]";
+static constexpr const char* CALLRESULT_MESSAGE_0          = "[3, \"0\", {\"name\":\"alice\"}]";
+static constexpr const char* CALLRESULT_MESSAGE_1          = "[3, \"1\", {\"name\":\"bob\"}]";
+static constexpr const char* CALLERROR_MESSAGE_0           = "[4, \"0\", \"NotImplemented\", \"This is an error!\", {}]";
 
 TEST_SUITE("CALL messages")
 {
@@ -282,4 +287,292 @@ TEST_SUITE("CALL messages")
         CHECK(websocket.sendCalled());
         CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALLERROR_MESSAGE_1), 0);
     }
+
+    TEST_CASE("Escaping of the error message")
+    {
+        RpcClientListener             listener;
+        WebsocketClientStub           websocket;
+        IWebsocketClient::Credentials credentials;
+        RpcClient                     client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.start("", credentials);
+
+        listener.received_error = true;
+        listener.error_code     = IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+        listener.error_message  = "Invalid \"id\" value\n";
+        websocket.notifyDataReceived(EXPECTED_CALL_MESSAGE_1, strlen(EXPECTED_CALL_MESSAGE_1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        CHECK(websocket.sendCalled());
+        CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()),
+                        "[4,\"1\",\"TypeConstraintViolation\",\"Invalid \\\"id\\\" value\\n\",{}]"),
+                 0);
+
+        // Frame must be valid JSON
+        rapidjson::Document frame;
+        frame.Parse(reinterpret_cast<const char*>(websocket.sentData()));
+        CHECK_FALSE(frame.HasParseError());
+        CHECK_EQ(std::string(frame[3].GetString()), "Invalid \"id\" value\n");
+    }
+
+    TEST_CASE("Payload of a call request given as received")
+    {
+        RpcClientListener             listener;
+        WebsocketClientStub           websocket;
+        IWebsocketClient::Credentials credentials;
+        RpcClient                     client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.start("", credentials);
+
+        // Payload is not parsed by the RPC layer
+        const std::string payload = "{ \"id\" : \"a\\\"b\", \"list\": [1, {\"x\": null}] }";
+        const std::string message = " [ 2 , \"1\", \"Heartbeat\", " + payload + " ] ";
+        listener.response         = CALLRESULT_PAYLOAD;
+        websocket.notifyDataReceived(message.c_str(), message.size());
+        std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        CHECK_EQ(listener.action, ACTION);
+        CHECK_EQ(listener.payload, payload);
+        CHECK(websocket.sendCalled());
+        CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALLRESULT_MESSAGE_1), 0);
+
+        // Payload must be an object
+        const std::string invalid_message = "[2,\"2\",\"Reset\",\"{}\"]";
+        websocket.notifyDataReceived(invalid_message.c_str(), invalid_message.size());
+        std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        CHECK_EQ(listener.action, ACTION);
+        CHECK_EQ(std::string(reinterpret_cast<const char*>(websocket.sentData())).find("[4,\"\",\"ProtocolError\","), 0u);
+    }
+}
+
+TEST_SUITE("Pipelined CALL messages")
+{
+    TEST_CASE("Strict ordering timeout")
+    {
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+
+        // First call is slow to get its response
+        rapidjson::Document response_0;
+        bool                result_0 = false;
+        std::thread         call_thread([&] { result_0 = client.call(ACTION, payload, response_0, std::chrono::milliseconds(500)); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+
+        std::thread response_thread(
+            [&websocket]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(150u));
+                websocket.notifyDataReceived(CALLRESULT_MESSAGE_0, strlen(CALLRESULT_MESSAGE_0));
+                std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+                websocket.notifyDataReceived(CALLRESULT_MESSAGE_1, strlen(CALLRESULT_MESSAGE_1));
+            });
+
+        // Second call waits longer than its timeout before being sent
+        rapidjson::Document response_1;
+        CHECK(client.call(ACTION, payload, response_1, std::chrono::milliseconds(100)));
+        call_thread.join();
+        response_thread.join();
+        CHECK(result_0);
+
+        CHECK_EQ(std::string(response_0["name"].GetString()), "alice");
+        CHECK_EQ(std::string(response_1["name"].GetString()), "bob");
+    }
+
+    TEST_CASE("Out of order responses")
+    {
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.setStrictOrdering(false);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+
+        // First call gets its response after the second one
+        rapidjson::Document response_0;
+        bool                result_0 = false;
+        std::thread         call_thread([&] { result_0 = client.call(ACTION, payload, response_0, std::chrono::milliseconds(500)); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+
+        std::thread response_thread(
+            [&websocket]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+                websocket.notifyDataReceived(CALLRESULT_MESSAGE_1, strlen(CALLRESULT_MESSAGE_1));
+                std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+                websocket.notifyDataReceived(CALLRESULT_MESSAGE_0, strlen(CALLRESULT_MESSAGE_0));
+            });
+
+        rapidjson::Document response_1;
+        CHECK(client.call(ACTION, payload, response_1, std::chrono::milliseconds(500)));
+        call_thread.join();
+        response_thread.join();
+        CHECK(result_0);
+
+        CHECK_EQ(std::string(response_0["name"].GetString()), "alice");
+        CHECK_EQ(std::string(response_1["name"].GetString()), "bob");
+    }
+
+    TEST_CASE("Call error")
+    {
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.setStrictOrdering(false);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+        rapidjson::Document response;
+
+        std::thread response_thread(
+            [&websocket]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(25u));
+                websocket.notifyDataReceived(CALLERROR_MESSAGE_0, strlen(CALLERROR_MESSAGE_0));
+            });
+        auto start = std::chrono::steady_clock::now();
+        CHECK_FALSE(client.call(ACTION, payload, response, std::chrono::milliseconds(1000)));
+        auto end = std::chrono::steady_clock::now();
+        CHECK_LT(end - start, std::chrono::milliseconds(500u));
+        response_thread.join();
+    }
+}
+
+TEST_SUITE("Asynchronous CALL messages")
+{
+    TEST_CASE("Nominal")
+    {
+        TimerPool           timer_pool;
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL, &timer_pool);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+
+        bool        called   = false;
+        bool        received = false;
+        std::string name;
+        CHECK(client.callAsync(ACTION,
+                               payload,
+                               [&](bool _received, const rapidjson::Document& response)
+                               {
+                                   called   = true;
+                                   received = _received;
+                                   if (received)
+                                   {
+                                       name = response["name"].GetString();
+                                   }
+                               }));
+        CHECK(websocket.sendCalled());
+        CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALL_MESSAGE_0), 0);
+        CHECK_FALSE(called);
+
+        websocket.notifyDataReceived(CALLRESULT_MESSAGE_0, strlen(CALLRESULT_MESSAGE_0));
+        CHECK(called);
+        CHECK(received);
+        CHECK_EQ(name, "alice");
+    }
+
+    TEST_CASE("Timeout")
+    {
+        TimerPool           timer_pool;
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL, &timer_pool);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+
+        std::atomic<bool> called   = false;
+        std::atomic<bool> received = true;
+        CHECK(client.callAsync(
+            ACTION,
+            payload,
+            [&](bool _received, const rapidjson::Document&)
+            {
+                received = _received;
+                called   = true;
+            },
+            std::chrono::milliseconds(100)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(400u));
+        CHECK(called);
+        CHECK_FALSE(received);
+
+        // Late response is dropped
+        websocket.notifyDataReceived(CALLRESULT_MESSAGE_0, strlen(CALLRESULT_MESSAGE_0));
+        CHECK_FALSE(received);
+    }
+
+    TEST_CASE("Timeouts at the deadline of each call")
+    {
+        TimerPool           timer_pool;
+        RpcClientListener   listener;
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL, &timer_pool);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.setStrictOrdering(false);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+
+        // Each call times out at its own deadline, neither before nor long after
+        static constexpr size_t   CALLS_COUNT           = 3u;
+        std::chrono::milliseconds timeouts[CALLS_COUNT] = {
+            std::chrono::milliseconds(250), std::chrono::milliseconds(50), std::chrono::milliseconds(150)};
+        std::atomic<int64_t> elapsed[CALLS_COUNT];
+        auto                 start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < CALLS_COUNT; i++)
+        {
+            elapsed[i] = -1;
+            CHECK(client.callAsync(
+                ACTION,
+                payload,
+                [&elapsed, start, i](bool, const rapidjson::Document&)
+                {
+                    elapsed[i] =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+                },
+                timeouts[i]));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(400u));
+        for (size_t i = 0; i < CALLS_COUNT; i++)
+        {
+            CHECK_GE(elapsed[i], timeouts[i].count());
+            CHECK_LT(elapsed[i], timeouts[i].count() + 50);
+        }
+    }
+
+    TEST_CASE("No timer pool")
+    {
+        WebsocketClientStub websocket;
+        RpcClient           client(websocket, WS_PROTOCOL);
+        websocket.setConnected();
+
+        rapidjson::Document payload;
+        payload.Parse(CALL_PAYLOAD);
+        CHECK_FALSE(client.callAsync(ACTION, payload, [](bool, const rapidjson::Document&) { }));
+        CHECK_FALSE(websocket.sendCalled());
+    }
 }
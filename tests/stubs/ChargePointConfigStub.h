@@ -44,8 +44,16 @@ class ChargePointConfigStub : public IChargePointConfig
 
     /** @brief Path to the database to store persistent data */
     std::string databasePath() const override { return getString("DatabasePath"); }
+    /** @brief Enable the write-ahead log journal mode of the database */
+    bool databaseWalMode() const override { return getBool("DatabaseWalMode"); }
+    /** @brief Durability level of the database writes (OFF, NORMAL, FULL or EXTRA, empty = SQLite default) */
+    std::string databaseSynchronousMode() const override { return getString("DatabaseSynchronousMode"); }
+    /** @brief Path to the database to store the logs, it must not be the same file as databasePath() */
+    std::string logDatabasePath() const override { return getString("LogDatabasePath"); }
     /** @brief Path to the JSON schemas to validate the messages */
     std::string jsonSchemasPath() const override { return getString("JsonSchemasPath"); }
+    /** @brief Number of worker threads for the asynchronous jobs (0 = number of hardware threads, minimum is 2) */
+    unsigned int workerThreadCount() const override { return get<unsigned int>("WorkerThreadCount"); }
 
     // Communication parameters
 
@@ -59,6 +67,10 @@ class ChargePointConfigStub : public IChargePointConfig
     std::chrono::milliseconds retryInterval() const override { return get<std::chrono::milliseconds>("RetryInterval"); }
     /** @brief Call request timeout */
     std::chrono::milliseconds callRequestTimeout() const override { return get<std::chrono::milliseconds>("CallRequestTimeout"); }
+    /** @brief Allow several call requests to be in flight at the same time */
+    bool callRequestsPipelining() const override { return getBool("CallRequestsPipelining"); }
+    /** @brief Maximum size in bytes of a received websocket message */
+    unsigned int webSocketMaxMessageSize() const override { return get<unsigned int>("WebSocketMaxMessageSize"); }
     /** @brief Cipher list to use for TLSv1.2 connections */
     std::string tlsv12CipherList() const override { return getString("Tlsv12CipherList"); }
     /** @brief Cipher list to use for TLSv1.3 connections */
@@ -114,11 +126,23 @@ class ChargePointConfigStub : public IChargePointConfig
 
     /** @brief Maximum number of entries in the authentication cache */
     unsigned int authentCacheMaxEntriesCount() const override { return get<unsigned int>("AuthentCacheMaxEntriesCount"); }
+    /** @brief Keep an in-memory index of the authentication cache and local list */
+    bool authentInMemoryIndex() const override { return getBool("AuthentInMemoryIndex"); }
+    /** @brief Build the new authentication local list in a separate table on full updates */
+    bool authentLocalListDoubleBuffering() const override { return getBool("AuthentLocalListDoubleBuffering"); }
+
+    // Requests FIFO
+
+    /** @brief Maximum number of requests in the transaction related requests FIFO (0 = no limit) */
+    unsigned int requestFifoMaxSize() const override { return get<unsigned int>("RequestFifoMaxSize"); }
+    /** @brief Maximum number of requests of the transaction related requests FIFO to send at the same time when replaying the FIFO */
+    unsigned int requestFifoReplayDepth() const override { return get<unsigned int>("RequestFifoReplayDepth"); }
 
     // Logs
 
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     unsigned int logMaxEntriesCount() const override { return get<unsigned int>("LogMaxEntriesCount"); }
+    unsigned int logAsyncQueueSize() const override { return get<unsigned int>("LogAsyncQueueSize"); }
 
     // Security
 
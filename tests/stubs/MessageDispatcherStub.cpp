@@ -36,21 +36,23 @@ bool MessageDispatcherStub::registerHandler(const std::string& action, IMessageH
 }
 
 /** @copydoc bool IMessageDispatcher::dispatchMessage(const std::string&,
-                                                          const rapidjson::Value&,
+                                                          const char*,
+                                                          size_t,
                                                           rapidjson::Document&,
                                                           const char*&,
                                                           std::string&) */
-bool MessageDispatcherStub::dispatchMessage(const std::string&      action,
-                                            const rapidjson::Value& payload,
-                                            rapidjson::Document&    response,
-                                            const char*&            error_code,
-                                            std::string&            error_message)
+bool MessageDispatcherStub::dispatchMessage(const std::string&   action,
+                                            const char*          payload,
+                                            size_t               size,
+                                            rapidjson::Document& response,
+                                            const char*&         error_code,
+                                            std::string&         error_message)
 {
     bool ret          = false;
     auto iter_handler = m_handlers.find(action);
     if (iter_handler != m_handlers.end())
     {
-        ret = iter_handler->second->handle(action, payload, response, error_code, error_message);
+        ret = iter_handler->second->handle(action, payload, size, response, error_code, error_message);
     }
     return ret;
 }
@@ -42,15 +42,17 @@ class MessageDispatcherStub : public IMessageDispatcher
     bool registerHandler(const std::string& action, IMessageHandler& handler) override;
 
     /** @copydoc bool IMessageDispatcher::dispatchMessage(const std::string&,
-                                                          const rapidjson::Value&,
+                                                          const char*,
+                                                          size_t,
                                                           rapidjson::Document&,
                                                           const char*&,
                                                           std::string&) */
-    bool dispatchMessage(const std::string&      action,
-                         const rapidjson::Value& payload,
-                         rapidjson::Document&    response,
-                         const char*&            error_code,
-                         std::string&            error_message) override;
+    bool dispatchMessage(const std::string&   action,
+                         const char*          payload,
+                         size_t               size,
+                         rapidjson::Document& response,
+                         const char*&         error_code,
+                         std::string&         error_message) override;
 
     /** @brief Check if a specific action as a registered handler */
     bool hasHandler(const std::string& action) const;
@@ -24,7 +24,7 @@ namespace messages
 {
 
 /** @brief Constructor */
-RequestFifoStub::RequestFifoStub() : m_fifo(), m_listener(nullptr) { }
+RequestFifoStub::RequestFifoStub() : m_fifo(), m_id(0), m_listener(nullptr) { }
 
 /** @brief Destructor */
 RequestFifoStub::~RequestFifoStub() { }
@@ -32,7 +32,7 @@ RequestFifoStub::~RequestFifoStub() { }
 /** @copydoc void IRequestFifo::push(unsigned int, const std::string&, const rapidjson::Document&) const */
 void RequestFifoStub::push(unsigned int connector_id, const std::string& action, const rapidjson::Document& payload)
 {
-    m_fifo.emplace(connector_id, action, payload);
+    m_fifo.emplace_back(m_id++, connector_id, action, payload);
 }
 
 /** @copydoc bool IRequestFifo::front(unsigned int&, std::string&, const rapidjson::Document&) const */
@@ -56,16 +56,57 @@ bool RequestFifoStub::front(unsigned int& connector_id, std::string& action, rap
 /** @@copydoc void IRequestFifo::pop() */
 void RequestFifoStub::pop()
 {
-    m_fifo.pop();
+    m_fifo.pop_front();
 }
 
-/** @brief Clear the fifo */
-void RequestFifoStub::clear()
+/** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t) */
+size_t RequestFifoStub::front(std::vector<Request>& requests, size_t max_count)
+{
+    return front(requests, max_count, [](unsigned int, const std::string&) { return Selection::Select; });
+}
+
+/** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t, const Selector&) */
+size_t RequestFifoStub::front(std::vector<Request>& requests, size_t max_count, const Selector& selector)
 {
-    while (!m_fifo.empty())
+    requests.clear();
+    for (auto it = m_fifo.begin(); (it != m_fifo.end()) && (requests.size() < max_count); ++it)
     {
-        m_fifo.pop();
+        Selection selection = selector(it->connector_id, it->action);
+        if (selection == Selection::End)
+        {
+            break;
+        }
+        if (selection == Selection::Skip)
+        {
+            continue;
+        }
+        requests.emplace_back();
+        Request& request     = requests.back();
+        request.id           = it->id;
+        request.connector_id = it->connector_id;
+        request.action       = it->action;
+        request.payload.CopyFrom(it->request, request.payload.GetAllocator());
     }
+    return requests.size();
+}
+
+/** @copydoc void IRequestFifo::pop(unsigned int) */
+void RequestFifoStub::pop(unsigned int id)
+{
+    for (auto it = m_fifo.begin(); it != m_fifo.end(); ++it)
+    {
+        if (it->id == id)
+        {
+            m_fifo.erase(it);
+            break;
+        }
+    }
+}
+
+/** @brief Clear the fifo */
+void RequestFifoStub::clear()
+{
+    m_fifo.clear();
 }
 
 } // namespace messages
@@ -21,7 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "IRequestFifo.h"
 
-#include <queue>
+#include <deque>
 
 namespace ocpp
 {
@@ -45,6 +45,12 @@ class RequestFifoStub : public IRequestFifo
 
     /** @@copydoc void IRequestFifo::pop() */
     void pop() override;
+    /** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t) */
+    size_t front(std::vector<Request>& requests, size_t max_count) override;
+    /** @copydoc size_t IRequestFifo::front(std::vector<Request>&, size_t, const Selector&) */
+    size_t front(std::vector<Request>& requests, size_t max_count, const Selector& selector) override;
+    /** @copydoc void IRequestFifo::pop(unsigned int) */
+    void pop(unsigned int id) override;
 
     /** @copydoc size_t IRequestFifo::size() const */
     size_t size() const override { return m_fifo.size(); }
@@ -68,13 +74,15 @@ class RequestFifoStub : public IRequestFifo
     struct Entry
     {
         /** @brief Default constructor */
-        Entry() : connector_id(0), action(), request() { }
+        Entry() : id(0), connector_id(0), action(), request() { }
         /** @brief Constructor */
-        Entry(unsigned int _connector_id, std::string _action, const rapidjson::Document& _request)
-            : connector_id(_connector_id), action(_action), request()
+        Entry(unsigned int _id, unsigned int _connector_id, std::string _action, const rapidjson::Document& _request)
+            : id(_id), connector_id(_connector_id), action(_action), request()
         {
             request.CopyFrom(_request, request.GetAllocator());
         }
+        /** @brief Id */
+        unsigned int id;
 
         /** @brief Id of the connector related to the request */
         unsigned int connector_id;
@@ -85,7 +93,9 @@ class RequestFifoStub : public IRequestFifo
     };
 
     /** @brief FIFO */
-    std::queue<Entry> m_fifo;
+    std::deque<Entry> m_fifo;
+    /** @brief Current id of the request */
+    unsigned int m_id;
     /** @brief Listener */
     IListener* m_listener;
 };
@@ -23,7 +23,18 @@ namespace ocpp
 namespace rpc
 {
 /** @brief Constructor */
-RpcStub::RpcStub() : m_connected(false), m_listener(nullptr), m_spy(nullptr), m_call_will_fail(false), m_response() { }
+RpcStub::RpcStub()
+    : m_connected(false),
+      m_listener(nullptr),
+      m_spy(nullptr),
+      m_call_will_fail(false),
+      m_response(),
+      m_calls(),
+      m_async_calls_deferred(false),
+      m_calls_mutex(),
+      m_pending_async_calls()
+{
+}
 /** @brief Destructor */
 RpcStub::~RpcStub() { }
 
@@ -49,6 +60,63 @@ bool RpcStub::call(const std::string&         action,
     return ret;
 }
 
+/** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCallback, std::chrono::milliseconds) */
+bool RpcStub::callAsync(const std::string& action, const rapidjson::Document& payload, CallCallback callback, std::chrono::milliseconds timeout)
+{
+    (void)timeout;
+
+    bool ret = false;
+    if (m_connected)
+    {
+        rapidjson::Document* doc = new rapidjson::Document();
+        doc->CopyFrom(payload, doc->GetAllocator());
+        if (m_async_calls_deferred)
+        {
+            std::lock_guard<std::mutex> lock(m_calls_mutex);
+            m_calls.emplace_back(action, doc);
+            m_pending_async_calls.push_back(callback);
+        }
+        else
+        {
+            m_calls.emplace_back(action, doc);
+
+            rapidjson::Document response;
+            response.CopyFrom(m_response, response.GetAllocator());
+            callback(!m_call_will_fail, response);
+        }
+
+        ret = true;
+    }
+
+    return ret;
+}
+
+/** @brief Get the number of asynchronous calls waiting to be completed */
+size_t RpcStub::getPendingAsyncCallsCount()
+{
+    std::lock_guard<std::mutex> lock(m_calls_mutex);
+    return m_pending_async_calls.size();
+}
+
+/** @brief Complete a deferred asynchronous call with the current response */
+void RpcStub::completeAsyncCall(size_t index, bool received)
+{
+    CallCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(m_calls_mutex);
+        if (index >= m_pending_async_calls.size())
+        {
+            return;
+        }
+        callback = m_pending_async_calls[index];
+        m_pending_async_calls.erase(m_pending_async_calls.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    rapidjson::Document response;
+    response.CopyFrom(m_response, response.GetAllocator());
+    callback(received, response);
+}
+
 /** @brief Set the next response */
 void RpcStub::setResponse(const rapidjson::Document& response)
 {
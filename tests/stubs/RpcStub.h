@@ -22,6 +22,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace ocpp
@@ -47,6 +48,12 @@ class RpcStub : public IRpc
               rapidjson::Document&       response,
               std::chrono::milliseconds  timeout) override;
 
+    /** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCallback, std::chrono::milliseconds) */
+    bool callAsync(const std::string&         action,
+                   const rapidjson::Document& payload,
+                   CallCallback               callback,
+                   std::chrono::milliseconds  timeout) override;
+
     /** @copydoc void IRpc::registerListener(IListener&) */
     void registerListener(IRpc::IListener& listener) override { m_listener = &listener; }
 
@@ -69,6 +76,12 @@ class RpcStub : public IRpc
     const std::vector<std::pair<std::string, std::unique_ptr<rapidjson::Document>>>& getCalls() const { return m_calls; }
     /** @brief Clear the list of calls */
     void clearCalls() { m_calls.clear(); }
+    /** @brief Indicate if the asynchronous calls are completed later by completeAsyncCall() instead of immediately */
+    void setAsyncCallsDeferred(bool deferred) { m_async_calls_deferred = deferred; }
+    /** @brief Get the number of asynchronous calls waiting to be completed */
+    size_t getPendingAsyncCallsCount();
+    /** @brief Complete a deferred asynchronous call with the current response (index in the list of the pending calls) */
+    void completeAsyncCall(size_t index, bool received);
 
   private:
     /** @brief Connectivity state */
@@ -83,6 +96,12 @@ class RpcStub : public IRpc
     rapidjson::Document m_response;
     /** @brief Calls */
     std::vector<std::pair<std::string, std::unique_ptr<rapidjson::Document>>> m_calls;
+    /** @brief Indicate if the asynchronous calls are completed later */
+    bool m_async_calls_deferred;
+    /** @brief Mutex for concurrent access to the calls */
+    std::mutex m_calls_mutex;
+    /** @brief Asynchronous calls waiting to be completed */
+    std::vector<CallCallback> m_pending_async_calls;
 };
 
 } // namespace rpc
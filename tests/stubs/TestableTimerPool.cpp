@@ -62,6 +62,12 @@ void TestableTimerPool::registerTimer(Timer* timer)
     }
 }
 
+/** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+void TestableTimerPool::unregisterTimer(Timer* timer)
+{
+    m_timers.remove(timer);
+}
+
 /** @copydoc void ITimerPool::lock() */
 void TestableTimerPool::lock() { }
 
@@ -48,6 +48,8 @@ class TestableTimerPool : public ITimerPool
 
     /** @copydoc void ITimerPool::addTimer(Timer*) */
     void registerTimer(Timer* timer) override;
+    /** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+    void unregisterTimer(Timer* timer) override;
     /** @copydoc void ITimerPool::lock() */
     void lock() override;
     /** @copydoc void ITimerPool::unlock() */
@@ -34,8 +34,12 @@ class TestableWorkerThreadPool : public WorkerThreadPool
     TestableWorkerThreadPool() : WorkerThreadPool(0u) { }
 
   protected:
-    /** @brief Add a job to the queue */
-    virtual void queue(const std::shared_ptr<IJob>& job) { job->run(); }
+    /** @brief Add a task to the queue */
+    bool queueTask(Task&& task) override
+    {
+        task();
+        return true;
+    }
 };
 
 } // namespace helpers
@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Database.h"
+#include "LogDatabase.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ocpp::database;
+using namespace ocpp::log;
+
+/*
+ * Benchmark of the insertion in a bounded log table
+ *
+ * For each maximum number of entries, the table is first filled up to its capacity, then the mean
+ * insertion time is measured while the oldest entries are rotated out. Inserts are grouped in
+ * transactions with synchronous writes disabled to measure the cost of the rotation instead of the
+ * cost of the disk flushes.
+ * The 'legacy' option replaces the rotation trigger with the one of previous versions which counts
+ * the entries of the table on each insert.
+ *
+ * Usage : bench_logdatabase [inserts=2000] [legacy]
+ */
+
+/** @brief Execute a single SQL statement */
+static void exec(Database& db, const std::string& sql)
+{
+    auto query = db.query(sql);
+    if (!query || !query->exec())
+    {
+        std::cout << "Error on [" << sql << "] : " << db.lastError() << std::endl;
+    }
+}
+
+/** @brief Benchmark a table with the given capacity */
+static void bench(const std::filesystem::path& db_path, unsigned int max_entries, size_t inserts, bool legacy)
+{
+    std::filesystem::remove(db_path);
+
+    Database db;
+    db.open(db_path);
+    exec(db, "PRAGMA synchronous = OFF;");
+
+    LogDatabase log_db(db, "BenchLogs", max_entries);
+    const std::string file    = "bench_logdatabase.cpp:42";
+    const std::string message = "[2,\"1234\",\"MeterValues\",{\"connectorId\":1,\"transactionId\":1234,\"meterValue\":[]}]";
+
+    // Fill the table
+    exec(db, "BEGIN;");
+    for (unsigned int i = 0; i < max_entries; i++)
+    {
+        log_db.log(static_cast<std::time_t>(i), 1u, file, message);
+    }
+    exec(db, "COMMIT;");
+
+    if (legacy)
+    {
+        exec(db, "DROP TRIGGER delete_oldest_BenchLogs;");
+        exec(db,
+             "CREATE TRIGGER delete_oldest_BenchLogs AFTER INSERT ON BenchLogs WHEN ((SELECT count() FROM BenchLogs) > " +
+                 std::to_string(max_entries) +
+                 ") BEGIN DELETE FROM BenchLogs WHERE ROWID IN (SELECT ROWID FROM BenchLogs LIMIT 1);END;");
+    }
+
+    // Measure insertions with rotation
+    auto start = std::chrono::steady_clock::now();
+    exec(db, "BEGIN;");
+    for (size_t i = 0; i < inserts; i++)
+    {
+        log_db.log(static_cast<std::time_t>(i), 1u, file, message);
+    }
+    exec(db, "COMMIT;");
+    auto end = std::chrono::steady_clock::now();
+
+    // Check the table size
+    unsigned int count = 0;
+    auto         query = db.query("SELECT count() FROM BenchLogs;");
+    if (query && query->exec() && query->hasRows())
+    {
+        count = query->getUInt32(0);
+    }
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << std::setw(10) << max_entries << " entries : " << std::setw(10) << (ns / static_cast<long>(inserts)) << " ns/insert"
+              << std::setw(12) << count << " rows" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t inserts = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 2000u;
+    bool   legacy  = (argc > 2) && (std::strcmp(argv[2], "legacy") == 0);
+
+    std::filesystem::path db_path = std::filesystem::temp_directory_path();
+    db_path.append("bench_logdatabase.db");
+
+    for (unsigned int max_entries : {1000u, 10000u, 100000u, 1000000u})
+    {
+        bench(db_path, max_entries, inserts, legacy);
+    }
+    std::filesystem::remove(db_path);
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LockFreeQueue.h"
+#include "Queue.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ocpp::helpers;
+
+/*
+ * Benchmark of the message queues under contention
+ *
+ * Producer threads push a given number of items into the queue while a single consumer thread
+ * pops them, one by one or by batches. The mutex based queue is compared with the lock-free
+ * MPSC and SPSC queues, with and without spinning before parking the consumer.
+ * All the queues have the same capacity, producers retry when the queue is full.
+ *
+ * Usage : bench_queue [items=1000000] [producers=4]
+ */
+
+/** @brief Capacity of the queues */
+static constexpr size_t QUEUE_CAPACITY = 1024u;
+/** @brief Maximum number of items retrieved at once */
+static constexpr size_t BATCH_SIZE = 64u;
+
+/** @brief Benchmark a queue */
+template <typename QueueType>
+static void bench(const std::string& name, QueueType& queue, size_t producers, size_t items, bool batch)
+{
+    size_t items_per_producer = items / producers;
+    size_t total_items        = items_per_producer * producers;
+
+    auto                     start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back(
+            [&queue, items_per_producer]
+            {
+                for (size_t i = 0; i < items_per_producer; i++)
+                {
+                    while (!queue.push(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    size_t received = 0;
+    size_t values[BATCH_SIZE];
+    while (received != total_items)
+    {
+        received += queue.popBatch(values, (batch ? BATCH_SIZE : 1u), 1000u);
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::cout << std::left << std::setw(36) << name << std::right << std::setw(10) << duration << "us" << std::setw(12)
+              << static_cast<uint64_t>(static_cast<double>(total_items) * 1000000. / static_cast<double>(duration + 1)) << " items/s"
+              << std::endl;
+}
+
+/** @brief Benchmark all the queue types with the given number of producers */
+static void benchAll(size_t producers, size_t items)
+{
+    std::cout << "Producers : " << producers << std::endl;
+    for (bool batch : {false, true})
+    {
+        std::string suffix = (batch ? " - batch pop" : "");
+        {
+            Queue<size_t, QUEUE_CAPACITY> queue;
+            bench("Queue (mutex)" + suffix, queue, producers, items, batch);
+        }
+        {
+            MpscQueue<size_t, QUEUE_CAPACITY> queue;
+            bench("MpscQueue" + suffix, queue, producers, items, batch);
+        }
+        {
+            MpscQueue<size_t, QUEUE_CAPACITY> queue(1000u);
+            bench("MpscQueue spin" + suffix, queue, producers, items, batch);
+        }
+        if (producers == 1u)
+        {
+            SpscQueue<size_t, QUEUE_CAPACITY> queue;
+            bench("SpscQueue" + suffix, queue, producers, items, batch);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t items     = 1000000u;
+    size_t producers = 4u;
+    if (argc > 1)
+    {
+        items = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        producers = std::strtoul(argv[2], nullptr, 10);
+    }
+    if ((items == 0) || (producers == 0))
+    {
+        std::cout << "Usage : bench_queue [items=1000000] [producers=4]" << std::endl;
+        return 1;
+    }
+
+    benchAll(1u, items);
+    if (producers > 1u)
+    {
+        benchAll(producers, items);
+    }
+
+    return 0;
+}
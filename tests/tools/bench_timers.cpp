@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Timer.h"
+#include "TimerPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ocpp::helpers;
+
+/*
+ * Benchmark of the timer pool scaling with the number of timers
+ *
+ * For each number of timers, the mean duration of the start, restart, stop and lookup by name
+ * operations is measured while all the timers are active (long intervals, the timers don't elapse).
+ * Then all the timers are started as single shot timers elapsing within the next 100ms and
+ * the time needed for the pool to fire all of them is measured with the lateness of the callbacks.
+ *
+ * Usage : bench_timers [max_timers=100000]
+ */
+
+/** @brief Nanoseconds elapsed since a time point divided by a number of operations */
+static long nsPerOp(std::chrono::steady_clock::time_point start, size_t count)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<long>(ns / static_cast<long>(count));
+}
+
+/** @brief Benchmark a pool with the given number of timers */
+static void bench(size_t count)
+{
+    TimerPool                           pool;
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::atomic<size_t>                 fired(0);
+    for (size_t i = 0; i < count; i++)
+    {
+        std::string name = "timer" + std::to_string(i);
+        timers.emplace_back(pool.createTimer(name.c_str()));
+        timers.back()->setCallback([&fired] { fired++; });
+    }
+
+    // Operations on active timers, intervals are spread to get a random order
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        timers[i]->start(std::chrono::milliseconds(3600000u + ((i * 7919u) % count)));
+    }
+    long start_ns = nsPerOp(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        timers[i]->restart(std::chrono::milliseconds(3600000u + ((i * 104729u) % count)));
+    }
+    long restart_ns = nsPerOp(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i += 10u)
+    {
+        pool.getTimer("timer" + std::to_string(i));
+    }
+    long lookup_ns = nsPerOp(start, (count + 9u) / 10u);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        timers[i]->stop();
+    }
+    long stop_ns = nsPerOp(start, count);
+
+    // Fire all the timers within 100ms
+    pool.resetStats();
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        timers[i]->start(std::chrono::milliseconds((i * 7919u) % 100u), true);
+    }
+    while ((fired < count) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(60u)))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+    }
+    auto           fire_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TimerPoolStats stats   = pool.stats();
+
+    std::cout << std::setw(8) << count << " timers : start " << std::setw(6) << start_ns << " ns - restart " << std::setw(6) << restart_ns
+              << " ns - stop " << std::setw(6) << stop_ns << " ns - lookup " << std::setw(8) << lookup_ns << " ns - fire all "
+              << std::setw(6) << fire_ms << " ms (" << fired << " fired, lateness mean " << stats.mean_lateness.count() << " us - max "
+              << stats.max_lateness.count() << " us)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t max_timers = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 100000u;
+
+    for (size_t count = 100u; count <= max_timers; count *= 10u)
+    {
+        bench(count);
+    }
+
+    return 0;
+}
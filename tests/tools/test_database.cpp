@@ -20,8 +20,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <chrono>
 #include <filesystem>
 #include <limits>
+#include <thread>
 
 using namespace ocpp::database;
 
@@ -135,5 +137,102 @@ TEST_SUITE("Database class test suite")
         CHECK_EQ(query.get(), nullptr);
     }
 
+    TEST_CASE("Transactions")
+    {
+        std::filesystem::remove(test_database_path);
+
+        Database db;
+        CHECK(db.open(test_database_path, true, "NORMAL"));
+
+        auto query = db.query("PRAGMA journal_mode;");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        CHECK(query->hasRows());
+        CHECK_EQ(query->getString(0), "wal");
+
+        query = db.query("CREATE TABLE IF NOT EXISTS TxTable ([id] INTEGER, PRIMARY KEY([id] AUTOINCREMENT));");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        auto insert_query = db.query("INSERT INTO TxTable VALUES (NULL);");
+        CHECK_NE(insert_query.get(), nullptr);
+        auto count_query = db.query("SELECT count() FROM TxTable;");
+        CHECK_NE(count_query.get(), nullptr);
+        auto count = [&count_query]
+        {
+            count_query->reset();
+            count_query->exec();
+            return count_query->getUInt32(0);
+        };
+
+        // Commit
+        {
+            Database::Transaction transaction(db);
+            CHECK(transaction.isStarted());
+            for (int i = 0; i < 10; i++)
+            {
+                insert_query->reset();
+                CHECK(insert_query->exec());
+            }
+            CHECK(transaction.commit());
+            CHECK_FALSE(transaction.isStarted());
+        }
+        CHECK_EQ(count(), 10u);
+
+        // Rollback on destruction
+        {
+            Database::Transaction transaction(db);
+            insert_query->reset();
+            CHECK(insert_query->exec());
+            CHECK_EQ(count(), 11u);
+        }
+        CHECK_EQ(count(), 10u);
+
+        // Nested transactions
+        {
+            Database::Transaction transaction(db);
+            insert_query->reset();
+            CHECK(insert_query->exec());
+            {
+                Database::Transaction nested_transaction(db);
+                insert_query->reset();
+                CHECK(insert_query->exec());
+                CHECK(nested_transaction.commit());
+            }
+            CHECK(transaction.commit());
+        }
+        CHECK_EQ(count(), 12u);
+        {
+            Database::Transaction transaction(db);
+            insert_query->reset();
+            CHECK(insert_query->exec());
+            {
+                Database::Transaction nested_transaction(db);
+                insert_query->reset();
+                CHECK(insert_query->exec());
+            }
+            CHECK_FALSE(transaction.commit());
+        }
+        CHECK_EQ(count(), 12u);
+
+        // Queries from other threads wait for the end of the transaction
+        std::thread other_thread;
+        {
+            Database::Transaction transaction(db);
+            insert_query->reset();
+            CHECK(insert_query->exec());
+
+            other_thread = std::thread(
+                [&db]
+                {
+                    auto other_query = db.query("INSERT INTO TxTable VALUES (NULL);");
+                    other_query->exec();
+                });
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            CHECK_EQ(count(), 13u);
+        }
+        other_thread.join();
+        CHECK_EQ(count(), 13u);
+    }
+
     TEST_CASE("Cleanup") { std::filesystem::remove(test_database_path); }
 }
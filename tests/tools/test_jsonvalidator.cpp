@@ -0,0 +1,133 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JsonSchemaRegistry.h"
+#include "JsonValidator.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace ocpp::json;
+
+/** @brief Path to the test schema */
+static const std::string SCHEMA_FILE = "/tmp/test_jsonvalidator_schema.json";
+
+/** @brief Create the test schema */
+static void createSchema()
+{
+    std::ofstream schema(SCHEMA_FILE);
+    schema << "{\"type\": \"object\", \"properties\": {\"value\": {\"type\": \"integer\", \"minimum\": 0}}, \"required\": [\"value\"]}";
+}
+
+/** @brief Parse a JSON document */
+static rapidjson::Document parse(const char* json)
+{
+    rapidjson::Document doc;
+    doc.Parse(json);
+    return doc;
+}
+
+TEST_SUITE("JsonValidator class test suite")
+{
+    TEST_CASE("Schema loading")
+    {
+        JsonSchemaRegistry::clear();
+        createSchema();
+
+        JsonValidator validator;
+        CHECK_FALSE(validator.init("/tmp/not_existing_schema.json"));
+        CHECK_FALSE(validator.isValid(parse("{\"value\": 1}")));
+        CHECK_EQ(JsonSchemaRegistry::size(), 0u);
+
+        CHECK(validator.init(SCHEMA_FILE));
+        CHECK_EQ(JsonSchemaRegistry::size(), 1u);
+
+        CHECK(validator.isValid(parse("{\"value\": 1}")));
+        CHECK_FALSE(validator.isValid(parse("{\"value\": -1}")));
+        CHECK_EQ(validator.lastError(), "Error on keyword : minimum");
+        CHECK_FALSE(validator.isValid(parse("{}")));
+        CHECK_EQ(validator.lastError(), "Error on keyword : required");
+    }
+
+    TEST_CASE("Shared schema")
+    {
+        JsonSchemaRegistry::clear();
+        createSchema();
+
+        auto schema = JsonSchemaRegistry::get(SCHEMA_FILE);
+        CHECK(schema);
+        CHECK_EQ(JsonSchemaRegistry::get(SCHEMA_FILE), schema);
+
+        // Schema is not reloaded for the next validators
+        std::remove(SCHEMA_FILE.c_str());
+        JsonValidator validator1;
+        JsonValidator validator2;
+        CHECK(validator1.init(SCHEMA_FILE));
+        CHECK(validator2.init(SCHEMA_FILE));
+        CHECK_EQ(JsonSchemaRegistry::size(), 1u);
+
+        // Schema still in use stay valid after release
+        JsonSchemaRegistry::clear();
+        schema.reset();
+        CHECK(validator1.isValid(parse("{\"value\": 1}")));
+        CHECK_FALSE(validator2.isValid(parse("{\"value\": \"1\"}")));
+    }
+
+    TEST_CASE("Validation from several threads")
+    {
+        JsonSchemaRegistry::clear();
+        createSchema();
+
+        JsonValidator validator;
+        REQUIRE(validator.init(SCHEMA_FILE));
+
+        std::vector<std::thread>  threads;
+        std::atomic<unsigned int> valid_count(0);
+        for (unsigned int i = 0; i < 4u; i++)
+        {
+            threads.emplace_back(
+                [&valid_count, i]
+                {
+                    // One validator per thread, sharing the same schema
+                    JsonValidator thread_validator;
+                    if (thread_validator.init(SCHEMA_FILE))
+                    {
+                        for (int j = 0; j < 1000; j++)
+                        {
+                            std::string json = "{\"value\": " + std::to_string(static_cast<int>(i) - 1) + "}";
+                            if (thread_validator.isValid(parse(json.c_str())))
+                            {
+                                valid_count++;
+                            }
+                        }
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        CHECK_EQ(valid_count, 3000u);
+        CHECK_EQ(JsonSchemaRegistry::size(), 1u);
+    }
+}
@@ -26,8 +26,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <atomic>
 #include <filesystem>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace ocpp::database;
 using namespace ocpp::log;
@@ -76,6 +79,15 @@ TEST_SUITE("Database class test suite")
         CHECK_EQ(count, 10u);
     }
 
+    TEST_CASE("Log database path")
+    {
+        CHECK_EQ(LogDatabase::path("/tmp/ocpp.db", "/tmp/logs.db"), "/tmp/logs.db");
+        CHECK_EQ(LogDatabase::path("/tmp/ocpp.db", ""), "/tmp/ocpp_logs.db");
+        CHECK_EQ(LogDatabase::path("/tmp/ocpp.db", "/tmp/../tmp/ocpp.db"), "/tmp/ocpp_logs.db");
+        CHECK_EQ(LogDatabase::path("ocpp", ""), "ocpp_logs");
+        CHECK_EQ(LogDatabase::path("", ""), "");
+    }
+
     TEST_CASE("Default logger")
     {
         Database db;
@@ -115,6 +127,8 @@ TEST_SUITE("Database class test suite")
         CHECK_EQ(query->getUInt32(2), 4);
         CHECK_EQ(query->getString(4), "This is the last one saved!");
         CHECK_FALSE(query->next());
+
+        Logger::unregisterLoggers(db);
     }
 
     TEST_CASE("Custom logger")
@@ -156,6 +170,143 @@ TEST_SUITE("Database class test suite")
         CHECK_EQ(query->getUInt32(2), 1);
         CHECK_EQ(query->getString(4), "This is the last one saved!");
         CHECK_FALSE(query->next());
+
+        Logger::unregisterLoggers(db);
+    }
+
+    TEST_CASE("Asynchronous mode")
+    {
+        Database db;
+        CHECK(db.open(test_database_path));
+
+        Logger::registerLogger(db, "AsyncLogs", 1000u);
+        CHECK(Logger::startAsyncMode(16u, LogOverflowPolicy::BLOCK));
+        CHECK_FALSE(Logger::startAsyncMode());
+
+        for (unsigned int i = 0; i < 100u; i++)
+        {
+            LOG_INFO2("AsyncLogs") << "Async log " << i;
+        }
+        Logger::flush();
+
+        // No log dropped and order is kept
+        auto query = db.query("SELECT * FROM AsyncLogs ORDER BY id ASC;");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        CHECK(query->hasRows());
+        unsigned int count = 0;
+        do
+        {
+            CHECK_EQ(query->getUInt32(2), 2);
+            CHECK_EQ(query->getString(4), "Async log " + std::to_string(count));
+            count++;
+        } while (query->next());
+        CHECK_EQ(count, 100u);
+        CHECK_EQ(Logger::droppedLogs(), 0u);
+
+        CHECK(Logger::stopAsyncMode());
+        CHECK_FALSE(Logger::stopAsyncMode());
+
+        Logger::unregisterLoggers(db);
+    }
+
+    TEST_CASE("Asynchronous mode - dropped logs")
+    {
+        Database db;
+        CHECK(db.open(test_database_path));
+
+        Logger::registerLogger(db, "DroppedLogs", 1000u);
+        CHECK(Logger::startAsyncMode(2u, LogOverflowPolicy::DROP));
+
+        uint64_t dropped = Logger::droppedLogs();
+        for (unsigned int i = 0; i < 500u; i++)
+        {
+            LOG_COM2("DroppedLogs") << "Dropped log " << i;
+        }
+        CHECK(Logger::stopAsyncMode());
+        dropped = Logger::droppedLogs() - dropped;
+
+        // Each log has been either written or dropped
+        auto query = db.query("SELECT count() FROM DroppedLogs;");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        CHECK(query->hasRows());
+        CHECK_EQ(query->getUInt32(0) + dropped, 500u);
+
+        Logger::unregisterLoggers(db);
+    }
+
+    TEST_CASE("Asynchronous mode - unregistered logger")
+    {
+        {
+            Database db;
+            CHECK(db.open(test_database_path));
+
+            Logger::registerDefaultLogger(db, 1000u);
+            CHECK(Logger::startAsyncMode(4096u, LogOverflowPolicy::BLOCK));
+
+            LOG_INFO << "Stored log";
+            {
+                // Log in progress while its logger is unregistered
+                Logger logger("INFO", 2u, "test_logs.cpp", "0");
+                logger << "Ignored log";
+                Logger::unregisterLoggers(db);
+            }
+            LOG_INFO << "Not stored log";
+            Logger::flush();
+
+            auto query = db.query("SELECT message FROM " DEFAULT_LOG_NAME " WHERE message LIKE '%log';");
+            CHECK_NE(query.get(), nullptr);
+            CHECK(query->exec());
+            CHECK(query->hasRows());
+            CHECK_EQ(query->getString(0), "Stored log");
+            CHECK_FALSE(query->next());
+        }
+
+        // The database doesn't exist anymore
+        LOG_INFO << "Log after the destruction of the database";
+        CHECK(Logger::stopAsyncMode());
+    }
+
+    TEST_CASE("Asynchronous mode - stop while logging")
+    {
+        Database db;
+        CHECK(db.open(test_database_path));
+        auto log_db = std::make_shared<LogDatabase>(db, "StoppedLogs", 10000u);
+
+        AsyncLogger logger;
+        CHECK(logger.start(4096u, LogOverflowPolicy::BLOCK));
+
+        // Producers keep logging while the logger is stopped
+        std::atomic<unsigned int> queued(0);
+        std::vector<std::thread>  producers;
+        for (unsigned int i = 0; i < 4u; i++)
+        {
+            producers.emplace_back(
+                [&]
+                {
+                    for (unsigned int j = 0; j < 500u; j++)
+                    {
+                        if (logger.log(std::time(nullptr), 2u, "INFO", __FILE__, "0", log_db, "Stopped log " + std::to_string(j)))
+                        {
+                            queued++;
+                        }
+                    }
+                });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+        CHECK(logger.stop());
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+
+        // Every record accepted before the stop has been written
+        auto query = db.query("SELECT count() FROM StoppedLogs;");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        CHECK(query->hasRows());
+        CHECK_EQ(query->getUInt32(0) + logger.droppedRecords(), queued.load());
     }
 
     TEST_CASE("Cleanup") { std::filesystem::remove(test_database_path); }
@@ -16,11 +16,14 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include "LockFreeQueue.h"
 #include "Queue.h"
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 using namespace ocpp::helpers;
 
@@ -30,26 +33,28 @@ TEST_SUITE("Queue class test suite - Nominal")
     {
         Queue<size_t, 10> queue;
 
-        CHECK_EQ(queue.size(), 10);
+        CHECK_EQ(queue.capacity(), 10);
+        CHECK_EQ(queue.size(), 0);
         CHECK_EQ(queue.count(), 0);
         CHECK(queue.empty());
         CHECK_FALSE(queue.full());
 
-        for (size_t i = 0; i < queue.size(); i++)
+        for (size_t i = 0; i < queue.capacity(); i++)
         {
             CHECK(queue.push(i));
             CHECK_EQ(queue.count(), (i + 1));
+            CHECK_EQ(queue.size(), (i + 1));
         }
         CHECK_FALSE(queue.push(55u));
         CHECK_FALSE(queue.empty());
         CHECK(queue.full());
 
         size_t val = 0;
-        for (size_t i = 0; i < queue.size(); i++)
+        for (size_t i = 0; i < queue.capacity(); i++)
         {
             CHECK(queue.pop(val, 0));
             CHECK_EQ(val, i);
-            CHECK_EQ(queue.count(), (queue.size() - (i + 1)));
+            CHECK_EQ(queue.count(), (queue.capacity() - (i + 1)));
         }
         CHECK_FALSE(queue.pop(val, 0));
         CHECK(queue.empty());
@@ -103,6 +108,7 @@ TEST_SUITE("Queue class test suite - Nominal")
     {
         Queue<int, 0> queue;
 
+        CHECK_EQ(queue.capacity(), 0);
         CHECK_EQ(queue.size(), 0);
         CHECK_EQ(queue.count(), 0);
         CHECK(queue.empty());
@@ -112,4 +118,164 @@ TEST_SUITE("Queue class test suite - Nominal")
         int val = 0;
         CHECK_FALSE(queue.pop(val, 0));
     }
+
+    TEST_CASE("Batch pop")
+    {
+        Queue<int> queue;
+
+        int vals[4] = {0};
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 0);
+        for (int i = 0; i < 6; i++)
+        {
+            CHECK(queue.push(i));
+        }
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 4u);
+        CHECK_EQ(vals[0], 0);
+        CHECK_EQ(vals[3], 3);
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 2u);
+        CHECK_EQ(vals[0], 4);
+        CHECK_EQ(vals[1], 5);
+        CHECK(queue.empty());
+    }
+}
+
+TEST_SUITE("LockFreeQueue class test suite")
+{
+    TEST_CASE("Standard operations")
+    {
+        SpscQueue<size_t, 16> queue;
+
+        CHECK_EQ(queue.capacity(), 16);
+        CHECK_EQ(queue.size(), 0);
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.full());
+
+        // Several laps in the ring buffer
+        size_t val = 0;
+        for (size_t lap = 0; lap < 3u; lap++)
+        {
+            for (size_t i = 0; i < queue.capacity(); i++)
+            {
+                CHECK(queue.push(lap * 100u + i));
+                CHECK_EQ(queue.count(), (i + 1));
+            }
+            CHECK_FALSE(queue.push(55u));
+            CHECK(queue.full());
+
+            for (size_t i = 0; i < queue.capacity(); i++)
+            {
+                CHECK(queue.pop(val, 0));
+                CHECK_EQ(val, lap * 100u + i);
+            }
+            CHECK_FALSE(queue.pop(val, 0));
+            CHECK(queue.empty());
+        }
+
+        CHECK(queue.push(45u));
+        CHECK(queue.push(890u));
+        CHECK_EQ(queue.size(), 2u);
+        queue.clear();
+        CHECK(queue.empty());
+    }
+
+    TEST_CASE("Batch pop")
+    {
+        MpscQueue<int, 8> queue;
+
+        int vals[4] = {0};
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 0);
+        for (int i = 0; i < 6; i++)
+        {
+            CHECK(queue.push(i));
+        }
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 4u);
+        CHECK_EQ(vals[0], 0);
+        CHECK_EQ(vals[3], 3);
+        CHECK_EQ(queue.popBatch(vals, 4u, 0), 2u);
+        CHECK_EQ(vals[0], 4);
+        CHECK_EQ(vals[1], 5);
+        CHECK(queue.empty());
+    }
+
+    TEST_CASE("Timeout management")
+    {
+        MpscQueue<int, 4> queue(100u);
+
+        int val = 0;
+        CHECK_FALSE(queue.pop(val, 200u));
+
+        std::thread push_thread(
+            [&queue]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                queue.push(12345);
+            });
+
+        CHECK(queue.pop(val, 2000u));
+        CHECK_EQ(val, 12345);
+        push_thread.join();
+
+        std::thread cancel_thread(
+            [&queue]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                queue.setEnable(false);
+            });
+        CHECK_FALSE(queue.pop(val));
+        cancel_thread.join();
+
+        queue.setEnable(true);
+        queue.push(12345);
+        CHECK(queue.pop(val));
+        CHECK_EQ(val, 12345);
+    }
+
+    TEST_CASE("Multiple producers")
+    {
+        static constexpr size_t PRODUCERS_COUNT = 4u;
+        static constexpr size_t ITEMS_COUNT     = 20000u;
+
+        MpscQueue<size_t, 64> queue(50u);
+
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < PRODUCERS_COUNT; p++)
+        {
+            producers.emplace_back(
+                [&queue, p]
+                {
+                    for (size_t i = 0; i < ITEMS_COUNT; i++)
+                    {
+                        while (!queue.push(p * ITEMS_COUNT + i))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        // Items of each producer must be received in order
+        std::vector<size_t> next(PRODUCERS_COUNT, 0);
+        bool                ordered  = true;
+        size_t              received = 0;
+        size_t              vals[16];
+        while (received != (PRODUCERS_COUNT * ITEMS_COUNT))
+        {
+            size_t count = queue.popBatch(vals, 16u, 2000u);
+            REQUIRE_NE(count, 0);
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t producer = vals[i] / ITEMS_COUNT;
+                ordered         = ordered && ((vals[i] % ITEMS_COUNT) == next[producer]);
+                next[producer]++;
+            }
+            received += count;
+        }
+        CHECK(ordered);
+        CHECK(queue.empty());
+
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+    }
 }
@@ -18,10 +18,15 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Timer.h"
 #include "TimerPool.h"
+#include "WorkerThreadPool.h"
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 using namespace ocpp::helpers;
 
@@ -185,4 +190,174 @@ TEST_SUITE("Timers class test suite")
         CHECK_EQ(calls2, 2u);
         CHECK_EQ(calls3, 6u);
     }
+
+    TEST_CASE("Standard operations - ordering of many timers")
+    {
+        TimerPool                           pool;
+        std::vector<std::unique_ptr<Timer>> timers;
+        std::mutex                          fired_mutex;
+        std::vector<size_t>                 fired;
+        for (size_t i = 0; i < 50u; i++)
+        {
+            std::string name = "timer" + std::to_string(i);
+            timers.emplace_back(pool.createTimer(name.c_str()));
+            timers.back()->setCallback(
+                [i, &fired_mutex, &fired]
+                {
+                    std::lock_guard<std::mutex> lock(fired_mutex);
+                    fired.push_back(i);
+                });
+        }
+
+        // Start in a shuffled order : timer i elapses after 20 + 8 * i ms
+        for (size_t i = 0; i < 50u; i++)
+        {
+            size_t index = (i * 17u) % 50u;
+            CHECK(timers[index]->start(std::chrono::milliseconds(20u + 8u * index), true));
+        }
+
+        // Stop and restart some timers
+        CHECK(timers[10]->stop());
+        CHECK(timers[0]->stop());
+        CHECK(timers[49]->stop());
+        CHECK(timers[25]->restart(std::chrono::milliseconds(20u + 8u * 25u), true));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(600u));
+
+        std::lock_guard<std::mutex> lock(fired_mutex);
+        CHECK_EQ(fired.size(), 47u);
+        for (size_t i = 1; i < fired.size(); i++)
+        {
+            CHECK_LT(fired[i - 1u], fired[i]);
+        }
+        for (size_t i = 0; i < 50u; i++)
+        {
+            CHECK_FALSE(timers[i]->isStarted());
+        }
+
+        // Lookup by name
+        CHECK_EQ(pool.getTimer("timer42"), timers[42].get());
+        CHECK_EQ(pool.getTimer("unknown"), nullptr);
+        timers[42].reset();
+        CHECK_EQ(pool.getTimer("timer42"), nullptr);
+    }
+
+    TEST_CASE("Executor - slow callbacks")
+    {
+        std::shared_ptr<WorkerThreadPool> executor = std::make_shared<WorkerThreadPool>(2u);
+        TimerPool                         pool(executor);
+        std::unique_ptr<Timer>            slow_timer(pool.createTimer());
+        std::unique_ptr<Timer>            fast_timer(pool.createTimer());
+        std::atomic<unsigned int>         slow_calls(0);
+        std::atomic<unsigned int>         fast_calls(0);
+        slow_timer->setCallback(
+            [&slow_calls]
+            {
+                slow_calls++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(300u));
+            });
+        fast_timer->setCallback([&fast_calls] { fast_calls++; });
+
+        // The slow callback delays neither the other timers nor the timer operations
+        auto start = std::chrono::steady_clock::now();
+        CHECK(slow_timer->start(std::chrono::milliseconds(50u), true));
+        CHECK(fast_timer->start(std::chrono::milliseconds(100u), true));
+        std::this_thread::sleep_for(std::chrono::milliseconds(150u));
+        CHECK_EQ(slow_calls, 1u);
+        CHECK_EQ(fast_calls, 1u);
+        CHECK(fast_timer->start(std::chrono::milliseconds(10u), true));
+        CHECK(fast_timer->stop());
+        CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(250u));
+
+        // Expirations of a periodic timer while its callback is running are coalesced
+        std::this_thread::sleep_for(std::chrono::milliseconds(250u));
+        pool.resetStats();
+        CHECK(slow_timer->start(std::chrono::milliseconds(50u)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(475u));
+        CHECK(slow_timer->stop());
+        CHECK_EQ(slow_calls, 3u);
+        TimerPoolStats stats = pool.stats();
+        CHECK_EQ(stats.fired, 2u);
+        CHECK_GE(stats.coalesced, 5u);
+
+        // A stopped timer is not called even if its expiry was pending
+        std::this_thread::sleep_for(std::chrono::milliseconds(400u));
+        CHECK_EQ(slow_calls, 3u);
+    }
+
+    TEST_CASE("Coalescing window and lateness statistics")
+    {
+        TimerPool              pool(nullptr, std::chrono::milliseconds(100u));
+        std::unique_ptr<Timer> timer1(pool.createTimer());
+        std::unique_ptr<Timer> timer2(pool.createTimer());
+        std::unique_ptr<Timer> timer3(pool.createTimer());
+        std::atomic<unsigned int> calls(0);
+        auto                      callback = [&calls] { calls++; };
+        timer1->setCallback(callback);
+        timer2->setCallback(callback);
+        timer3->setCallback(callback);
+
+        // Timers 1 and 2 expire within the coalescing window : timer 1 is delayed to the expiry of timer 2
+        CHECK(timer1->start(std::chrono::milliseconds(100u), true));
+        CHECK(timer2->start(std::chrono::milliseconds(150u), true));
+        CHECK(timer3->start(std::chrono::milliseconds(300u), true));
+        std::this_thread::sleep_for(std::chrono::milliseconds(125u));
+        CHECK_EQ(calls, 0u);
+        std::this_thread::sleep_for(std::chrono::milliseconds(60u));
+        CHECK_EQ(calls, 2u);
+        std::this_thread::sleep_for(std::chrono::milliseconds(165u));
+        CHECK_EQ(calls, 3u);
+
+        TimerPoolStats stats = pool.stats();
+        CHECK_EQ(stats.fired, 3u);
+        CHECK_EQ(stats.coalesced, 0u);
+        CHECK_GE(stats.max_lateness, std::chrono::milliseconds(50u));
+        CHECK_LT(stats.max_lateness, std::chrono::milliseconds(100u));
+        CHECK_LE(stats.mean_lateness, stats.max_lateness);
+
+        pool.resetStats();
+        stats = pool.stats();
+        CHECK_EQ(stats.fired, 0u);
+        CHECK_EQ(stats.max_lateness.count(), 0);
+    }
+
+    TEST_CASE("Coalescing window - no early expiry")
+    {
+        static constexpr size_t             TIMERS_COUNT = 50u;
+        static constexpr unsigned int       WINDOW_MS    = 40u;
+        TimerPool                           pool(nullptr, std::chrono::milliseconds(WINDOW_MS));
+        std::vector<std::unique_ptr<Timer>> timers;
+        std::atomic<unsigned int>           early(0);
+        std::atomic<unsigned int>           late(0);
+        std::atomic<unsigned int>           calls(0);
+
+        // Timers expiring at close but different time points are coalesced, none of them elapses before its expiry
+        // and none of them is delayed more than the coalescing window
+        for (size_t i = 0; i < TIMERS_COUNT; i++)
+        {
+            std::chrono::milliseconds interval(10u + (i * 7u) % 200u);
+            auto                      expiry = std::chrono::steady_clock::now() + interval;
+            timers.emplace_back(pool.createTimer());
+            timers.back()->setCallback(
+                [&early, &late, &calls, expiry]
+                {
+                    auto now = std::chrono::steady_clock::now();
+                    if (now < expiry)
+                    {
+                        early++;
+                    }
+                    if (now > (expiry + std::chrono::milliseconds(WINDOW_MS + 30u)))
+                    {
+                        late++;
+                    }
+                    calls++;
+                });
+            CHECK(timers.back()->start(interval, true));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(400u));
+
+        CHECK_EQ(calls, TIMERS_COUNT);
+        CHECK_EQ(early, 0u);
+        CHECK_EQ(late, 0u);
+    }
 }
@@ -20,6 +20,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <array>
+#include <atomic>
+#include <iostream>
+
 using namespace ocpp::helpers;
 
 TEST_SUITE("WorkerThreadPool class test suite")
@@ -158,4 +162,148 @@ TEST_SUITE("WorkerThreadPool class test suite")
         CHECK_EQ(waiter7.value(), "Pouf");
         CHECK_FALSE(waiter8.success());
     }
+
+    TEST_CASE("Fire and forget jobs")
+    {
+        WorkerThreadPool worker_thread_pool(3);
+        CHECK_EQ(worker_thread_pool.threadCount(), 3u);
+
+        std::mutex              jobs_done_mutex;
+        std::condition_variable jobs_done_var;
+        unsigned int            jobs_done = 0;
+        auto                    job       = [&jobs_done, &jobs_done_mutex, &jobs_done_var]
+        {
+            std::lock_guard<std::mutex> lock(jobs_done_mutex);
+            jobs_done++;
+            jobs_done_var.notify_all();
+        };
+
+        CHECK(worker_thread_pool.post(job));
+        CHECK(worker_thread_pool.post(job));
+        CHECK(worker_thread_pool.post([] { throw std::exception(); }));
+        CHECK(worker_thread_pool.post(job));
+
+        std::unique_lock<std::mutex> lock(jobs_done_mutex);
+        CHECK(jobs_done_var.wait_for(lock, std::chrono::milliseconds(1000u), [&jobs_done] { return (jobs_done == 3u); }));
+
+        // No threads
+        WorkerThreadPool no_thread_pool(0);
+        CHECK_EQ(no_thread_pool.threadCount(), 0u);
+        CHECK_FALSE(no_thread_pool.post(job));
+    }
+
+    TEST_CASE("Rejected jobs")
+    {
+        // The jobs which can't be queued end immediately without success
+        WorkerThreadPool no_thread_pool(0);
+        bool             executed = false;
+
+        Waiter<void> waiter1 = no_thread_pool.run<void>([&executed] { executed = true; });
+        CHECK(waiter1.wait(std::chrono::milliseconds(0)));
+        CHECK_FALSE(waiter1.success());
+
+        Waiter<int> waiter2 = no_thread_pool.run<int>(
+            [&executed]
+            {
+                executed = true;
+                return 12;
+            });
+        CHECK(waiter2.wait(std::chrono::milliseconds(0)));
+        CHECK_FALSE(waiter2.success());
+        CHECK_EQ(waiter2.value(), 0);
+
+        CHECK_FALSE(executed);
+    }
+
+    TEST_CASE("Thread count")
+    {
+        CHECK_EQ(WorkerThreadPool::computeThreadCount(1u), WorkerThreadPool::MIN_THREAD_COUNT);
+        CHECK_EQ(WorkerThreadPool::computeThreadCount(5u), 5u);
+        CHECK_GE(WorkerThreadPool::computeThreadCount(0u), WorkerThreadPool::MIN_THREAD_COUNT);
+        CHECK_GE(WorkerThreadPool::computeThreadCount(0u), std::thread::hardware_concurrency());
+    }
+
+    TEST_CASE("Small buffer job storage")
+    {
+        unsigned int value = 0;
+
+        Task small_task([&value] { value++; });
+        CHECK(small_task);
+        CHECK(small_task.isInline());
+
+        std::array<uint8_t, Task::INLINE_SIZE + 1u> big_capture = {};
+        Task                                        big_task([&value, big_capture] { value += big_capture.size(); });
+        CHECK(big_task);
+        CHECK_FALSE(big_task.isInline());
+
+        Task moved_task(std::move(small_task));
+        CHECK_FALSE(small_task);
+        moved_task();
+        CHECK_EQ(value, 1u);
+
+        moved_task = std::move(big_task);
+        CHECK_FALSE(big_task);
+        CHECK_FALSE(moved_task.isInline());
+        moved_task();
+        CHECK_EQ(value, 2u + Task::INLINE_SIZE);
+
+        moved_task = nullptr;
+        CHECK_FALSE(moved_task);
+    }
+
+    /** @brief Measure the number of jobs per second executed by a pool */
+    template <typename PostFunction>
+    static void measureThroughput(const char* name, size_t producers, size_t jobs_per_producer, PostFunction post)
+    {
+        WorkerThreadPool    worker_thread_pool(4);
+        std::atomic<size_t> jobs_done(0);
+        size_t              total_jobs = producers * jobs_per_producer;
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < producers; i++)
+        {
+            threads.emplace_back(
+                [&worker_thread_pool, &jobs_done, &post, jobs_per_producer]
+                {
+                    for (size_t j = 0; j < jobs_per_producer; j++)
+                    {
+                        post(worker_thread_pool, jobs_done);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        while (jobs_done != total_jobs)
+        {
+            std::this_thread::yield();
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << name << " : " << total_jobs << " jobs from " << producers << " thread(s) in " << duration.count() << "us => "
+                  << static_cast<uint64_t>(static_cast<double>(total_jobs) * 1000000. / static_cast<double>(duration.count() + 1))
+                  << " jobs/s" << std::endl;
+        CHECK_EQ(jobs_done, total_jobs);
+    }
+
+    TEST_CASE("Throughput benchmarks")
+    {
+        static constexpr size_t JOBS_COUNT = 100000u;
+
+        auto run_job  = [](WorkerThreadPool& pool, std::atomic<size_t>& jobs_done) { pool.run<void>([&jobs_done] { jobs_done++; }); };
+        auto post_job = [](WorkerThreadPool& pool, std::atomic<size_t>& jobs_done) { pool.post([&jobs_done] { jobs_done++; }); };
+        auto nested_post_job = [](WorkerThreadPool& pool, std::atomic<size_t>& jobs_done)
+        {
+            // Jobs posted from the worker threads are queued on their own queue
+            pool.post([&pool, &jobs_done] { pool.post([&jobs_done] { jobs_done++; }); });
+        };
+
+        measureThroughput("run<void>()", 1u, JOBS_COUNT, run_job);
+        measureThroughput("post()", 1u, JOBS_COUNT, post_job);
+        measureThroughput("run<void>() x4", 4u, JOBS_COUNT / 4u, run_job);
+        measureThroughput("post() x4", 4u, JOBS_COUNT / 4u, post_job);
+        measureThroughput("post() from workers", 1u, JOBS_COUNT, nested_post_job);
+    }
 }
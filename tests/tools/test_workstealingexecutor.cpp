@@ -0,0 +1,178 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "WorkStealingExecutor.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace ocpp::helpers;
+
+TEST_SUITE("WorkStealingExecutor class test suite")
+{
+    TEST_CASE("Thread management")
+    {
+        WorkStealingExecutor default_executor;
+        CHECK_GE(default_executor.threadCount(), 1u);
+
+        WorkStealingExecutor executor(3);
+        CHECK_EQ(executor.threadCount(), 3u);
+    }
+
+    TEST_CASE("Tasks execution")
+    {
+        WorkStealingExecutor executor(3);
+
+        std::mutex              tasks_done_mutex;
+        std::condition_variable tasks_done_var;
+        unsigned int            tasks_done = 0;
+        for (unsigned int i = 0; i < 100u; i++)
+        {
+            CHECK(executor.post(
+                [&]
+                {
+                    std::lock_guard<std::mutex> lock(tasks_done_mutex);
+                    tasks_done++;
+                    tasks_done_var.notify_all();
+                }));
+        }
+        CHECK(executor.post([] { throw std::exception(); }));
+
+        std::unique_lock<std::mutex> lock(tasks_done_mutex);
+        CHECK(tasks_done_var.wait_for(lock, std::chrono::milliseconds(1000u), [&tasks_done] { return (tasks_done == 100u); }));
+    }
+
+    TEST_CASE("Exceptions in tasks")
+    {
+        WorkStealingExecutor executor(1);
+
+        // The thread keeps executing the tasks after an exception
+        std::atomic<unsigned int> tasks_done = 0;
+        CHECK(executor.post([] { throw std::runtime_error("task error"); }));
+        CHECK(executor.post([] { throw 0; }));
+        CHECK(executor.post([&] { tasks_done++; }));
+        for (unsigned int i = 0; (i < 1000u) && (tasks_done == 0); i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+        }
+        CHECK_EQ(tasks_done, 1u);
+    }
+
+    TEST_CASE("Work stealing")
+    {
+        WorkStealingExecutor executor(2);
+
+        std::mutex              tasks_done_mutex;
+        std::condition_variable tasks_done_var;
+        unsigned int            tasks_done = 0;
+        std::atomic<bool>       stolen     = false;
+        std::atomic<bool>       result     = false;
+        std::atomic<bool>       end        = false;
+
+        // Tasks posted from an executor thread are queued on this thread, which stays busy
+        // until they have been executed : they can only be executed by stealing them
+        executor.post(
+            [&]
+            {
+                std::thread::id owner = std::this_thread::get_id();
+                for (unsigned int i = 0; i < 10u; i++)
+                {
+                    executor.post(
+                        [&, owner]
+                        {
+                            std::lock_guard<std::mutex> lock(tasks_done_mutex);
+                            stolen = (std::this_thread::get_id() != owner);
+                            tasks_done++;
+                            tasks_done_var.notify_all();
+                        });
+                }
+
+                std::unique_lock<std::mutex> lock(tasks_done_mutex);
+                result = tasks_done_var.wait_for(lock, std::chrono::milliseconds(1000u), [&tasks_done] { return (tasks_done == 10u); });
+                end    = true;
+            });
+
+        while (!end)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10u));
+        }
+        CHECK(result);
+        CHECK(stolen);
+    }
+
+    TEST_CASE("Pending tasks executed on destruction")
+    {
+        std::atomic<unsigned int> tasks_done = 0;
+        {
+            WorkStealingExecutor executor(1);
+            std::atomic<bool>    release = false;
+            CHECK(executor.post(
+                [&]
+                {
+                    while (!release)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+                    }
+                }));
+            for (unsigned int i = 0; i < 10u; i++)
+            {
+                CHECK(executor.post([&] { tasks_done++; }));
+            }
+            release = true;
+        }
+        CHECK_EQ(tasks_done, 10u);
+    }
+
+    TEST_CASE("Maximum number of pending tasks")
+    {
+        WorkStealingExecutor executor(1, 2);
+        CHECK_EQ(executor.maxPendingTasks(), 2u);
+
+        // Keep the thread busy so that the next tasks stay pending
+        std::atomic<bool> started = false;
+        std::atomic<bool> release = false;
+        CHECK(executor.post(
+            [&]
+            {
+                started = true;
+                while (!release)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+                }
+            }));
+        while (!started)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+        }
+
+        std::atomic<unsigned int> tasks_done = 0;
+        CHECK(executor.post([&] { tasks_done++; }));
+        CHECK(executor.post([&] { tasks_done++; }));
+        CHECK_FALSE(executor.post([&] { tasks_done++; }));
+
+        // Room is made once the pending tasks have been executed
+        release = true;
+        while (tasks_done != 2u)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1u));
+        }
+        CHECK(executor.post([&] { tasks_done++; }));
+    }
+}
@@ -0,0 +1,117 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+#include "DateTime.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using namespace ocpp::types;
+
+/*
+ * Micro-benchmark of the DateTime string conversions
+ *
+ * The stream based implementation which was used before the RFC 3339 parser and formatter
+ * is compared with the current one. The number of dynamic allocations per conversion
+ * is measured by replacing the global allocation operators.
+ *
+ * Usage : bench_datetime [iterations=100000]
+ */
+
+/** @brief Stream based parsing (previous implementation) */
+static bool streamAssign(const std::string& value, std::time_t& datetime)
+{
+    bool               ret = false;
+    std::istringstream ss(value);
+    std::tm            t = {};
+    ss >> std::get_time(&t, "%Y-%m-%dT%TZ");
+    if (ss.fail())
+    {
+        ss.clear();
+        ss.str(value);
+        ss >> std::get_time(&t, "%Y-%m-%dT%T");
+    }
+    if (!ss.fail())
+    {
+        datetime = std::mktime(&t);
+        datetime += t.tm_gmtoff;
+        datetime -= (t.tm_isdst * 3600);
+        ret = true;
+    }
+    return ret;
+}
+
+/** @brief Stream based formatting (previous implementation) */
+static std::string streamStr(std::time_t datetime)
+{
+    std::ostringstream ss;
+    std::tm            t = {};
+    gmtime_r(&datetime, &t);
+    ss << std::put_time(&t, "%Y-%m-%dT%TZ");
+    return ss.str();
+}
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 100000u;
+
+    const std::string       value        = "2021-06-01T10:12:35Z";
+    const std::string       value_ms     = "2021-06-01T10:12:35.123+02:00";
+    volatile std::time_t    sink         = 0;
+    volatile size_t         sink_size    = 0;
+    const std::time_t       base         = 1622542355;
+    char                    buffer[DateTime::STRING_BUFFER_SIZE];
+
+    report("parse (streams)",
+           measure(iterations,
+                   [&](size_t)
+                   {
+                       std::time_t datetime = 0;
+                       streamAssign(value, datetime);
+                       sink = datetime;
+                   }));
+    report("parse (RFC 3339)",
+           measure(iterations,
+                   [&](size_t)
+                   {
+                       DateTime datetime;
+                       datetime.assign(value.c_str(), value.size());
+                       sink = datetime.timestamp();
+                   }));
+    report("parse with fraction and offset (RFC 3339)",
+           measure(iterations,
+                   [&](size_t)
+                   {
+                       DateTime datetime;
+                       datetime.assign(value_ms.c_str(), value_ms.size());
+                       sink = datetime.timestamp();
+                   }));
+    report("format (streams)", measure(iterations, [&](size_t i) { sink_size = streamStr(base + static_cast<std::time_t>(i)).size(); }));
+    report("format to std::string (RFC 3339)",
+           measure(iterations, [&](size_t i) { sink_size = DateTime(base + static_cast<std::time_t>(i)).str().size(); }));
+    report("format to buffer (RFC 3339)",
+           measure(iterations,
+                   [&](size_t i) { sink_size = DateTime(base + static_cast<std::time_t>(i), 123u).format(buffer, sizeof(buffer)); }));
+
+    (void)sink;
+    (void)sink_size;
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+#include "Enums.h"
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace ocpp::types;
+
+/*
+ * Micro-benchmark of the enum string conversions
+ *
+ * The std::map based implementation which was used before the constant hash tables
+ * is compared with the current one on the Measurand enum (the biggest one).
+ * The number of dynamic allocations per conversion is measured by replacing the
+ * global allocation operators.
+ *
+ * Usage : bench_enumtostringfromstring [iterations=1000000]
+ */
+
+/** @brief std::map based conversions (previous implementation) */
+template <typename EnumType>
+class MapEnumToStringFromString
+{
+  public:
+    /** @brief Constructor */
+    MapEnumToStringFromString(const EnumToStringFromString<EnumType>& helper)
+    {
+        for (size_t i = 0; i < EnumToStringFromString<EnumType>::MAX_VALUES; i++)
+        {
+            std::string str = helper.toString(static_cast<EnumType>(i));
+            if (!str.empty())
+            {
+                m_enum_to_string[static_cast<EnumType>(i)] = str;
+                m_string_to_enum[str]                      = static_cast<EnumType>(i);
+            }
+        }
+    }
+    /** @brief Get the string representation of the enum value */
+    std::string toString(EnumType value) const
+    {
+        std::string ret;
+        auto        it = m_enum_to_string.find(value);
+        if (it != m_enum_to_string.end())
+        {
+            ret = it->second;
+        }
+        return ret;
+    }
+    /** @brief Get the value represented by a string */
+    bool fromString(const std::string& str, EnumType& val) const
+    {
+        bool ret = false;
+        auto it  = m_string_to_enum.find(str);
+        if (it != m_string_to_enum.end())
+        {
+            val = it->second;
+            ret = true;
+        }
+        return ret;
+    }
+
+  private:
+    /** @brief Map for enum to string conversion */
+    std::map<EnumType, std::string> m_enum_to_string;
+    /** @brief Map for string to enum conversion */
+    std::map<std::string, EnumType> m_string_to_enum;
+};
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 1000000u;
+
+    // Strings to convert, received as non null terminated strings in the JSON payloads
+    std::vector<Measurand>   values;
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < EnumToStringFromString<Measurand>::MAX_VALUES; i++)
+    {
+        std::string str = MeasurandHelper.toString(static_cast<Measurand>(i));
+        if (!str.empty())
+        {
+            values.push_back(static_cast<Measurand>(i));
+            strings.push_back(str);
+        }
+    }
+    MapEnumToStringFromString<Measurand> map_helper(MeasurandHelper);
+    volatile size_t                      sink = 0;
+
+    report("toString (std::map)", measure(iterations, [&](size_t i) { sink = map_helper.toString(values[i % values.size()]).size(); }));
+    report("toString (table)", measure(iterations, [&](size_t i) { sink = MeasurandHelper.toString(values[i % values.size()])[0]; }));
+    report("fromString (std::map)",
+           measure(iterations,
+                   [&](size_t i)
+                   {
+                       const std::string& str   = strings[i % strings.size()];
+                       Measurand          value = Measurand::Current;
+                       map_helper.fromString(std::string(str.c_str(), str.size()), value);
+                       sink = static_cast<size_t>(value);
+                   }));
+    report("fromString (hash table)",
+           measure(iterations,
+                   [&](size_t i)
+                   {
+                       const std::string& str   = strings[i % strings.size()];
+                       Measurand          value = Measurand::Current;
+                       MeasurandHelper.fromString(std::string_view(str.c_str(), str.size()), value);
+                       sink = static_cast<size_t>(value);
+                   }));
+
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Authorize.h"
+#include "BootNotification.h"
+#include "CiStringType.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <type_traits>
+
+using namespace ocpp::messages;
+using namespace ocpp::types;
+
+// Compile time checks
+static_assert(CiStringType<20u>::max() == 20u);
+static_assert(CiStringType<20u>("IdTag").size() == 5u);
+static_assert(std::is_trivially_copyable<CiStringType<500u>>::value);
+static_assert(std::is_trivially_copyable<Optional<CiStringType<500u>>>::value);
+static_assert(std::is_trivially_copyable<IdTagInfo>::value);
+static_assert(std::is_trivially_copyable<AuthorizeReq>::value);
+static_assert(std::is_trivially_copyable<AuthorizeConf>::value);
+static_assert(std::is_trivially_copyable<BootNotificationReq>::value);
+static_assert(sizeof(CiStringType<20u>) <= 24u);
+
+/** @brief Assign a value through the type-erased view */
+static bool assignView(CiStringView view, const std::string& value)
+{
+    return view.assign(value);
+}
+
+TEST_SUITE("CiStringType class test suite")
+{
+    TEST_CASE("Assignment")
+    {
+        CiStringType<10u> str;
+        CHECK(str.empty());
+        CHECK_EQ(str.size(), 0);
+        CHECK_EQ(str.c_str()[0], 0);
+
+        CHECK(str.assign("Hello"));
+        CHECK_FALSE(str.empty());
+        CHECK_EQ(str.size(), 5u);
+        CHECK_EQ(str.str(), "Hello");
+        CHECK(str == "Hello");
+
+        // Exact size limit
+        CHECK(str.assign(std::string("0123456789")));
+        CHECK_EQ(str.size(), 10u);
+        CHECK_EQ(str.str(), "0123456789");
+
+        // Truncation
+        CHECK_FALSE(str.assign("0123456789A"));
+        CHECK_EQ(str.size(), 10u);
+        CHECK_EQ(std::string(str.c_str()), "0123456789");
+
+        // Non null terminated value
+        CHECK(str.assign("HelloWorld!", 5u));
+        CHECK_EQ(str.str(), "Hello");
+
+        // Literal
+        str = "World";
+        CHECK_EQ(str.str(), "World");
+
+        CHECK(str.assign(""));
+        CHECK(str.empty());
+    }
+
+    TEST_CASE("Comparison")
+    {
+        CiStringType<10u> str("ABCD");
+        CiStringType<20u> other("ABCD");
+        std::string       value = str;
+
+        CHECK(str == other);
+        CHECK(str == value);
+        CHECK(str == "ABCD");
+        CHECK_FALSE(str != other);
+        CHECK_FALSE(str != value);
+        CHECK_FALSE(str != "ABCD");
+
+        other.assign("ABC");
+        value = "ABCDE";
+        CHECK(str != other);
+        CHECK(str != value);
+        CHECK(str != "ABC");
+    }
+
+    TEST_CASE("View")
+    {
+        CiStringType<5u> str;
+        CiStringView     view(str);
+        CHECK_EQ(view.max(), 5u);
+        CHECK(view.empty());
+
+        CHECK(assignView(str, "12345"));
+        CHECK_EQ(str.str(), "12345");
+        CHECK_EQ(view.size(), 5u);
+        CHECK_EQ(view.str(), "12345");
+
+        CHECK_FALSE(assignView(str, "123456"));
+        CHECK_EQ(str.str(), "12345");
+
+        Optional<CiStringType<5u>> opt;
+        CHECK(assignView(opt.value(), "abc"));
+        CHECK(opt.isSet());
+        CHECK_EQ(opt.value().str(), "abc");
+
+        // Copies do not share their storage
+        CiStringType<5u> copy = str;
+        CHECK(str.assign("xyz"));
+        CHECK_EQ(copy.str(), "12345");
+    }
+}
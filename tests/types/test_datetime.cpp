@@ -0,0 +1,162 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DateTime.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace ocpp::types;
+
+/** @brief Parse a string representation */
+static DateTime parse(const char* value)
+{
+    DateTime date_time;
+    CAPTURE(value);
+    CHECK(date_time.assign(value));
+    return date_time;
+}
+
+TEST_SUITE("DateTime class test suite")
+{
+    TEST_CASE("Parsing")
+    {
+        // UTC
+        DateTime date_time = parse("2021-06-01T10:12:35Z");
+        CHECK_EQ(date_time.timestamp(), 1622542355);
+        CHECK_EQ(date_time.millisecond(), 0);
+        CHECK_EQ(parse("2021-06-01t10:12:35z").timestamp(), 1622542355);
+        CHECK_EQ(parse("2021-06-01 10:12:35Z").timestamp(), 1622542355);
+
+        // No offset = UTC
+        CHECK_EQ(parse("2021-06-01T10:12:35").timestamp(), 1622542355);
+
+        // Fractional seconds
+        date_time = parse("2021-06-01T10:12:35.123Z");
+        CHECK_EQ(date_time.timestamp(), 1622542355);
+        CHECK_EQ(date_time.millisecond(), 123);
+        CHECK_EQ(parse("2021-06-01T10:12:35.5Z").millisecond(), 500);
+        CHECK_EQ(parse("2021-06-01T10:12:35.000Z").millisecond(), 0);
+        CHECK_EQ(parse("2021-06-01T10:12:35.987654321Z").millisecond(), 987);
+
+        // Offsets
+        CHECK_EQ(parse("2021-06-01T12:12:35+02:00").timestamp(), 1622542355);
+        CHECK_EQ(parse("2021-06-01T05:42:35.250-04:30").timestamp(), 1622542355);
+        CHECK_EQ(parse("2021-06-01T05:42:35.250-04:30").millisecond(), 250);
+        CHECK_EQ(parse("2021-06-01T00:00:00+00:00").timestamp(), 1622505600);
+
+        // Calendar limits
+        CHECK_EQ(parse("1970-01-01T00:00:00Z").timestamp(), 0);
+        CHECK_EQ(parse("2000-02-29T23:59:59Z").timestamp(), 951868799);
+        CHECK_EQ(parse("2024-12-31T23:59:59Z").timestamp(), 1735689599);
+        CHECK_EQ(parse("1969-12-31T23:59:59Z").timestamp(), -1);
+        CHECK_EQ(parse("2016-12-31T23:59:60Z").timestamp(), 1483228800);
+    }
+
+    TEST_CASE("Invalid strings")
+    {
+        const char* invalid[] = {"",
+                                 "2021",
+                                 "2021-06-01",
+                                 "2021-06-01T10:12",
+                                 "21-06-01T10:12:35Z",
+                                 "2021-6-01T10:12:35Z",
+                                 "2021/06/01T10:12:35Z",
+                                 "2021-06-01X10:12:35Z",
+                                 "2021-13-01T10:12:35Z",
+                                 "2021-00-01T10:12:35Z",
+                                 "2021-02-29T10:12:35Z",
+                                 "2021-06-31T10:12:35Z",
+                                 "2021-06-01T24:12:35Z",
+                                 "2021-06-01T10:60:35Z",
+                                 "2021-06-01T10:12:61Z",
+                                 "2021-06-01T10:12:35.Z",
+                                 "2021-06-01T10:12:35ZZ",
+                                 "2021-06-01T10:12:35+02",
+                                 "2021-06-01T10:12:35+0200",
+                                 "2021-06-01T10:12:35+24:00",
+                                 "2021-06-01T10:12:35 UTC",
+                                 "not a date"};
+
+        DateTime date_time(1622542355, 456u);
+        for (const char* value : invalid)
+        {
+            CAPTURE(value);
+            CHECK_FALSE(date_time.assign(value));
+            CHECK_EQ(date_time.timestamp(), 1622542355);
+            CHECK_EQ(date_time.millisecond(), 456);
+        }
+
+        // The size is taken into account
+        CHECK_FALSE(date_time.assign("2021-06-01T10:12:35Z", 10u));
+        CHECK(date_time.assign("2021-06-01T10:12:35Z-garbage", 20u));
+        CHECK_EQ(date_time.timestamp(), 1622542355);
+    }
+
+    TEST_CASE("Formatting")
+    {
+        CHECK_EQ(DateTime(1622542355).str(), "2021-06-01T10:12:35Z");
+        CHECK_EQ(DateTime(1622542355, 7u).str(), "2021-06-01T10:12:35.007Z");
+        CHECK_EQ(DateTime(0).str(), "1970-01-01T00:00:00Z");
+        CHECK_EQ(DateTime(-1).str(), "1969-12-31T23:59:59Z");
+        CHECK_EQ(DateTime(951868799).str(), "2000-02-29T23:59:59Z");
+        CHECK_EQ(DateTime(253402300799).str(), "9999-12-31T23:59:59Z");
+        CHECK_EQ(DateTime(253402300800).str(), "");
+
+        // Caller buffer
+        char buffer[DateTime::STRING_BUFFER_SIZE];
+        CHECK_EQ(DateTime(1622542355, 999u).format(buffer, sizeof(buffer)), 24u);
+        CHECK_EQ(std::string(buffer), "2021-06-01T10:12:35.999Z");
+        CHECK_EQ(DateTime(1622542355, 999u).format(buffer, 24u), 0u);
+        CHECK_EQ(DateTime(1622542355).format(buffer, 21u), 20u);
+        CHECK_EQ(std::string(buffer), "2021-06-01T10:12:35Z");
+        CHECK_EQ(DateTime(1622542355).format(buffer, 20u), 0u);
+    }
+
+    TEST_CASE("Round trip")
+    {
+        const std::time_t day = 86400;
+        for (std::time_t timestamp = -day * 366; timestamp < day * 365 * 200; timestamp += day * 7 + 3607)
+        {
+            std::time_t millisecond = ((timestamp % 1000) + 1000) % 1000;
+            DateTime    date_time(timestamp, static_cast<unsigned int>(millisecond));
+            DateTime parsed;
+            CHECK(parsed.assign(date_time.str()));
+            CHECK(parsed == date_time);
+        }
+    }
+
+    TEST_CASE("Comparisons")
+    {
+        DateTime a(1622542355, 100u);
+        DateTime b(1622542355, 200u);
+        CHECK(a < b);
+        CHECK(b > a);
+        CHECK(a <= b);
+        CHECK(a != b);
+        CHECK_FALSE(a == b);
+        CHECK(a == DateTime(1622542355, 100u));
+
+        // Comparisons with timestamps ignore the milliseconds
+        CHECK(a == std::time_t(1622542355));
+        CHECK(b == std::time_t(1622542355));
+        CHECK_FALSE(a.empty());
+        CHECK(DateTime().empty());
+    }
+}
@@ -0,0 +1,158 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Enums.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <set>
+#include <string>
+
+using namespace ocpp::types;
+
+/** @brief Enum for the tests */
+enum class Color
+{
+    Red,
+    Green,
+    Blue,
+    Light_Blue
+};
+
+/** @brief Helper for the tests, built at compile time */
+static constexpr EnumToStringFromString<Color> ColorHelper = {
+    {Color::Red, "Red"}, {Color::Green, "Green"}, {Color::Blue, "Blue"}, {Color::Light_Blue, "Light.Blue"}};
+
+static_assert(ColorHelper.toString(Color::Green)[0] == 'G', "Compile time conversion to string");
+static_assert(ColorHelper.fromString("Light.Blue") == Color::Light_Blue, "Compile time conversion from string");
+static_assert(ColorHelper.fromString("Yellow") == Color::Blue, "Unknown string gives the smallest string's value");
+
+/** @brief Check that all the values of a helper can be converted back and forth */
+template <typename EnumType>
+static void checkHelper(const char* name, const EnumToStringFromString<EnumType>& helper)
+{
+    CAPTURE(name);
+
+    std::set<std::string> strings;
+    for (size_t i = 0; i < EnumToStringFromString<EnumType>::MAX_VALUES; i++)
+    {
+        EnumType    value = static_cast<EnumType>(i);
+        std::string str   = helper.toString(value);
+        if (!str.empty())
+        {
+            CAPTURE(str);
+            CHECK(strings.insert(str).second);
+
+            EnumType converted = static_cast<EnumType>(EnumToStringFromString<EnumType>::MAX_VALUES - 1u);
+            CHECK(helper.fromString(str, converted));
+            CHECK_EQ(static_cast<size_t>(converted), i);
+            CHECK_EQ(static_cast<size_t>(helper.fromString(str.c_str())), i);
+        }
+    }
+    CHECK_FALSE(strings.empty());
+
+    // Unknown strings
+    EnumType converted = static_cast<EnumType>(0);
+    CHECK_FALSE(helper.fromString("", converted));
+    CHECK_FALSE(helper.fromString("NotAnEnumValue", converted));
+    CHECK_FALSE(helper.fromString(*strings.begin() + " ", converted));
+    CHECK_FALSE(helper.fromString(strings.begin()->substr(0, strings.begin()->size() - 1u), converted));
+    CHECK_EQ(std::string(helper.toString(helper.fromString("NotAnEnumValue"))), *strings.begin());
+}
+
+TEST_SUITE("EnumToStringFromString class test suite")
+{
+    TEST_CASE("Conversions")
+    {
+        CHECK_EQ(std::string(ColorHelper.toString(Color::Red)), "Red");
+        CHECK_EQ(std::string(ColorHelper.toString(Color::Light_Blue)), "Light.Blue");
+        CHECK_EQ(std::string(ColorHelper.toString(static_cast<Color>(10))), "");
+        CHECK_EQ(std::string(ColorHelper.toString(static_cast<Color>(1000))), "");
+
+        Color color = Color::Red;
+        CHECK(ColorHelper.fromString(std::string("Green"), color));
+        CHECK_EQ(color, Color::Green);
+        CHECK_FALSE(ColorHelper.fromString("green", color));
+        CHECK_EQ(color, Color::Green);
+        CHECK_EQ(ColorHelper.fromString(std::string_view("Blue!", 4u)), Color::Blue);
+
+        checkHelper("ColorHelper", ColorHelper);
+    }
+
+    TEST_CASE("CSL")
+    {
+        std::vector<Color> colors = EnumsFromCsl("Red, Blue ,Yellow,Light.Blue", ColorHelper);
+        REQUIRE_EQ(colors.size(), 3u);
+        CHECK_EQ(colors[0], Color::Red);
+        CHECK_EQ(colors[1], Color::Blue);
+        CHECK_EQ(colors[2], Color::Light_Blue);
+    }
+
+    TEST_CASE("OCPP enums")
+    {
+        checkHelper("RegistrationStatusHelper", RegistrationStatusHelper);
+        checkHelper("ChargePointStatusHelper", ChargePointStatusHelper);
+        checkHelper("ChargePointErrorCodeHelper", ChargePointErrorCodeHelper);
+        checkHelper("MessageTriggerHelper", MessageTriggerHelper);
+        checkHelper("TriggerMessageStatusHelper", TriggerMessageStatusHelper);
+        checkHelper("AuthorizationStatusHelper", AuthorizationStatusHelper);
+        checkHelper("ClearCacheStatusHelper", ClearCacheStatusHelper);
+        checkHelper("ConfigurationStatusHelper", ConfigurationStatusHelper);
+        checkHelper("AvailabilityTypeHelper", AvailabilityTypeHelper);
+        checkHelper("AvailabilityStatusHelper", AvailabilityStatusHelper);
+        checkHelper("ReservationStatusHelper", ReservationStatusHelper);
+        checkHelper("CancelReservationStatusHelper", CancelReservationStatusHelper);
+        checkHelper("DataTransferStatusHelper", DataTransferStatusHelper);
+        checkHelper("ReadingContextHelper", ReadingContextHelper);
+        checkHelper("ValueFormatHelper", ValueFormatHelper);
+        checkHelper("MeasurandHelper", MeasurandHelper);
+        checkHelper("PhaseHelper", PhaseHelper);
+        checkHelper("LocationHelper", LocationHelper);
+        checkHelper("UnitOfMeasureHelper", UnitOfMeasureHelper);
+        checkHelper("ChargingProfilePurposeTypeHelper", ChargingProfilePurposeTypeHelper);
+        checkHelper("ClearChargingProfileStatusHelper", ClearChargingProfileStatusHelper);
+        checkHelper("ChargingProfileStatusHelper", ChargingProfileStatusHelper);
+        checkHelper("ChargingProfileKindTypeHelper", ChargingProfileKindTypeHelper);
+        checkHelper("RecurrencyKindTypeHelper", RecurrencyKindTypeHelper);
+        checkHelper("ChargingRateUnitTypeHelper", ChargingRateUnitTypeHelper);
+        checkHelper("ReasonHelper", ReasonHelper);
+        checkHelper("RemoteStartStopStatusHelper", RemoteStartStopStatusHelper);
+        checkHelper("DiagnosticsStatusHelper", DiagnosticsStatusHelper);
+        checkHelper("ResetTypeHelper", ResetTypeHelper);
+        checkHelper("ResetStatusHelper", ResetStatusHelper);
+        checkHelper("UnlockStatusHelper", UnlockStatusHelper);
+        checkHelper("FirmwareStatusHelper", FirmwareStatusHelper);
+        checkHelper("UpdateTypeHelper", UpdateTypeHelper);
+        checkHelper("UpdateStatusHelper", UpdateStatusHelper);
+        checkHelper("GetCompositeScheduleStatusHelper", GetCompositeScheduleStatusHelper);
+        checkHelper("CertificateSignedStatusEnumTypeHelper", CertificateSignedStatusEnumTypeHelper);
+        checkHelper("DeleteCertificateStatusEnumTypeHelper", DeleteCertificateStatusEnumTypeHelper);
+        checkHelper("HashAlgorithmEnumTypeHelper", HashAlgorithmEnumTypeHelper);
+        checkHelper("MessageTriggerEnumTypeHelper", MessageTriggerEnumTypeHelper);
+        checkHelper("TriggerMessageStatusEnumTypeHelper", TriggerMessageStatusEnumTypeHelper);
+        checkHelper("CertificateUseEnumTypeHelper", CertificateUseEnumTypeHelper);
+        checkHelper("GetInstalledCertificateStatusEnumTypeHelper", GetInstalledCertificateStatusEnumTypeHelper);
+        checkHelper("LogEnumTypeHelper", LogEnumTypeHelper);
+        checkHelper("LogStatusEnumTypeHelper", LogStatusEnumTypeHelper);
+        checkHelper("CertificateStatusEnumTypeHelper", CertificateStatusEnumTypeHelper);
+        checkHelper("UploadLogStatusEnumTypeHelper", UploadLogStatusEnumTypeHelper);
+        checkHelper("GenericStatusEnumTypeHelper", GenericStatusEnumTypeHelper);
+        checkHelper("FirmwareStatusEnumTypeHelper", FirmwareStatusEnumTypeHelper);
+        checkHelper("UpdateFirmwareStatusEnumTypeHelper", UpdateFirmwareStatusEnumTypeHelper);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MessageAssembler.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <cstring>
+#include <string>
+
+using namespace ocpp::websockets;
+
+/** @brief Get the last completed message as a string */
+static std::string message(const MessageAssembler& assembler)
+{
+    return std::string(reinterpret_cast<const char*>(assembler.data()), assembler.size());
+}
+
+TEST_SUITE("Nominal")
+{
+    TEST_CASE("Single chunk message is not copied")
+    {
+        MessageAssembler assembler(64u);
+
+        const char msg[] = "[2,\"1\",\"Heartbeat\",{}]";
+        CHECK_EQ(assembler.push(msg, strlen(msg), true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(assembler.data(), msg);
+        CHECK_EQ(assembler.size(), strlen(msg));
+    }
+
+    TEST_CASE("Fragmented message")
+    {
+        MessageAssembler assembler(64u);
+
+        CHECK_EQ(assembler.push("[2,\"1\",", 7u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push("\"Heartbeat\"", 11u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push(",{}]", 4u, true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(message(assembler), "[2,\"1\",\"Heartbeat\",{}]");
+
+        // Buffer is reused for the next message
+        const void* buffer = assembler.data();
+        CHECK_EQ(assembler.push("[3,", 3u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push("\"1\",{}]", 7u, true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(message(assembler), "[3,\"1\",{}]");
+        CHECK_EQ(assembler.data(), buffer);
+    }
+
+    TEST_CASE("Message of the maximum size")
+    {
+        MessageAssembler assembler(8u);
+
+        CHECK_EQ(assembler.push("0123", 4u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push("4567", 4u, true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(message(assembler), "01234567");
+    }
+}
+
+TEST_SUITE("Errors")
+{
+    TEST_CASE("Too large message")
+    {
+        MessageAssembler assembler(8u);
+
+        CHECK_EQ(assembler.push("0123", 4u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push("45678", 5u, false), MessageAssembler::Status::TOO_LARGE);
+        CHECK_EQ(assembler.push("0123456789", 10u, true), MessageAssembler::Status::TOO_LARGE);
+
+        // Next message is processed normally
+        CHECK_EQ(assembler.push("abc", 3u, false), MessageAssembler::Status::INCOMPLETE);
+        CHECK_EQ(assembler.push("def", 3u, true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(message(assembler), "abcdef");
+    }
+
+    TEST_CASE("Reset of a partial message")
+    {
+        MessageAssembler assembler(64u);
+
+        CHECK_EQ(assembler.push("garbage", 7u, false), MessageAssembler::Status::INCOMPLETE);
+        assembler.reset();
+        CHECK_EQ(assembler.push("[3,\"1\",{}]", 10u, true), MessageAssembler::Status::COMPLETE);
+        CHECK_EQ(message(assembler), "[3,\"1\",{}]");
+    }
+}